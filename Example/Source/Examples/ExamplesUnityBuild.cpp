@@ -63,4 +63,9 @@
 	#ifdef RENDERER_OPENVR
 		#include "Private/Renderer/Scene/VrController.cpp"
 	#endif
+	#include "Private/Renderer/CommandBufferReplay/CommandBufferReplay.cpp"
+	#include "Private/Renderer/CrnTextureBenchmark/CrnTextureBenchmark.cpp"
+	#include "Private/Renderer/CacheLookupBenchmark/CacheLookupBenchmark.cpp"
+	#include "Private/Renderer/CommandBufferBenchmark/CommandBufferBenchmark.cpp"
+	#include "Private/Renderer/ParticlesBenchmark/ParticlesBenchmark.cpp"
 #endif
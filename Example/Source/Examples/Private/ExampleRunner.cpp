@@ -56,6 +56,11 @@
 	#include "Examples/Private/Renderer/Mesh/Mesh.h"
 	#include "Examples/Private/Renderer/Compositor/Compositor.h"
 	#include "Examples/Private/Renderer/Scene/Scene.h"
+	#include "Examples/Private/Renderer/CommandBufferReplay/CommandBufferReplay.h"
+	#include "Examples/Private/Renderer/CrnTextureBenchmark/CrnTextureBenchmark.h"
+	#include "Examples/Private/Renderer/CacheLookupBenchmark/CacheLookupBenchmark.h"
+	#include "Examples/Private/Renderer/CommandBufferBenchmark/CommandBufferBenchmark.h"
+	#include "Examples/Private/Renderer/ParticlesBenchmark/ParticlesBenchmark.h"
 #endif
 
 // "ini.h"-library implementation in here since the tiny external library is used by multiple examples
@@ -148,6 +153,7 @@ ExampleRunner::ExampleRunner() :
 	const std::array<std::string_view, 6> onlyShaderModel4Plus = {{"Null", "Vulkan", "OpenGL", "Direct3D10", "Direct3D11", "Direct3D12"}};
 	const std::array<std::string_view, 5> onlyShaderModel5Plus = {{"Null", "Vulkan", "OpenGL", "Direct3D11", "Direct3D12"}};
 	const std::array<std::string_view, 5> meshShaderNeeded	   = {{"Null", "Vulkan", "OpenGL", "Direct3D12"}};
+	const std::array<std::string_view, 1> onlyNullRhi		   = {{"Null"}};
 
 	// Basics
 	addExample("Triangle",					&runRhiExample<Triangle>,						supportsAllRhi);
@@ -184,6 +190,11 @@ ExampleRunner::ExampleRunner() :
 		addExample("Mesh",						&runRenderExample<Mesh>,					supportsAllRhi);
 		addExample("Compositor",				&runRenderExample<Compositor>,				supportsAllRhi);
 		addExample("Scene",						&runRenderExample<Scene>,					supportsAllRhi);
+		addExample("CommandBufferReplay",		&runBasicExample<CommandBufferReplay>,		onlyNullRhi);
+		addExample("CrnTextureBenchmark",		&runRenderExample<CrnTextureBenchmark>,		supportsAllRhi);
+		addExample("CacheLookupBenchmark",		&runRenderExample<CacheLookupBenchmark>,	supportsAllRhi);
+		addExample("CommandBufferBenchmark",	&runRenderExample<CommandBufferBenchmark>,	supportsAllRhi);
+		addExample("ParticlesBenchmark",		&runRenderExample<ParticlesBenchmark>,		supportsAllRhi);
 		mDefaultExampleName = "ImGuiExampleSelector";
 	#else
 		mDefaultExampleName = "Triangle";
@@ -189,6 +189,21 @@ void IApplicationRenderer::onUpdate()
 //[-------------------------------------------------------]
 void IApplicationRenderer::deinitialization()
 {
+	#ifdef RENDERER_TOOLKIT
+	{
+		// In case new pipeline state combinations were used, precompile the pipeline state object cache using the recorded pipeline state usage so the next run starts with a warm pipeline state object cache
+		Renderer::IRenderer* renderer = getRenderer();
+		if (nullptr != renderer && mRendererToolkitProjectStartupThread.joinable())
+		{
+			mRendererToolkitProjectStartupThread.join();
+			std::lock_guard<std::mutex> projectMutexLock(mProjectMutex);
+			if (nullptr != mProject && renderer->getRhi().getCapabilities().shaderBytecode && renderer->doesPipelineStateObjectCacheNeedSaving())
+			{
+				mProject->precompilePipelineStateObjectCache(*renderer);
+			}
+		}
+	}
+	#endif
 	delete mRendererInstance;
 	mRendererInstance = nullptr;
 	delete mRendererContext;
@@ -204,7 +219,10 @@ void IApplicationRenderer::deinitialization()
 	mFileManager = nullptr;
 	#ifdef RENDERER_TOOLKIT
 		{
-			mRendererToolkitProjectStartupThread.join();
+			if (mRendererToolkitProjectStartupThread.joinable())
+			{
+				mRendererToolkitProjectStartupThread.join();
+			}
 			std::lock_guard<std::mutex> projectMutexLock(mProjectMutex);
 			if (nullptr != mProject)
 			{
@@ -0,0 +1,207 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Renderer/CacheLookupBenchmark/CacheLookupBenchmark.h"
+
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Core/Thread/ShardedHashMap.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+#include <Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderCacheManager.h>
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_CACHE_LOOKUP_KEYS			  = 4096;		///< Number of cache IDs which are present before the lookups start, roughly the number of shader combinations of a complex scene
+		static constexpr uint32_t NUMBER_OF_CACHE_LOOKUPS_PER_THREAD	  = 1000000;	///< Number of operations each thread performs
+		static constexpr uint32_t CACHE_LOOKUP_INSERT_INTERVAL			  = 1000;		///< Every n-th operation inserts a new cache ID, like a shader combination showing up for the first time
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_CACHE_LOOKUP_THREADS = 16;
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Baseline: Hash map guarded by a single mutex, like the shader cache manager used to be
+		*/
+		class CacheLookupMutexHashMap final
+		{
+		public:
+			[[nodiscard]] bool tryGet(uint32_t key, uintptr_t& value) const
+			{
+				std::lock_guard<std::mutex> mutexLock(mMutex);
+				const std::unordered_map<uint32_t, uintptr_t>::const_iterator iterator = mMap.find(key);
+				if (mMap.cend() != iterator)
+				{
+					value = iterator->second;
+					return true;
+				}
+				return false;
+			}
+
+			bool insert(uint32_t key, uintptr_t value)
+			{
+				std::lock_guard<std::mutex> mutexLock(mMutex);
+				return mMap.emplace(key, value).second;
+			}
+
+		private:
+			std::unordered_map<uint32_t, uintptr_t> mMap;
+			mutable std::mutex						mMutex;
+		};
+
+		typedef Renderer::ShardedHashMap<uint32_t, uintptr_t> CacheLookupShardedHashMap;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline uint32_t getCacheLookupKey(uint32_t index)
+		{
+			// Cache IDs are hashes, so scatter the index
+			return index * 2654435761u + 1;
+		}
+
+		/**
+		*  @brief
+		*    Run the lookup benchmark on the given map and return the number of lookups per second
+		*/
+		template <typename MAP>
+		[[nodiscard]] double runCacheLookupBenchmark(MAP& map, uint32_t numberOfThreads)
+		{
+			// Fill the map
+			for (uint32_t i = 0; i < NUMBER_OF_CACHE_LOOKUP_KEYS; ++i)
+			{
+				map.insert(getCacheLookupKey(i), i);
+			}
+
+			// Look up from multiple threads at once, each thread inserts its own new keys so insertions never collide
+			std::atomic<uint32_t> numberOfFoundValues(0);
+			std::vector<std::thread> threads;
+			threads.reserve(numberOfThreads);
+			Renderer::Stopwatch stopwatch(true);
+			for (uint32_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+			{
+				threads.emplace_back([&map, &numberOfFoundValues, threadIndex]()
+				{
+					uint32_t localNumberOfFoundValues = 0;
+					uint32_t nextInsertIndex = NUMBER_OF_CACHE_LOOKUP_KEYS + threadIndex;
+					for (uint32_t i = 0; i < NUMBER_OF_CACHE_LOOKUPS_PER_THREAD; ++i)
+					{
+						if (0 == (i % CACHE_LOOKUP_INSERT_INTERVAL))
+						{
+							map.insert(getCacheLookupKey(nextInsertIndex), nextInsertIndex);
+							nextInsertIndex += MAXIMUM_NUMBER_OF_CACHE_LOOKUP_THREADS;
+						}
+						else
+						{
+							uintptr_t value = 0;
+							if (map.tryGet(getCacheLookupKey((i * 7919 + threadIndex) % NUMBER_OF_CACHE_LOOKUP_KEYS), value))
+							{
+								++localNumberOfFoundValues;
+							}
+						}
+					}
+					numberOfFoundValues += localNumberOfFoundValues;
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			stopwatch.stop();
+
+			// Done
+			const double seconds = std::max(static_cast<double>(stopwatch.getSeconds()), 0.000001);
+			return static_cast<double>(numberOfFoundValues) / seconds;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+void CacheLookupBenchmark::onInitialization()
+{
+	// Get and check the renderer instance
+	Renderer::IRenderer& renderer = getRendererSafe();
+
+	// Run the benchmark with a doubling number of threads up to the number of hardware threads
+	const uint32_t numberOfHardwareThreads = std::clamp(std::thread::hardware_concurrency(), 1u, ::detail::MAXIMUM_NUMBER_OF_CACHE_LOOKUP_THREADS);
+	RHI_LOG(renderer.getContext(), INFORMATION, "Cache lookup benchmark: %u cache IDs, %u operations per thread with one insertion per %u operations, up to %u threads", ::detail::NUMBER_OF_CACHE_LOOKUP_KEYS, ::detail::NUMBER_OF_CACHE_LOOKUPS_PER_THREAD, ::detail::CACHE_LOOKUP_INSERT_INTERVAL, numberOfHardwareThreads)
+	for (uint32_t numberOfThreads = 1; numberOfThreads <= numberOfHardwareThreads; numberOfThreads *= 2)
+	{
+		::detail::CacheLookupMutexHashMap mutexHashMap;
+		const double mutexLookupsPerSecond = ::detail::runCacheLookupBenchmark(mutexHashMap, numberOfThreads);
+		::detail::CacheLookupShardedHashMap shardedHashMap;
+		const double shardedLookupsPerSecond = ::detail::runCacheLookupBenchmark(shardedHashMap, numberOfThreads);
+
+		// Write the result into the log
+		const Renderer::ShardedHashMapStatistics statistics = shardedHashMap.getStatistics();
+		RHI_LOG(renderer.getContext(), INFORMATION, "Cache lookup benchmark: %u threads, single mutex %.2f M lookups/s, sharded %.2f M lookups/s, %.3f %% contended read locks, %.3f %% contended write locks", numberOfThreads,
+			mutexLookupsPerSecond / 1000000.0, shardedLookupsPerSecond / 1000000.0,
+			(0 != statistics.numberOfReadLocks) ? static_cast<double>(statistics.numberOfContendedReadLocks) * 100.0 / static_cast<double>(statistics.numberOfReadLocks) : 0.0,
+			(0 != statistics.numberOfWriteLocks) ? static_cast<double>(statistics.numberOfContendedWriteLocks) * 100.0 / static_cast<double>(statistics.numberOfWriteLocks) : 0.0)
+	}
+
+	{ // Write the lock statistics of the real shader cache manager into the log, they cover everything since the renderer was started
+		const Renderer::ShardedHashMapStatistics statistics = renderer.getShaderBlueprintResourceManager().getShaderCacheManager().getShaderCacheLookupStatistics();
+		RHI_LOG(renderer.getContext(), INFORMATION, "Cache lookup benchmark: Shader cache manager so far did %llu lookups (%llu contended) and %llu insertions (%llu contended)",
+			static_cast<unsigned long long>(statistics.numberOfReadLocks), static_cast<unsigned long long>(statistics.numberOfContendedReadLocks),
+			static_cast<unsigned long long>(statistics.numberOfWriteLocks), static_cast<unsigned long long>(statistics.numberOfContendedWriteLocks))
+	}
+
+	// Done, go back to the example selector
+	#ifdef RENDERER_IMGUI
+		switchExample("ImGuiExampleSelector");
+	#else
+		exit();
+	#endif
+}
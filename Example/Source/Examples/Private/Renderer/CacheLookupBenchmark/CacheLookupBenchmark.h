@@ -0,0 +1,95 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Framework/PlatformTypes.h"
+#include "Examples/Private/Framework/ExampleBase.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Multi-threaded cache lookup benchmark example
+*
+*  @remarks
+*    Looks up a fixed set of cache IDs from a growing number of threads while every now and then a new ID gets inserted,
+*    which is the access pattern of the shader cache manager and the graphics program cache manager during permutation
+*    storms. Compares a hash map guarded by a single mutex with "Renderer::ShardedHashMap", writes the lookups per second
+*    and the lock contention into the log and switches back to the example selector when done.
+*
+*    Demonstrates:
+*    - "Renderer::ShardedHashMap" usage
+*    - Measure the multi-threaded lookup throughput and lock contention of the renderer caches
+*/
+class CacheLookupBenchmark final : public ExampleBase
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline CacheLookupBenchmark()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~CacheLookupBenchmark() override
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+public:
+	virtual void onInitialization() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit CacheLookupBenchmark(const CacheLookupBenchmark&) = delete;
+	CacheLookupBenchmark& operator=(const CacheLookupBenchmark&) = delete;
+
+
+};
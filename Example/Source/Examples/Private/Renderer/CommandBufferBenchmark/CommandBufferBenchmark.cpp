@@ -0,0 +1,192 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Renderer/CommandBufferBenchmark/CommandBufferBenchmark.h"
+
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+
+#include <vector>
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_BENCHMARK_DRAW_COMMANDS	   = 100000;	///< Number of draw commands recorded per frame
+		static constexpr uint32_t NUMBER_OF_BENCHMARK_FRAMES		   = 100;		///< Number of recorded frames
+		static constexpr uint32_t NUMBER_OF_OVERSIZED_COMMAND_PACKETS  = 4;			///< Number of command packets which are too large for a command buffer page
+		static constexpr uint32_t OVERSIZED_COMMAND_PACKET_INTERVAL	   = 10000;		///< Every n-th draw command an oversized command packet is recorded
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Record the benchmark draw commands and return the recording time in milliseconds
+		*/
+		[[nodiscard]] float recordBenchmarkDrawCommands(Rhi::CommandBuffer& commandBuffer)
+		{
+			Renderer::Stopwatch stopwatch(true);
+			for (uint32_t i = 0; i < NUMBER_OF_BENCHMARK_DRAW_COMMANDS; ++i)
+			{
+				Rhi::Command::DrawIndexedGraphics::create(commandBuffer, 36 + (i & 63), 1, i * 3, 0, i);
+			}
+			stopwatch.stop();
+			return stopwatch.getMilliseconds();
+		}
+
+		/**
+		*  @brief
+		*    Record draw commands, optionally mixed with oversized command packets, and return the number of recorded command packets
+		*/
+		[[nodiscard]] uint32_t recordOversizedCommandPackets(Rhi::CommandBuffer& commandBuffer, Rhi::IUniformBuffer& uniformBuffer, const std::vector<uint8_t>& oversizedData, bool oversized)
+		{
+			uint32_t numberOfOversizedCommandPackets = 0;
+			for (uint32_t i = 0; i < NUMBER_OF_BENCHMARK_DRAW_COMMANDS; ++i)
+			{
+				if (oversized && 0 == (i % OVERSIZED_COMMAND_PACKET_INTERVAL) && numberOfOversizedCommandPackets < NUMBER_OF_OVERSIZED_COMMAND_PACKETS)
+				{
+					Rhi::Command::CopyUniformBufferData::create(commandBuffer, uniformBuffer, oversizedData.data(), static_cast<uint32_t>(oversizedData.size()));
+					++numberOfOversizedCommandPackets;
+				}
+				Rhi::Command::DrawGraphics::create(commandBuffer, 3, 1, i, 0);
+			}
+			return NUMBER_OF_BENCHMARK_DRAW_COMMANDS + numberOfOversizedCommandPackets;
+		}
+
+		/**
+		*  @brief
+		*    Walk the command packet links of the given command buffer and return the number of command packets
+		*/
+		[[nodiscard]] uint32_t countCommandPackets(const Rhi::CommandBuffer& commandBuffer)
+		{
+			uint32_t numberOfCommandPackets = 0;
+			for (Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket(); nullptr != constCommandPacket; constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket))
+			{
+				++numberOfCommandPackets;
+			}
+			return numberOfCommandPackets;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+void CommandBufferBenchmark::onInitialization()
+{
+	// Get and check the renderer instance
+	Renderer::IRenderer& renderer = getRendererSafe();
+	const Renderer::Context& context = renderer.getContext();
+	Rhi::CommandBufferPagePool& commandBufferPagePool = Rhi::CommandBufferPagePool::getInstance();
+	RHI_LOG(context, INFORMATION, "Command buffer benchmark: Recording %u draw commands %u times, %u free command buffer pages", ::detail::NUMBER_OF_BENCHMARK_DRAW_COMMANDS, ::detail::NUMBER_OF_BENCHMARK_FRAMES, commandBufferPagePool.getNumberOfFreePages())
+
+	// Fresh command buffer without any pages: The first recording of a frame
+	uint32_t highWaterMarkNumberOfBytes = 0;
+	{
+		Rhi::CommandBuffer commandBuffer;
+		const float milliseconds = ::detail::recordBenchmarkDrawCommands(commandBuffer);
+		highWaterMarkNumberOfBytes = commandBuffer.getNumberOfPages() * Rhi::CommandBufferPagePool::PAGE_NUMBER_OF_BYTES;
+		RHI_LOG(context, INFORMATION, "Command buffer benchmark: Fresh command buffer took %.3f ms, %u pages", static_cast<double>(milliseconds), commandBuffer.getNumberOfPages())
+	}
+
+	// Fresh command buffer pre-sized to the high-water mark of the previous recording, the pages of the previous recording are inside the page pool now
+	{
+		Rhi::CommandBuffer commandBuffer;
+		Renderer::Stopwatch stopwatch(true);
+		commandBuffer.reserve(highWaterMarkNumberOfBytes);
+		stopwatch.stop();
+		const float milliseconds = ::detail::recordBenchmarkDrawCommands(commandBuffer);
+		RHI_LOG(context, INFORMATION, "Command buffer benchmark: Reserved command buffer took %.3f ms (reserve %.3f ms), %u pages", static_cast<double>(milliseconds), static_cast<double>(stopwatch.getMilliseconds()), commandBuffer.getNumberOfPages())
+	}
+
+	{ // Cleared command buffer keeping its pages across frames: The steady state
+		Rhi::CommandBuffer commandBuffer;
+		float totalMilliseconds = 0.0f;
+		float minimumMilliseconds = 0.0f;
+		float maximumMilliseconds = 0.0f;
+		for (uint32_t frame = 0; frame < ::detail::NUMBER_OF_BENCHMARK_FRAMES; ++frame)
+		{
+			commandBuffer.clear();
+			const float milliseconds = ::detail::recordBenchmarkDrawCommands(commandBuffer);
+			if (frame > 0)
+			{
+				// The first frame is the fresh command buffer case measured above
+				totalMilliseconds += milliseconds;
+				minimumMilliseconds = (1 == frame) ? milliseconds : std::min(minimumMilliseconds, milliseconds);
+				maximumMilliseconds = std::max(maximumMilliseconds, milliseconds);
+			}
+		}
+		RHI_LOG(context, INFORMATION, "Command buffer benchmark: Cleared command buffer took %.3f ms on average (minimum %.3f ms, maximum %.3f ms), %u pages", static_cast<double>(totalMilliseconds) / static_cast<double>(::detail::NUMBER_OF_BENCHMARK_FRAMES - 1), static_cast<double>(minimumMilliseconds), static_cast<double>(maximumMilliseconds), commandBuffer.getNumberOfPages())
+	}
+
+	{ // Oversized command packets: The command packet links must stay intact when a cleared command buffer is recorded again without oversized command packets
+		Rhi::IUniformBufferPtr uniformBufferPtr(renderer.getBufferManager().createUniformBuffer(sizeof(float) * 4, nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Command buffer benchmark")));
+		if (nullptr != uniformBufferPtr)
+		{
+			// The command buffer isn't dispatched, so the uniform buffer being too small for the data doesn't matter
+			const std::vector<uint8_t> oversizedData(Rhi::CommandBufferPagePool::PAGE_NUMBER_OF_BYTES * 2, 0);
+			Rhi::CommandBuffer commandBuffer;
+			for (uint32_t frame = 0; frame < 2; ++frame)
+			{
+				commandBuffer.clear();
+				const uint32_t expectedNumberOfCommandPackets = ::detail::recordOversizedCommandPackets(commandBuffer, *uniformBufferPtr, oversizedData, (0 == frame));
+				const uint32_t numberOfCommandPackets = ::detail::countCommandPackets(commandBuffer);
+				if (numberOfCommandPackets == expectedNumberOfCommandPackets)
+				{
+					RHI_LOG(context, INFORMATION, "Command buffer benchmark: Oversized command packets frame %u is intact, %u command packets inside %u pages", frame, numberOfCommandPackets, commandBuffer.getNumberOfPages())
+				}
+				else
+				{
+					RHI_LOG(context, CRITICAL, "Command buffer benchmark: Oversized command packets frame %u is broken, %u instead of %u command packets", frame, numberOfCommandPackets, expectedNumberOfCommandPackets)
+				}
+			}
+		}
+	}
+	RHI_LOG(context, INFORMATION, "Command buffer benchmark: %u free command buffer pages", commandBufferPagePool.getNumberOfFreePages())
+
+	// Done, go back to the example selector
+	#ifdef RENDERER_IMGUI
+		switchExample("ImGuiExampleSelector");
+	#else
+		exit();
+	#endif
+}
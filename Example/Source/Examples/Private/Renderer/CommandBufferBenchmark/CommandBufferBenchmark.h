@@ -0,0 +1,94 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Framework/PlatformTypes.h"
+#include "Examples/Private/Framework/ExampleBase.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Command buffer recording benchmark example
+*
+*  @remarks
+*    Records 100k draw commands into a command buffer: Into a fresh command buffer, into a fresh command buffer pre-sized via
+*    "Rhi::CommandBuffer::reserve()" to the high-water mark of the previous recording and into a cleared command buffer which
+*    keeps its pages across frames. Also records oversized command packets to check the command packet links stay intact across
+*    "Rhi::CommandBuffer::clear()". Writes the recording times and page statistics into the log and switches back to the example
+*    selector when done.
+*
+*    Demonstrates:
+*    - "Rhi::CommandBuffer" and "Rhi::CommandBufferPagePool" usage
+*    - Measure the command buffer recording throughput
+*/
+class CommandBufferBenchmark final : public ExampleBase
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline CommandBufferBenchmark()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~CommandBufferBenchmark() override
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+public:
+	virtual void onInitialization() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit CommandBufferBenchmark(const CommandBufferBenchmark&) = delete;
+	CommandBufferBenchmark& operator=(const CommandBufferBenchmark&) = delete;
+
+
+};
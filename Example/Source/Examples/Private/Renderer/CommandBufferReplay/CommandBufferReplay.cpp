@@ -0,0 +1,378 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Renderer/CommandBufferReplay/CommandBufferReplay.h"
+#include "Examples/Private/ExampleRunner.h"
+
+#include <Renderer/Public/Core/File/DefaultFileManager.h>
+#include <Renderer/Public/Core/Renderer/CommandBufferCapture.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+
+#include <Rhi/Public/DefaultLog.h>
+#include <Rhi/Public/DefaultAssert.h>
+#include <Rhi/Public/DefaultAllocator.h>
+#include <Rhi/Public/RhiInstance.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_ROOT_PARAMETERS	 = 16;			///< Stand-in root signature number of root parameters, each is a descriptor table with a single uniform buffer
+		static constexpr uint32_t NUMBER_OF_BUFFER_BYTES	 = 64 * 1024;	///< Stand-in buffer size, large enough for typical indirect buffer offsets
+		static constexpr uint32_t NUMBER_OF_QUERIES			 = 1024;		///< Stand-in query pool size
+		static constexpr const char* NULL_SHADER_SOURCE_CODE = "42";		///< The null RHI doesn't care about the shader source code as long as there's one
+		static constexpr Rhi::VertexAttribute VERTEX_ATTRIBUTES_LAYOUT[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Rhi::VertexAttributeFormat::FLOAT_2,	// vertexAttributeFormat (Rhi::VertexAttributeFormat)
+				"Position",								// name[32] (char)
+				"POSITION",								// semanticName[32] (char)
+				0,										// semanticIndex (uint32_t)
+				// Data source
+				0,										// inputSlot (uint32_t)
+				0,										// alignedByteOffset (uint32_t)
+				sizeof(float) * 2,						// strideInBytes (uint32_t)
+				0										// instancesPerElement (uint32_t)
+			}
+		};
+		static const Rhi::VertexAttributes VERTEX_ATTRIBUTES(static_cast<uint32_t>(sizeof(VERTEX_ATTRIBUTES_LAYOUT) / sizeof(Rhi::VertexAttribute)), VERTEX_ATTRIBUTES_LAYOUT);
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+CommandBufferReplay::CommandBufferReplay(ExampleRunner& exampleRunner, const char* rhiName, const std::string_view& exampleName) :
+	mExampleRunner(exampleRunner),
+	mRhiInstance(nullptr),
+	mExampleName(exampleName)
+{
+	// Copy the given RHI name
+	if (nullptr != rhiName)
+	{
+		strncpy(mRhiName, rhiName, 32);
+
+		// In case the source string is longer then 32 bytes (including null terminator) make sure that the string is null terminated
+		mRhiName[31] = '\0';
+	}
+	else
+	{
+		mRhiName[0] = '\0';
+	}
+}
+
+int CommandBufferReplay::run()
+{
+	// Create RHI instance
+	Rhi::DefaultLog defaultLog;
+	Rhi::DefaultAssert defaultAssert;
+	Rhi::DefaultAllocator defaultAllocator;
+	Rhi::Context rhiContext(defaultLog, defaultAssert, defaultAllocator);
+	mRhiInstance = new Rhi::RhiInstance(mRhiName, rhiContext);
+
+	// Get the RHI instance and ensure it's valid
+	mRhi = mRhiInstance->getRhi();
+	if (nullptr != mRhi && mRhi->isInitialized())
+	{
+		// Load the command buffer capture
+		Renderer::DefaultFileManager fileManager(defaultLog, defaultAssert, defaultAllocator, std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string());
+		const std::string virtualFilename = std::string(fileManager.getLocalDataMountPoint()) + '/' + Renderer::CommandBufferCapture::DEFAULT_FILENAME;
+		Renderer::CommandBufferCapture commandBufferCapture;
+		if (fileManager.doesFileExist(virtualFilename.c_str()) && commandBufferCapture.loadByVirtualFilename(fileManager, virtualFilename.c_str()))
+		{
+			// Call initialization method
+			if (onInitialization(commandBufferCapture))
+			{
+				// Let the application to its job
+				onDoJob();
+			}
+
+			// Call de-initialization method
+			onDeinitialization();
+		}
+		else
+		{
+			RHI_LOG(mRhi->getContext(), CRITICAL, "Failed to load the command buffer capture \"%s\", use the renderer debug GUI metrics window to capture a command buffer", virtualFilename.c_str())
+		}
+	}
+
+	// Destroy the RHI instance
+	mRhi = nullptr;
+	delete mRhiInstance;
+	mRhiInstance = nullptr;
+
+	// Done, no error
+	mExampleRunner.switchExample("ImGuiExampleSelector");
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+bool CommandBufferReplay::onInitialization(const Renderer::CommandBufferCapture& commandBufferCapture)
+{
+	// Create the buffer and texture manager
+	mBufferManager = mRhi->createBufferManager();
+	mTextureManager = mRhi->createTextureManager();
+
+	{ // Create the root signature used by all stand-in resources
+		Rhi::DescriptorRangeBuilder ranges[::detail::NUMBER_OF_ROOT_PARAMETERS];
+		Rhi::RootParameterBuilder rootParameters[::detail::NUMBER_OF_ROOT_PARAMETERS];
+		for (uint32_t i = 0; i < ::detail::NUMBER_OF_ROOT_PARAMETERS; ++i)
+		{
+			ranges[i].initialize(Rhi::ResourceType::UNIFORM_BUFFER, i, "UniformBlock", Rhi::ShaderVisibility::ALL);
+			rootParameters[i].initializeAsDescriptorTable(1, &ranges[i]);
+		}
+
+		// Setup
+		Rhi::RootSignatureBuilder rootSignatureBuilder;
+		rootSignatureBuilder.initialize(::detail::NUMBER_OF_ROOT_PARAMETERS, rootParameters, 0, nullptr, Rhi::RootSignatureFlags::ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+
+		// Create the instance
+		mRootSignature = mRhi->createRootSignature(rootSignatureBuilder);
+	}
+
+	// Create the render pass and the uniform buffer used by the stand-in resources
+	const Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::Enum::R8G8B8A8;
+	mRenderPass = mRhi->createRenderPass(1, &textureFormat);
+	mUniformBuffer = mBufferManager->createUniformBuffer(::detail::NUMBER_OF_BUFFER_BYTES);
+
+	{ // Create the shaders used by the stand-in resources
+		// -> The stand-in resources are only there to feed the RHI command dispatch, so we don't need any meaningful shader
+		const char* shaderSourceCode = nullptr;
+		#ifdef RHI_NULL
+			if (mRhi->getNameId() == Rhi::NameId::NULL_DUMMY)
+			{
+				shaderSourceCode = ::detail::NULL_SHADER_SOURCE_CODE;
+			}
+		#endif
+		if (nullptr == shaderSourceCode)
+		{
+			// Error! (unsupported RHI)
+			RHI_LOG(mRhi->getContext(), CRITICAL, "Error: Unsupported RHI, command buffer replay stand-in resources are only available for the null RHI")
+			return false;
+		}
+		Rhi::IShaderLanguage& shaderLanguage = mRhi->getDefaultShaderLanguage();
+		mGraphicsProgram = shaderLanguage.createGraphicsProgram(*mRootSignature, ::detail::VERTEX_ATTRIBUTES, shaderLanguage.createVertexShaderFromSourceCode(::detail::VERTEX_ATTRIBUTES, shaderSourceCode), shaderLanguage.createFragmentShaderFromSourceCode(shaderSourceCode));
+		mComputeShader = shaderLanguage.createComputeShaderFromSourceCode(shaderSourceCode);
+	}
+
+	// Create one stand-in resource per captured resource ID
+	const Renderer::CommandBufferCapture::ResourceTypes& resourceTypes = commandBufferCapture.getResourceTypes();
+	mResources.reserve(resourceTypes.size());
+	for (Rhi::ResourceType resourceType : resourceTypes)
+	{
+		Rhi::IResource* resource = createStandInResource(resourceType);
+		if (nullptr == resource)
+		{
+			// Error!
+			RHI_LOG(mRhi->getContext(), CRITICAL, "Failed to create a command buffer replay stand-in resource of type %u", static_cast<uint32_t>(resourceType))
+			return false;
+		}
+		resource->addReference();
+		mResources.push_back(resource);
+	}
+
+	// Since we're always dispatching the same commands to the RHI, we can fill the command buffer once during initialization and then reuse it multiple times during runtime
+	if (!commandBufferCapture.fillCommandBuffer(mCommandBuffer, mResources.data()))
+	{
+		// Error!
+		RHI_LOG(mRhi->getContext(), CRITICAL, "The command buffer capture contains invalid commands")
+		return false;
+	}
+	RHI_LOG(mRhi->getContext(), INFORMATION, "Command buffer replay: %u commands using %u stand-in resources", commandBufferCapture.getNumberOfCommands(), static_cast<uint32_t>(mResources.size()))
+
+	// Done
+	return true;
+}
+
+void CommandBufferReplay::onDeinitialization()
+{
+	// Release the used resources
+	mCommandBuffer.clear();
+	for (Rhi::IResource* resource : mResources)
+	{
+		resource->releaseReference();
+	}
+	mResources.clear();
+	mComputeShader = nullptr;
+	mGraphicsProgram = nullptr;
+	mUniformBuffer = nullptr;
+	mRenderPass = nullptr;
+	mRootSignature = nullptr;
+	mBufferManager = nullptr;
+	mTextureManager = nullptr;
+}
+
+Rhi::IResource* CommandBufferReplay::createStandInResource(Rhi::ResourceType resourceType)
+{
+	switch (resourceType)
+	{
+		case Rhi::ResourceType::ROOT_SIGNATURE:
+		{
+			// Each resource ID gets an own instance so the RHI implementation redundant state change handling stays intact
+			Rhi::DescriptorRangeBuilder ranges[::detail::NUMBER_OF_ROOT_PARAMETERS];
+			Rhi::RootParameterBuilder rootParameters[::detail::NUMBER_OF_ROOT_PARAMETERS];
+			for (uint32_t i = 0; i < ::detail::NUMBER_OF_ROOT_PARAMETERS; ++i)
+			{
+				ranges[i].initialize(Rhi::ResourceType::UNIFORM_BUFFER, i, "UniformBlock", Rhi::ShaderVisibility::ALL);
+				rootParameters[i].initializeAsDescriptorTable(1, &ranges[i]);
+			}
+			Rhi::RootSignatureBuilder rootSignatureBuilder;
+			rootSignatureBuilder.initialize(::detail::NUMBER_OF_ROOT_PARAMETERS, rootParameters, 0, nullptr, Rhi::RootSignatureFlags::ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+			return mRhi->createRootSignature(rootSignatureBuilder);
+		}
+
+		case Rhi::ResourceType::RESOURCE_GROUP:
+		{
+			Rhi::IResource* resource = mUniformBuffer;
+			return mRootSignature->createResourceGroup(0, 1, &resource);
+		}
+
+		case Rhi::ResourceType::GRAPHICS_PROGRAM:
+		{
+			Rhi::IShaderLanguage& shaderLanguage = mRhi->getDefaultShaderLanguage();
+			return shaderLanguage.createGraphicsProgram(*mRootSignature, ::detail::VERTEX_ATTRIBUTES, shaderLanguage.createVertexShaderFromSourceCode(::detail::VERTEX_ATTRIBUTES, ::detail::NULL_SHADER_SOURCE_CODE), shaderLanguage.createFragmentShaderFromSourceCode(::detail::NULL_SHADER_SOURCE_CODE));
+		}
+
+		case Rhi::ResourceType::VERTEX_ARRAY:
+		{
+			const Rhi::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { { mBufferManager->createVertexBuffer(::detail::NUMBER_OF_BUFFER_BYTES) } };
+			return mBufferManager->createVertexArray(::detail::VERTEX_ATTRIBUTES, static_cast<uint32_t>(sizeof(vertexArrayVertexBuffers) / sizeof(Rhi::VertexArrayVertexBuffer)), vertexArrayVertexBuffers, mBufferManager->createIndexBuffer(::detail::NUMBER_OF_BUFFER_BYTES));
+		}
+
+		case Rhi::ResourceType::RENDER_PASS:
+		{
+			const Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::Enum::R8G8B8A8;
+			return mRhi->createRenderPass(1, &textureFormat);
+		}
+
+		case Rhi::ResourceType::QUERY_POOL:
+			return mRhi->createQueryPool(Rhi::QueryType::TIMESTAMP, ::detail::NUMBER_OF_QUERIES);
+
+		case Rhi::ResourceType::SWAP_CHAIN:
+		case Rhi::ResourceType::FRAMEBUFFER:
+		{
+			// Swap chains are replayed by using framebuffers, there's no need for an output window
+			const Rhi::FramebufferAttachment colorFramebufferAttachment(mTextureManager->createTexture2D(1, 1, Rhi::TextureFormat::Enum::R8G8B8A8, nullptr, Rhi::TextureFlag::SHADER_RESOURCE | Rhi::TextureFlag::RENDER_TARGET));
+			return mRhi->createFramebuffer(*mRenderPass, &colorFramebufferAttachment);
+		}
+
+		case Rhi::ResourceType::GRAPHICS_PIPELINE_STATE:
+		{
+			Rhi::GraphicsPipelineState graphicsPipelineState = Rhi::GraphicsPipelineStateBuilder(mRootSignature, mGraphicsProgram, ::detail::VERTEX_ATTRIBUTES, *mRenderPass);
+			graphicsPipelineState.depthStencilState.depthEnable = false;
+			return mRhi->createGraphicsPipelineState(graphicsPipelineState);
+		}
+
+		case Rhi::ResourceType::COMPUTE_PIPELINE_STATE:
+			return mRhi->createComputePipelineState(*mRootSignature, *mComputeShader);
+
+		case Rhi::ResourceType::VERTEX_BUFFER:
+			return mBufferManager->createVertexBuffer(::detail::NUMBER_OF_BUFFER_BYTES);
+
+		case Rhi::ResourceType::INDEX_BUFFER:
+			return mBufferManager->createIndexBuffer(::detail::NUMBER_OF_BUFFER_BYTES);
+
+		case Rhi::ResourceType::TEXTURE_BUFFER:
+			return mBufferManager->createTextureBuffer(::detail::NUMBER_OF_BUFFER_BYTES);
+
+		case Rhi::ResourceType::STRUCTURED_BUFFER:
+			return mBufferManager->createStructuredBuffer(::detail::NUMBER_OF_BUFFER_BYTES, nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(float) * 4);
+
+		case Rhi::ResourceType::INDIRECT_BUFFER:
+			return mBufferManager->createIndirectBuffer(::detail::NUMBER_OF_BUFFER_BYTES, nullptr, Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS);
+
+		case Rhi::ResourceType::UNIFORM_BUFFER:
+			return mBufferManager->createUniformBuffer(::detail::NUMBER_OF_BUFFER_BYTES);
+
+		case Rhi::ResourceType::TEXTURE_1D:
+			return mTextureManager->createTexture1D(1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::TEXTURE_1D_ARRAY:
+			return mTextureManager->createTexture1DArray(1, 1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::TEXTURE_2D:
+			return mTextureManager->createTexture2D(1, 1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::TEXTURE_2D_ARRAY:
+			return mTextureManager->createTexture2DArray(1, 1, 1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::TEXTURE_3D:
+			return mTextureManager->createTexture3D(1, 1, 1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::TEXTURE_CUBE:
+			return mTextureManager->createTextureCube(1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::TEXTURE_CUBE_ARRAY:
+			return mTextureManager->createTextureCubeArray(1, 1, Rhi::TextureFormat::Enum::R8G8B8A8);
+
+		case Rhi::ResourceType::SAMPLER_STATE:
+			return mRhi->createSamplerState(Rhi::ISamplerState::getDefaultSamplerState());
+
+		case Rhi::ResourceType::VERTEX_SHADER:
+		case Rhi::ResourceType::TESSELLATION_CONTROL_SHADER:
+		case Rhi::ResourceType::TESSELLATION_EVALUATION_SHADER:
+		case Rhi::ResourceType::GEOMETRY_SHADER:
+		case Rhi::ResourceType::FRAGMENT_SHADER:
+		case Rhi::ResourceType::TASK_SHADER:
+		case Rhi::ResourceType::MESH_SHADER:
+		case Rhi::ResourceType::COMPUTE_SHADER:
+		default:
+			// Shaders aren't referenced by RHI commands
+			return nullptr;
+	}
+}
+
+void CommandBufferReplay::onDoJob()
+{
+	// Dispatch the replayed command buffer once to warm up the RHI implementation, then measure the dispatch CPU time
+	mCommandBuffer.dispatchToRhi(*mRhi);
+	Renderer::Stopwatch stopwatch(true);
+	for (uint32_t i = 0; i < NUMBER_OF_ITERATIONS; ++i)
+	{
+		mCommandBuffer.dispatchToRhi(*mRhi);
+	}
+	stopwatch.stop();
+
+	// Write the result into the log
+	RHI_LOG(mRhi->getContext(), INFORMATION, "Command buffer replay: %u iterations took %.3f ms, %.3f ms per iteration", NUMBER_OF_ITERATIONS, static_cast<double>(stopwatch.getMilliseconds()), static_cast<double>(stopwatch.getMilliseconds() / NUMBER_OF_ITERATIONS))
+}
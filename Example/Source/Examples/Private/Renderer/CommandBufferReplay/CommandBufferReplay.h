@@ -0,0 +1,192 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Rhi/Public/Rhi.h>
+
+#include <string_view>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Rhi
+{
+	class RhiInstance;
+}
+namespace Renderer
+{
+	class CommandBufferCapture;
+}
+class ExampleRunner;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    An example showing how to replay a command buffer capture without having any output window (also known as headless rendering)
+*
+*  @remarks
+*    Loads the command buffer capture written by the renderer debug GUI metrics window ("LocalData/CommandBufferCapture.command_buffer_capture"),
+*    creates stand-in RHI resources for the captured resource IDs and dispatches the replayed command buffer multiple times. The RHI dispatch
+*    CPU time is written into the log. Intended to be used together with the null RHI to profile the RHI command dispatch costs in isolation.
+*
+*    Demonstrates:
+*    - Command buffer capture
+*    - Measure RHI command dispatch CPU costs without having any output window
+*/
+class CommandBufferReplay final
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Constructor
+	*
+	*  @param[in] exampleRunner
+	*    Example runner
+	*  @param[in] rhiName
+	*    Case sensitive ASCII name of the RHI to instance, if null pointer or unknown RHI no RHI will be used.
+	*    Example RHI names: "Null", "Vulkan", "OpenGL", "OpenGLES3", "Direct3D9", "Direct3D10", "Direct3D11", "Direct3D12"
+	*  @param[in] exampleName
+	*    Example name
+	*/
+	CommandBufferReplay(ExampleRunner& exampleRunner, const char* rhiName, const std::string_view& exampleName);
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline ~CommandBufferReplay()
+	{
+		// The resources are released within "onDeinitialization()"
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Run the application
+	*
+	*  @return
+	*    Program return code, 0 to indicate that no error has occurred
+	*/
+	[[nodiscard]] int run();
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	static constexpr uint32_t NUMBER_OF_ITERATIONS = 100;	///< Number of times the replayed command buffer is dispatched
+	typedef std::vector<Rhi::IResource*> Resources;			///< Resource ID is the index
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	CommandBufferReplay& operator=(const CommandBufferReplay& commandBufferReplay) = delete;
+
+	/**
+	*  @brief
+	*    Called on application initialization
+	*
+	*  @param[in] commandBufferCapture
+	*    Command buffer capture to replay
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*
+	*  @note
+	*    - When this method is called it's ensured that the RHI instance "mRhi" is valid
+	*/
+	[[nodiscard]] bool onInitialization(const Renderer::CommandBufferCapture& commandBufferCapture);
+
+	/**
+	*  @brief
+	*    Called on application de-initialization
+	*
+	*  @note
+	*    - When this method is called it's ensured that the RHI instance "mRhi" is valid
+	*/
+	void onDeinitialization();
+
+	/**
+	*  @brief
+	*    Create a stand-in RHI resource of the given type
+	*
+	*  @param[in] resourceType
+	*    Type of the RHI resource to create
+	*
+	*  @return
+	*    The created RHI resource, null pointer on error
+	*
+	*  @note
+	*    - When this method is called it's ensured that the RHI instance "mRhi" is valid
+	*/
+	[[nodiscard]] Rhi::IResource* createStandInResource(Rhi::ResourceType resourceType);
+
+	/**
+	*  @brief
+	*    Called on application should to its job
+	*
+	*  @note
+	*    - When this method is called it's ensured that the RHI instance "mRhi" is valid
+	*/
+	void onDoJob();
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	ExampleRunner&					mExampleRunner;
+	char							mRhiName[32];		///< Case sensitive ASCII name of the RHI to instance
+	Rhi::RhiInstance*				mRhiInstance;		///< RHI instance, can be a null pointer
+	Rhi::IRhiPtr					mRhi;				///< RHI instance, can be a null pointer
+	const std::string_view			mExampleName;
+	Rhi::IBufferManagerPtr			mBufferManager;		///< Buffer manager, can be a null pointer
+	Rhi::ITextureManagerPtr			mTextureManager;	///< Texture manager, can be a null pointer
+	Rhi::IRootSignaturePtr			mRootSignature;		///< Root signature used by the stand-in resources, can be a null pointer
+	Rhi::IRenderPassPtr				mRenderPass;		///< Render pass used by the stand-in resources, can be a null pointer
+	Rhi::IUniformBufferPtr			mUniformBuffer;		///< Uniform buffer used by the stand-in resource groups, can be a null pointer
+	Rhi::IGraphicsProgramPtr		mGraphicsProgram;	///< Graphics program used by the stand-in graphics pipeline states, can be a null pointer
+	Rhi::IComputeShaderPtr			mComputeShader;		///< Compute shader used by the stand-in compute pipeline states, can be a null pointer
+	Resources						mResources;			///< Stand-in RHI resources, we're owning a reference
+	Rhi::CommandBuffer				mCommandBuffer;		///< Replayed command buffer
+
+
+};
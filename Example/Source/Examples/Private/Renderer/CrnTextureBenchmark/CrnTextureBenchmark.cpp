@@ -0,0 +1,115 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Renderer/CrnTextureBenchmark/CrnTextureBenchmark.h"
+
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Asset/AssetManager.h>
+#include <Renderer/Public/Asset/AssetPackage.h>
+#include <Renderer/Public/Core/File/IFileManager.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+#include <Renderer/Public/Resource/ResourceStreamer.h>
+#include <Renderer/Public/Resource/Texture/TextureResourceManager.h>
+
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+void CrnTextureBenchmark::onInitialization()
+{
+	// Get and check the renderer instance
+	Renderer::IRenderer& renderer = getRendererSafe();
+
+	// Gather all CRN texture assets of the example asset package
+	// -> CRN array textures are intentionally ignored, the asset list file of the array would measure the same slice CRN files a second time
+	std::vector<Renderer::AssetId> assetIds;
+	int64_t numberOfFileBytes = 0;
+	const Renderer::AssetPackage* assetPackage = renderer.getAssetManager().tryGetAssetPackageById(STRING_ID("Example/Content"));
+	if (nullptr != assetPackage)
+	{
+		const Renderer::IFileManager& fileManager = renderer.getFileManager();
+		for (const Renderer::Asset& asset : assetPackage->getSortedAssetVector())
+		{
+			const char* filenameExtension = strrchr(&asset.virtualFilename[0], '.');
+			if (nullptr != filenameExtension && 0 == strcmp(filenameExtension, ".crn"))
+			{
+				assetIds.push_back(asset.assetId);
+				numberOfFileBytes += std::max(static_cast<int64_t>(0), fileManager.getFileSize(asset.virtualFilename));
+			}
+		}
+	}
+	if (assetIds.empty())
+	{
+		RHI_LOG(renderer.getContext(), CRITICAL, "CRN texture benchmark: There are no CRN texture assets to load")
+	}
+	else
+	{
+		// Load all CRN textures multiple times
+		// -> The first iteration creates the texture resources, the following iterations force a reload of the texture resources
+		Renderer::TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
+		Renderer::ResourceStreamer& resourceStreamer = renderer.getResourceStreamer();
+		const size_t numberOfTextures = assetIds.size();
+		const double numberOfMegabytes = static_cast<double>(numberOfFileBytes) / (1024.0 * 1024.0);
+		mTextureResourceIds.resize(numberOfTextures);
+		RHI_LOG(renderer.getContext(), INFORMATION, "CRN texture benchmark: Loading %u CRN textures (%.3f MB) %u times, number of top mipmaps to remove is %u", static_cast<uint32_t>(numberOfTextures), numberOfMegabytes, NUMBER_OF_ITERATIONS, textureResourceManager.getNumberOfTopMipmapsToRemove())
+		for (uint32_t iteration = 0; iteration < NUMBER_OF_ITERATIONS; ++iteration)
+		{
+			Renderer::Stopwatch stopwatch(true);
+			for (size_t i = 0; i < numberOfTextures; ++i)
+			{
+				textureResourceManager.loadTextureResourceByAssetId(assetIds[i], ASSET_ID("Unrimp/Texture/DynamicByCode/WhiteMap2D"), mTextureResourceIds[i], nullptr, false, (iteration > 0));
+			}
+			resourceStreamer.flushAllQueues();
+			stopwatch.stop();
+
+			// Write the result into the log
+			const double seconds = std::max(static_cast<double>(stopwatch.getSeconds()), 0.000001);
+			RHI_LOG(renderer.getContext(), INFORMATION, "CRN texture benchmark: Iteration %u took %.3f ms, %.3f MB/s, %.1f textures/s", iteration, static_cast<double>(stopwatch.getMilliseconds()), numberOfMegabytes / seconds, static_cast<double>(numberOfTextures) / seconds)
+		}
+	}
+
+	// Done, go back to the example selector
+	#ifdef RENDERER_IMGUI
+		switchExample("ImGuiExampleSelector");
+	#else
+		exit();
+	#endif
+}
+
+void CrnTextureBenchmark::onDeinitialization()
+{
+	// Release the used resources
+	Renderer::TextureResourceManager& textureResourceManager = getRendererSafe().getTextureResourceManager();
+	for (Renderer::TextureResourceId textureResourceId : mTextureResourceIds)
+	{
+		if (Renderer::isValid(textureResourceId))
+		{
+			textureResourceManager.destroyTextureResource(textureResourceId);
+		}
+	}
+	mTextureResourceIds.clear();
+}
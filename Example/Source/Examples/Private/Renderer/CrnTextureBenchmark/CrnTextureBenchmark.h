@@ -0,0 +1,121 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Framework/PlatformTypes.h"
+#include "Examples/Private/Framework/ExampleBase.h"
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	typedef uint32_t TextureResourceId;	///< POD texture resource identifier
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    CRN texture loading benchmark example
+*
+*  @remarks
+*    Loads all CRN texture assets of the example asset package multiple times and writes the CRN texture loading and
+*    transcoding throughput in MB/s (measured by the CRN file size) and textures per second into the log. Switches back
+*    to the example selector when done.
+*
+*    Demonstrates:
+*    - Texture resource manager usage
+*    - Measure the CRN texture loading and transcoding throughput
+*/
+class CrnTextureBenchmark final : public ExampleBase
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline CrnTextureBenchmark()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~CrnTextureBenchmark() override
+	{
+		// The resources are released within "onDeinitialization()"
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+public:
+	virtual void onInitialization() override;
+	virtual void onDeinitialization() override;
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	static constexpr uint32_t NUMBER_OF_ITERATIONS = 5;	///< Number of times all CRN textures are loaded, the first iteration includes the cold file system cache
+	typedef std::vector<Renderer::TextureResourceId> TextureResourceIds;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit CrnTextureBenchmark(const CrnTextureBenchmark&) = delete;
+	CrnTextureBenchmark& operator=(const CrnTextureBenchmark&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	TextureResourceIds mTextureResourceIds;	///< Texture resource IDs of the loaded CRN textures
+
+
+};
@@ -0,0 +1,156 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Renderer/ParticlesBenchmark/ParticlesBenchmark.h"
+
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Core/Math/Transform.h>
+#include <Renderer/Public/Core/Thread/ThreadPool.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+#include <Renderer/Public/Resource/Scene/SceneNode.h>
+#include <Renderer/Public/Resource/Scene/SceneResource.h>
+#include <Renderer/Public/Resource/Scene/SceneResourceManager.h>
+#include <Renderer/Public/Resource/Scene/Item/Particles/ParticlesSceneItem.h>
+
+#include <vector>
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_BENCHMARK_PARTICLES	= 1000000;		///< Total number of simulated particles
+		static constexpr uint32_t NUMBER_OF_SMALL_EMITTERS		= 64;			///< Number of particles scene items the particles are spread over in the many emitters case
+		static constexpr uint32_t NUMBER_OF_BENCHMARK_FRAMES	= 100;			///< Number of measured simulated frames
+		static constexpr float	  SIMULATION_TIME_STEP			= 1.0f / 60.0f;	///< Simulated time step in seconds
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Spread the benchmark particles over the given number of particles scene items and write the simulation times into the log
+		*/
+		void benchmarkParticlesSceneItems(const Renderer::IRenderer& renderer, Renderer::SceneResource& sceneResource, uint32_t numberOfParticlesSceneItems)
+		{
+			const Renderer::Context& context = renderer.getContext();
+
+			// Create the particles scene items without a material, the particles are simulated but not rendered
+			// -> The emission rate fills the particle pools within the first simulated frame, the short lifetime lets the particles die and be emitted again during the measured frames
+			const uint32_t maximumNumberOfParticles = NUMBER_OF_BENCHMARK_PARTICLES / numberOfParticlesSceneItems;
+			std::vector<Renderer::ParticlesSceneItem*> particlesSceneItems;
+			particlesSceneItems.reserve(numberOfParticlesSceneItems);
+			Renderer::SceneNode* sceneNode = sceneResource.createSceneNode(Renderer::Transform::IDENTITY);
+			for (uint32_t i = 0; i < numberOfParticlesSceneItems; ++i)
+			{
+				Renderer::ParticlesSceneItem* particlesSceneItem = sceneResource.createSceneItem<Renderer::ParticlesSceneItem>(*sceneNode);
+				particlesSceneItem->setMaximumNumberOfParticles(maximumNumberOfParticles);
+				Renderer::ParticlesSceneItem::EmitterProperties emitterProperties = particlesSceneItem->getEmitterProperties();
+				emitterProperties.emissionRate	  = static_cast<float>(maximumNumberOfParticles) / SIMULATION_TIME_STEP;
+				emitterProperties.minimumLifetime = 0.5f;
+				emitterProperties.maximumLifetime = 1.5f;
+				particlesSceneItem->setEmitterProperties(emitterProperties);
+				particlesSceneItems.push_back(particlesSceneItem);
+			}
+			if (particlesSceneItems[0]->getMaximumNumberOfParticles() != maximumNumberOfParticles)
+			{
+				RHI_LOG(context, CRITICAL, "Particles benchmark: The particles scene item needs a RHI implementation with structured buffer support")
+			}
+			else
+			{
+				// Fill the particle pools
+				Renderer::ParticlesSceneItem::updateParticlesSceneItems(renderer, particlesSceneItems.data(), numberOfParticlesSceneItems, SIMULATION_TIME_STEP);
+
+				// Measure the steady state
+				float totalMilliseconds = 0.0f;
+				float minimumMilliseconds = 0.0f;
+				float maximumMilliseconds = 0.0f;
+				for (uint32_t frame = 0; frame < NUMBER_OF_BENCHMARK_FRAMES; ++frame)
+				{
+					Renderer::Stopwatch stopwatch(true);
+					Renderer::ParticlesSceneItem::updateParticlesSceneItems(renderer, particlesSceneItems.data(), numberOfParticlesSceneItems, SIMULATION_TIME_STEP);
+					stopwatch.stop();
+					const float milliseconds = stopwatch.getMilliseconds();
+					totalMilliseconds += milliseconds;
+					minimumMilliseconds = (0 == frame) ? milliseconds : std::min(minimumMilliseconds, milliseconds);
+					maximumMilliseconds = std::max(maximumMilliseconds, milliseconds);
+				}
+				uint32_t numberOfAliveParticles = 0;
+				for (const Renderer::ParticlesSceneItem* particlesSceneItem : particlesSceneItems)
+				{
+					numberOfAliveParticles += particlesSceneItem->getNumberOfAliveParticles();
+				}
+				const double averageMilliseconds = static_cast<double>(totalMilliseconds) / static_cast<double>(NUMBER_OF_BENCHMARK_FRAMES);
+				RHI_LOG(context, INFORMATION, "Particles benchmark: %u particles scene items with %u particles each took %.3f ms on average (minimum %.3f ms, maximum %.3f ms), %u alive particles, %.1f million particles per second", numberOfParticlesSceneItems, maximumNumberOfParticles, averageMilliseconds, static_cast<double>(minimumMilliseconds), static_cast<double>(maximumMilliseconds), numberOfAliveParticles, static_cast<double>(numberOfAliveParticles) / (averageMilliseconds * 1000.0))
+			}
+
+			// Destroy the particles scene items
+			sceneResource.destroyAllSceneNodesAndItems();
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+void ParticlesBenchmark::onInitialization()
+{
+	// Get and check the renderer instance
+	Renderer::IRenderer& renderer = getRendererSafe();
+	RHI_LOG(renderer.getContext(), INFORMATION, "Particles benchmark: Simulating %u particles %u times with %u threads", ::detail::NUMBER_OF_BENCHMARK_PARTICLES, ::detail::NUMBER_OF_BENCHMARK_FRAMES, static_cast<uint32_t>(renderer.getDefaultThreadPool().getThreadCount()))
+
+	// Create an empty scene resource the particles scene items live in
+	Renderer::SceneResourceManager& sceneResourceManager = renderer.getSceneResourceManager();
+	const Renderer::SceneResourceId sceneResourceId = sceneResourceManager.createEmptySceneResourceByAssetId(ASSET_ID("Example/Scene/ParticlesBenchmark"));
+	Renderer::SceneResource& sceneResource = sceneResourceManager.getById(sceneResourceId);
+
+	// A single huge emitter and many small emitters
+	::detail::benchmarkParticlesSceneItems(renderer, sceneResource, 1);
+	::detail::benchmarkParticlesSceneItems(renderer, sceneResource, ::detail::NUMBER_OF_SMALL_EMITTERS);
+	sceneResourceManager.destroySceneResource(sceneResourceId);
+
+	// Done, go back to the example selector
+	#ifdef RENDERER_IMGUI
+		switchExample("ImGuiExampleSelector");
+	#else
+		exit();
+	#endif
+}
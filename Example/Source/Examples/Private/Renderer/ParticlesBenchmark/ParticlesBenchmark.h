@@ -0,0 +1,94 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Framework/PlatformTypes.h"
+#include "Examples/Private/Framework/ExampleBase.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    CPU particle simulation benchmark example
+*
+*  @remarks
+*    Simulates one million particles on the CPU: Once inside a single particles scene item and once spread over many small
+*    particles scene items, to see how well the default thread pool is used across emitters. The particle pools are filled in
+*    the first simulated frame and the particles die and are emitted again during the measured frames. Writes the simulation
+*    times into the log and switches back to the example selector when done. RHI implementations which can't map buffers,
+*    like the null RHI, skip the packing of the alive particles into the structured buffers.
+*
+*    Demonstrates:
+*    - "Renderer::ParticlesSceneItem" usage without a material
+*    - Measure the CPU particle simulation throughput
+*/
+class ParticlesBenchmark final : public ExampleBase
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline ParticlesBenchmark()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline virtual ~ParticlesBenchmark() override
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+public:
+	virtual void onInitialization() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit ParticlesBenchmark(const ParticlesBenchmark&) = delete;
+	ParticlesBenchmark& operator=(const ParticlesBenchmark&) = delete;
+
+
+};
@@ -174,6 +174,25 @@ namespace Renderer
 		return false;
 	}
 
+	uint32_t MemoryFile::compressLz4(const uint8_t* sourceData, uint32_t numberOfSourceBytes, ByteVector& destinationByteVector)
+	{
+		ASSERT(nullptr != sourceData, "Invalid LZ4 source data")
+		ASSERT(0 != numberOfSourceBytes, "Zero LZ4 source bytes are invalid")
+		const size_t destinationOffset = destinationByteVector.size();
+		const int destinationCapacity = LZ4_compressBound(static_cast<int>(numberOfSourceBytes));
+		destinationByteVector.resize(destinationOffset + static_cast<size_t>(destinationCapacity));
+		const int numberOfWrittenBytes = LZ4_compress_HC(reinterpret_cast<const char*>(sourceData), reinterpret_cast<char*>(destinationByteVector.data() + destinationOffset), static_cast<int>(numberOfSourceBytes), destinationCapacity, LZ4HC_CLEVEL_MAX);
+		ASSERT(numberOfWrittenBytes > 0, "LZ4 compression failed")
+		destinationByteVector.resize(destinationOffset + static_cast<size_t>(numberOfWrittenBytes));
+		return static_cast<uint32_t>(numberOfWrittenBytes);
+	}
+
+	bool MemoryFile::decompressLz4(const uint8_t* compressedData, uint32_t numberOfCompressedBytes, uint8_t* destinationData, uint32_t numberOfDecompressedBytes)
+	{
+		const int numberOfWrittenBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData), reinterpret_cast<char*>(destinationData), static_cast<int>(numberOfCompressedBytes), static_cast<int>(numberOfDecompressedBytes));
+		return (numberOfDecompressedBytes == static_cast<uint32_t>(numberOfWrittenBytes));
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
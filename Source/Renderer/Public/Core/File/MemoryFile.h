@@ -131,6 +131,24 @@ namespace Renderer
 		RENDERER_API_EXPORT void decompress();
 		[[nodiscard]] RENDERER_API_EXPORT bool writeLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename) const;
 
+		/**
+		*  @brief
+		*    Append LZ4 compressed data to the given byte vector; used by file formats consisting of multiple independently compressed chunks
+		*
+		*  @return
+		*    Number of appended compressed bytes
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT static uint32_t compressLz4(const uint8_t* sourceData, uint32_t numberOfSourceBytes, ByteVector& destinationByteVector);
+
+		/**
+		*  @brief
+		*    Decompress a single LZ4 compressed chunk into the given destination buffer; thread-safe
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT static bool decompressLz4(const uint8_t* compressedData, uint32_t numberOfCompressedBytes, uint8_t* destinationData, uint32_t numberOfDecompressedBytes);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IFile methods                ]
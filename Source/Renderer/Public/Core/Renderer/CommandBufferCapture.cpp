@@ -0,0 +1,692 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Renderer/CommandBufferCapture.h"
+#include "Renderer/Public/Core/File/MemoryFile.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+#include "Renderer/Public/Core/StringId.h"
+
+#include <cstring>		// For "memcpy()"
+#include <type_traits>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("CommandBufferCapture");
+		static constexpr uint32_t FORMAT_VERSION = 1;
+
+		typedef std::unordered_map<const Rhi::IResource*, uint32_t> ResourceIds;	///< Key = RHI resource, value = resource ID
+
+		#pragma pack(push)
+		#pragma pack(1)
+			struct CaptureHeader final
+			{
+				uint32_t numberOfResources;
+				uint32_t numberOfCommands;
+				uint32_t numberOfCommandBytes;
+				uint32_t numberOfPointerBytes;	///< Command layouts are stored as-is, so a capture is bound to the pointer size of the architecture which wrote it
+			};
+			struct CommandHeader final
+			{
+				uint8_t  commandDispatchFunctionIndex;	///< "Rhi::CommandDispatchFunctionIndex"
+				uint8_t  padding[3];
+				uint32_t numberOfAuxiliaryBytes;
+			};
+		#pragma pack(pop)
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		// Call the given function for each RHI resource pointer referenced by a command
+		// -> Commands without any RHI resource references are handled by the generic version which does nothing
+		template <typename T, typename F>
+		void forEachResource(T&, F&&)
+		{
+			// Nothing here
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetGraphicsRootSignature& command, F&& function)
+		{
+			function(command.rootSignature);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetGraphicsPipelineState& command, F&& function)
+		{
+			function(command.graphicsPipelineState);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetGraphicsResourceGroup& command, F&& function)
+		{
+			function(command.resourceGroup);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetGraphicsVertexArray& command, F&& function)
+		{
+			function(command.vertexArray);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetGraphicsRenderTarget& command, F&& function)
+		{
+			function(command.renderTarget);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::DrawGraphics& command, F&& function)
+		{
+			function(command.indirectBuffer);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::DrawIndexedGraphics& command, F&& function)
+		{
+			function(command.indirectBuffer);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::DrawMeshTasks& command, F&& function)
+		{
+			function(command.indirectBuffer);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetComputeRootSignature& command, F&& function)
+		{
+			function(command.rootSignature);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetComputePipelineState& command, F&& function)
+		{
+			function(command.computePipelineState);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetComputeResourceGroup& command, F&& function)
+		{
+			function(command.resourceGroup);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetTextureMinimumMaximumMipmapIndex& command, F&& function)
+		{
+			function(command.texture);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::ResolveMultisampleFramebuffer& command, F&& function)
+		{
+			function(command.destinationRenderTarget);
+			function(command.sourceMultisampleFramebuffer);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::CopyResource& command, F&& function)
+		{
+			function(command.destinationResource);
+			function(command.sourceResource);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::GenerateMipmaps& command, F&& function)
+		{
+			function(command.resource);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::CopyUniformBufferData& command, F&& function)
+		{
+			function(command.uniformBuffer);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::SetUniform& command, F&& function)
+		{
+			function(command.graphicsProgram);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::ResetQueryPool& command, F&& function)
+		{
+			function(command.queryPool);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::BeginQuery& command, F&& function)
+		{
+			function(command.queryPool);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::EndQuery& command, F&& function)
+		{
+			function(command.queryPool);
+		}
+
+		template <typename F>
+		void forEachResource(Rhi::Command::WriteTimestampQuery& command, F&& function)
+		{
+			function(command.queryPool);
+		}
+
+		// Return the auxiliary data of a command
+		// -> The command buffer doesn't store the number of auxiliary bytes, it's implicitly known by the command implementation
+		// -> Commands which can either reference external memory or use auxiliary memory are captured as commands using auxiliary memory
+		template <typename T>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(T& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			numberOfAuxiliaryBytes = 0;
+			return reinterpret_cast<const uint8_t*>(&command) + sizeof(T);
+		}
+
+		template <typename T>
+		[[nodiscard]] const uint8_t* getDrawAuxiliaryData(T& command, uint32_t numberOfBytesPerDraw, uint32_t& numberOfAuxiliaryBytes)
+		{
+			numberOfAuxiliaryBytes = (nullptr != command.indirectBuffer) ? 0 : numberOfBytesPerDraw * command.numberOfDraws;
+			return reinterpret_cast<const uint8_t*>(&command) + sizeof(T);
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::SetGraphicsViewports& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			numberOfAuxiliaryBytes = static_cast<uint32_t>(sizeof(Rhi::Viewport) * command.numberOfViewports);
+			const uint8_t* auxiliaryData = (nullptr != command.viewports) ? reinterpret_cast<const uint8_t*>(command.viewports) : reinterpret_cast<const uint8_t*>(&command) + sizeof(Rhi::Command::SetGraphicsViewports);
+			command.viewports = nullptr;
+			return auxiliaryData;
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::SetGraphicsScissorRectangles& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			numberOfAuxiliaryBytes = static_cast<uint32_t>(sizeof(Rhi::ScissorRectangle) * command.numberOfScissorRectangles);
+			const uint8_t* auxiliaryData = (nullptr != command.scissorRectangles) ? reinterpret_cast<const uint8_t*>(command.scissorRectangles) : reinterpret_cast<const uint8_t*>(&command) + sizeof(Rhi::Command::SetGraphicsScissorRectangles);
+			command.scissorRectangles = nullptr;
+			return auxiliaryData;
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::DrawGraphics& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			return getDrawAuxiliaryData(command, sizeof(Rhi::DrawArguments), numberOfAuxiliaryBytes);
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::DrawIndexedGraphics& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			return getDrawAuxiliaryData(command, sizeof(Rhi::DrawIndexedArguments), numberOfAuxiliaryBytes);
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::DrawMeshTasks& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			return getDrawAuxiliaryData(command, sizeof(Rhi::DrawMeshTasksArguments), numberOfAuxiliaryBytes);
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::CopyUniformBufferData& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			numberOfAuxiliaryBytes = command.numberOfBytes;
+			return reinterpret_cast<const uint8_t*>(&command) + sizeof(Rhi::Command::CopyUniformBufferData);
+		}
+
+		template <>
+		[[nodiscard]] const uint8_t* getAuxiliaryData(Rhi::Command::SetUniform& command, uint32_t& numberOfAuxiliaryBytes)
+		{
+			switch (command.type)
+			{
+				case Rhi::Command::SetUniform::Type::UNIFORM_1I:
+					numberOfAuxiliaryBytes = sizeof(int);
+					break;
+
+				case Rhi::Command::SetUniform::Type::UNIFORM_1F:
+					numberOfAuxiliaryBytes = sizeof(float);
+					break;
+
+				case Rhi::Command::SetUniform::Type::UNIFORM_2FV:
+					numberOfAuxiliaryBytes = sizeof(float) * 2;
+					break;
+
+				case Rhi::Command::SetUniform::Type::UNIFORM_3FV:
+					numberOfAuxiliaryBytes = sizeof(float) * 3;
+					break;
+
+				case Rhi::Command::SetUniform::Type::UNIFORM_4FV:
+					numberOfAuxiliaryBytes = sizeof(float) * 4;
+					break;
+
+				case Rhi::Command::SetUniform::Type::UNIFORM_MATRIX_3FV:
+					numberOfAuxiliaryBytes = sizeof(float) * 3 * 3;
+					break;
+
+				case Rhi::Command::SetUniform::Type::UNIFORM_MATRIX_4FV:
+					numberOfAuxiliaryBytes = sizeof(float) * 4 * 4;
+					break;
+			}
+			return reinterpret_cast<const uint8_t*>(&command) + sizeof(Rhi::Command::SetUniform);
+		}
+
+		template <typename T>
+		void captureCommand(const void* data, Renderer::CommandBufferCapture::ResourceTypes& resourceTypes, ResourceIds& resourceIds, std::vector<uint8_t>& commandData)
+		{
+			// Get a local copy of the command and its auxiliary data, external data is pulled into the auxiliary data
+			const T& originalCommand = *static_cast<const T*>(data);
+			alignas(T) uint8_t commandBytes[sizeof(T)];
+			memcpy(commandBytes, &originalCommand, sizeof(T));
+			T& command = *reinterpret_cast<T*>(commandBytes);
+			uint32_t numberOfAuxiliaryBytes = 0;
+			const uint8_t* auxiliaryData = getAuxiliaryData(command, numberOfAuxiliaryBytes);
+			if (auxiliaryData == commandBytes + sizeof(T))
+			{
+				// Auxiliary memory of the command packet and not of our local copy
+				auxiliaryData = reinterpret_cast<const uint8_t*>(&originalCommand) + sizeof(T);
+			}
+
+			// Map the RHI resources to resource IDs, the resource ID is stored as pointer sized value and zero is reserved for null pointers
+			forEachResource(command, [&resourceTypes, &resourceIds](auto& resource)
+			{
+				if (nullptr != resource)
+				{
+					const Rhi::IResource* rhiResource = resource;
+					ResourceIds::const_iterator iterator = resourceIds.find(rhiResource);
+					if (resourceIds.cend() == iterator)
+					{
+						iterator = resourceIds.emplace(rhiResource, static_cast<uint32_t>(resourceTypes.size())).first;
+						resourceTypes.push_back(rhiResource->getResourceType());
+					}
+					resource = reinterpret_cast<std::remove_reference_t<decltype(resource)>>(static_cast<uintptr_t>(iterator->second) + 1);
+				}
+			});
+
+			// Write command header, command and auxiliary data
+			const CommandHeader commandHeader = { static_cast<uint8_t>(T::COMMAND_DISPATCH_FUNCTION_INDEX), { 0, 0, 0 }, numberOfAuxiliaryBytes };
+			const size_t offset = commandData.size();
+			commandData.resize(offset + sizeof(CommandHeader) + sizeof(T) + numberOfAuxiliaryBytes);
+			memcpy(commandData.data() + offset, &commandHeader, sizeof(CommandHeader));
+			memcpy(commandData.data() + offset + sizeof(CommandHeader), commandBytes, sizeof(T));
+			if (numberOfAuxiliaryBytes > 0)
+			{
+				memcpy(commandData.data() + offset + sizeof(CommandHeader) + sizeof(T), auxiliaryData, numberOfAuxiliaryBytes);
+			}
+		}
+
+		void captureCommandBuffer(const Rhi::CommandBuffer& commandBuffer, Renderer::CommandBufferCapture::ResourceTypes& resourceTypes, ResourceIds& resourceIds, std::vector<uint8_t>& commandData, uint32_t& numberOfCommands)
+		{
+			Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
+			while (nullptr != constCommandPacket)
+			{
+				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				switch (Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket))
+				{
+					// Command buffer
+					case Rhi::CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER:
+						// Flatten the dispatched command buffer into the capture
+						captureCommandBuffer(*static_cast<const Rhi::Command::DispatchCommandBuffer*>(command)->commandBufferToDispatch, resourceTypes, resourceIds, commandData, numberOfCommands);
+						--numberOfCommands;
+						break;
+
+					// Graphics
+					#define CAPTURE_COMMAND(commandDispatchFunctionIndex, commandType) case Rhi::CommandDispatchFunctionIndex::commandDispatchFunctionIndex: captureCommand<Rhi::Command::commandType>(command, resourceTypes, resourceIds, commandData); break;
+					CAPTURE_COMMAND(SET_GRAPHICS_ROOT_SIGNATURE,			  SetGraphicsRootSignature)
+					CAPTURE_COMMAND(SET_GRAPHICS_PIPELINE_STATE,			  SetGraphicsPipelineState)
+					CAPTURE_COMMAND(SET_GRAPHICS_RESOURCE_GROUP,			  SetGraphicsResourceGroup)
+					CAPTURE_COMMAND(SET_GRAPHICS_VERTEX_ARRAY,				  SetGraphicsVertexArray)
+					CAPTURE_COMMAND(SET_GRAPHICS_VIEWPORTS,					  SetGraphicsViewports)
+					CAPTURE_COMMAND(SET_GRAPHICS_SCISSOR_RECTANGLES,		  SetGraphicsScissorRectangles)
+					CAPTURE_COMMAND(SET_GRAPHICS_RENDER_TARGET,				  SetGraphicsRenderTarget)
+					CAPTURE_COMMAND(CLEAR_GRAPHICS,							  ClearGraphics)
+					CAPTURE_COMMAND(DRAW_GRAPHICS,							  DrawGraphics)
+					CAPTURE_COMMAND(DRAW_INDEXED_GRAPHICS,					  DrawIndexedGraphics)
+					CAPTURE_COMMAND(DRAW_MESH_TASKS,						  DrawMeshTasks)
+
+					// Compute
+					CAPTURE_COMMAND(SET_COMPUTE_ROOT_SIGNATURE,				  SetComputeRootSignature)
+					CAPTURE_COMMAND(SET_COMPUTE_PIPELINE_STATE,				  SetComputePipelineState)
+					CAPTURE_COMMAND(SET_COMPUTE_RESOURCE_GROUP,				  SetComputeResourceGroup)
+					CAPTURE_COMMAND(DISPATCH_COMPUTE,						  DispatchCompute)
+
+					// Resource
+					CAPTURE_COMMAND(SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX, SetTextureMinimumMaximumMipmapIndex)
+					CAPTURE_COMMAND(RESOLVE_MULTISAMPLE_FRAMEBUFFER,		  ResolveMultisampleFramebuffer)
+					CAPTURE_COMMAND(COPY_RESOURCE,							  CopyResource)
+					CAPTURE_COMMAND(GENERATE_MIPMAPS,						  GenerateMipmaps)
+					CAPTURE_COMMAND(COPY_UNIFORM_BUFFER_DATA,				  CopyUniformBufferData)
+					CAPTURE_COMMAND(SET_UNIFORM,							  SetUniform)
+
+					// Query
+					CAPTURE_COMMAND(RESET_QUERY_POOL,						  ResetQueryPool)
+					CAPTURE_COMMAND(BEGIN_QUERY,							  BeginQuery)
+					CAPTURE_COMMAND(END_QUERY,								  EndQuery)
+					CAPTURE_COMMAND(WRITE_TIMESTAMP_QUERY,					  WriteTimestampQuery)
+
+					// Debug
+					CAPTURE_COMMAND(SET_DEBUG_MARKER,						  SetDebugMarker)
+					CAPTURE_COMMAND(BEGIN_DEBUG_EVENT,						  BeginDebugEvent)
+					CAPTURE_COMMAND(END_DEBUG_EVENT,						  EndDebugEvent)
+					#undef CAPTURE_COMMAND
+
+					// Done
+					case Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+						ASSERT(false, "Invalid command dispatch function index")
+						break;
+				}
+				++numberOfCommands;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
+			}
+		}
+
+		template <typename T>
+		[[nodiscard]] bool isCommandValid(const uint8_t* commandData, size_t numberOfRemainingBytes, uint32_t numberOfAuxiliaryBytes, uint32_t numberOfResources)
+		{
+			// The command and its auxiliary bytes must be inside the command data
+			if (sizeof(T) > numberOfRemainingBytes || numberOfAuxiliaryBytes > numberOfRemainingBytes - sizeof(T))
+			{
+				return false;
+			}
+
+			// The number of auxiliary bytes must match the number of auxiliary bytes the command implementation is going to read, external memory isn't allowed
+			alignas(T) uint8_t commandBytes[sizeof(T)];
+			memcpy(commandBytes, commandData, sizeof(T));
+			T& command = *reinterpret_cast<T*>(commandBytes);
+			uint32_t expectedNumberOfAuxiliaryBytes = Renderer::getInvalid<uint32_t>();
+			if (getAuxiliaryData(command, expectedNumberOfAuxiliaryBytes) != commandBytes + sizeof(T) || expectedNumberOfAuxiliaryBytes != numberOfAuxiliaryBytes)
+			{
+				return false;
+			}
+
+			// All resource IDs must be known
+			bool valid = true;
+			forEachResource(command, [numberOfResources, &valid](auto& resource)
+			{
+				if (reinterpret_cast<uintptr_t>(resource) > numberOfResources)
+				{
+					valid = false;
+				}
+			});
+			return valid;
+		}
+
+		/**
+		*  @brief
+		*    Check the serialized commands before they're turned into RHI commands
+		*
+		*  @return
+		*    "true" if each command is known, has the number of auxiliary bytes its implementation reads, only references known resource IDs and the commands exactly cover the command data, else "false"
+		*
+		*  @note
+		*    - Dispatched command buffers are flattened when capturing, so a nested command buffer dispatch inside the command data is invalid as well
+		*/
+		[[nodiscard]] bool isCommandDataValid(const std::vector<uint8_t>& commandData, uint32_t numberOfCommands, uint32_t numberOfResources)
+		{
+			size_t offset = 0;
+			for (uint32_t i = 0; i < numberOfCommands; ++i)
+			{
+				// Read the command header
+				if (sizeof(CommandHeader) > commandData.size() - offset)
+				{
+					return false;
+				}
+				CommandHeader commandHeader;
+				memcpy(&commandHeader, commandData.data() + offset, sizeof(CommandHeader));
+				offset += sizeof(CommandHeader);
+
+				// Check the command
+				size_t numberOfCommandBytes = 0;
+				bool valid = false;
+				switch (static_cast<Rhi::CommandDispatchFunctionIndex>(commandHeader.commandDispatchFunctionIndex))
+				{
+					#define VALIDATE_COMMAND(commandDispatchFunctionIndex, commandType) case Rhi::CommandDispatchFunctionIndex::commandDispatchFunctionIndex: valid = isCommandValid<Rhi::Command::commandType>(commandData.data() + offset, commandData.size() - offset, commandHeader.numberOfAuxiliaryBytes, numberOfResources); numberOfCommandBytes = sizeof(Rhi::Command::commandType); break;
+					VALIDATE_COMMAND(SET_GRAPHICS_ROOT_SIGNATURE,			   SetGraphicsRootSignature)
+					VALIDATE_COMMAND(SET_GRAPHICS_PIPELINE_STATE,			   SetGraphicsPipelineState)
+					VALIDATE_COMMAND(SET_GRAPHICS_RESOURCE_GROUP,			   SetGraphicsResourceGroup)
+					VALIDATE_COMMAND(SET_GRAPHICS_VERTEX_ARRAY,				   SetGraphicsVertexArray)
+					VALIDATE_COMMAND(SET_GRAPHICS_VIEWPORTS,				   SetGraphicsViewports)
+					VALIDATE_COMMAND(SET_GRAPHICS_SCISSOR_RECTANGLES,		   SetGraphicsScissorRectangles)
+					VALIDATE_COMMAND(SET_GRAPHICS_RENDER_TARGET,			   SetGraphicsRenderTarget)
+					VALIDATE_COMMAND(CLEAR_GRAPHICS,						   ClearGraphics)
+					VALIDATE_COMMAND(DRAW_GRAPHICS,							   DrawGraphics)
+					VALIDATE_COMMAND(DRAW_INDEXED_GRAPHICS,					   DrawIndexedGraphics)
+					VALIDATE_COMMAND(DRAW_MESH_TASKS,						   DrawMeshTasks)
+					VALIDATE_COMMAND(SET_COMPUTE_ROOT_SIGNATURE,			   SetComputeRootSignature)
+					VALIDATE_COMMAND(SET_COMPUTE_PIPELINE_STATE,			   SetComputePipelineState)
+					VALIDATE_COMMAND(SET_COMPUTE_RESOURCE_GROUP,			   SetComputeResourceGroup)
+					VALIDATE_COMMAND(DISPATCH_COMPUTE,						   DispatchCompute)
+					VALIDATE_COMMAND(SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX, SetTextureMinimumMaximumMipmapIndex)
+					VALIDATE_COMMAND(RESOLVE_MULTISAMPLE_FRAMEBUFFER,		   ResolveMultisampleFramebuffer)
+					VALIDATE_COMMAND(COPY_RESOURCE,							   CopyResource)
+					VALIDATE_COMMAND(GENERATE_MIPMAPS,						   GenerateMipmaps)
+					VALIDATE_COMMAND(COPY_UNIFORM_BUFFER_DATA,				   CopyUniformBufferData)
+					VALIDATE_COMMAND(SET_UNIFORM,							   SetUniform)
+					VALIDATE_COMMAND(RESET_QUERY_POOL,						   ResetQueryPool)
+					VALIDATE_COMMAND(BEGIN_QUERY,							   BeginQuery)
+					VALIDATE_COMMAND(END_QUERY,								   EndQuery)
+					VALIDATE_COMMAND(WRITE_TIMESTAMP_QUERY,					   WriteTimestampQuery)
+					VALIDATE_COMMAND(SET_DEBUG_MARKER,						   SetDebugMarker)
+					VALIDATE_COMMAND(BEGIN_DEBUG_EVENT,						   BeginDebugEvent)
+					VALIDATE_COMMAND(END_DEBUG_EVENT,						   EndDebugEvent)
+					#undef VALIDATE_COMMAND
+
+					// Dispatched command buffers are flattened into the command buffer capture
+					case Rhi::CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER:
+					case Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+					default:
+						return false;
+				}
+				if (!valid)
+				{
+					return false;
+				}
+				offset += numberOfCommandBytes + commandHeader.numberOfAuxiliaryBytes;
+			}
+
+			// There must be no trailing command data
+			return (offset == commandData.size());
+		}
+
+		template <typename T>
+		[[nodiscard]] const uint8_t* fillCommand(const uint8_t* commandData, uint32_t numberOfAuxiliaryBytes, Rhi::CommandBuffer& commandBuffer, Rhi::IResource* const* resources, [[maybe_unused]] uint32_t numberOfResources)
+		{
+			// Add the command and resolve the resource IDs
+			T* command = commandBuffer.addCommand<T>(numberOfAuxiliaryBytes);
+			memcpy(command, commandData, sizeof(T) + numberOfAuxiliaryBytes);
+			forEachResource(*command, [resources, numberOfResources](auto& resource)
+			{
+				const uintptr_t resourceId = reinterpret_cast<uintptr_t>(resource);
+				if (0 != resourceId)
+				{
+					ASSERT(resourceId <= numberOfResources, "Invalid command buffer capture resource ID")
+					ASSERT(nullptr != resources[resourceId - 1], "Invalid command buffer capture resource")
+					resource = static_cast<std::remove_reference_t<decltype(resource)>>(resources[resourceId - 1]);
+				}
+			});
+
+			// Return the next command header
+			return commandData + sizeof(T) + numberOfAuxiliaryBytes;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void CommandBufferCapture::capture(const Rhi::CommandBuffer& commandBuffer)
+	{
+		clear();
+		::detail::ResourceIds resourceIds;
+		::detail::captureCommandBuffer(commandBuffer, mResourceTypes, resourceIds, mCommandData, mNumberOfCommands);
+	}
+
+	bool CommandBufferCapture::loadByVirtualFilename(const IFileManager& fileManager, VirtualFilename virtualFilename)
+	{
+		clear();
+
+		// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
+		MemoryFile memoryFile;
+		if (memoryFile.loadLz4CompressedDataByVirtualFilename(::detail::FORMAT_TYPE, ::detail::FORMAT_VERSION, fileManager, virtualFilename))
+		{
+			memoryFile.decompress();
+
+			// Read in the capture header
+			::detail::CaptureHeader captureHeader;
+			if (memoryFile.getNumberOfBytes() >= sizeof(::detail::CaptureHeader))
+			{
+				memoryFile.read(&captureHeader, sizeof(::detail::CaptureHeader));
+				if (sizeof(void*) == captureHeader.numberOfPointerBytes && memoryFile.getNumberOfBytes() == sizeof(::detail::CaptureHeader) + sizeof(Rhi::ResourceType) * captureHeader.numberOfResources + captureHeader.numberOfCommandBytes)
+				{
+					// Read in the resource types and the commands
+					mResourceTypes.resize(captureHeader.numberOfResources);
+					mCommandData.resize(captureHeader.numberOfCommandBytes);
+					memoryFile.read(mResourceTypes.data(), sizeof(Rhi::ResourceType) * captureHeader.numberOfResources);
+					memoryFile.read(mCommandData.data(), captureHeader.numberOfCommandBytes);
+					mNumberOfCommands = captureHeader.numberOfCommands;
+
+					// Reject command data which would make the replay read out-of-bounds
+					if (::detail::isCommandDataValid(mCommandData, mNumberOfCommands, captureHeader.numberOfResources))
+					{
+						// Done
+						return true;
+					}
+					clear();
+				}
+			}
+		}
+
+		// Error!
+		return false;
+	}
+
+	bool CommandBufferCapture::saveByVirtualFilename(const IFileManager& fileManager, VirtualFilename virtualFilename) const
+	{
+		const ::detail::CaptureHeader captureHeader = { static_cast<uint32_t>(mResourceTypes.size()), mNumberOfCommands, static_cast<uint32_t>(mCommandData.size()), static_cast<uint32_t>(sizeof(void*)) };
+		MemoryFile memoryFile(0, sizeof(::detail::CaptureHeader) + sizeof(Rhi::ResourceType) * mResourceTypes.size() + mCommandData.size());
+		memoryFile.write(&captureHeader, sizeof(::detail::CaptureHeader));
+		memoryFile.write(mResourceTypes.data(), sizeof(Rhi::ResourceType) * mResourceTypes.size());
+		memoryFile.write(mCommandData.data(), mCommandData.size());
+		return memoryFile.writeLz4CompressedDataByVirtualFilename(::detail::FORMAT_TYPE, ::detail::FORMAT_VERSION, fileManager, virtualFilename);
+	}
+
+	bool CommandBufferCapture::fillCommandBuffer(Rhi::CommandBuffer& commandBuffer, Rhi::IResource* const* resources) const
+	{
+		// Check the whole command data first so the command buffer is never left partially filled
+		const uint32_t numberOfResources = static_cast<uint32_t>(mResourceTypes.size());
+		if (!::detail::isCommandDataValid(mCommandData, mNumberOfCommands, numberOfResources))
+		{
+			// Error!
+			return false;
+		}
+
+		// Fill the command buffer
+		const uint8_t* commandData = mCommandData.data();
+		for (uint32_t i = 0; i < mNumberOfCommands; ++i)
+		{
+			::detail::CommandHeader commandHeader;
+			memcpy(&commandHeader, commandData, sizeof(::detail::CommandHeader));
+			commandData += sizeof(::detail::CommandHeader);
+			switch (static_cast<Rhi::CommandDispatchFunctionIndex>(commandHeader.commandDispatchFunctionIndex))
+			{
+				// Graphics
+				#define FILL_COMMAND(commandDispatchFunctionIndex, commandType) case Rhi::CommandDispatchFunctionIndex::commandDispatchFunctionIndex: commandData = ::detail::fillCommand<Rhi::Command::commandType>(commandData, commandHeader.numberOfAuxiliaryBytes, commandBuffer, resources, numberOfResources); break;
+				FILL_COMMAND(SET_GRAPHICS_ROOT_SIGNATURE,			   SetGraphicsRootSignature)
+				FILL_COMMAND(SET_GRAPHICS_PIPELINE_STATE,			   SetGraphicsPipelineState)
+				FILL_COMMAND(SET_GRAPHICS_RESOURCE_GROUP,			   SetGraphicsResourceGroup)
+				FILL_COMMAND(SET_GRAPHICS_VERTEX_ARRAY,				   SetGraphicsVertexArray)
+				FILL_COMMAND(SET_GRAPHICS_VIEWPORTS,				   SetGraphicsViewports)
+				FILL_COMMAND(SET_GRAPHICS_SCISSOR_RECTANGLES,		   SetGraphicsScissorRectangles)
+				FILL_COMMAND(SET_GRAPHICS_RENDER_TARGET,			   SetGraphicsRenderTarget)
+				FILL_COMMAND(CLEAR_GRAPHICS,						   ClearGraphics)
+				FILL_COMMAND(DRAW_GRAPHICS,							   DrawGraphics)
+				FILL_COMMAND(DRAW_INDEXED_GRAPHICS,					   DrawIndexedGraphics)
+				FILL_COMMAND(DRAW_MESH_TASKS,						   DrawMeshTasks)
+
+				// Compute
+				FILL_COMMAND(SET_COMPUTE_ROOT_SIGNATURE,			   SetComputeRootSignature)
+				FILL_COMMAND(SET_COMPUTE_PIPELINE_STATE,			   SetComputePipelineState)
+				FILL_COMMAND(SET_COMPUTE_RESOURCE_GROUP,			   SetComputeResourceGroup)
+				FILL_COMMAND(DISPATCH_COMPUTE,						   DispatchCompute)
+
+				// Resource
+				FILL_COMMAND(SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX, SetTextureMinimumMaximumMipmapIndex)
+				FILL_COMMAND(RESOLVE_MULTISAMPLE_FRAMEBUFFER,		   ResolveMultisampleFramebuffer)
+				FILL_COMMAND(COPY_RESOURCE,							   CopyResource)
+				FILL_COMMAND(GENERATE_MIPMAPS,						   GenerateMipmaps)
+				FILL_COMMAND(COPY_UNIFORM_BUFFER_DATA,				   CopyUniformBufferData)
+				FILL_COMMAND(SET_UNIFORM,							   SetUniform)
+
+				// Query
+				FILL_COMMAND(RESET_QUERY_POOL,						   ResetQueryPool)
+				FILL_COMMAND(BEGIN_QUERY,							   BeginQuery)
+				FILL_COMMAND(END_QUERY,								   EndQuery)
+				FILL_COMMAND(WRITE_TIMESTAMP_QUERY,					   WriteTimestampQuery)
+
+				// Debug
+				FILL_COMMAND(SET_DEBUG_MARKER,						   SetDebugMarker)
+				FILL_COMMAND(BEGIN_DEBUG_EVENT,						   BeginDebugEvent)
+				FILL_COMMAND(END_DEBUG_EVENT,						   EndDebugEvent)
+				#undef FILL_COMMAND
+
+				// Dispatched command buffers are flattened into the command buffer capture, "::detail::isCommandDataValid()" already rejected those
+				case Rhi::CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER:
+				case Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+				default:
+					ASSERT(false, "Invalid command buffer capture command dispatch function index")
+					return false;
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
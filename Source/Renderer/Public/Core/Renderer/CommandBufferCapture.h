@@ -0,0 +1,168 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Export.h"
+
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IFileManager;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef const char* VirtualFilename;	///< UTF-8 virtual filename, the virtual filename scheme is "<mount point = project name>/<asset directory>/<asset name>.<file extension>" (example "Example/Mesh/Monster/Squirrel.mesh"), never ever a null pointer and always finished by a terminating zero
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Command buffer capture
+	*
+	*  @remarks
+	*    Serializes the commands of a RHI command buffer so a frame can be written to disk and replayed later on, e.g. against the null RHI
+	*    to measure the CPU dispatch cost of a RHI implementation in isolation. Dispatched command buffers are flattened into the capture.
+	*    RHI resource references are mapped to stable resource IDs which are assigned in the order of the first usage. For replay, the
+	*    user provides one RHI resource per resource ID, the resource type of each resource ID is part of the capture.
+	*
+	*  @note
+	*    - Captures are only portable between builds of the same architecture since the command layouts are stored as-is
+	*    - Legacy uniform handles ("Rhi::Command::SetUniform") are RHI implementation specific and hence only meaningful when replaying against the captured RHI implementation
+	*/
+	class CommandBufferCapture final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr const char* DEFAULT_FILENAME = "CommandBufferCapture.command_buffer_capture";	///< Default command buffer capture filename inside the local data mount point
+		typedef std::vector<Rhi::ResourceType> ResourceTypes;	///< Resource ID is the index
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline CommandBufferCapture() :
+			mNumberOfCommands(0)
+		{
+			// Nothing here
+		}
+
+		inline ~CommandBufferCapture()
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline const ResourceTypes& getResourceTypes() const
+		{
+			return mResourceTypes;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfCommands() const
+		{
+			return mNumberOfCommands;
+		}
+
+		inline void clear()
+		{
+			mResourceTypes.clear();
+			mCommandData.clear();
+			mNumberOfCommands = 0;
+		}
+
+		RENDERER_API_EXPORT void capture(const Rhi::CommandBuffer& commandBuffer);
+		[[nodiscard]] RENDERER_API_EXPORT bool loadByVirtualFilename(const IFileManager& fileManager, VirtualFilename virtualFilename);
+		[[nodiscard]] RENDERER_API_EXPORT bool saveByVirtualFilename(const IFileManager& fileManager, VirtualFilename virtualFilename) const;
+
+		/**
+		*  @brief
+		*    Fill a command buffer with the captured commands
+		*
+		*  @param[out] commandBuffer
+		*    RHI command buffer to fill
+		*  @param[in] resources
+		*    RHI resources to use, one resource per resource ID of type "Renderer::CommandBufferCapture::getResourceTypes()", must be valid
+		*
+		*  @return
+		*    "true" if all went fine, else "false" if the captured commands are invalid (e.g. sizes exceeding the command data or a nested command buffer dispatch), the command buffer is left untouched in this case
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT bool fillCommandBuffer(Rhi::CommandBuffer& commandBuffer, Rhi::IResource* const* resources) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit CommandBufferCapture(const CommandBufferCapture&) = delete;
+		CommandBufferCapture& operator=(const CommandBufferCapture&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		ResourceTypes		 mResourceTypes;
+		std::vector<uint8_t> mCommandData;		///< Serialized commands, each command is a command header followed by the command with resource IDs instead of resource pointers and the command auxiliary bytes
+		uint32_t			 mNumberOfCommands;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -91,6 +91,10 @@ namespace Renderer
 				renderTargetTextureElement.texture->releaseReference();
 				renderTargetTextureElement.texture = nullptr;
 			}
+
+			// Forget about the aliasing, it's only valid for the RHI textures it was set up for
+			setInvalid(renderTargetTextureElement.aliasIndex);
+			renderTargetTextureElement.aliasFlags = 0;
 		}
 	}
 
@@ -152,62 +156,47 @@ namespace Renderer
 				// Do we need to create the RHI texture instance right now?
 				if (nullptr == renderTargetTextureElement.texture)
 				{
-					// Get the texture width and height and apply resolution scale in case the main compositor workspace render target is used
-					uint32_t width = renderTargetTextureSignature.getWidth();
-					uint32_t height = renderTargetTextureSignature.getHeight();
-					if (isInvalid(width) || isInvalid(height))
+					if (isValid(renderTargetTextureElement.aliasIndex))
+					{
+						// Share the RHI texture of the aliased render target texture, create it if it doesn't exist yet
+						// -> The render target texture element vector isn't changed by this, so our reference stays valid
+						renderTargetTextureElement.texture = getTextureByAssetId(mSortedRenderTargetTextureVector[renderTargetTextureElement.aliasIndex].assetId, renderTarget, numberOfMultisamples, resolutionScale, nullptr);
+					}
+					else
 					{
-						uint32_t renderTargetWidth = 1;
-						uint32_t renderTargetHeight = 1;
-						renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
-						if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_RESOLUTION_SCALE) == 0)
+						// Get the texture width and height and apply resolution scale in case the main compositor workspace render target is used
+						uint32_t width = 1;
+						uint32_t height = 1;
+						getTextureWidthAndHeight(renderTargetTextureSignature, renderTarget, resolutionScale, width, height);
+
+						// Get texture flags, aliasing render target textures might need additional flags
+						const uint8_t flags = static_cast<uint8_t>(renderTargetTextureSignature.getFlags() | renderTargetTextureElement.aliasFlags);
+						uint32_t textureFlags = 0;
+						if ((flags & RenderTargetTextureSignature::Flag::UNORDERED_ACCESS) != 0)
 						{
-							resolutionScale = 1.0f;
+							textureFlags |= Rhi::TextureFlag::UNORDERED_ACCESS;
 						}
-						if (isInvalid(width))
+						if ((flags & RenderTargetTextureSignature::Flag::SHADER_RESOURCE) != 0)
 						{
-							width = static_cast<uint32_t>(static_cast<float>(renderTargetWidth) * resolutionScale * renderTargetTextureSignature.getWidthScale());
-							if (width < 1)
-							{
-								width = 1;
-							}
+							textureFlags |= Rhi::TextureFlag::SHADER_RESOURCE;
 						}
-						if (isInvalid(height))
+						if ((flags & RenderTargetTextureSignature::Flag::RENDER_TARGET) != 0)
 						{
-							height = static_cast<uint32_t>(static_cast<float>(renderTargetHeight) * resolutionScale * renderTargetTextureSignature.getHeightScale());
-							if (height < 1)
-							{
-								height = 1;
-							}
+							textureFlags |= Rhi::TextureFlag::RENDER_TARGET;
+						}
+						if ((flags & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0)
+						{
+							textureFlags |= Rhi::TextureFlag::GENERATE_MIPMAPS;
+							textureFlags |= Rhi::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
 						}
-					}
 
-					// Get texture flags
-					uint32_t textureFlags = 0;
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::UNORDERED_ACCESS) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::UNORDERED_ACCESS;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::SHADER_RESOURCE) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::SHADER_RESOURCE;
+						// Create the texture instance, but without providing texture data (we use the texture as render target)
+						// -> Use the "Rhi::TextureFlag::RENDER_TARGET"-flag to mark this texture as a render target
+						// -> Required for Vulkan, Direct3D 9, Direct3D 10, Direct3D 11 and Direct3D 12
+						// -> Not required for OpenGL and OpenGL ES 3
+						// -> The optimized texture clear value is a Direct3D 12 related option
+						renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, renderTargetTextureSignature.getTextureFormat(), nullptr, textureFlags, Rhi::TextureUsage::DEFAULT, (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u), nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
 					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::RENDER_TARGET;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::GENERATE_MIPMAPS;
-						textureFlags |= Rhi::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
-					}
-
-					// Create the texture instance, but without providing texture data (we use the texture as render target)
-					// -> Use the "Rhi::TextureFlag::RENDER_TARGET"-flag to mark this texture as a render target
-					// -> Required for Vulkan, Direct3D 9, Direct3D 10, Direct3D 11 and Direct3D 12
-					// -> Not required for OpenGL and OpenGL ES 3
-					// -> The optimized texture clear value is a Direct3D 12 related option
-					renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, renderTargetTextureSignature.getTextureFormat(), nullptr, textureFlags, Rhi::TextureUsage::DEFAULT, (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u), nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
 					renderTargetTextureElement.texture->addReference();
 
 					{ // Tell the texture resource manager about our render target texture so it can be referenced inside e.g. compositor nodes
@@ -282,6 +271,78 @@ namespace Renderer
 		}
 	}
 
+	const RenderTargetTextureSignature* RenderTargetTextureManager::getRenderTargetTextureSignatureByAssetId(AssetId assetId) const
+	{
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		return (mAssetIdToIndex.cend() != iterator) ? &mSortedRenderTargetTextureVector[iterator->second].renderTargetTextureSignature : nullptr;
+	}
+
+	bool RenderTargetTextureManager::setRenderTargetTextureAlias(AssetId assetId, AssetId aliasedAssetId)
+	{
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		AssetIdToIndex::const_iterator aliasedIterator = mAssetIdToIndex.find(aliasedAssetId);
+		if (mAssetIdToIndex.cend() == iterator || mAssetIdToIndex.cend() == aliasedIterator)
+		{
+			// Error!
+			ASSERT(false, "Unknown asset ID, this shouldn't have happened")
+			return false;
+		}
+
+		// Aliasing is only possible as long as none of the RHI textures has been created
+		RenderTargetTextureElement& renderTargetTextureElement = mSortedRenderTargetTextureVector[iterator->second];
+		uint32_t aliasIndex = aliasedIterator->second;
+		if (isValid(mSortedRenderTargetTextureVector[aliasIndex].aliasIndex))
+		{
+			// Always directly reference the render target texture element owning the RHI texture
+			aliasIndex = mSortedRenderTargetTextureVector[aliasIndex].aliasIndex;
+		}
+		RenderTargetTextureElement& aliasedRenderTargetTextureElement = mSortedRenderTargetTextureVector[aliasIndex];
+		if (nullptr != renderTargetTextureElement.texture || nullptr != aliasedRenderTargetTextureElement.texture || iterator->second == aliasIndex)
+		{
+			return false;
+		}
+		ASSERT(renderTargetTextureElement.renderTargetTextureSignature.getTextureFormat() == aliasedRenderTargetTextureElement.renderTargetTextureSignature.getTextureFormat(), "Render target texture aliasing requires identical texture formats")
+
+		// The owned RHI texture must support the texture usages of all aliasing render target textures
+		renderTargetTextureElement.aliasIndex = aliasIndex;
+		aliasedRenderTargetTextureElement.aliasFlags |= static_cast<uint8_t>(renderTargetTextureElement.renderTargetTextureSignature.getFlags() & (RenderTargetTextureSignature::Flag::UNORDERED_ACCESS | RenderTargetTextureSignature::Flag::SHADER_RESOURCE | RenderTargetTextureSignature::Flag::RENDER_TARGET));
+
+		// Done
+		return true;
+	}
+
+	void RenderTargetTextureManager::getTextureWidthAndHeight(const RenderTargetTextureSignature& renderTargetTextureSignature, const Rhi::IRenderTarget& renderTarget, float resolutionScale, uint32_t& width, uint32_t& height)
+	{
+		width = renderTargetTextureSignature.getWidth();
+		height = renderTargetTextureSignature.getHeight();
+		if (isInvalid(width) || isInvalid(height))
+		{
+			uint32_t renderTargetWidth = 1;
+			uint32_t renderTargetHeight = 1;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_RESOLUTION_SCALE) == 0)
+			{
+				resolutionScale = 1.0f;
+			}
+			if (isInvalid(width))
+			{
+				width = static_cast<uint32_t>(static_cast<float>(renderTargetWidth) * resolutionScale * renderTargetTextureSignature.getWidthScale());
+				if (width < 1)
+				{
+					width = 1;
+				}
+			}
+			if (isInvalid(height))
+			{
+				height = static_cast<uint32_t>(static_cast<float>(renderTargetHeight) * resolutionScale * renderTargetTextureSignature.getHeightScale());
+				if (height < 1)
+				{
+					height = 1;
+				}
+			}
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
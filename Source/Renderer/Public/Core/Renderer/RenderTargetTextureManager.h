@@ -80,11 +80,15 @@ namespace Renderer
 			RenderTargetTextureSignature renderTargetTextureSignature;
 			Rhi::ITexture*				 texture;				///< Can be a null pointer, no "Rhi::ITexturePtr" to not have overhead when internally reallocating
 			uint32_t					 numberOfReferences;	///< Number of texture references (don't misuse the RHI texture reference counter for this)
+			uint32_t					 aliasIndex;			///< Index of the render target texture element owning the shared RHI texture, "Renderer::getInvalid<uint32_t>()" if this render target texture element owns its RHI texture
+			uint8_t						 aliasFlags;			///< Render target texture signature flags (see "Renderer::RenderTargetTextureSignature::Flag") the owned RHI texture must additionally support since aliasing render target texture elements share it
 
 			inline RenderTargetTextureElement() :
 				assetId(getInvalid<AssetId>()),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasIndex(getInvalid<uint32_t>()),
+				aliasFlags(0)
 			{
 				// Nothing here
 			}
@@ -93,7 +97,9 @@ namespace Renderer
 				assetId(getInvalid<AssetId>()),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasIndex(getInvalid<uint32_t>()),
+				aliasFlags(0)
 			{
 				// Nothing here
 			}
@@ -102,7 +108,9 @@ namespace Renderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasIndex(getInvalid<uint32_t>()),
+				aliasFlags(0)
 			{
 				// Nothing here
 			}
@@ -111,7 +119,9 @@ namespace Renderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(&_texture),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasIndex(getInvalid<uint32_t>()),
+				aliasFlags(0)
 			{
 				// Nothing here
 			}
@@ -147,6 +157,53 @@ namespace Renderer
 		[[nodiscard]] Rhi::ITexture* getTextureByAssetId(AssetId assetId, const Rhi::IRenderTarget& renderTarget, uint8_t numberOfMultisamples, float resolutionScale, const RenderTargetTextureSignature** outRenderTargetTextureSignature);
 		void releaseRenderTargetTextureBySignature(const RenderTargetTextureSignature& renderTargetTextureSignature);
 
+		/**
+		*  @brief
+		*    Return the render target texture signature of a render target texture
+		*
+		*  @param[in] assetId
+		*    Asset ID of the render target texture
+		*
+		*  @return
+		*    The render target texture signature, null pointer if the asset ID is unknown, don't destroy the instance
+		*/
+		[[nodiscard]] const RenderTargetTextureSignature* getRenderTargetTextureSignatureByAssetId(AssetId assetId) const;
+
+		/**
+		*  @brief
+		*    Let a render target texture share the RHI texture of another render target texture
+		*
+		*  @param[in] assetId
+		*    Asset ID of the render target texture which should share the RHI texture
+		*  @param[in] aliasedAssetId
+		*    Asset ID of the render target texture owning the RHI texture
+		*
+		*  @return
+		*    "true" if the alias has been set, "false" if one of the RHI textures has already been created
+		*
+		*  @note
+		*    - The caller is responsible for ensuring that both render target textures resolve to the same texture format, size and number of multisamples and have non-overlapping lifetimes
+		*    - Aliases are reset by "Renderer::RenderTargetTextureManager::clearRhiResources()"
+		*/
+		bool setRenderTargetTextureAlias(AssetId assetId, AssetId aliasedAssetId);
+
+		/**
+		*  @brief
+		*    Return the texture width and height a render target texture signature resolves to
+		*
+		*  @param[in] renderTargetTextureSignature
+		*    Render target texture signature
+		*  @param[in] renderTarget
+		*    Main render target used for render target texture signatures without a fixed width or height
+		*  @param[in] resolutionScale
+		*    Resolution scale, only used if the render target texture signature allows resolution scale
+		*  @param[out] width
+		*    Receives the texture width, at least one
+		*  @param[out] height
+		*    Receives the texture height, at least one
+		*/
+		static void getTextureWidthAndHeight(const RenderTargetTextureSignature& renderTargetTextureSignature, const Rhi::IRenderTarget& renderTarget, float resolutionScale, uint32_t& width, uint32_t& height);
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
@@ -68,7 +68,8 @@ namespace Renderer
 				RENDER_TARGET          = 1u << 2u,	///< This texture can be used as framebuffer object (FBO) attachment render target
 				ALLOW_MULTISAMPLE      = 1u << 3u,	///< Allow multisample
 				GENERATE_MIPMAPS       = 1u << 4u,	///< Generate mipmaps
-				ALLOW_RESOLUTION_SCALE = 1u << 5u	///< Allow resolution scale
+				ALLOW_RESOLUTION_SCALE = 1u << 5u,	///< Allow resolution scale
+				TRANSIENT              = 1u << 6u	///< The render target texture content is only needed within a frame and only accessed by the compositor passes explicitly referencing it (framebuffer attachment, material property, copy or mipmap generation), this allows the compositor to share the RHI texture with other transient render target textures having non-overlapping lifetimes
 			};
 		};
 
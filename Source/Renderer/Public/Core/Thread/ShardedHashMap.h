@@ -0,0 +1,356 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_UInt_is_zero': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Generic_error_category': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_UInt_is_zero': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+	#include <atomic>
+	#include <shared_mutex>
+	#include <unordered_map>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Structures                                            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Lock statistics of a sharded hash map, summed up over all shards
+	*
+	*  @note
+	*    - A lock is counted as contended if it couldn't be acquired without waiting
+	*/
+	struct ShardedHashMapStatistics final
+	{
+		uint64_t numberOfReadLocks;				///< Number of shared locks, one per lookup
+		uint64_t numberOfContendedReadLocks;	///< Number of shared locks which had to wait for a writer
+		uint64_t numberOfWriteLocks;			///< Number of exclusive locks, one per insertion or erase
+		uint64_t numberOfContendedWriteLocks;	///< Number of exclusive locks which had to wait for a reader or writer
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Concurrent hash map for read-mostly data, split into shards each having its own reader-writer lock
+	*
+	*  @remarks
+	*    Lookups only take the shared lock of a single shard, so any number of threads can look up concurrently and a writer
+	*    only blocks the readers of the shard it's writing to. Meant for caches which are filled once and then looked up a lot
+	*    by multiple threads, like the shader cache and the graphics program cache during permutation storms.
+	*
+	*  @note
+	*    - Every single method is atomic, compound sequences like "look up and insert when missing" still need an external
+	*      mutex if the result of the lookup must remain valid until the insertion, see "Renderer::ShaderCacheManager"
+	*    - The map doesn't own the values, in case of pointers the user is responsible for destroying them
+	*    - Keys are expected to be hashes already (e.g. "Renderer::StringId" or FNV1a hash based IDs), the shard is selected
+	*      by Fibonacci hashing on top of it
+	*/
+	template <typename KEY, typename VALUE, uint32_t NUMBER_OF_SHARDS = 16>
+	class ShardedHashMap final
+	{
+		static_assert(NUMBER_OF_SHARDS > 0 && NUMBER_OF_SHARDS <= 65536 && 0 == (NUMBER_OF_SHARDS & (NUMBER_OF_SHARDS - 1)), "The number of shards must be a power of two");
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline ShardedHashMap()
+		{
+			// Nothing here
+		}
+
+		inline ~ShardedHashMap()
+		{
+			// Nothing here
+		}
+
+		/**
+		*  @brief
+		*    Look up a value
+		*
+		*  @param[in] key
+		*    Key of the value to look up
+		*  @param[out] value
+		*    Receives the value, not touched if there's no value for the given key
+		*
+		*  @return
+		*    "true" if there's a value for the given key, else "false"
+		*/
+		[[nodiscard]] bool tryGet(KEY key, VALUE& value) const
+		{
+			const Shard& shard = getShard(key);
+			std::shared_lock<std::shared_mutex> sharedLock = lockShared(shard);
+			const typename Map::const_iterator iterator = shard.map.find(key);
+			if (shard.map.cend() != iterator)
+			{
+				value = iterator->second;
+				return true;
+			}
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Insert a value
+		*
+		*  @param[in] key
+		*    Key of the value to insert
+		*  @param[in] value
+		*    Value to insert
+		*
+		*  @return
+		*    "true" if the value was inserted, "false" if there's already a value for the given key (the existing value is kept)
+		*/
+		bool insert(KEY key, VALUE value)
+		{
+			Shard& shard = getShard(key);
+			std::unique_lock<std::shared_mutex> uniqueLock = lockExclusive(shard);
+			return shard.map.emplace(key, value).second;
+		}
+
+		/**
+		*  @brief
+		*    Erase a value, but only if the given key is still mapped to the expected value
+		*
+		*  @param[in] key
+		*    Key of the value to erase
+		*  @param[in] expectedValue
+		*    Value the key is expected to be mapped to, used to not erase a value another thread has inserted in the meantime
+		*
+		*  @return
+		*    "true" if the value was erased, else "false"
+		*/
+		bool erase(KEY key, VALUE expectedValue)
+		{
+			Shard& shard = getShard(key);
+			std::unique_lock<std::shared_mutex> uniqueLock = lockExclusive(shard);
+			const typename Map::const_iterator iterator = shard.map.find(key);
+			if (shard.map.cend() != iterator && iterator->second == expectedValue)
+			{
+				shard.map.erase(iterator);
+				return true;
+			}
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Call the given function for each key value pair, the shard which is currently visited is locked in shared mode
+		*
+		*  @param[in] function
+		*    Function to call, signature "void(KEY key, VALUE value)", must not access this map
+		*/
+		template <typename FUNCTION>
+		void forEach(FUNCTION function) const
+		{
+			for (const Shard& shard : mShards)
+			{
+				std::shared_lock<std::shared_mutex> sharedLock = lockShared(shard);
+				for (const auto& element : shard.map)
+				{
+					function(element.first, element.second);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Reserve space for the given total number of elements, which are expected to be evenly distributed over the shards
+		*/
+		void reserve(size_t numberOfElements)
+		{
+			const size_t numberOfElementsPerShard = (numberOfElements + NUMBER_OF_SHARDS - 1) / NUMBER_OF_SHARDS;
+			for (Shard& shard : mShards)
+			{
+				std::unique_lock<std::shared_mutex> uniqueLock = lockExclusive(shard);
+				shard.map.reserve(numberOfElementsPerShard);
+			}
+		}
+
+		void clear()
+		{
+			for (Shard& shard : mShards)
+			{
+				std::unique_lock<std::shared_mutex> uniqueLock = lockExclusive(shard);
+				shard.map.clear();
+			}
+		}
+
+		[[nodiscard]] size_t size() const
+		{
+			size_t numberOfElements = 0;
+			for (const Shard& shard : mShards)
+			{
+				std::shared_lock<std::shared_mutex> sharedLock = lockShared(shard);
+				numberOfElements += shard.map.size();
+			}
+			return numberOfElements;
+		}
+
+		[[nodiscard]] inline bool empty() const
+		{
+			return (0 == size());
+		}
+
+		/**
+		*  @brief
+		*    Return the lock statistics summed up over all shards
+		*
+		*  @return
+		*    The lock statistics, the counters are updated with relaxed memory order so the result is only a snapshot
+		*/
+		[[nodiscard]] ShardedHashMapStatistics getStatistics() const
+		{
+			ShardedHashMapStatistics statistics = {};
+			for (const Shard& shard : mShards)
+			{
+				statistics.numberOfReadLocks		   += shard.numberOfReadLocks.load(std::memory_order_relaxed);
+				statistics.numberOfContendedReadLocks  += shard.numberOfContendedReadLocks.load(std::memory_order_relaxed);
+				statistics.numberOfWriteLocks		   += shard.numberOfWriteLocks.load(std::memory_order_relaxed);
+				statistics.numberOfContendedWriteLocks += shard.numberOfContendedWriteLocks.load(std::memory_order_relaxed);
+			}
+			return statistics;
+		}
+
+		void resetStatistics()
+		{
+			for (Shard& shard : mShards)
+			{
+				shard.numberOfReadLocks.store(0, std::memory_order_relaxed);
+				shard.numberOfContendedReadLocks.store(0, std::memory_order_relaxed);
+				shard.numberOfWriteLocks.store(0, std::memory_order_relaxed);
+				shard.numberOfContendedWriteLocks.store(0, std::memory_order_relaxed);
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::unordered_map<KEY, VALUE> Map;
+
+		// Each shard on its own cache line to avoid false sharing between threads working on different shards
+		PRAGMA_WARNING_PUSH
+			PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'Renderer::ShardedHashMap<...>::Shard': structure was padded due to alignment specifier
+			struct alignas(64) Shard final
+			{
+				mutable std::shared_mutex	  mutex;
+				Map							  map;
+				mutable std::atomic<uint64_t> numberOfReadLocks{0};
+				mutable std::atomic<uint64_t> numberOfContendedReadLocks{0};
+				mutable std::atomic<uint64_t> numberOfWriteLocks{0};
+				mutable std::atomic<uint64_t> numberOfContendedWriteLocks{0};
+			};
+		PRAGMA_WARNING_POP
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit ShardedHashMap(const ShardedHashMap&) = delete;
+		ShardedHashMap& operator=(const ShardedHashMap&) = delete;
+
+		[[nodiscard]] inline const Shard& getShard(KEY key) const
+		{
+			return mShards[getShardIndex(key)];
+		}
+
+		[[nodiscard]] inline Shard& getShard(KEY key)
+		{
+			return mShards[getShardIndex(key)];
+		}
+
+		[[nodiscard]] inline uint32_t getShardIndex(KEY key) const
+		{
+			// Fibonacci hashing, the upper bits of the product are the well mixed ones
+			return ((static_cast<uint32_t>(std::hash<KEY>()(key)) * 2654435769u) >> 16) & (NUMBER_OF_SHARDS - 1);
+		}
+
+		[[nodiscard]] std::shared_lock<std::shared_mutex> lockShared(const Shard& shard) const
+		{
+			if (!shard.mutex.try_lock_shared())
+			{
+				shard.numberOfContendedReadLocks.fetch_add(1, std::memory_order_relaxed);
+				shard.mutex.lock_shared();
+			}
+			shard.numberOfReadLocks.fetch_add(1, std::memory_order_relaxed);
+			return std::shared_lock<std::shared_mutex>(shard.mutex, std::adopt_lock);
+		}
+
+		[[nodiscard]] std::unique_lock<std::shared_mutex> lockExclusive(Shard& shard)
+		{
+			if (!shard.mutex.try_lock())
+			{
+				shard.numberOfContendedWriteLocks.fetch_add(1, std::memory_order_relaxed);
+				shard.mutex.lock();
+			}
+			shard.numberOfWriteLocks.fetch_add(1, std::memory_order_relaxed);
+			return std::unique_lock<std::shared_mutex>(shard.mutex, std::adopt_lock);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Shard mShards[NUMBER_OF_SHARDS];
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
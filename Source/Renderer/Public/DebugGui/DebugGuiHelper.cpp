@@ -23,12 +23,16 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/DebugGui/DebugGuiHelper.h"
 #include "Renderer/Public/Core/Math/Transform.h"
+#include "Renderer/Public/Core/File/IFileManager.h"
+#include "Renderer/Public/Core/Renderer/CommandBufferCapture.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h"
 #include "Renderer/Public/Resource/Skeleton/SkeletonResourceManager.h"
 #include "Renderer/Public/Resource/Skeleton/SkeletonResource.h"
+#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
+#include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "Renderer/Public/IRenderer.h"
 
@@ -130,6 +134,25 @@ namespace
 			return outputBackup;
 		}
 
+		void countCommandFunctions(const Rhi::CommandBuffer& commandBuffer, uint32_t* numberOfCommandFunctions)
+		{
+			Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
+			while (nullptr != constCommandPacket)
+			{
+				// Count command packet, dispatched command buffers (e.g. the ones of the compositor node instances) are counted as well
+				const Rhi::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
+				++numberOfCommandFunctions[static_cast<uint32_t>(commandDispatchFunctionIndex)];
+				if (Rhi::CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER == commandDispatchFunctionIndex)
+				{
+					countCommandFunctions(*static_cast<const Rhi::Command::DispatchCommandBuffer*>(Rhi::CommandPacketHelper::loadCommand(constCommandPacket))->commandBufferToDispatch, numberOfCommandFunctions);
+				}
+
+				{ // Next command
+					constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
+				}
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -386,43 +409,16 @@ namespace Renderer
 				ImGui::Text("Rendered renderables %s", ::detail::stringFormatCommas(static_cast<uint64_t>(numberOfRenderables), temporary));
 
 				// Command buffer metrics
-				const Rhi::CommandBuffer& commandBuffer = compositorWorkspaceInstance->getCommandBuffer();
-				#ifdef RHI_STATISTICS
-					const uint32_t numberOfCommands = commandBuffer.getNumberOfCommands();
-				#else
-					uint32_t numberOfCommands = 0;
-					{
-						const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-						Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
-						while (nullptr != constCommandPacket)
-						{
-							// Count command packet
-							++numberOfCommands;
-
-							{ // Next command
-								const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-								constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
-							}
-						}
-					}
-				#endif
+				// -> Loop through all commands and count them, including the commands inside the dispatched compositor node instance command buffers
+				uint32_t numberOfCommandFunctions[static_cast<uint8_t>(Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] = {};
+				::detail::countCommandFunctions(compositorWorkspaceInstance->getCommandBuffer(), numberOfCommandFunctions);
+				uint32_t numberOfCommands = 0;
+				for (uint32_t numberOfCommandFunction : numberOfCommandFunctions)
+				{
+					numberOfCommands += numberOfCommandFunction;
+				}
 				if (ImGui::TreeNode("EmittedCommands", "Emitted commands: %s", ::detail::stringFormatCommas(numberOfCommands, temporary)))
 				{
-					// Loop through all commands and count them
-					uint32_t numberOfCommandFunctions[static_cast<uint8_t>(Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] = {};
-					const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-					Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
-					while (nullptr != constCommandPacket)
-					{
-						// Count command packet
-						++numberOfCommandFunctions[static_cast<uint32_t>(Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket))];
-
-						{ // Next command
-							const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-							constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
-						}
-					}
-
 					// Print the number of emitted command functions
 					static constexpr const char* commandFunction[static_cast<uint32_t>(Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] =
 					{
@@ -468,6 +464,34 @@ namespace Renderer
 					}
 					ImGui::TreePop();
 				}
+				ImGui::Text("Eliminated redundant commands: %s", ::detail::stringFormatCommas(compositorWorkspaceInstance->getNumberOfEliminatedCommandPackets(), temporary));
+				{ // Frame graph
+					char bytesTemporary[128] = {};
+					ImGui::Text("Culled compositor passes: %s", ::detail::stringFormatCommas(compositorWorkspaceInstance->getNumberOfCulledCompositorInstancePasses(), temporary));
+					ImGui::Text("Aliased render target textures: %s (%s bytes saved)", ::detail::stringFormatCommas(compositorWorkspaceInstance->getNumberOfAliasedRenderTargetTextures(), temporary), ::detail::stringFormatCommas(compositorWorkspaceInstance->getNumberOfAliasedRenderTargetTextureBytes(), bytesTemporary));
+				}
+				if (ImGui::Button("Capture command buffer"))
+				{
+					// Write the command buffer into the local data directory, can be replayed by using e.g. the null RHI to profile RHI implementation dispatch costs in isolation
+					CommandBufferCapture commandBufferCapture;
+					commandBufferCapture.capture(compositorWorkspaceInstance->getCommandBuffer());
+					const IRenderer& renderer = compositorWorkspaceInstance->getRenderer();
+					IFileManager& fileManager = renderer.getFileManager();
+					const std::string virtualFilename = std::string(fileManager.getLocalDataMountPoint()) + '/' + CommandBufferCapture::DEFAULT_FILENAME;
+					if (!fileManager.createDirectories(fileManager.getLocalDataMountPoint()) || !commandBufferCapture.saveByVirtualFilename(fileManager, virtualFilename.c_str()))
+					{
+						RHI_LOG(renderer.getContext(), CRITICAL, "The renderer failed to save the command buffer capture to \"%s\"", virtualFilename.c_str())
+					}
+				}
+
+				{ // Resident resource data, the memory budget is only shown if there's one
+					const IRenderer& renderer = compositorWorkspaceInstance->getRenderer();
+					const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
+					const MeshResourceManager& meshResourceManager = renderer.getMeshResourceManager();
+					char budgetTemporary[128] = {};
+					ImGui::Text("Resident texture bytes: %s%s%s", ::detail::stringFormatCommas(textureResourceManager.getNumberOfResidentBytes(), temporary), isValid(textureResourceManager.getMemoryBudget()) ? " / " : "", isValid(textureResourceManager.getMemoryBudget()) ? ::detail::stringFormatCommas(textureResourceManager.getMemoryBudget(), budgetTemporary) : "");
+					ImGui::Text("Resident mesh bytes: %s%s%s", ::detail::stringFormatCommas(meshResourceManager.getNumberOfResidentBytes(), temporary), isValid(meshResourceManager.getMemoryBudget()) ? " / " : "", isValid(meshResourceManager.getMemoryBudget()) ? ::detail::stringFormatCommas(meshResourceManager.getMemoryBudget(), budgetTemporary) : "");
+				}
 
 				// RHI and pipeline statistics
 				#ifdef RHI_STATISTICS
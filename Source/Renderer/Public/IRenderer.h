@@ -505,6 +505,29 @@ namespace Renderer
 		virtual void loadPipelineStateObjectCache() = 0;
 		virtual void savePipelineStateObjectCache() = 0;
 
+		/**
+		*  @brief
+		*    Return whether or not new pipeline state combinations were used since the pipeline state object cache was loaded or saved
+		*
+		*  @return
+		*    "true" if the pipeline state object cache needs saving, else "false"
+		*/
+		[[nodiscard]] virtual bool doesPipelineStateObjectCacheNeedSaving() const = 0;
+
+		/**
+		*  @brief
+		*    Precompile the pipeline state object cache using the recorded pipeline state usage
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (e.g. there's no recorded pipeline state usage or the RHI has no shader bytecode support)
+		*
+		*  @note
+		*    - "Renderer::IRenderer::savePipelineStateObjectCache()" records the used material blueprint pipeline state combinations of the RHI inside the local data, the recorded pipeline state usage of all sessions is accumulated
+		*    - All recorded combinations which aren't inside the pipeline state object cache yet are compiled synchronously and the resulting pipeline state object cache for the used RHI is saved, this can be an expensive operation
+		*    - Usually called by the renderer toolkit, see "RendererToolkit::IProject::precompilePipelineStateObjectCache()"
+		*/
+		[[nodiscard]] virtual bool precompilePipelineStateObjectCache() = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -121,72 +121,75 @@ namespace
 		{
 			shaderProperties.clear();
 
-			{ // Gather shader properties from static material properties generating shader combinations
-				const Renderer::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector = materialResource.getSortedPropertyVector();
-				const size_t numberOfMaterialProperties = sortedMaterialPropertyVector.size();
-				for (size_t i = 0; i < numberOfMaterialProperties; ++i)
+			{ // Gather shader properties from static material properties generating shader combinations, inherited material properties only in case they're not overwritten
+				for (const Renderer::MaterialResource* currentMaterialResource = &materialResource; nullptr != currentMaterialResource; currentMaterialResource = currentMaterialResource->getParentMaterialResource())
 				{
-					const Renderer::MaterialProperty& materialProperty = sortedMaterialPropertyVector[i];
-					if (materialProperty.getUsage() == Renderer::MaterialProperty::Usage::SHADER_COMBINATION)
+					const Renderer::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector = currentMaterialResource->getSortedPropertyVector();
+					const size_t numberOfMaterialProperties = sortedMaterialPropertyVector.size();
+					for (size_t i = 0; i < numberOfMaterialProperties; ++i)
 					{
-						switch (materialProperty.getValueType())
+						const Renderer::MaterialProperty& materialProperty = sortedMaterialPropertyVector[i];
+						if (materialProperty.getUsage() == Renderer::MaterialProperty::Usage::SHADER_COMBINATION && materialResource.getPropertyById(materialProperty.getMaterialPropertyId()) == &materialProperty)
 						{
-							case Renderer::MaterialPropertyValue::ValueType::BOOLEAN:
-								shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getBooleanValue());
-								break;
+							switch (materialProperty.getValueType())
+							{
+								case Renderer::MaterialPropertyValue::ValueType::BOOLEAN:
+									shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getBooleanValue());
+									break;
 
-							case Renderer::MaterialPropertyValue::ValueType::INTEGER:
-								shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getIntegerValue());
-								break;
+								case Renderer::MaterialPropertyValue::ValueType::INTEGER:
+									shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getIntegerValue());
+									break;
 
-							case Renderer::MaterialPropertyValue::ValueType::GLOBAL_MATERIAL_PROPERTY_ID:
-							{
-								const Renderer::MaterialProperty* globalMaterialProperty = globalMaterialProperties.getPropertyById(materialProperty.getGlobalMaterialPropertyId());
-								if (nullptr != globalMaterialProperty)
-								{
-									setShaderPropertiesPropertyValue(materialProperty.getMaterialPropertyId(), *globalMaterialProperty, shaderProperties);
-								}
-								else
+								case Renderer::MaterialPropertyValue::ValueType::GLOBAL_MATERIAL_PROPERTY_ID:
 								{
-									// Try global material property reference fallback
-									globalMaterialProperty = materialBlueprintResource.getMaterialProperties().getPropertyById(materialProperty.getGlobalMaterialPropertyId());
+									const Renderer::MaterialProperty* globalMaterialProperty = globalMaterialProperties.getPropertyById(materialProperty.getGlobalMaterialPropertyId());
 									if (nullptr != globalMaterialProperty)
 									{
 										setShaderPropertiesPropertyValue(materialProperty.getMaterialPropertyId(), *globalMaterialProperty, shaderProperties);
 									}
 									else
 									{
-										// Error, can't resolve reference
-										ASSERT(false, "Unknown global material property")	// TODO(co) Error handling
+										// Try global material property reference fallback
+										globalMaterialProperty = materialBlueprintResource.getMaterialProperties().getPropertyById(materialProperty.getGlobalMaterialPropertyId());
+										if (nullptr != globalMaterialProperty)
+										{
+											setShaderPropertiesPropertyValue(materialProperty.getMaterialPropertyId(), *globalMaterialProperty, shaderProperties);
+										}
+										else
+										{
+											// Error, can't resolve reference
+											ASSERT(false, "Unknown global material property")	// TODO(co) Error handling
+										}
 									}
+									break;
 								}
-								break;
-							}
 
-							case Renderer::MaterialPropertyValue::ValueType::UNKNOWN:
-							case Renderer::MaterialPropertyValue::ValueType::INTEGER_2:
-							case Renderer::MaterialPropertyValue::ValueType::INTEGER_3:
-							case Renderer::MaterialPropertyValue::ValueType::INTEGER_4:
-							case Renderer::MaterialPropertyValue::ValueType::FLOAT:
-							case Renderer::MaterialPropertyValue::ValueType::FLOAT_2:
-							case Renderer::MaterialPropertyValue::ValueType::FLOAT_3:
-							case Renderer::MaterialPropertyValue::ValueType::FLOAT_4:
-							case Renderer::MaterialPropertyValue::ValueType::FLOAT_3_3:
-							case Renderer::MaterialPropertyValue::ValueType::FLOAT_4_4:
-							case Renderer::MaterialPropertyValue::ValueType::FILL_MODE:
-							case Renderer::MaterialPropertyValue::ValueType::CULL_MODE:
-							case Renderer::MaterialPropertyValue::ValueType::CONSERVATIVE_RASTERIZATION_MODE:
-							case Renderer::MaterialPropertyValue::ValueType::DEPTH_WRITE_MASK:
-							case Renderer::MaterialPropertyValue::ValueType::STENCIL_OP:
-							case Renderer::MaterialPropertyValue::ValueType::COMPARISON_FUNC:
-							case Renderer::MaterialPropertyValue::ValueType::BLEND:
-							case Renderer::MaterialPropertyValue::ValueType::BLEND_OP:
-							case Renderer::MaterialPropertyValue::ValueType::FILTER_MODE:
-							case Renderer::MaterialPropertyValue::ValueType::TEXTURE_ADDRESS_MODE:
-							case Renderer::MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID:
-							default:
-								ASSERT(false, "Unknown material property value type")	// TODO(co) Error handling
-								break;
+								case Renderer::MaterialPropertyValue::ValueType::UNKNOWN:
+								case Renderer::MaterialPropertyValue::ValueType::INTEGER_2:
+								case Renderer::MaterialPropertyValue::ValueType::INTEGER_3:
+								case Renderer::MaterialPropertyValue::ValueType::INTEGER_4:
+								case Renderer::MaterialPropertyValue::ValueType::FLOAT:
+								case Renderer::MaterialPropertyValue::ValueType::FLOAT_2:
+								case Renderer::MaterialPropertyValue::ValueType::FLOAT_3:
+								case Renderer::MaterialPropertyValue::ValueType::FLOAT_4:
+								case Renderer::MaterialPropertyValue::ValueType::FLOAT_3_3:
+								case Renderer::MaterialPropertyValue::ValueType::FLOAT_4_4:
+								case Renderer::MaterialPropertyValue::ValueType::FILL_MODE:
+								case Renderer::MaterialPropertyValue::ValueType::CULL_MODE:
+								case Renderer::MaterialPropertyValue::ValueType::CONSERVATIVE_RASTERIZATION_MODE:
+								case Renderer::MaterialPropertyValue::ValueType::DEPTH_WRITE_MASK:
+								case Renderer::MaterialPropertyValue::ValueType::STENCIL_OP:
+								case Renderer::MaterialPropertyValue::ValueType::COMPARISON_FUNC:
+								case Renderer::MaterialPropertyValue::ValueType::BLEND:
+								case Renderer::MaterialPropertyValue::ValueType::BLEND_OP:
+								case Renderer::MaterialPropertyValue::ValueType::FILTER_MODE:
+								case Renderer::MaterialPropertyValue::ValueType::TEXTURE_ADDRESS_MODE:
+								case Renderer::MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID:
+								default:
+									ASSERT(false, "Unknown material property value type")	// TODO(co) Error handling
+									break;
+							}
 						}
 					}
 				}
@@ -327,13 +330,15 @@ namespace Renderer
 							if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
 							{
 								// Get the pipeline state object (PSO) to use, preferably by using cached information
+								// -> The renderable pipeline state caches and the pipeline state cache managers are shared by concurrently filled compositor nodes
+								const std::lock_guard<std::mutex> commandBufferFillMutexLock(materialBlueprintResourceManager.getCommandBufferFillMutex());
 								Rhi::IPipelineState* foundPipelineState = nullptr;
 								if (isValid(materialBlueprintResource->getComputeShaderBlueprintResourceId()))
 								{
 									// Compute material blueprint resource
 
 									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
-									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
+									const uint32_t generationCounter = materialResource->getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
 
 									// Get the pipeline state object (PSO) to use, preferably by using cached information
 									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
@@ -382,7 +387,7 @@ namespace Renderer
 									// Graphics material blueprint resource
 
 									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
-									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter() + materialTechnique->getSerializedGraphicsPipelineStateHash();
+									const uint32_t generationCounter = materialResource->getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter() + materialTechnique->getSerializedGraphicsPipelineStateHash();
 
 									// Get the pipeline state object (PSO) to use, preferably by using cached information
 									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
@@ -499,9 +504,10 @@ namespace Renderer
 		// RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), commandBuffer, "Graphics render queue")
 
 		// TODO(co) This is just a dummy implementation. For example automatic instancing has to be incorporated as well as more efficient buffer management.
+		// -> Compositor nodes filled by a worker thread bring their own staged instance and indirect buffer managers
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
-		UniformInstanceBufferManager& uniformInstanceBufferManager = materialBlueprintResourceManager.getUniformInstanceBufferManager();
-		TextureInstanceBufferManager& textureInstanceBufferManager = materialBlueprintResourceManager.getTextureInstanceBufferManager();
+		UniformInstanceBufferManager& uniformInstanceBufferManager = (nullptr != compositorContextData.getUniformInstanceBufferManager()) ? *compositorContextData.getUniformInstanceBufferManager() : materialBlueprintResourceManager.getUniformInstanceBufferManager();
+		TextureInstanceBufferManager& textureInstanceBufferManager = (nullptr != compositorContextData.getTextureInstanceBufferManager()) ? *compositorContextData.getTextureInstanceBufferManager() : materialBlueprintResourceManager.getTextureInstanceBufferManager();
 		LightBufferManager& lightBufferManager = materialBlueprintResourceManager.getLightBufferManager();
 		const uint32_t instanceCount = (compositorContextData.getSinglePassStereoInstancing() ? 2u : 1u);
 
@@ -526,16 +532,16 @@ namespace Renderer
 			// Setup input assembly (IA): Set the used vertex array
 			Rhi::Command::SetGraphicsVertexArray::create(commandBuffer, mPositionOnlyPass ? renderable.getPositionOnlyVertexArrayPtrWithFallback() : renderable.getVertexArrayPtr());
 
-			{ // Fill the pass buffer manager
-				PassBufferManager* passBufferManager = materialBlueprintResource.getPassBufferManager();
-				if (nullptr != passBufferManager)
-				{
-					passBufferManager->fillBuffer(&renderTarget, compositorContextData, materialResource);
-				}
+			// Fill the pass buffer manager
+			uint32_t passBufferIndex = getInvalid<uint32_t>();
+			PassBufferManager* passBufferManager = materialBlueprintResource.getPassBufferManager();
+			if (nullptr != passBufferManager)
+			{
+				passBufferIndex = passBufferManager->fillBuffer(&renderTarget, compositorContextData, materialResource);
 			}
 
 			// Bind the graphics material blueprint resource and instance and light buffer manager to the used RHI
-			materialBlueprintResource.fillGraphicsCommandBuffer(commandBuffer);
+			materialBlueprintResource.fillGraphicsCommandBuffer(passBufferIndex, commandBuffer);
 			const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer = materialBlueprintResource.getInstanceUniformBuffer();
 			const MaterialBlueprintResource::TextureBuffer* instanceTextureBuffer = materialBlueprintResource.getInstanceTextureBuffer();
 			if (nullptr != instanceTextureBuffer)
@@ -552,7 +558,8 @@ namespace Renderer
 			{ // Cheap state change: Bind the material technique to the used RHI
 				uint32_t resourceGroupRootParameterIndex = getInvalid<uint32_t>();
 				Rhi::IResourceGroup* resourceGroup = nullptr;
-				materialTechnique.fillGraphicsCommandBuffer(mRenderer, commandBuffer, resourceGroupRootParameterIndex, &resourceGroup);
+				const void* lastBoundMaterialPool = nullptr;
+				materialTechnique.fillGraphicsCommandBuffer(mRenderer, commandBuffer, resourceGroupRootParameterIndex, &resourceGroup, lastBoundMaterialPool);
 				if (isValid(resourceGroupRootParameterIndex) && nullptr != resourceGroup)
 				{
 					Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, resourceGroupRootParameterIndex, resourceGroup);
@@ -564,11 +571,11 @@ namespace Renderer
 			if (nullptr != instanceTextureBuffer)
 			{
 				RHI_ASSERT(mRenderer.getContext(), nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
-				startInstanceLocation = textureInstanceBufferManager.fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, commandBuffer);
+				startInstanceLocation = textureInstanceBufferManager.fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), materialBlueprintResource, passBufferManager, passBufferIndex, *instanceUniformBuffer, renderable, materialTechnique, commandBuffer);
 			}
 			else if (nullptr != instanceUniformBuffer)
 			{
-				startInstanceLocation = uniformInstanceBufferManager.fillBuffer(materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, commandBuffer);
+				startInstanceLocation = uniformInstanceBufferManager.fillBuffer(materialBlueprintResource, passBufferManager, passBufferIndex, *instanceUniformBuffer, renderable, materialTechnique, commandBuffer);
 			}
 
 			// Render the specified geometric primitive, based on indexing into an array of vertices
@@ -603,7 +610,8 @@ namespace Renderer
 			uint8_t* indirectBufferData = nullptr;
 			if (mNumberOfDrawIndexedCalls > 0 || mNumberOfDrawCalls > 0 )
 			{
-				IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(sizeof(Rhi::DrawIndexedArguments) * mNumberOfDrawIndexedCalls + sizeof(Rhi::DrawArguments) * mNumberOfDrawCalls);
+				IndirectBufferManager& indirectBufferManager = (nullptr != compositorContextData.getIndirectBufferManager()) ? *compositorContextData.getIndirectBufferManager() : mIndirectBufferManager;
+				IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = indirectBufferManager.getIndirectBuffer(sizeof(Rhi::DrawIndexedArguments) * mNumberOfDrawIndexedCalls + sizeof(Rhi::DrawArguments) * mNumberOfDrawCalls);
 				RHI_ASSERT(mRenderer.getContext(), nullptr != managedIndirectBuffer, "Invalid managed indirect buffer")
 				indirectBuffer		 = managedIndirectBuffer->indirectBuffer;
 				indirectBufferOffset = managedIndirectBuffer->indirectBufferOffset;
@@ -616,6 +624,11 @@ namespace Renderer
 			uint32_t currentNumberOfDraws = 0;
 			bool currentDrawIndexed = false;
 
+			// Currently used pass buffer and bound material pool, both belong to the currently bound material blueprint resource
+			PassBufferManager* currentPassBufferManager = nullptr;
+			uint32_t currentPassBufferIndex = getInvalid<uint32_t>();
+			const void* currentMaterialPool = nullptr;
+
 			// Process queues
 			for (Queue& queue : mQueues)
 			{
@@ -676,22 +689,25 @@ namespace Renderer
 						{
 							compositorContextData.mCurrentlyBoundMaterialBlueprintResource = &materialBlueprintResource;
 							std::fill(currentSetGraphicsResourceGroup.begin(), currentSetGraphicsResourceGroup.end(), nullptr);
+							currentMaterialPool = nullptr;
 							bindMaterialBlueprint = true;
 						}
 						if (bindMaterialBlueprint || enforcePassBufferManagerFillBuffer)
 						{
 							// Fill the pass buffer manager
 							passBufferManager = materialBlueprintResource.getPassBufferManager();
+							currentPassBufferManager = passBufferManager;
+							currentPassBufferIndex = getInvalid<uint32_t>();
 							if (nullptr != passBufferManager)
 							{
-								passBufferManager->fillBuffer(&renderTarget, compositorContextData, materialResource);
+								currentPassBufferIndex = passBufferManager->fillBuffer(&renderTarget, compositorContextData, materialResource);
 								enforcePassBufferManagerFillBuffer = false;
 							}
 						}
 						if (bindMaterialBlueprint)
 						{
 							// Bind the graphics material blueprint resource and instance and light buffer manager to the used RHI
-							materialBlueprintResource.fillGraphicsCommandBuffer(mScratchCommandBuffer);
+							materialBlueprintResource.fillGraphicsCommandBuffer(currentPassBufferIndex, mScratchCommandBuffer);
 							if (nullptr != instanceTextureBuffer)
 							{
 								RHI_ASSERT(mRenderer.getContext(), nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
@@ -706,13 +722,13 @@ namespace Renderer
 						else if (nullptr != passBufferManager)
 						{
 							// Bind pass buffer manager since we filled the buffer
-							passBufferManager->fillGraphicsCommandBuffer(mScratchCommandBuffer);
+							passBufferManager->fillGraphicsCommandBuffer(currentPassBufferIndex, mScratchCommandBuffer);
 						}
 
 						{ // Cheap state change: Bind the material technique to the used RHI
 							uint32_t resourceGroupRootParameterIndex = getInvalid<uint32_t>();
 							Rhi::IResourceGroup* resourceGroup = nullptr;
-							materialTechnique.fillGraphicsCommandBuffer(mRenderer, mScratchCommandBuffer, resourceGroupRootParameterIndex, &resourceGroup);
+							materialTechnique.fillGraphicsCommandBuffer(mRenderer, mScratchCommandBuffer, resourceGroupRootParameterIndex, &resourceGroup, currentMaterialPool);
 							if (isValid(resourceGroupRootParameterIndex) && nullptr != resourceGroup && currentSetGraphicsResourceGroup[resourceGroupRootParameterIndex] != resourceGroup)
 							{
 								currentSetGraphicsResourceGroup[resourceGroupRootParameterIndex] = resourceGroup;
@@ -725,11 +741,11 @@ namespace Renderer
 						if (nullptr != instanceTextureBuffer)
 						{
 							RHI_ASSERT(mRenderer.getContext(), nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
-							startInstanceLocation = textureInstanceBufferManager.fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, mScratchCommandBuffer);
+							startInstanceLocation = textureInstanceBufferManager.fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), materialBlueprintResource, currentPassBufferManager, currentPassBufferIndex, *instanceUniformBuffer, renderable, materialTechnique, mScratchCommandBuffer);
 						}
 						else if (nullptr != instanceUniformBuffer)
 						{
-							startInstanceLocation = uniformInstanceBufferManager.fillBuffer(materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, mScratchCommandBuffer);
+							startInstanceLocation = uniformInstanceBufferManager.fillBuffer(materialBlueprintResource, currentPassBufferManager, currentPassBufferIndex, *instanceUniformBuffer, renderable, materialTechnique, mScratchCommandBuffer);
 						}
 
 						// Emit draw command, if necessary
@@ -986,16 +1002,16 @@ namespace Renderer
 			// Set the used compute pipeline state object (PSO)
 			Rhi::Command::SetComputePipelineState::create(commandBuffer, &foundComputePipelineState);
 
-			{ // Fill the pass buffer manager
-				PassBufferManager* passBufferManager = materialBlueprintResource.getPassBufferManager();
-				if (nullptr != passBufferManager)
-				{
-					passBufferManager->fillBuffer(nullptr, compositorContextData, materialResource);
-				}
+			// Fill the pass buffer manager
+			uint32_t passBufferIndex = getInvalid<uint32_t>();
+			PassBufferManager* passBufferManager = materialBlueprintResource.getPassBufferManager();
+			if (nullptr != passBufferManager)
+			{
+				passBufferIndex = passBufferManager->fillBuffer(nullptr, compositorContextData, materialResource);
 			}
 
 			// Bind the compute material blueprint resource and instance and light buffer manager to the used RHI
-			materialBlueprintResource.fillComputeCommandBuffer(commandBuffer);
+			materialBlueprintResource.fillComputeCommandBuffer(passBufferIndex, commandBuffer);
 			const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer = materialBlueprintResource.getInstanceUniformBuffer();
 			if (nullptr != instanceUniformBuffer)
 			{
@@ -1008,7 +1024,8 @@ namespace Renderer
 			{ // Cheap state change: Bind the material technique to the used RHI
 				uint32_t resourceGroupRootParameterIndex = getInvalid<uint32_t>();
 				Rhi::IResourceGroup* resourceGroup = nullptr;
-				queuedRenderable.materialTechnique->fillComputeCommandBuffer(mRenderer, commandBuffer, resourceGroupRootParameterIndex, &resourceGroup);
+				const void* lastBoundMaterialPool = nullptr;
+				queuedRenderable.materialTechnique->fillComputeCommandBuffer(mRenderer, commandBuffer, resourceGroupRootParameterIndex, &resourceGroup, lastBoundMaterialPool);
 				if (isValid(resourceGroupRootParameterIndex) && nullptr != resourceGroup)
 				{
 					Rhi::Command::SetComputeResourceGroup::create(commandBuffer, resourceGroupRootParameterIndex, resourceGroup);
@@ -1017,7 +1034,7 @@ namespace Renderer
 
 			// Fill the instance buffer manager
 			// TODO(co) Think about compute instance buffer support
-			// [[maybe_unused]] const uint32_t startInstanceLocation = (nullptr != instanceUniformBuffer) ? textureInstanceBufferManager.fillBuffer(materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, *materialTechnique, commandBuffer) : 0;
+			// [[maybe_unused]] const uint32_t startInstanceLocation = (nullptr != instanceUniformBuffer) ? textureInstanceBufferManager.fillBuffer(materialBlueprintResource, passBufferManager, passBufferIndex, *instanceUniformBuffer, renderable, *materialTechnique, commandBuffer) : 0;
 
 			// Dispatch compute
 			Rhi::Command::DispatchCompute::create(commandBuffer, groupCountX, groupCountY, groupCountZ);
@@ -65,9 +65,11 @@ namespace Renderer
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
 		mCachedDistanceToCamera(getInvalid<float>()),
+		mCachedShadowCascadeMask(0xFF),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
-		mCastShadows(false)
+		mCastShadows(false),
+		mCachedStaticShadowCaster(false)
 	{
 		// Nothing here
 	}
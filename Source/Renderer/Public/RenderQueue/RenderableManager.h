@@ -161,6 +161,46 @@ namespace Renderer
 			mCachedDistanceToCamera = distanceToCamera;
 		}
 
+		/**
+		*  @brief
+		*    Return the cached shadow cascade mask
+		*
+		*  @return
+		*    The cached shadow cascade mask, bit n is set if the renderable manager is relevant for shadow cascade n
+		*
+		*  @see
+		*    - "Renderer::SceneCullingManager::cullShadowCascades()"
+		*/
+		[[nodiscard]] inline uint8_t getCachedShadowCascadeMask() const
+		{
+			return mCachedShadowCascadeMask;
+		}
+
+		inline void setCachedShadowCascadeMask(uint8_t shadowCascadeMask)
+		{
+			mCachedShadowCascadeMask = shadowCascadeMask;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the renderable manager is considered to be a static shadow caster
+		*
+		*  @return
+		*    "true" if the transform didn't change for a while, else "false"
+		*
+		*  @see
+		*    - "Renderer::SceneCullingManager::cullShadowCascades()"
+		*/
+		[[nodiscard]] inline bool getCachedStaticShadowCaster() const
+		{
+			return mCachedStaticShadowCaster;
+		}
+
+		inline void setCachedStaticShadowCaster(bool staticShadowCaster)
+		{
+			mCachedStaticShadowCaster = staticShadowCaster;
+		}
+
 		/**
 		*  @brief
 		*    Return the minimum renderables render queue index (inclusive)
@@ -241,9 +281,11 @@ namespace Renderer
 		bool			 mVisible;
 		// Cached data
 		float			 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
+		uint8_t			 mCachedShadowCascadeMask;	///< Cached shadow cascade mask is updated during the shadow cascade culling phase, bit n is set if the renderable manager is relevant for shadow cascade n
 		uint8_t			 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		uint8_t			 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		bool			 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
+		bool			 mCachedStaticShadowCaster;	///< Cached static shadow caster state is updated during the shadow cascade culling phase
 
 
 	};
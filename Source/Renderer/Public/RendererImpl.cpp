@@ -39,6 +39,7 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateCompiler.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/Cache/ComputePipelineStateCompiler.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsProgramBinaryCacheManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/Listener/MaterialBlueprintResourceListener.h"
 #include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
@@ -86,27 +87,37 @@ namespace
 		namespace PipelineStateCache
 		{
 			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("PipelineStateCache");
+			static constexpr uint32_t FORMAT_VERSION = 2;
+		}
+		namespace GraphicsProgramBinaryCache
+		{
+			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("GraphicsProgramBinaryCache");
 			static constexpr uint32_t FORMAT_VERSION = 1;
 		}
+		namespace PipelineStateUsage
+		{
+			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("PipelineStateUsage");
+			static constexpr uint32_t FORMAT_VERSION = 2;
+		}
 
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		void getPipelineStateObjectCacheFilename(const Renderer::IRenderer& renderer, std::string& virtualDirectoryName, std::string& virtualFilename)
+		void getPipelineStateObjectCacheFilename(const Renderer::IRenderer& renderer, const char* filename, const char* fileExtension, std::string& virtualDirectoryName, std::string& virtualFilename)
 		{
 			virtualDirectoryName = renderer.getFileManager().getLocalDataMountPoint();
-			virtualFilename = virtualDirectoryName + '/' + renderer.getRhi().getName() + ".pso_cache";
+			virtualFilename = virtualDirectoryName + '/' + filename + fileExtension;
 		}
 
-		[[nodiscard]] bool loadPipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, Renderer::MemoryFile& memoryFile)
+		[[nodiscard]] bool loadPipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, const char* filename, const char* fileExtension, uint32_t formatType, uint32_t formatVersion, Renderer::MemoryFile& memoryFile)
 		{
 			// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
 			std::string virtualDirectoryName;
 			std::string virtualFilename;
-			getPipelineStateObjectCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+			getPipelineStateObjectCacheFilename(renderer, filename, fileExtension, virtualDirectoryName, virtualFilename);
 			const Renderer::IFileManager& fileManager = renderer.getFileManager();
-			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(formatType, formatVersion, fileManager, virtualFilename.c_str()))
 			{
 				memoryFile.decompress();
 
@@ -119,13 +130,13 @@ namespace
 			return false;
 		}
 
-		void savePipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, const Renderer::MemoryFile& memoryFile)
+		void savePipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, const char* filename, const char* fileExtension, uint32_t formatType, uint32_t formatVersion, const Renderer::MemoryFile& memoryFile)
 		{
 			std::string virtualDirectoryName;
 			std::string virtualFilename;
-			getPipelineStateObjectCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+			getPipelineStateObjectCacheFilename(renderer, filename, fileExtension, virtualDirectoryName, virtualFilename);
 			Renderer::IFileManager& fileManager = renderer.getFileManager();
-			if (fileManager.createDirectories(virtualDirectoryName.c_str()) && !memoryFile.writeLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			if (fileManager.createDirectories(virtualDirectoryName.c_str()) && !memoryFile.writeLz4CompressedDataByVirtualFilename(formatType, formatVersion, fileManager, virtualFilename.c_str()))
 			{
 				RHI_LOG(renderer.getContext(), CRITICAL, "The renderer failed to save the pipeline state object cache to \"%s\"", virtualFilename.c_str())
 			}
@@ -352,7 +363,7 @@ namespace Renderer
 
 			// Load file
 			MemoryFile memoryFile;
-			if (::detail::loadPipelineStateObjectCacheFile(*this, memoryFile))
+			if (::detail::loadPipelineStateObjectCacheFile(*this, mRhi->getName(), ".pso_cache", ::detail::PipelineStateCache::FORMAT_TYPE, ::detail::PipelineStateCache::FORMAT_VERSION, memoryFile))
 			{
 				mShaderBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile);
 				mMaterialBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile);
@@ -363,19 +374,95 @@ namespace Renderer
 				// RHI_ASSERT(getContext(), false, "Renderer is unable to load the pipeline state object cache. This will possibly result decreased runtime performance up to runtime hiccups. You might want to create the pipeline state object cache via the renderer toolkit.")
 			}
 		}
+
+		// Load the graphics program binary cache
+		// -> Graphics program binaries are driver specific, so they're kept inside a local data file of their own which is never shipped
+		GraphicsProgramBinaryCacheManager* graphicsProgramBinaryCacheManager = mMaterialBlueprintResourceManager->getGraphicsProgramBinaryCacheManager();
+		if (nullptr != graphicsProgramBinaryCacheManager && nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			MemoryFile memoryFile;
+			if (::detail::loadPipelineStateObjectCacheFile(*this, mRhi->getName(), ".program_binary_cache", ::detail::GraphicsProgramBinaryCache::FORMAT_TYPE, ::detail::GraphicsProgramBinaryCache::FORMAT_VERSION, memoryFile))
+			{
+				graphicsProgramBinaryCacheManager->loadCache(memoryFile);
+			}
+		}
 	}
 
 	void RendererImpl::savePipelineStateObjectCache()
 	{
 		// Do only save the pipeline state object cache if writing local data is allowed
 		// -> We only support saving material blueprint based shader bytecodes, creating shaders without material blueprint is supposed to be only used for debugging and tiny shaders which are compiled at the very beginning of rendering
-		if (mRhi->getCapabilities().shaderBytecode && nullptr != mFileManager->getLocalDataMountPoint() && (mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving()))
+		const bool materialBlueprintPipelineStateObjectCacheNeedsSaving = mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving();
+		if (mRhi->getCapabilities().shaderBytecode && nullptr != mFileManager->getLocalDataMountPoint() && (mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || materialBlueprintPipelineStateObjectCacheNeedsSaving))
 		{
 			MemoryFile memoryFile;
 			mShaderBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
 			mMaterialBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
-			::detail::savePipelineStateObjectCacheFile(*this, memoryFile);
+			::detail::savePipelineStateObjectCacheFile(*this, mRhi->getName(), ".pso_cache", ::detail::PipelineStateCache::FORMAT_TYPE, ::detail::PipelineStateCache::FORMAT_VERSION, memoryFile);
+		}
+
+		// Record the pipeline state usage, input for "Renderer::IRenderer::precompilePipelineStateObjectCache()"
+		// -> Also recorded if the RHI has no shader bytecode support
+		if (nullptr != mFileManager->getLocalDataMountPoint() && materialBlueprintPipelineStateObjectCacheNeedsSaving)
+		{
+			savePipelineStateUsage();
+		}
+
+		// Save the graphics program binary cache
+		GraphicsProgramBinaryCacheManager* graphicsProgramBinaryCacheManager = mMaterialBlueprintResourceManager->getGraphicsProgramBinaryCacheManager();
+		if (nullptr != graphicsProgramBinaryCacheManager && nullptr != mFileManager->getLocalDataMountPoint() && graphicsProgramBinaryCacheManager->doesCacheNeedSaving())
+		{
+			MemoryFile memoryFile;
+			graphicsProgramBinaryCacheManager->saveCache(memoryFile);
+			::detail::savePipelineStateObjectCacheFile(*this, mRhi->getName(), ".program_binary_cache", ::detail::GraphicsProgramBinaryCache::FORMAT_TYPE, ::detail::GraphicsProgramBinaryCache::FORMAT_VERSION, memoryFile);
+		}
+	}
+
+
+	bool RendererImpl::doesPipelineStateObjectCacheNeedSaving() const
+	{
+		return (mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving());
+	}
+
+	bool RendererImpl::precompilePipelineStateObjectCache()
+	{
+		// Sanity checks
+		if (!mRhi->getCapabilities().shaderBytecode)
+		{
+			RHI_LOG(getContext(), CRITICAL, "The renderer can't precompile the pipeline state object cache since the \"%s\" RHI has no shader bytecode support", mRhi->getName())
+			return false;
+		}
+		if (nullptr == mFileManager->getLocalDataMountPoint())
+		{
+			RHI_LOG(getContext(), CRITICAL, "The renderer can't precompile the pipeline state object cache since writing local data isn't allowed")
+			return false;
+		}
+
+		// Add the pipeline state usage of this session to the recorded pipeline state usage and load the result
+		if (mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving())
+		{
+			savePipelineStateUsage();
 		}
+		MemoryFile usageMemoryFile;
+		if (!::detail::loadPipelineStateObjectCacheFile(*this, mRhi->getName(), ".pipeline_state_usage", ::detail::PipelineStateUsage::FORMAT_TYPE, ::detail::PipelineStateUsage::FORMAT_VERSION, usageMemoryFile))
+		{
+			RHI_LOG(getContext(), CRITICAL, "The renderer can't precompile the pipeline state object cache since there's no recorded pipeline state usage")
+			return false;
+		}
+
+		// Compile all recorded pipeline state combinations which aren't known yet
+		// -> The recorded pipeline state usage contains the pipeline state usage of this session, so there's no need to clear the pipeline state object cache
+		mMaterialBlueprintResourceManager->loadPipelineStateUsage(usageMemoryFile);
+		flushAllQueues();
+
+		// Save the now fully warm pipeline state object cache, regardless of whether or not something has changed
+		MemoryFile memoryFile;
+		mShaderBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
+		mMaterialBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
+		::detail::savePipelineStateObjectCacheFile(*this, mRhi->getName(), ".pso_cache", ::detail::PipelineStateCache::FORMAT_TYPE, ::detail::PipelineStateCache::FORMAT_VERSION, memoryFile);
+
+		// Done
+		return true;
 	}
 
 
@@ -388,6 +475,22 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RendererImpl::savePipelineStateUsage()
+	{
+		// The recorded pipeline state usage is keyed by material blueprint asset IDs and merged with the previously recorded one, this way
+		// the pipeline state usage of all sessions is accumulated instead of only keeping the last session. There's one recorded pipeline
+		// state usage per RHI since e.g. the used material blueprints might depend on the RHI capabilities.
+		MemoryFile recordedMemoryFile;
+		const bool recordedPipelineStateUsageAvailable = ::detail::loadPipelineStateObjectCacheFile(*this, mRhi->getName(), ".pipeline_state_usage", ::detail::PipelineStateUsage::FORMAT_TYPE, ::detail::PipelineStateUsage::FORMAT_VERSION, recordedMemoryFile);
+		MemoryFile memoryFile;
+		mMaterialBlueprintResourceManager->savePipelineStateUsage(recordedPipelineStateUsageAvailable ? &recordedMemoryFile : nullptr, memoryFile);
+		::detail::savePipelineStateObjectCacheFile(*this, mRhi->getName(), ".pipeline_state_usage", ::detail::PipelineStateUsage::FORMAT_TYPE, ::detail::PipelineStateUsage::FORMAT_VERSION, memoryFile);
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
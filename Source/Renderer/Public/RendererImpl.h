@@ -117,6 +117,8 @@ namespace Renderer
 		virtual void clearPipelineStateObjectCache() override;
 		virtual void loadPipelineStateObjectCache() override;
 		virtual void savePipelineStateObjectCache() override;
+		[[nodiscard]] virtual bool doesPipelineStateObjectCacheNeedSaving() const override;
+		[[nodiscard]] virtual bool precompilePipelineStateObjectCache() override;
 
 
 	//[-------------------------------------------------------]
@@ -132,6 +134,7 @@ namespace Renderer
 	private:
 		explicit RendererImpl(const RendererImpl& source) = delete;
 		RendererImpl& operator =(const RendererImpl& source) = delete;
+		void savePipelineStateUsage();
 
 
 	//[-------------------------------------------------------]
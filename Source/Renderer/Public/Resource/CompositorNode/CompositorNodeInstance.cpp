@@ -61,10 +61,9 @@ namespace Renderer
 		for (ICompositorInstancePass* compositorInstancePass : mCompositorInstancePasses)
 		{
 			// Check whether or not to execute the compositor pass instance
-			const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
-			if ((!compositorResourcePass.getSkipFirstExecution() || compositorInstancePass->mNumberOfExecutionRequests > 0) &&
-				(isInvalid(compositorResourcePass.getNumberOfExecutions()) || compositorInstancePass->mNumberOfExecutionRequests < compositorResourcePass.getNumberOfExecutions()))
+			if (isCompositorInstancePassExecuted(*compositorInstancePass))
 			{
+				const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
 				{ // Set the current graphics render target
 					// TODO(co) For now: In case if it's a compositor channel ID (input/output node) use the given render target
 					Rhi::IRenderTarget* newRenderTarget = isValid(compositorResourcePass.getCompositorTarget().getCompositorChannelId()) ? &renderTarget : compositorInstancePass->getRenderTarget();
@@ -106,6 +105,38 @@ namespace Renderer
 		return *currentRenderTarget;
 	}
 
+	Rhi::IRenderTarget& CompositorNodeInstance::getOutputRenderTarget(Rhi::IRenderTarget& renderTarget) const
+	{
+		// Same render target selection as inside "Renderer::CompositorNodeInstance::fillCommandBuffer()"
+		Rhi::IRenderTarget* currentRenderTarget = nullptr;
+		for (const ICompositorInstancePass* compositorInstancePass : mCompositorInstancePasses)
+		{
+			if (isCompositorInstancePassExecuted(*compositorInstancePass))
+			{
+				// In case it's a compositor channel ID (input/output node) use the given render target
+				currentRenderTarget = isValid(compositorInstancePass->getCompositorResourcePass().getCompositorTarget().getCompositorChannelId()) ? &renderTarget : compositorInstancePass->getRenderTarget();
+			}
+		}
+
+		// Sanity check
+		ASSERT(nullptr != currentRenderTarget, "At least for now a compositor node must end with a valid current render target")
+
+		// Done
+		return *currentRenderTarget;
+	}
+
+	bool CompositorNodeInstance::canFillCommandBufferConcurrently() const
+	{
+		for (const ICompositorInstancePass* compositorInstancePass : mCompositorInstancePasses)
+		{
+			if (isCompositorInstancePassExecuted(*compositorInstancePass) && !compositorInstancePass->canFillCommandBufferConcurrently())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 	void CompositorNodeInstance::onPostCommandBufferDispatch() const
 	{
 		for (ICompositorInstancePass* compositorInstancePass : mCompositorInstancePasses)
@@ -115,6 +146,19 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	bool CompositorNodeInstance::isCompositorInstancePassExecuted(const ICompositorInstancePass& compositorInstancePass)
+	{
+		// Culled compositor instance passes don't contribute to the compositor workspace output (see "Renderer::CompositorWorkspaceInstance::compileFrameGraph()")
+		const ICompositorResourcePass& compositorResourcePass = compositorInstancePass.getCompositorResourcePass();
+		return (!compositorInstancePass.mCulled &&
+				(!compositorResourcePass.getSkipFirstExecution() || compositorInstancePass.mNumberOfExecutionRequests > 0) &&
+				(isInvalid(compositorResourcePass.getNumberOfExecutions()) || compositorInstancePass.mNumberOfExecutionRequests < compositorResourcePass.getNumberOfExecutions()));
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -101,6 +101,11 @@ namespace Renderer
 			return mCompositorInstancePasses;
 		}
 
+		[[nodiscard]] inline const Rhi::CommandBuffer& getCommandBuffer() const	// Filled during compositor workspace instance execution, dispatched in-order by the compositor workspace instance command buffer
+		{
+			return mCommandBuffer;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -119,6 +124,30 @@ namespace Renderer
 		void compositorWorkspaceInstanceLoadingFinished() const;
 		[[nodiscard]] Rhi::IRenderTarget& fillCommandBuffer(Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) const;
 
+		/**
+		*  @brief
+		*    Return the RHI render target the compositor node instance command buffer fill is going to end with, without filling a command buffer
+		*
+		*  @param[in] renderTarget
+		*    RHI render target to render into
+		*
+		*  @return
+		*    The RHI render target "Renderer::CompositorNodeInstance::fillCommandBuffer()" is going to return for the given RHI render target
+		*
+		*  @note
+		*    - Used to determine the RHI render target of each compositor node instance up-front before filling the command buffers concurrently
+		*/
+		[[nodiscard]] Rhi::IRenderTarget& getOutputRenderTarget(Rhi::IRenderTarget& renderTarget) const;
+
+		/**
+		*  @brief
+		*    Return whether or not all compositor instance passes which are going to be executed can be filled by a worker thread
+		*
+		*  @return
+		*    "true" if the compositor node instance command buffer can be filled concurrently to other compositor node instances, else "false"
+		*/
+		[[nodiscard]] bool canFillCommandBufferConcurrently() const;
+
 		/**
 		*  @brief
 		*    Called post command buffer dispatch
@@ -126,6 +155,13 @@ namespace Renderer
 		void onPostCommandBufferDispatch() const;
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] static bool isCompositorInstancePassExecuted(const ICompositorInstancePass& compositorInstancePass);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -133,6 +169,7 @@ namespace Renderer
 		CompositorNodeResourceId		   mCompositorNodeResourceId;
 		const CompositorWorkspaceInstance& mCompositorWorkspaceInstance;
 		CompositorInstancePasses		   mCompositorInstancePasses;	///< Owns the compositor instance passes and has to destroy them if no longer needed
+		Rhi::CommandBuffer				   mCommandBuffer;				///< RHI command buffer this compositor node instance records into, kept across frames to avoid reallocations
 
 
 	};
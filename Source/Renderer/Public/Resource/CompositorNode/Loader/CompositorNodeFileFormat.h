@@ -60,7 +60,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("CompositorNode");
-		static constexpr uint32_t FORMAT_VERSION = 9;
+		static constexpr uint32_t FORMAT_VERSION = 11;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -142,6 +142,10 @@ namespace Renderer
 				AssetId textureAssetId;
 				AssetId depthToExponentialVarianceMaterialBlueprintAssetId;
 				AssetId blurMaterialBlueprintAssetId;
+				bool	cacheStaticShadowCasters		= false;
+				float	staticShadowCacheSnapThreshold	= 1.0f;	///< In shadow map texels
+				AssetId	depthReductionMaterialBlueprintAssetId;	///< Optional, if set the depth reduction depth map asset ID must be valid as well
+				AssetId	depthReductionDepthMapAssetId;
 			};
 
 			struct PassResolveMultisample final : public Pass
@@ -66,8 +66,7 @@ namespace Renderer
 		mMaterialBlueprintAssetId = passCompute->materialBlueprintAssetId;
 
 		{ // Read material properties
-			// TODO(co) Get rid of the evil const-cast
-			MaterialProperties::SortedPropertyVector& sortedPropertyVector = const_cast<MaterialProperties::SortedPropertyVector&>(mMaterialProperties.getSortedPropertyVector());
+			MaterialProperties::SortedPropertyVector& sortedPropertyVector = mMaterialProperties.getSortedPropertyVector();
 			sortedPropertyVector.resize(passCompute->numberOfMaterialProperties);
 			memcpy(reinterpret_cast<char*>(sortedPropertyVector.data()), data + sizeof(v1CompositorNode::PassCompute), sizeof(MaterialProperty) * passCompute->numberOfMaterialProperties);
 		}
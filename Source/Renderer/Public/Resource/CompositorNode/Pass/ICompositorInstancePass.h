@@ -81,6 +81,11 @@ namespace Renderer
 			return mRenderTarget;
 		}
 
+		[[nodiscard]] inline bool isCulled() const	// A culled compositor instance pass doesn't contribute to the compositor workspace output and is hence not executed
+		{
+			return mCulled;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
@@ -112,6 +117,22 @@ namespace Renderer
 		*/
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) = 0;
 
+		/**
+		*  @brief
+		*    Return whether or not the compositor pass can be filled by a worker thread concurrently to other compositor node instances
+		*
+		*  @return
+		*    "true" if the compositor pass can be filled concurrently, else "false"
+		*
+		*  @note
+		*    - Concurrently filled compositor passes use the staged instance and indirect buffer managers of the given compositor context data, they mustn't map RHI resources on their own
+		*    - The default implementation returns "false", meaning the compositor pass is always filled by the render thread
+		*/
+		[[nodiscard]] inline virtual bool canFillCommandBufferConcurrently() const
+		{
+			return false;
+		}
+
 		/**
 		*  @brief
 		*    Called post command buffer dispatch
@@ -133,7 +154,8 @@ namespace Renderer
 			mCompositorResourcePass(compositorResourcePass),
 			mCompositorNodeInstance(compositorNodeInstance),
 			mRenderTarget(nullptr),
-			mNumberOfExecutionRequests(0)
+			mNumberOfExecutionRequests(0),
+			mCulled(false)
 		{
 			// Nothing here
 		}
@@ -155,6 +177,7 @@ namespace Renderer
 		const CompositorNodeInstance&  mCompositorNodeInstance;
 		Rhi::IRenderTarget*			   mRenderTarget;	/// Render target, can be a null pointer, don't destroy the instance
 		uint32_t					   mNumberOfExecutionRequests;
+		bool						   mCulled;	///< Set by the owner compositor workspace instance frame graph compilation
 
 
 	};
@@ -65,6 +65,11 @@ namespace Renderer
 	protected:
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
 
+		[[nodiscard]] inline virtual bool canFillCommandBufferConcurrently() const override
+		{
+			return true;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
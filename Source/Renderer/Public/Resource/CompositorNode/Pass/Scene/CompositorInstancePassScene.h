@@ -68,6 +68,11 @@ namespace Renderer
 		virtual void onCompositorWorkspaceInstanceLoadingFinished() override;
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
 
+		[[nodiscard]] inline virtual bool canFillCommandBufferConcurrently() const override
+		{
+			return true;
+		}
+
 		inline virtual void onPostCommandBufferDispatch() override
 		{
 			// Directly clear the render queue as soon as the frame rendering has been finished to avoid evil dangling pointers
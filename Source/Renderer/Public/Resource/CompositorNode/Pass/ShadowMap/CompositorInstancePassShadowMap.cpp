@@ -27,9 +27,15 @@
 #include "Renderer/Public/Resource/CompositorNode/CompositorNodeInstance.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialTechnique.h"
+#include "Renderer/Public/Resource/Material/MaterialResource.h"
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Light/LightSceneItem.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/Scene/SceneResource.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/Core/IProfiler.h"
@@ -58,8 +64,19 @@ namespace
 		//[-------------------------------------------------------]
 		static constexpr float	  SHADOW_MAP_FILTER_SIZE							  = 7.0f;
 		static constexpr uint8_t  INTERMEDIATE_CASCADE_INDEX						  = 3;
+		static constexpr float	  STATIC_SHADOW_CACHE_DEPTH_PADDING					  = 0.25f;	///< Depth range padding on both sides in percent of the shadow cascade depth range when caching static shadow casters
 		static constexpr uint32_t DEPTH_SHADOW_MAP_TEXTURE_ASSET_ID					  = ASSET_ID("Unrimp/Texture/DynamicByCode/DepthShadowMap");
 		static constexpr uint32_t INTERMEDIATE_DEPTH_BLUR_SHADOW_MAP_TEXTURE_ASSET_ID = ASSET_ID("Unrimp/Texture/DynamicByCode/IntermediateDepthBlurShadowMap");
+		static constexpr uint32_t STATIC_DEPTH_SHADOW_MAP_TEXTURE_ASSET_IDS[Renderer::CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES] =
+		{
+			ASSET_ID("Unrimp/Texture/DynamicByCode/StaticDepthShadowMap0"),
+			ASSET_ID("Unrimp/Texture/DynamicByCode/StaticDepthShadowMap1"),
+			ASSET_ID("Unrimp/Texture/DynamicByCode/StaticDepthShadowMap2"),
+			ASSET_ID("Unrimp/Texture/DynamicByCode/StaticDepthShadowMap3")
+		};
+		static constexpr uint32_t NUMBER_OF_DEPTH_REDUCTION_ELEMENTS	  = 32 * 32;	///< Fixed global compute size of the depth reduction material blueprint, one minimum and maximum depth per element
+		static constexpr float	  DEPTH_REDUCTION_DISTANCE_MARGIN		  = 0.05f;		///< The depth reduction result is latent, so give the camera some room to move before shadow receivers fall outside of the shadow cascades
+		static constexpr float	  MINIMUM_DEPTH_REDUCTION_DISTANCE_RANGE = 0.001f;
 
 
 		//[-------------------------------------------------------]
@@ -71,6 +88,35 @@ namespace
 			return temporaryVector / temporaryVector.w;
 		}
 
+		[[nodiscard]] bool canReuseStaticShadowCache(const glm::mat4& viewSpaceToClipSpace, const glm::mat4& cachedViewSpaceToClipSpace, uint32_t shadowMapSize, float snapThresholdInTexels)
+		{
+			// Project the clip space corners of the shadow cascade into the cached shadow cascade, covers translation, rotation and scale
+			// -> The depth of the corners is the unpadded depth range of the shadow cascade, the padding is the slack the cached depth range has
+			static constexpr float MINIMUM_DEPTH = STATIC_SHADOW_CACHE_DEPTH_PADDING / (1.0f + 2.0f * STATIC_SHADOW_CACHE_DEPTH_PADDING);
+			static constexpr float MAXIMUM_DEPTH = 1.0f - MINIMUM_DEPTH;
+			static constexpr float CORNERS[8][3] =
+			{
+				{ -1.0f, -1.0f, MINIMUM_DEPTH }, { 1.0f, -1.0f, MINIMUM_DEPTH }, { -1.0f, 1.0f, MINIMUM_DEPTH }, { 1.0f, 1.0f, MINIMUM_DEPTH },
+				{ -1.0f, -1.0f, MAXIMUM_DEPTH }, { 1.0f, -1.0f, MAXIMUM_DEPTH }, { -1.0f, 1.0f, MAXIMUM_DEPTH }, { 1.0f, 1.0f, MAXIMUM_DEPTH }
+			};
+			const glm::mat4 clipSpaceToCachedClipSpace = cachedViewSpaceToClipSpace * glm::inverse(viewSpaceToClipSpace);
+			float maximumMovement = 0.0f;
+			for (int i = 0; i < 8; ++i)
+			{
+				const glm::vec4 cachedCorner = transformVectorByMatrix(clipSpaceToCachedClipSpace, glm::vec4(CORNERS[i][0], CORNERS[i][1], CORNERS[i][2], 1.0f));
+
+				// The depth range of the shadow cascade must be covered by the cached depth range, else shadow casters get clipped
+				if (cachedCorner.z < 0.0f || cachedCorner.z > 1.0f)
+				{
+					return false;
+				}
+				maximumMovement = std::max(maximumMovement, std::max(std::abs(cachedCorner.x - CORNERS[i][0]), std::abs(cachedCorner.y - CORNERS[i][1])));
+			}
+
+			// Clip space to texel space
+			return (maximumMovement * static_cast<float>(shadowMapSize) * 0.5f <= snapThresholdInTexels);
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -148,9 +194,16 @@ namespace Renderer
 			const bool stabilizeCascades = false;
 //			const bool stabilizeCascades = mStabilizeCascades;
 
-			// TODO(co) The minimum and maximum distance need to be calculated dynamically via depth buffer reduction as seen inside e.g. https://github.com/TheRealMJP/MSAAFilter/tree/master/MSAAFilter
-			const float minimumDistance = 0.0f;
-			const float maximumDistance = 0.5f;
+			// Get the minimum and maximum distance of the depth range visible to the camera as fraction of the camera clip range
+			// -> Calculated dynamically via depth buffer reduction as seen inside e.g. https://github.com/TheRealMJP/MSAAFilter/tree/master/MSAAFilter
+			// -> Fixed depth range in case there's no depth buffer reduction result
+			float minimumDistance = 0.0f;
+			float maximumDistance = 0.0f;
+			if (!readDepthReduction(cameraSceneItem->getNearZ(), cameraSceneItem->getFarZ(), minimumDistance, maximumDistance))
+			{
+				minimumDistance = 0.0f;
+				maximumDistance = 0.5f;
+			}
 
 			// Compute the split distances based on the partitioning mode
 			float cascadeSplits[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
@@ -209,22 +262,19 @@ namespace Renderer
 				}
 			}
 
-			// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
-			RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, static_cast<const CompositorResourcePassShadowMap&>(getCompositorResourcePass()).getDebugName())
-
-			// Render the meshes to each cascade
-			// -> Shadows should never be rendered via single pass stereo instancing
-			const CompositorContextData shadowCompositorContextData(compositorContextData.getCompositorWorkspaceInstance(), compositorContextData.getCameraSceneItem(), false, compositorContextData.getLightSceneItem(), compositorContextData.getCompositorInstancePassShadowMap());
+			// Compute the MVP matrices from the light's point of view
+			const glm::dvec3& worldSpaceCameraPosition = cameraSceneItem->getWorldSpaceCameraPosition();
+			glm::mat4 depthProjectionMatrices[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+			glm::mat4 depthViewMatrices[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+			glm::mat4 viewSpaceToClipSpaceMatrices[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+			glm::vec3 minimumCascadeExtents[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+			glm::vec3 maximumCascadeExtents[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
 			for (uint8_t cascadeIndex = 0; cascadeIndex < mNumberOfShadowCascades; ++cascadeIndex)
 			{
-				// Scoped debug event
-				RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, ("Shadow cascade " + std::to_string(cascadeIndex)).c_str())
-
-				// Compute the MVP matrix from the light's point of view
-				glm::mat4 depthProjectionMatrix;
-				glm::mat4 depthViewMatrix;
-				glm::vec3 minimumExtents;
-				glm::vec3 maximumExtents;
+				glm::mat4& depthProjectionMatrix = depthProjectionMatrices[cascadeIndex];
+				glm::mat4& depthViewMatrix = depthViewMatrices[cascadeIndex];
+				glm::vec3& minimumExtents = minimumCascadeExtents[cascadeIndex];
+				glm::vec3& maximumExtents = maximumCascadeExtents[cascadeIndex];
 				glm::vec3 cascadeExtents;
 				const float splitDistance = cascadeSplits[cascadeIndex];
 				{
@@ -298,12 +348,15 @@ namespace Renderer
 					const glm::vec3 shadowCameraPosition = frustumCenter + worldSpaceSunlightDirection * -minimumExtents.z;
 
 					// Come up with a new orthographic camera for the shadow caster
-					depthProjectionMatrix = glm::ortho(minimumExtents.x, maximumExtents.x, minimumExtents.y, maximumExtents.y, 0.0f, cascadeExtents.z);
+					// -> When caching static shadow casters, pad the depth range so the cache survives camera movement along the light direction
+					const float depthPadding = mCacheStaticShadowCasters ? cascadeExtents.z * ::detail::STATIC_SHADOW_CACHE_DEPTH_PADDING : 0.0f;
+					depthProjectionMatrix = glm::ortho(minimumExtents.x, maximumExtents.x, minimumExtents.y, maximumExtents.y, -depthPadding, cascadeExtents.z + depthPadding);
 					depthViewMatrix = glm::lookAt(shadowCameraPosition, frustumCenter, rightDirection);
 				}
 
 				// Create the rounding matrix, by projecting the world-space origin and determining the fractional offset in texel space
-				glm::mat4 viewSpaceToClipSpace = depthProjectionMatrix * depthViewMatrix;
+				glm::mat4& viewSpaceToClipSpace = viewSpaceToClipSpaceMatrices[cascadeIndex];
+				viewSpaceToClipSpace = depthProjectionMatrix * depthViewMatrix;
 				if (stabilizeCascades)
 				{
 					glm::vec4 shadowOrigin(0.0f, 0.0f, 0.0f, 1.0f);
@@ -320,10 +373,119 @@ namespace Renderer
 					viewSpaceToClipSpace = depthProjectionMatrix * depthViewMatrix;
 				}
 
+				// Reuse the light space data the cached static shadow caster depth was rendered with as long as the shadow cascade doesn't move too much
+				StaticShadowCache& staticShadowCache = mStaticShadowCaches[cascadeIndex];
+				if (mCacheStaticShadowCasters && staticShadowCache.valid)
+				{
+					// The cached matrices are relative to the camera position at the time the cache was filled
+					const glm::mat4 cachedDepthViewMatrix = staticShadowCache.depthViewMatrix * glm::translate(Math::MAT4_IDENTITY, glm::vec3(worldSpaceCameraPosition - staticShadowCache.worldSpaceCameraPosition));
+					const glm::mat4 cachedViewSpaceToClipSpace = staticShadowCache.depthProjectionMatrix * cachedDepthViewMatrix;
+					if (::detail::canReuseStaticShadowCache(viewSpaceToClipSpace, cachedViewSpaceToClipSpace, mShadowMapSize, mStaticShadowCacheSnapThreshold))
+					{
+						depthProjectionMatrix = staticShadowCache.depthProjectionMatrix;
+						depthViewMatrix = cachedDepthViewMatrix;
+						minimumExtents = staticShadowCache.minimumExtents;
+						maximumExtents = staticShadowCache.maximumExtents;
+						viewSpaceToClipSpace = cachedViewSpaceToClipSpace;
+					}
+					else
+					{
+						staticShadowCache.valid = false;
+					}
+				}
+			}
+
+			// Cull the scene items against all shadow cascades at once, the light is traveling opposite to the sunlight direction
+			// -> Updates the cached shadow cascade masks of the renderable managers
+			SceneCullingManager& sceneCullingManager = cameraSceneItem->getSceneResource().getSceneCullingManager();
+			uint64_t staticShadowCasterSignatures[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES] = {};
+			sceneCullingManager.cullShadowCascades(compositorContextData, -worldSpaceSunlightDirection, viewSpaceToClipSpaceMatrices, mNumberOfShadowCascades, staticShadowCasterSignatures);
+
+			// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
+			RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, static_cast<const CompositorResourcePassShadowMap&>(getCompositorResourcePass()).getDebugName())
+
+			// Reduce the depth map of the camera and copy the result into the readback buffer, it's read back as soon as the readback buffer gets reused
+			// -> Skipped while the GPU isn't done with the readback buffer, see "readDepthReduction()"
+			const uint32_t depthReductionReadbackIndex = mNumberOfDepthReductionDispatches % NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS;
+			if (nullptr != mDepthReductionCompositorInstancePassCompute && !mDepthReductionReadbackPending[depthReductionReadbackIndex])
+			{
+				mDepthReductionCompositorInstancePassCompute->onFillCommandBuffer(nullptr, compositorContextData, commandBuffer);
+				mDepthReductionCompositorInstancePassCompute->onPostCommandBufferDispatch();
+				Rhi::Command::CopyResource::create(commandBuffer, *mDepthReductionReadbackStructuredBufferPtr[depthReductionReadbackIndex], *mDepthReductionStructuredBufferPtr);
+				Rhi::Command::ResetQueryPool::create(commandBuffer, *mDepthReductionQueryPoolPtr, depthReductionReadbackIndex);
+				Rhi::Command::WriteTimestampQuery::create(commandBuffer, *mDepthReductionQueryPoolPtr, depthReductionReadbackIndex);
+				mDepthReductionReadbackPending[depthReductionReadbackIndex] = true;
+				++mNumberOfDepthReductionDispatches;
+			}
+
+			// Render the meshes to each cascade
+			// -> Shadows should never be rendered via single pass stereo instancing
+			const CompositorContextData shadowCompositorContextData(compositorContextData.getCompositorWorkspaceInstance(), compositorContextData.getCameraSceneItem(), false, compositorContextData.getLightSceneItem(), compositorContextData.getCompositorInstancePassShadowMap());
+			for (uint8_t cascadeIndex = 0; cascadeIndex < mNumberOfShadowCascades; ++cascadeIndex)
+			{
+				// Scoped debug event
+				RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, ("Shadow cascade " + std::to_string(cascadeIndex)).c_str())
+
+				const glm::mat4& depthProjectionMatrix = depthProjectionMatrices[cascadeIndex];
+				const glm::mat4& depthViewMatrix = depthViewMatrices[cascadeIndex];
+				const glm::mat4& viewSpaceToClipSpace = viewSpaceToClipSpaceMatrices[cascadeIndex];
+				const glm::vec3& minimumExtents = minimumCascadeExtents[cascadeIndex];
+				const glm::vec3& maximumExtents = maximumCascadeExtents[cascadeIndex];
+				const glm::vec3 cascadeExtents = maximumExtents - minimumExtents;
+				const float splitDistance = cascadeSplits[cascadeIndex];
+				const uint8_t shadowCascadeMask = static_cast<uint8_t>(1u << cascadeIndex);
+				const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId();
+
 				// Set custom camera matrices
 				const_cast<CameraSceneItem*>(cameraSceneItem)->setCustomWorldSpaceToViewSpaceMatrix(depthViewMatrix);
 				const_cast<CameraSceneItem*>(cameraSceneItem)->setCustomViewSpaceToClipSpaceMatrix(depthProjectionMatrix, glm::ortho(minimumExtents.x, maximumExtents.x, minimumExtents.y, maximumExtents.y, cascadeExtents.z, 0.0f));
 
+				// Render static shadow casters into the static shadow caster cache of the shadow cascade if required
+				StaticShadowCache& staticShadowCache = mStaticShadowCaches[cascadeIndex];
+				if (mCacheStaticShadowCasters && (!staticShadowCache.valid || staticShadowCache.staticShadowCasterSignature != staticShadowCasterSignatures[cascadeIndex]))
+				{
+					// Scoped debug event
+					RENDERER_SCOPED_PROFILER_EVENT(renderer.getContext(), commandBuffer, "Render static shadow casters")
+
+					// Set graphics render target
+					RHI_ASSERT(renderer.getContext(), nullptr != mStaticDepthFramebufferPtr[cascadeIndex], "Invalid static depth framebuffer")
+					Rhi::Command::SetGraphicsRenderTarget::create(commandBuffer, mStaticDepthFramebufferPtr[cascadeIndex]);
+
+					// Set the graphics viewport and scissor rectangle
+					Rhi::Command::SetGraphicsViewportAndScissorRectangle::create(commandBuffer, 0, 0, mShadowMapSize, mShadowMapSize);
+
+					{ // Clear the graphics depth buffer of the current render target
+						const float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+						Rhi::Command::ClearGraphics::create(commandBuffer, Rhi::ClearFlag::DEPTH, color);
+					}
+
+					// Render static shadow casters, not only the ones visible to the camera since the cache is reused as long as the shadow cascade doesn't change
+					const SceneItemSet& sceneItemSet = sceneCullingManager.getCullableSceneItemSet();
+					for (uint32_t i = 0; i < sceneItemSet.numberOfSceneItems; ++i)
+					{
+						const RenderableManager* renderableManager = sceneItemSet.sceneItemVector[i]->getRenderableManager();
+						if (nullptr != renderableManager && renderableManager->isVisible() && !renderableManager->getRenderables().empty() && renderableManager->getCastShadows() &&
+							renderableManager->getCachedStaticShadowCaster() && 0 != (renderableManager->getCachedShadowCascadeMask() & shadowCascadeMask))
+						{
+							mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, shadowCompositorContextData, true);
+						}
+					}
+					if (mRenderQueue.getNumberOfDrawCalls() > 0)
+					{
+						mRenderQueue.fillGraphicsCommandBuffer(*mStaticDepthFramebufferPtr[cascadeIndex], shadowCompositorContextData, commandBuffer);
+						mRenderQueue.clear();
+					}
+
+					// Remember the light space data the static shadow caster cache was rendered with
+					staticShadowCache.valid							= true;
+					staticShadowCache.staticShadowCasterSignature	= staticShadowCasterSignatures[cascadeIndex];
+					staticShadowCache.worldSpaceCameraPosition		= worldSpaceCameraPosition;
+					staticShadowCache.depthProjectionMatrix			= depthProjectionMatrix;
+					staticShadowCache.depthViewMatrix				= depthViewMatrix;
+					staticShadowCache.minimumExtents				= minimumExtents;
+					staticShadowCache.maximumExtents				= maximumExtents;
+				}
+
 				{ // Render shadow casters
 					// Scoped debug event
 					RENDERER_SCOPED_PROFILER_EVENT(renderer.getContext(), commandBuffer, "Render shadow casters")
@@ -339,16 +501,14 @@ namespace Renderer
 						Rhi::Command::ClearGraphics::create(commandBuffer, Rhi::ClearFlag::DEPTH, color);
 					}
 
-					// Render shadow casters
-					// TODO(co) Optimization: Do only render stuff which calls into the current shadow cascade
+					// Render shadow casters which are relevant for the current shadow cascade, static shadow casters are inside the static shadow caster cache if it's used
 					RHI_ASSERT(renderer.getContext(), nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
-					const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId();
 					for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
 					{
 						// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
 						// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
 						// really worth to do so since the render queue only considers renderables inside the render queue range anyway.
-						if (renderableManager->getCastShadows())
+						if (renderableManager->getCastShadows() && 0 != (renderableManager->getCachedShadowCascadeMask() & shadowCascadeMask) && (!mCacheStaticShadowCasters || !renderableManager->getCachedStaticShadowCaster()))
 						{
 							mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, shadowCompositorContextData, true);
 						}
@@ -394,7 +554,9 @@ namespace Renderer
 				}
 				mPassData.currentShadowCascadeIndex = cascadeIndex;
 
-				// Calculate exponential variance shadow map (EVSM) and blur if necessary
+				// Calculate exponential variance shadow map (EVSM) and blur if necessary, when using the static shadow caster cache the static shadow caster depth is combined with the dynamic one
+				CompositorInstancePassCompute* depthToExponentialVarianceCompositorInstancePassCompute = mCacheStaticShadowCasters ? mStaticDepthToExponentialVarianceCompositorInstancePassCompute[cascadeIndex] : mDepthToExponentialVarianceCompositorInstancePassCompute;
+				RHI_ASSERT(renderer.getContext(), nullptr != depthToExponentialVarianceCompositorInstancePassCompute, "Invalid depth to exponential variance compositor instance pass compute")
 				const glm::vec4& cascadeScale = mPassData.shadowCascadeScales[cascadeIndex];
 				const float filterSizeX = std::max(mShadowFilterSize * cascadeScale.x, 1.0f);
 				const float filterSizeY = std::max(mShadowFilterSize * cascadeScale.y, 1.0f);
@@ -403,8 +565,8 @@ namespace Renderer
 					// Execute compositor instance pass compute, use cascade index three as intermediate render target
 					RHI_ASSERT(renderer.getContext(), nullptr != mVarianceFramebufferPtr[::detail::INTERMEDIATE_CASCADE_INDEX], "Invalid variance framebuffer")
 					Rhi::Command::SetGraphicsRenderTarget::create(commandBuffer, mVarianceFramebufferPtr[::detail::INTERMEDIATE_CASCADE_INDEX]);
-					mDepthToExponentialVarianceCompositorInstancePassCompute->onFillCommandBuffer(mVarianceFramebufferPtr[::detail::INTERMEDIATE_CASCADE_INDEX], shadowCompositorContextData, commandBuffer);
-					mDepthToExponentialVarianceCompositorInstancePassCompute->onPostCommandBufferDispatch();
+					depthToExponentialVarianceCompositorInstancePassCompute->onFillCommandBuffer(mVarianceFramebufferPtr[::detail::INTERMEDIATE_CASCADE_INDEX], shadowCompositorContextData, commandBuffer);
+					depthToExponentialVarianceCompositorInstancePassCompute->onPostCommandBufferDispatch();
 
 					// Horizontal blur
 					mPassData.shadowFilterSize = filterSizeX;
@@ -424,8 +586,8 @@ namespace Renderer
 					// Execute compositor instance pass compute
 					RHI_ASSERT(renderer.getContext(), nullptr != mVarianceFramebufferPtr[cascadeIndex], "Invalid variance framebuffer")
 					Rhi::Command::SetGraphicsRenderTarget::create(commandBuffer, mVarianceFramebufferPtr[cascadeIndex]);
-					mDepthToExponentialVarianceCompositorInstancePassCompute->onFillCommandBuffer(mVarianceFramebufferPtr[cascadeIndex], shadowCompositorContextData, commandBuffer);
-					mDepthToExponentialVarianceCompositorInstancePassCompute->onPostCommandBufferDispatch();
+					depthToExponentialVarianceCompositorInstancePassCompute->onFillCommandBuffer(mVarianceFramebufferPtr[cascadeIndex], shadowCompositorContextData, commandBuffer);
+					depthToExponentialVarianceCompositorInstancePassCompute->onPostCommandBufferDispatch();
 				}
 			}
 		}
@@ -450,6 +612,9 @@ namespace Renderer
 		mCascadeSplitsLambda(0.99f),
 		mShadowFilterSize(8.0f),
 		mStabilizeCascades(true),
+		mCacheStaticShadowCasters(compositorResourcePassShadowMap.getCacheStaticShadowCasters()),
+		mStaticShadowCacheSnapThreshold(compositorResourcePassShadowMap.getStaticShadowCacheSnapThreshold()),
+		mDepthReduction(true),
 		// Internal
 		mSettingsGenerationCounter(0),
 		mUsedSettingsGenerationCounter(0),
@@ -461,12 +626,24 @@ namespace Renderer
 		mHorizontalBlurCompositorResourcePassCompute(nullptr),
 		mHorizontalBlurCompositorInstancePassCompute(nullptr),
 		mVerticalBlurCompositorResourcePassCompute(nullptr),
-		mVerticalBlurCompositorInstancePassCompute(nullptr)
+		mVerticalBlurCompositorInstancePassCompute(nullptr),
+		mDepthReductionCompositorResourcePassCompute(nullptr),
+		mDepthReductionCompositorInstancePassCompute(nullptr),
+		mNumberOfDepthReductionDispatches(0),
+		mDepthReductionMinimumDepth(1.0f),
+		mDepthReductionMaximumDepth(0.0f)
 	{
 		mPassData.shadowMatrix = Math::MAT4_IDENTITY;
 		for (int i = 0; i < CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES; ++i)
 		{
 			mPassData.shadowCascadeScales[i] = Math::VEC4_ONE;
+			setInvalid(mStaticDepthTextureResourceIds[i]);
+			mStaticDepthToExponentialVarianceCompositorResourcePassCompute[i] = nullptr;
+			mStaticDepthToExponentialVarianceCompositorInstancePassCompute[i] = nullptr;
+		}
+		for (bool& depthReductionReadbackPending : mDepthReductionReadbackPending)
+		{
+			depthReductionReadbackPending = false;
 		}
 		createShadowMapRenderTarget();
 	}
@@ -522,6 +699,82 @@ namespace Renderer
 					mDepthToExponentialVarianceCompositorInstancePassCompute = new CompositorInstancePassCompute(*mDepthToExponentialVarianceCompositorResourcePassCompute, getCompositorNodeInstance());
 				}
 
+				// Static shadow caster cache: Depth shadow map per shadow cascade as well as a depth to exponential variance variant combining it with the dynamic depth shadow map
+				if (mCacheStaticShadowCasters)
+				{
+					const Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::D32_FLOAT;
+					Rhi::IRenderPass* renderPass = rhi.createRenderPass(0, nullptr, textureFormat, 1 RHI_RESOURCE_DEBUG_NAME("Compositor instance pass static depth shadow map"));
+					for (uint8_t cascadeIndex = 0; cascadeIndex < mNumberOfShadowCascades; ++cascadeIndex)
+					{
+						Rhi::ITexture* texture = renderer.getTextureManager().createTexture2D(mShadowMapSize, mShadowMapSize, textureFormat, nullptr, Rhi::TextureFlag::SHADER_RESOURCE | Rhi::TextureFlag::RENDER_TARGET, Rhi::TextureUsage::DEFAULT, numberOfShadowMultisamples, nullptr RHI_RESOURCE_DEBUG_NAME(("Compositor instance pass static depth shadow map " + std::to_string(cascadeIndex)).c_str()));
+
+						{ // Create the framebuffer object (FBO) instance
+							const Rhi::FramebufferAttachment depthStencilFramebufferAttachment(texture);
+							mStaticDepthFramebufferPtr[cascadeIndex] = rhi.createFramebuffer(*renderPass, nullptr, &depthStencilFramebufferAttachment RHI_RESOURCE_DEBUG_NAME(("Compositor instance pass static depth shadow map " + std::to_string(cascadeIndex)).c_str()));
+						}
+
+						// Create texture resource
+						mStaticDepthTextureResourceIds[cascadeIndex] = textureResourceManager.createTextureResourceByAssetId(::detail::STATIC_DEPTH_SHADOW_MAP_TEXTURE_ASSET_IDS[cascadeIndex], *texture);
+
+						{ // Depth to exponential variance combined with the static depth shadow map
+							MaterialProperties materialProperties;
+							materialProperties.setPropertyById(STRING_ID("DepthMap"), MaterialPropertyValue::fromTextureAssetId(::detail::DEPTH_SHADOW_MAP_TEXTURE_ASSET_ID), MaterialProperty::Usage::UNKNOWN, true);
+							materialProperties.setPropertyById(STRING_ID("StaticDepthMap"), MaterialPropertyValue::fromTextureAssetId(::detail::STATIC_DEPTH_SHADOW_MAP_TEXTURE_ASSET_IDS[cascadeIndex]), MaterialProperty::Usage::UNKNOWN, true);
+							materialProperties.setPropertyById(STRING_ID("CombineStaticDepthMap"), MaterialPropertyValue::fromBoolean(true), MaterialProperty::Usage::UNKNOWN, true);
+							materialProperties.setPropertyById(STRING_ID("NumberOfMultisamples"), MaterialPropertyValue::fromInteger((numberOfShadowMultisamples == 1) ? 0 : numberOfShadowMultisamples), MaterialProperty::Usage::UNKNOWN, true);
+							mStaticDepthToExponentialVarianceCompositorResourcePassCompute[cascadeIndex] = new CompositorResourcePassCompute(compositorResourcePassShadowMap.getCompositorTarget(), compositorResourcePassShadowMap.getDepthToExponentialVarianceMaterialBlueprintAssetId(), materialProperties);
+							#if defined(RHI_DEBUG) || defined(RENDERER_PROFILER)
+								mStaticDepthToExponentialVarianceCompositorResourcePassCompute[cascadeIndex]->setDebugName("Static depth to exponential variance");
+							#endif
+							mStaticDepthToExponentialVarianceCompositorInstancePassCompute[cascadeIndex] = new CompositorInstancePassCompute(*mStaticDepthToExponentialVarianceCompositorResourcePassCompute[cascadeIndex], getCompositorNodeInstance());
+						}
+
+						// The static shadow caster cache needs to be filled
+						mStaticShadowCaches[cascadeIndex].valid = false;
+					}
+				}
+
+				// Depth reduction for tightening the shadow cascades to the depth range visible to the camera
+				// -> The depth reduction result is written into a structured buffer which is copied into a host readable readback ring, the depth map needs to use Reversed-Z with a clip space depth value range 0..1
+				// -> A timestamp query per readback buffer is used as fence, there's no dedicated RHI fence
+				const Rhi::Capabilities& capabilities = rhi.getCapabilities();
+				if (mDepthReduction && isValid(compositorResourcePassShadowMap.getDepthReductionMaterialBlueprintAssetId()) && capabilities.computeShader && capabilities.maximumStructuredBufferSize > 0 && capabilities.zeroToOneClipZ)
+				{
+					MaterialProperties materialProperties;
+					materialProperties.setPropertyById(STRING_ID("DepthMap"), MaterialPropertyValue::fromTextureAssetId(compositorResourcePassShadowMap.getDepthReductionDepthMapAssetId()), MaterialProperty::Usage::UNKNOWN, true);
+					Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+					mDepthReductionStructuredBufferPtr = bufferManager.createStructuredBuffer(sizeof(float) * 2 * ::detail::NUMBER_OF_DEPTH_REDUCTION_ELEMENTS, nullptr, Rhi::BufferFlag::UNORDERED_ACCESS, Rhi::BufferUsage::DYNAMIC_COPY, sizeof(float) * 2 RHI_RESOURCE_DEBUG_NAME("Compositor instance pass depth reduction"));
+					mDepthReductionCompositorResourcePassCompute = new CompositorResourcePassCompute(compositorResourcePassShadowMap.getCompositorTarget(), compositorResourcePassShadowMap.getDepthReductionMaterialBlueprintAssetId(), materialProperties);
+					#if defined(RHI_DEBUG) || defined(RENDERER_PROFILER)
+						mDepthReductionCompositorResourcePassCompute->setDebugName("Depth reduction");
+					#endif
+					mDepthReductionCompositorInstancePassCompute = new CompositorInstancePassCompute(*mDepthReductionCompositorResourcePassCompute, getCompositorNodeInstance());
+
+					// Tell the used material resource about the structured buffer receiving the depth reduction result
+					RHI_ASSERT(renderer.getContext(), isValid(mDepthReductionCompositorInstancePassCompute->getMaterialResourceId()), "Invalid depth reduction material resource ID")
+					for (MaterialTechnique* materialTechnique : renderer.getMaterialResourceManager().getById(mDepthReductionCompositorInstancePassCompute->getMaterialResourceId()).getSortedMaterialTechniqueVector())
+					{
+						materialTechnique->setStructuredBufferPtr(0, mDepthReductionStructuredBufferPtr);
+					}
+
+					// Readback ring, initialized with empty depth map tiles so RHI implementations which can't copy structured buffers never deliver a depth range
+					float emptyMinimumMaximumDepths[2 * ::detail::NUMBER_OF_DEPTH_REDUCTION_ELEMENTS];
+					for (uint32_t i = 0; i < ::detail::NUMBER_OF_DEPTH_REDUCTION_ELEMENTS; ++i)
+					{
+						emptyMinimumMaximumDepths[i * 2]	 = 1.0f;
+						emptyMinimumMaximumDepths[i * 2 + 1] = 0.0f;
+					}
+					for (uint8_t i = 0; i < NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS; ++i)
+					{
+						mDepthReductionReadbackStructuredBufferPtr[i] = bufferManager.createStructuredBuffer(sizeof(emptyMinimumMaximumDepths), emptyMinimumMaximumDepths, 0, Rhi::BufferUsage::STREAM_READ, sizeof(float) * 2 RHI_RESOURCE_DEBUG_NAME("Compositor instance pass depth reduction readback"));
+						mDepthReductionReadbackPending[i] = false;
+					}
+					mDepthReductionQueryPoolPtr = rhi.createQueryPool(Rhi::QueryType::TIMESTAMP, NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS RHI_RESOURCE_DEBUG_NAME("Compositor instance pass depth reduction fence"));
+					mNumberOfDepthReductionDispatches = 0;
+					mDepthReductionMinimumDepth = 1.0f;
+					mDepthReductionMaximumDepth = 0.0f;
+				}
+
 				{ // Variance shadow map
 					const Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F;
 					Rhi::ITexture* texture = renderer.getTextureManager().createTexture2DArray(mShadowMapSize, mShadowMapSize, CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES, textureFormat, nullptr, Rhi::TextureFlag::SHADER_RESOURCE | Rhi::TextureFlag::RENDER_TARGET, Rhi::TextureUsage::DEFAULT RHI_RESOURCE_DEBUG_NAME("Compositor instance pass variance shadow map"));
@@ -615,6 +868,31 @@ namespace Renderer
 		delete mVerticalBlurCompositorInstancePassCompute;
 		mVerticalBlurCompositorInstancePassCompute = nullptr;
 
+		// Static shadow caster cache
+		for (uint8_t cascadeIndex = 0; cascadeIndex < CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES; ++cascadeIndex)
+		{
+			delete mStaticDepthToExponentialVarianceCompositorInstancePassCompute[cascadeIndex];
+			mStaticDepthToExponentialVarianceCompositorInstancePassCompute[cascadeIndex] = nullptr;
+			delete mStaticDepthToExponentialVarianceCompositorResourcePassCompute[cascadeIndex];
+			mStaticDepthToExponentialVarianceCompositorResourcePassCompute[cascadeIndex] = nullptr;
+			mStaticDepthFramebufferPtr[cascadeIndex] = nullptr;
+			mStaticShadowCaches[cascadeIndex].valid = false;
+		}
+
+		// Depth reduction
+		delete mDepthReductionCompositorInstancePassCompute;
+		mDepthReductionCompositorInstancePassCompute = nullptr;
+		delete mDepthReductionCompositorResourcePassCompute;
+		mDepthReductionCompositorResourcePassCompute = nullptr;
+		mDepthReductionStructuredBufferPtr = nullptr;
+		for (uint8_t i = 0; i < NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS; ++i)
+		{
+			mDepthReductionReadbackStructuredBufferPtr[i] = nullptr;
+			mDepthReductionReadbackPending[i] = false;
+		}
+		mDepthReductionQueryPoolPtr = nullptr;
+		mNumberOfDepthReductionDispatches = 0;
+
 		// Release the framebuffers and other RHI resources referenced by the framebuffers
 		mDepthFramebufferPtr = nullptr;
 		for (uint8_t cascadeIndex = 0; cascadeIndex < CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES; ++cascadeIndex)
@@ -632,6 +910,14 @@ namespace Renderer
 		}
 		textureResourceManager.destroyTextureResource(mVarianceTextureResourceId);
 		setInvalid(mVarianceTextureResourceId);
+		for (TextureResourceId& staticDepthTextureResourceId : mStaticDepthTextureResourceIds)
+		{
+			if (isValid(staticDepthTextureResourceId))
+			{
+				textureResourceManager.destroyTextureResource(staticDepthTextureResourceId);
+				setInvalid(staticDepthTextureResourceId);
+			}
+		}
 		if (isValid(mIntermediateDepthBlurTextureResourceId))
 		{
 			textureResourceManager.destroyTextureResource(mIntermediateDepthBlurTextureResourceId);
@@ -639,6 +925,65 @@ namespace Renderer
 		}
 	}
 
+	bool CompositorInstancePassShadowMap::readDepthReduction(float nearZ, float farZ, float& minimumDistance, float& maximumDistance)
+	{
+		// The readback buffer which is reused by the upcoming depth reduction holds the oldest result
+		if (nullptr == mDepthReductionCompositorInstancePassCompute)
+		{
+			return false;
+		}
+		const uint32_t readbackIndex = mNumberOfDepthReductionDispatches % NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS;
+		if (mDepthReductionReadbackPending[readbackIndex])
+		{
+			// Poll the fence without waiting for it, in case the GPU isn't done with the readback buffer, yet, keep using the last result
+			Rhi::IRhi& rhi = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getRhi();
+			uint64_t timestamp = 0;
+			if (rhi.getQueryPoolResults(*mDepthReductionQueryPoolPtr, sizeof(uint64_t), reinterpret_cast<uint8_t*>(&timestamp), readbackIndex, 1, 0, 0))
+			{
+				// Finish the depth reduction, empty depth map tiles have a minimum depth which is greater than the maximum depth
+				Rhi::IStructuredBuffer& readbackStructuredBuffer = *mDepthReductionReadbackStructuredBufferPtr[readbackIndex];
+				float minimumDepth = 1.0f;
+				float maximumDepth = 0.0f;
+				Rhi::MappedSubresource mappedSubresource;
+				if (rhi.map(readbackStructuredBuffer, 0, Rhi::MapType::READ, 0, mappedSubresource))
+				{
+					const float* minimumMaximumDepth = static_cast<const float*>(mappedSubresource.data);
+					for (uint32_t i = 0; i < ::detail::NUMBER_OF_DEPTH_REDUCTION_ELEMENTS; ++i, minimumMaximumDepth += 2)
+					{
+						if (minimumMaximumDepth[0] <= minimumMaximumDepth[1])
+						{
+							minimumDepth = std::min(minimumDepth, minimumMaximumDepth[0]);
+							maximumDepth = std::max(maximumDepth, minimumMaximumDepth[1]);
+						}
+					}
+					rhi.unmap(readbackStructuredBuffer, 0);
+				}
+				mDepthReductionMinimumDepth = minimumDepth;
+				mDepthReductionMaximumDepth = maximumDepth;
+				mDepthReductionReadbackPending[readbackIndex] = false;
+			}
+		}
+		const float minimumDepth = mDepthReductionMinimumDepth;
+		const float maximumDepth = mDepthReductionMaximumDepth;
+		if (minimumDepth > maximumDepth)
+		{
+			// No result available, yet, or nothing visible to the camera
+			return false;
+		}
+
+		// Depth to view space depth, the compute shader already undid Reversed-Z so this is the inverse of a left-handed perspective projection with clip space depth value range 0..1
+		const float clipRange = farZ - nearZ;
+		const auto depthToDistance = [nearZ, farZ, clipRange](float depth)
+		{
+			return ((nearZ * farZ) / (farZ - depth * clipRange) - nearZ) / clipRange;
+		};
+		minimumDistance = std::clamp(depthToDistance(minimumDepth) * (1.0f - ::detail::DEPTH_REDUCTION_DISTANCE_MARGIN), 0.0f, 1.0f - ::detail::MINIMUM_DEPTH_REDUCTION_DISTANCE_RANGE);
+		maximumDistance = std::clamp(depthToDistance(maximumDepth) * (1.0f + ::detail::DEPTH_REDUCTION_DISTANCE_MARGIN), minimumDistance + ::detail::MINIMUM_DEPTH_REDUCTION_DISTANCE_RANGE, 1.0f);
+
+		// Done
+		return true;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -180,6 +180,44 @@ namespace Renderer
 			mStabilizeCascades = stabilizeCascades;
 		}
 
+		[[nodiscard]] inline bool getCacheStaticShadowCasters() const
+		{
+			return mCacheStaticShadowCasters;
+		}
+
+		inline void setCacheStaticShadowCasters(bool cacheStaticShadowCasters)
+		{
+			if (mCacheStaticShadowCasters != cacheStaticShadowCasters)
+			{
+				mCacheStaticShadowCasters = cacheStaticShadowCasters;
+				++mSettingsGenerationCounter;
+			}
+		}
+
+		[[nodiscard]] inline float getStaticShadowCacheSnapThreshold() const
+		{
+			return mStaticShadowCacheSnapThreshold;
+		}
+
+		inline void setStaticShadowCacheSnapThreshold(float staticShadowCacheSnapThreshold)
+		{
+			mStaticShadowCacheSnapThreshold = staticShadowCacheSnapThreshold;
+		}
+
+		[[nodiscard]] inline bool getDepthReduction() const
+		{
+			return mDepthReduction;
+		}
+
+		inline void setDepthReduction(bool depthReduction)
+		{
+			if (mDepthReduction != depthReduction)
+			{
+				mDepthReduction = depthReduction;
+				++mSettingsGenerationCounter;
+			}
+		}
+
 		//[-------------------------------------------------------]
 		//[ Internal                                              ]
 		//[-------------------------------------------------------]
@@ -212,19 +250,67 @@ namespace Renderer
 		void createShadowMapRenderTarget();
 		void destroyShadowMapRenderTarget();
 
+		/**
+		*  @brief
+		*    Read back the oldest depth reduction result
+		*
+		*  @remarks
+		*    The oldest readback buffer is only read after its fence signaled that the GPU is done with it. Until then, the last
+		*    read back depth range is used and no new depth reduction is dispatched so the pending readback buffer isn't overwritten.
+		*
+		*  @param[in] nearZ
+		*    Near clip plane of the camera the depth map was rendered with
+		*  @param[in] farZ
+		*    Far clip plane of the camera the depth map was rendered with
+		*  @param[out] minimumDistance
+		*    Receives the minimum distance of the depth range visible to the camera as fraction of the camera clip range, not touched on failure
+		*  @param[out] maximumDistance
+		*    Receives the maximum distance of the depth range visible to the camera as fraction of the camera clip range, not touched on failure
+		*
+		*  @return
+		*    "true" if there's a depth reduction result, else "false" (no depth reduction, no result available yet or nothing visible to the camera)
+		*/
+		[[nodiscard]] bool readDepthReduction(float nearZ, float farZ, float& minimumDistance, float& maximumDistance);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint8_t NUMBER_OF_FRAMES_IN_FLIGHT				   = 2;									///< Maximum number of frames the CPU records ahead of the GPU, matches the swap chain buffering of the RHI implementations
+		static constexpr uint8_t NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS = NUMBER_OF_FRAMES_IN_FLIGHT + 1;	///< The depth reduction result is read back right before the readback buffer is reused, +1 = one more frame so the GPU is usually done with it and the fence doesn't need to be waited for
+
+		/**
+		*  @brief
+		*    Light space data of a shadow cascade the cached static shadow caster depth was rendered with
+		*/
+		struct StaticShadowCache final
+		{
+			bool	   valid = false;
+			uint64_t   staticShadowCasterSignature = 0;	///< Signature of the static shadow casters inside the shadow cascade the cache was rendered with, per compositor instance pass so multiple shadow map passes don't interfere
+			glm::dvec3 worldSpaceCameraPosition;	///< The shadow cascade matrices are camera relative, so the 64 bit world space camera position is needed to reuse them
+			glm::mat4  depthProjectionMatrix;
+			glm::mat4  depthViewMatrix;
+			glm::vec3  minimumExtents;
+			glm::vec3  maximumExtents;
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
 		// Settings
-		bool	 mEnabled;						///< Shadow enabled?
-		uint32_t mShadowMapSize;				///< The shadow map size is usually 512, 1024 or 2048
-		uint8_t  mNumberOfShadowCascades;		///< Number of shadow cascades, usually 4
-		uint8_t  mNumberOfShadowMultisamples;	///< The number of shadow multisamples per pixel (valid values: 1, 2, 4, 8)
-		float	 mCascadeSplitsLambda;			///< Cascade splits lambda
-		float	 mShadowFilterSize;				///< Shadow filter size
-		bool	 mStabilizeCascades;			///< Keeps consistent sizes for each cascade, and snaps each cascade so that they move in texel-sized increments. Reduces temporal aliasing artifacts, but reduces the effective resolution of the cascades. See Valient, M., "Stable Rendering of Cascaded Shadow Maps", In: Engel, W. F ., et al., "ShaderX6: Advanced Rendering Techniques", Charles River Media, 2008, ISBN 1-58450-544-3.
+		bool	 mEnabled;							///< Shadow enabled?
+		uint32_t mShadowMapSize;					///< The shadow map size is usually 512, 1024 or 2048
+		uint8_t  mNumberOfShadowCascades;			///< Number of shadow cascades, usually 4
+		uint8_t  mNumberOfShadowMultisamples;		///< The number of shadow multisamples per pixel (valid values: 1, 2, 4, 8)
+		float	 mCascadeSplitsLambda;				///< Cascade splits lambda
+		float	 mShadowFilterSize;					///< Shadow filter size
+		bool	 mStabilizeCascades;				///< Keeps consistent sizes for each cascade, and snaps each cascade so that they move in texel-sized increments. Reduces temporal aliasing artifacts, but reduces the effective resolution of the cascades. See Valient, M., "Stable Rendering of Cascaded Shadow Maps", In: Engel, W. F ., et al., "ShaderX6: Advanced Rendering Techniques", Charles River Media, 2008, ISBN 1-58450-544-3.
+		bool	 mCacheStaticShadowCasters;			///< Cache the depth of static shadow casters per shadow cascade and only render dynamic shadow casters on top of it as long as the cascade doesn't change?
+		float	 mStaticShadowCacheSnapThreshold;	///< Maximum shadow cascade movement in shadow map texels at which the cached static shadow caster depth is still reused
+		bool	 mDepthReduction;					///< Tighten the shadow cascades to the depth range visible to the camera via depth buffer reduction (sample distribution shadow maps)? Only used if the compositor resource pass provides a depth reduction and the RHI supports compute shaders as well as structured buffers, else a fixed depth range is used.
 		// Internal
 		uint32_t					   mSettingsGenerationCounter;	// Most simple solution to detect settings changes which make internal data invalid
 		uint32_t					   mUsedSettingsGenerationCounter;
@@ -241,6 +327,22 @@ namespace Renderer
 		CompositorInstancePassCompute* mHorizontalBlurCompositorInstancePassCompute;
 		CompositorResourcePassCompute* mVerticalBlurCompositorResourcePassCompute;
 		CompositorInstancePassCompute* mVerticalBlurCompositorInstancePassCompute;
+		// Static shadow caster cache, only used if "mCacheStaticShadowCasters" is set
+		StaticShadowCache			   mStaticShadowCaches[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+		Rhi::IFramebufferPtr		   mStaticDepthFramebufferPtr[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+		TextureResourceId			   mStaticDepthTextureResourceIds[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+		CompositorResourcePassCompute* mStaticDepthToExponentialVarianceCompositorResourcePassCompute[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];	///< Combines the dynamic shadow caster depth with the cached static shadow caster depth of a shadow cascade
+		CompositorInstancePassCompute* mStaticDepthToExponentialVarianceCompositorInstancePassCompute[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+		// Depth reduction, only used if "mDepthReduction" is set and supported
+		Rhi::IStructuredBufferPtr	   mDepthReductionStructuredBufferPtr;	///< Structured buffer the depth reduction compute shader writes into, only accessed by the GPU
+		CompositorResourcePassCompute* mDepthReductionCompositorResourcePassCompute;
+		CompositorInstancePassCompute* mDepthReductionCompositorInstancePassCompute;
+		Rhi::IStructuredBufferPtr	   mDepthReductionReadbackStructuredBufferPtr[NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS];	///< Host readable readback ring the depth reduction result is copied into
+		Rhi::IQueryPoolPtr			   mDepthReductionQueryPoolPtr;	///< Timestamp query per readback buffer written after the copy, used as fence which signals that the readback buffer can be read
+		bool						   mDepthReductionReadbackPending[NUMBER_OF_DEPTH_REDUCTION_READBACK_BUFFERS];	///< Has a depth reduction been dispatched into the readback buffer which wasn't read back, yet?
+		uint32_t					   mNumberOfDepthReductionDispatches;
+		float						   mDepthReductionMinimumDepth;	///< Last read back minimum depth visible to the camera, greater than the maximum depth if there's no result
+		float						   mDepthReductionMaximumDepth;	///< Last read back maximum depth visible to the camera
 
 
 	};
@@ -48,6 +48,10 @@ namespace Renderer
 		mTextureAssetId = passShadowMap->textureAssetId;
 		mDepthToExponentialVarianceMaterialBlueprintAssetId = passShadowMap->depthToExponentialVarianceMaterialBlueprintAssetId;
 		mBlurMaterialBlueprintAssetId = passShadowMap->blurMaterialBlueprintAssetId;
+		mCacheStaticShadowCasters = passShadowMap->cacheStaticShadowCasters;
+		mStaticShadowCacheSnapThreshold = passShadowMap->staticShadowCacheSnapThreshold;
+		mDepthReductionMaterialBlueprintAssetId = passShadowMap->depthReductionMaterialBlueprintAssetId;
+		mDepthReductionDepthMapAssetId = passShadowMap->depthReductionDepthMapAssetId;
 	}
 
 
@@ -87,6 +87,26 @@ namespace Renderer
 			return mBlurMaterialBlueprintAssetId;
 		}
 
+		[[nodiscard]] inline bool getCacheStaticShadowCasters() const
+		{
+			return mCacheStaticShadowCasters;
+		}
+
+		[[nodiscard]] inline float getStaticShadowCacheSnapThreshold() const
+		{
+			return mStaticShadowCacheSnapThreshold;
+		}
+
+		[[nodiscard]] inline AssetId getDepthReductionMaterialBlueprintAssetId() const
+		{
+			return mDepthReductionMaterialBlueprintAssetId;
+		}
+
+		[[nodiscard]] inline AssetId getDepthReductionDepthMapAssetId() const
+		{
+			return mDepthReductionDepthMapAssetId;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ICompositorResourcePass methods ]
@@ -105,7 +125,9 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		inline explicit CompositorResourcePassShadowMap(const CompositorTarget& compositorTarget) :
-			CompositorResourcePassScene(compositorTarget)
+			CompositorResourcePassScene(compositorTarget),
+			mCacheStaticShadowCasters(false),
+			mStaticShadowCacheSnapThreshold(1.0f)
 		{
 			// Nothing here
 		}
@@ -126,6 +148,10 @@ namespace Renderer
 		AssetId	mTextureAssetId;										///< Shadow map texture asset ID
 		AssetId mDepthToExponentialVarianceMaterialBlueprintAssetId;	///< Depth to exponential variance material blueprint asset ID
 		AssetId mBlurMaterialBlueprintAssetId;							///< Blur material blueprint asset ID
+		bool	mCacheStaticShadowCasters;								///< Cache the depth of static shadow casters per shadow cascade and only render dynamic shadow casters on top of it as long as the cascade doesn't change?
+		float	mStaticShadowCacheSnapThreshold;						///< Maximum shadow cascade movement in shadow map texels at which the cached static shadow caster depth is still reused
+		AssetId mDepthReductionMaterialBlueprintAssetId;				///< Depth reduction material blueprint asset ID, if invalid the shadow cascades aren't tightened to the depth range visible to the camera
+		AssetId mDepthReductionDepthMapAssetId;							///< Asset ID of the depth map of the camera to reduce
 
 
 	};
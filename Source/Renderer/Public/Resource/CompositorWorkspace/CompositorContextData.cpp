@@ -44,6 +44,25 @@ namespace Renderer
 		mLightSceneItem(lightSceneItem),
 		mCompositorInstancePassShadowMap(compositorInstancePassShadowMap),
 		mWorldSpaceCameraPosition((nullptr != cameraSceneItem) ? cameraSceneItem->getWorldSpaceCameraPosition() : Math::DVEC3_ZERO),
+		mUniformInstanceBufferManager(nullptr),
+		mTextureInstanceBufferManager(nullptr),
+		mIndirectBufferManager(nullptr),
+		mCurrentlyBoundMaterialBlueprintResource(nullptr),
+		mGlobalComputeSize{0, 0, 0}
+	{
+		// Nothing here
+	}
+
+	CompositorContextData::CompositorContextData(const CompositorContextData& compositorContextData, UniformInstanceBufferManager& uniformInstanceBufferManager, TextureInstanceBufferManager& textureInstanceBufferManager, IndirectBufferManager& indirectBufferManager) :
+		mCompositorWorkspaceInstance(compositorContextData.mCompositorWorkspaceInstance),
+		mCameraSceneItem(compositorContextData.mCameraSceneItem),
+		mSinglePassStereoInstancing(compositorContextData.mSinglePassStereoInstancing),
+		mLightSceneItem(compositorContextData.mLightSceneItem),
+		mCompositorInstancePassShadowMap(compositorContextData.mCompositorInstancePassShadowMap),
+		mWorldSpaceCameraPosition(compositorContextData.mWorldSpaceCameraPosition),
+		mUniformInstanceBufferManager(&uniformInstanceBufferManager),
+		mTextureInstanceBufferManager(&textureInstanceBufferManager),
+		mIndirectBufferManager(&indirectBufferManager),
 		mCurrentlyBoundMaterialBlueprintResource(nullptr),
 		mGlobalComputeSize{0, 0, 0}
 	{
@@ -47,8 +47,11 @@ namespace Renderer
 {
 	class LightSceneItem;
 	class CameraSceneItem;
+	class IndirectBufferManager;
 	class MaterialBlueprintResource;
 	class CompositorWorkspaceInstance;
+	class UniformInstanceBufferManager;
+	class TextureInstanceBufferManager;
 	class CompositorInstancePassShadowMap;
 }
 
@@ -88,6 +91,9 @@ namespace Renderer
 			mLightSceneItem(nullptr),
 			mCompositorInstancePassShadowMap(nullptr),
 			mWorldSpaceCameraPosition(0.0, 0.0, 0.0),
+			mUniformInstanceBufferManager(nullptr),
+			mTextureInstanceBufferManager(nullptr),
+			mIndirectBufferManager(nullptr),
 			mCurrentlyBoundMaterialBlueprintResource(nullptr),
 			mGlobalComputeSize{0, 0, 0}
 		{
@@ -96,6 +102,21 @@ namespace Renderer
 
 		CompositorContextData(const CompositorWorkspaceInstance* compositorWorkspaceInstance, const CameraSceneItem* cameraSceneItem, bool singlePassStereoInstancing = false, const LightSceneItem* lightSceneItem = nullptr, const CompositorInstancePassShadowMap* compositorInstancePassShadowMap = nullptr);
 
+		/**
+		*  @brief
+		*    Constructor for filling command buffers by a worker thread
+		*
+		*  @param[in] compositorContextData
+		*    Compositor context data to copy, the cached render queue data isn't copied
+		*  @param[in] uniformInstanceBufferManager
+		*    Staged uniform instance buffer manager to use instead of the one of the material blueprint resource manager, must stay valid as long as the compositor context data instance exists
+		*  @param[in] textureInstanceBufferManager
+		*    Staged texture instance buffer manager to use instead of the one of the material blueprint resource manager, must stay valid as long as the compositor context data instance exists
+		*  @param[in] indirectBufferManager
+		*    Staged indirect buffer manager to use instead of the one of the render queue, must stay valid as long as the compositor context data instance exists
+		*/
+		CompositorContextData(const CompositorContextData& compositorContextData, UniformInstanceBufferManager& uniformInstanceBufferManager, TextureInstanceBufferManager& textureInstanceBufferManager, IndirectBufferManager& indirectBufferManager);
+
 		inline ~CompositorContextData()
 		{
 			// Nothing here
@@ -132,6 +153,24 @@ namespace Renderer
 			return mWorldSpaceCameraPosition;
 		}
 
+		[[nodiscard]] inline UniformInstanceBufferManager* getUniformInstanceBufferManager() const
+		{
+			// Can be a null pointer, use the one of the material blueprint resource manager in this case
+			return mUniformInstanceBufferManager;
+		}
+
+		[[nodiscard]] inline TextureInstanceBufferManager* getTextureInstanceBufferManager() const
+		{
+			// Can be a null pointer, use the one of the material blueprint resource manager in this case
+			return mTextureInstanceBufferManager;
+		}
+
+		[[nodiscard]] inline IndirectBufferManager* getIndirectBufferManager() const
+		{
+			// Can be a null pointer, use the one of the render queue in this case
+			return mIndirectBufferManager;
+		}
+
 		inline void resetCurrentlyBoundMaterialBlueprintResource() const
 		{
 			mCurrentlyBoundMaterialBlueprintResource = nullptr;
@@ -167,6 +206,10 @@ namespace Renderer
 		const CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;
 		// Cached data
 		glm::dvec3 mWorldSpaceCameraPosition;	///< Cached 64 bit world space position of the camera since often accessed due to camera relative rendering
+		// Buffer managers of a worker thread filling command buffers, null pointers if the global ones are used, don't destroy the instances
+		UniformInstanceBufferManager* mUniformInstanceBufferManager;
+		TextureInstanceBufferManager* mTextureInstanceBufferManager;
+		IndirectBufferManager*		  mIndirectBufferManager;
 		// Cached "Renderer::RenderQueue" data to reduce the number of state changes across different render queue instances (beneficial for complex compositors with e.g. multiple Gaussian blur passes)
 		mutable MaterialBlueprintResource* mCurrentlyBoundMaterialBlueprintResource;
 		mutable uint32_t				   mGlobalComputeSize[3];
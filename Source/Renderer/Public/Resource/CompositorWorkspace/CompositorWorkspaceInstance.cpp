@@ -33,17 +33,30 @@
 #include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorInstancePassShadowMap.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorResourcePassShadowMap.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Clear/CompositorResourcePassClear.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Compute/CompositorInstancePassCompute.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Copy/CompositorResourcePassCopy.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/DebugGui/CompositorResourcePassDebugGui.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/GenerateMipmaps/CompositorResourcePassGenerateMipmaps.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorResourcePassResolveMultisample.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/PassBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/MaterialBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/UniformInstanceBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/TextureInstanceBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialTechnique.h"
+#include "Renderer/Public/Resource/Material/MaterialResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/Core/Thread/ThreadPool.h"
 #include "Renderer/Public/Core/Renderer/FramebufferManager.h"
 #include "Renderer/Public/Core/Renderer/RenderTargetTextureManager.h"
 #ifdef RENDERER_GRAPHICS_DEBUGGER
@@ -55,6 +68,228 @@
 #include "Renderer/Public/IRenderer.h"
 
 #include <algorithm>
+#include <unordered_set>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef std::vector<Renderer::AssetId>											   FrameGraphTextureAssetIds;
+		typedef std::unordered_map<uint32_t, const Renderer::FramebufferSignature*>	FrameGraphFramebufferSignatures;	///< Key = "Renderer::CompositorFramebufferId"
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct FrameGraphPassAccesses final
+		{
+			FrameGraphTextureAssetIds readTextureAssetIds;
+			FrameGraphTextureAssetIds writtenTextureAssetIds;
+			bool					  cullable;	///< "false" if the compositor pass might have side effects beside writing the gathered textures
+		};
+		typedef std::vector<FrameGraphPassAccesses> FrameGraphPassesAccesses;
+
+		struct FrameGraphTextureLifetime final
+		{
+			Renderer::AssetId assetId;
+			uint32_t		  firstPassIndex;	///< Index of the first alive compositor instance pass accessing the render target texture
+			uint32_t		  lastPassIndex;	///< Index of the last alive compositor instance pass accessing the render target texture
+			bool			  aliasable;		///< Transient render target textures only accessed by compositor passes executed each frame can share RHI textures
+		};
+		typedef std::vector<FrameGraphTextureLifetime> FrameGraphTextureLifetimes;
+
+		struct FrameGraphPhysicalTexture final
+		{
+			Renderer::AssetId		 ownerAssetId;	///< Asset ID of the render target texture owning the RHI texture
+			uint32_t				 width;
+			uint32_t				 height;
+			Rhi::TextureFormat::Enum textureFormat;
+			uint8_t					 numberOfMultisamples;
+			bool					 generateMipmaps;
+			uint32_t				 lastPassIndex;	///< Index of the last compositor instance pass using the RHI texture
+		};
+		typedef std::vector<FrameGraphPhysicalTexture> FrameGraphPhysicalTextures;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void addFrameGraphFramebufferAttachments(const FrameGraphFramebufferSignatures& frameGraphFramebufferSignatures, Renderer::CompositorFramebufferId compositorFramebufferId, FrameGraphTextureAssetIds& textureAssetIds)
+		{
+			FrameGraphFramebufferSignatures::const_iterator iterator = frameGraphFramebufferSignatures.find(compositorFramebufferId);
+			if (frameGraphFramebufferSignatures.cend() != iterator)
+			{
+				const Renderer::FramebufferSignature& framebufferSignature = *iterator->second;
+				for (uint8_t i = 0; i < framebufferSignature.getNumberOfColorAttachments(); ++i)
+				{
+					textureAssetIds.push_back(framebufferSignature.getColorFramebufferSignatureAttachment(i).textureAssetId);
+				}
+				const Renderer::AssetId depthStencilTextureAssetId = framebufferSignature.getDepthStencilFramebufferSignatureAttachment().textureAssetId;
+				if (Renderer::isValid(depthStencilTextureAssetId))
+				{
+					textureAssetIds.push_back(depthStencilTextureAssetId);
+				}
+			}
+		}
+
+		void gatherFrameGraphPassAccesses(const Renderer::ICompositorResourcePass& compositorResourcePass, const FrameGraphFramebufferSignatures& frameGraphFramebufferSignatures, FrameGraphPassAccesses& frameGraphPassAccesses)
+		{
+			FrameGraphTextureAssetIds& readTextureAssetIds = frameGraphPassAccesses.readTextureAssetIds;
+			FrameGraphTextureAssetIds& writtenTextureAssetIds = frameGraphPassAccesses.writtenTextureAssetIds;
+			const Renderer::CompositorPassTypeId compositorPassTypeId = compositorResourcePass.getTypeId();
+
+			// Compositor passes which aren't executed each frame have a state across frames the frame graph doesn't know about
+			frameGraphPassAccesses.cullable = (!compositorResourcePass.getSkipFirstExecution() && Renderer::isInvalid(compositorResourcePass.getNumberOfExecutions()));
+
+			{ // Compositor target
+				const Renderer::CompositorTarget& compositorTarget = compositorResourcePass.getCompositorTarget();
+				if (Renderer::isValid(compositorTarget.getCompositorChannelId()))
+				{
+					// Writing into the render target of a compositor channel is an output of the compositor workspace
+					frameGraphPassAccesses.cullable = false;
+				}
+				else if (Renderer::isValid(compositorTarget.getCompositorFramebufferId()))
+				{
+					// Except for clear, compositor passes keep the previous framebuffer content
+					addFrameGraphFramebufferAttachments(frameGraphFramebufferSignatures, compositorTarget.getCompositorFramebufferId(), writtenTextureAssetIds);
+					if (Renderer::CompositorResourcePassClear::TYPE_ID != compositorPassTypeId)
+					{
+						addFrameGraphFramebufferAttachments(frameGraphFramebufferSignatures, compositorTarget.getCompositorFramebufferId(), readTextureAssetIds);
+					}
+				}
+			}
+
+			// Compositor pass type specific texture accesses
+			if (Renderer::CompositorResourcePassClear::TYPE_ID == compositorPassTypeId)
+			{
+				// Nothing here, only the compositor target is accessed
+			}
+			else if (Renderer::CompositorResourcePassCopy::TYPE_ID == compositorPassTypeId)
+			{
+				const Renderer::CompositorResourcePassCopy& compositorResourcePassCopy = static_cast<const Renderer::CompositorResourcePassCopy&>(compositorResourcePass);
+				readTextureAssetIds.push_back(compositorResourcePassCopy.getSourceTextureAssetId());
+				writtenTextureAssetIds.push_back(compositorResourcePassCopy.getDestinationTextureAssetId());
+			}
+			else if (Renderer::CompositorResourcePassGenerateMipmaps::TYPE_ID == compositorPassTypeId)
+			{
+				const Renderer::AssetId textureAssetId = static_cast<const Renderer::CompositorResourcePassGenerateMipmaps&>(compositorResourcePass).getTextureAssetId();
+				readTextureAssetIds.push_back(textureAssetId);
+				writtenTextureAssetIds.push_back(textureAssetId);
+			}
+			else if (Renderer::CompositorResourcePassResolveMultisample::TYPE_ID == compositorPassTypeId)
+			{
+				addFrameGraphFramebufferAttachments(frameGraphFramebufferSignatures, static_cast<const Renderer::CompositorResourcePassResolveMultisample&>(compositorResourcePass).getSourceMultisampleCompositorFramebufferId(), readTextureAssetIds);
+			}
+			else if (Renderer::CompositorResourcePassCompute::TYPE_ID == compositorPassTypeId || Renderer::CompositorResourcePassDebugGui::TYPE_ID == compositorPassTypeId)
+			{
+				// The material properties don't tell whether or not a texture is only read or also used for unordered access writes, so assume both
+				const Renderer::CompositorResourcePassCompute& compositorResourcePassCompute = static_cast<const Renderer::CompositorResourcePassCompute&>(compositorResourcePass);
+				for (const Renderer::MaterialProperty& materialProperty : compositorResourcePassCompute.getMaterialProperties().getSortedPropertyVector())
+				{
+					if (Renderer::MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID == materialProperty.getValueType())
+					{
+						readTextureAssetIds.push_back(materialProperty.getTextureAssetIdValue());
+						writtenTextureAssetIds.push_back(materialProperty.getTextureAssetIdValue());
+					}
+				}
+
+				// The properties of a material asset are unknown at this point in time and the debug GUI is an output by definition
+				if (Renderer::isValid(compositorResourcePassCompute.getMaterialAssetId()) || Renderer::CompositorResourcePassDebugGui::TYPE_ID == compositorPassTypeId)
+				{
+					frameGraphPassAccesses.cullable = false;
+				}
+			}
+			else
+			{
+				// Scene rendering compositor passes access whatever the rendered materials reference
+				if (Renderer::CompositorResourcePassShadowMap::TYPE_ID == compositorPassTypeId)
+				{
+					const Renderer::AssetId depthReductionDepthMapAssetId = static_cast<const Renderer::CompositorResourcePassShadowMap&>(compositorResourcePass).getDepthReductionDepthMapAssetId();
+					if (Renderer::isValid(depthReductionDepthMapAssetId))
+					{
+						readTextureAssetIds.push_back(depthReductionDepthMapAssetId);
+					}
+				}
+				frameGraphPassAccesses.cullable = false;
+			}
+
+			// A compositor pass without written textures must have other side effects, else it wouldn't exist
+			if (writtenTextureAssetIds.empty())
+			{
+				frameGraphPassAccesses.cullable = false;
+			}
+		}
+
+		[[nodiscard]] bool isTransientRenderTargetTexture(const Renderer::RenderTargetTextureManager& renderTargetTextureManager, Renderer::AssetId assetId)
+		{
+			const Renderer::RenderTargetTextureSignature* renderTargetTextureSignature = renderTargetTextureManager.getRenderTargetTextureSignatureByAssetId(assetId);
+			return (nullptr != renderTargetTextureSignature && (renderTargetTextureSignature->getFlags() & Renderer::RenderTargetTextureSignature::Flag::TRANSIENT) != 0);
+		}
+
+		[[nodiscard]] uint64_t getFrameGraphPhysicalTextureNumberOfBytes(const FrameGraphPhysicalTexture& frameGraphPhysicalTexture)
+		{
+			// Estimation, RHI implementations might add padding or alignment
+			const uint32_t numberOfMipmaps = frameGraphPhysicalTexture.generateMipmaps ? Rhi::ITexture::getNumberOfMipmaps(frameGraphPhysicalTexture.width, frameGraphPhysicalTexture.height) : 1u;
+			uint64_t numberOfBytes = 0;
+			for (uint32_t mipmapIndex = 0; mipmapIndex < numberOfMipmaps; ++mipmapIndex)
+			{
+				numberOfBytes += Rhi::TextureFormat::getNumberOfBytesPerSlice(frameGraphPhysicalTexture.textureFormat, std::max(frameGraphPhysicalTexture.width >> mipmapIndex, 1u), std::max(frameGraphPhysicalTexture.height >> mipmapIndex, 1u));
+			}
+			return numberOfBytes * frameGraphPhysicalTexture.numberOfMultisamples;
+		}
+
+		#ifdef RHI_DEBUG
+			[[nodiscard]] bool isTransientRenderTargetTextureReadByMaterialResource(const Renderer::IRenderer& renderer, const Renderer::RenderTargetTextureManager& renderTargetTextureManager, const Renderer::MaterialResource& materialResource)
+			{
+				// Material properties, including the inherited ones which aren't overwritten
+				for (const Renderer::MaterialResource* currentMaterialResource = &materialResource; nullptr != currentMaterialResource; currentMaterialResource = currentMaterialResource->getParentMaterialResource())
+				{
+					for (const Renderer::MaterialProperty& materialProperty : currentMaterialResource->getSortedPropertyVector())
+					{
+						if (Renderer::MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID == materialProperty.getValueType() && materialResource.getPropertyById(materialProperty.getMaterialPropertyId()) == &materialProperty && isTransientRenderTargetTexture(renderTargetTextureManager, materialProperty.getTextureAssetIdValue()))
+						{
+							return true;
+						}
+					}
+				}
+
+				// Static textures of the used material blueprints
+				const Renderer::MaterialBlueprintResourceManager& materialBlueprintResourceManager = renderer.getMaterialBlueprintResourceManager();
+				for (const Renderer::MaterialTechnique* materialTechnique : materialResource.getSortedMaterialTechniqueVector())
+				{
+					const Renderer::MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
+					if (nullptr != materialBlueprintResource)
+					{
+						for (const Renderer::MaterialBlueprintResource::Texture& texture : materialBlueprintResource->getTextures())
+						{
+							if (Renderer::MaterialProperty::Usage::STATIC == texture.materialProperty.getUsage() && isTransientRenderTargetTexture(renderTargetTextureManager, texture.materialProperty.getTextureAssetIdValue()))
+							{
+								return true;
+							}
+						}
+					}
+				}
+
+				// Done
+				return false;
+			}
+		#endif
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -76,7 +311,11 @@ namespace Renderer
 		mRenderTargetHeight(getInvalid<uint32_t>()),
 		mCompositorWorkspaceResourceId(getInvalid<CompositorWorkspaceResourceId>()),
 		mFramebufferManagerInitialized(false),
+		mNumberOfCulledCompositorInstancePasses(0),
+		mNumberOfAliasedRenderTargetTextures(0),
+		mNumberOfAliasedRenderTargetTextureBytes(0),
 		mExecutionRenderTarget(nullptr),
+		mNumberOfEliminatedCommandPackets(0),
 		mCompositorInstancePassShadowMap(nullptr)
 		#ifdef RHI_STATISTICS
 			, mPipelineStatisticsQueryPoolPtr((renderer.getRhi().getNameId() == Rhi::NameId::OPENGL && strstr(renderer.getRhi().getCapabilities().deviceName, "AMD ") != nullptr) ? nullptr : renderer.getRhi().createQueryPool(Rhi::QueryType::PIPELINE_STATISTICS, 2 RHI_RESOURCE_DEBUG_NAME("Compositor workspace instance"))),	// TODO(co) When using OpenGL "GL_ARB_pipeline_statistics_query" features, "glCopyImageSubData()" will horribly stall/freeze on Windows using AMD Radeon 18.12.2 (tested on 16 December 2018). No issues with NVIDIA GeForce game ready driver 417.35 (release data 12/12/2018).
@@ -92,6 +331,7 @@ namespace Renderer
 	{
 		// Cleanup
 		destroySequentialCompositorNodeInstances();
+		destroyWorkers();
 	}
 
 	void CompositorWorkspaceInstance::setNumberOfMultisamples(uint8_t numberOfMultisamples)
@@ -159,6 +399,11 @@ namespace Renderer
 		// Clear the command buffer from the previous frame
 		// -> We didn't request a clear together with the dispatch so e.g. "Renderer::DebugGuiHelper::drawMetricsWindow()" can show some command buffer statistics
 		mCommandBuffer.clear();
+		mNumberOfEliminatedCommandPackets = 0;
+		for (CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			compositorNodeInstance->mCommandBuffer.clear();
+		}
 
 		// We could directly clear the render queue index ranges renderable managers as soon as the frame rendering has been finished to avoid evil dangling pointers,
 		// but on the other hand a responsible user might be interested in the potentially on-screen renderable managers to perform work which should only be performed
@@ -170,6 +415,9 @@ namespace Renderer
 		const CompositorWorkspaceResource* compositorWorkspaceResource = mRenderer.getCompositorWorkspaceResourceManager().tryGetById(mCompositorWorkspaceResourceId);
 		if (nullptr != compositorWorkspaceResource && compositorWorkspaceResource->getLoadingState() == IResource::LoadingState::LOADED)
 		{
+			// Material property changes done after the renderer update must reach the child material resources before rendering
+			mRenderer.getMaterialResourceManager().propagatePendingMaterialProperties();
+
 			// Tell the global material properties managed by the material blueprint resource manager about the number of multisamples
 			// -> Since there can be multiple compositor workspace instances we can't do this once inside "Renderer::CompositorWorkspaceInstance::setNumberOfMultisamples()"
 			MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
@@ -252,15 +500,21 @@ namespace Renderer
 					RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), mCommandBuffer, "Compositor workspace")
 
 					// Fill command buffer
-					Rhi::IRenderTarget* currentRenderTarget = &renderTarget;
-					for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+					// -> Each compositor node instance records into its own command buffer, the command buffers are dispatched in-order via the compositor workspace instance command buffer
+					// -> The compositor node instance command buffers might be filled concurrently, see "Renderer::CompositorWorkspaceInstance::fillCompositorNodeInstanceCommandBuffers()"
+					fillCompositorNodeInstanceCommandBuffers(renderTarget, compositorContextData);
+					for (CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
 					{
-						currentRenderTarget = &compositorNodeInstance->fillCommandBuffer(*currentRenderTarget, compositorContextData, mCommandBuffer);
+						if (!compositorNodeInstance->mCommandBuffer.isEmpty())
+						{
+							Rhi::Command::DispatchCommandBuffer::create(mCommandBuffer, &compositorNodeInstance->mCommandBuffer);
+						}
 					}
 				}
 
 				{ // Dispatch command buffer to the RHI implementation
 					// The command buffer is about to be dispatched, inform everyone who cares about this
+					onPreCommandBufferDispatch();
 					materialBlueprintResourceManager.onPreCommandBufferDispatch();
 
 					// Dispatch command buffer to the RHI implementation
@@ -480,6 +734,10 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), !mFramebufferManagerInitialized, "Framebuffer manager is already initialized")
 		CompositorWorkspaceResourceManager& compositorWorkspaceResourceManager = mRenderer.getCompositorWorkspaceResourceManager();
 
+		// Cull dead compositor instance passes and set up render target texture aliasing before any RHI resource gets created
+		std::vector<AssetId> referencedRenderTargetTextureAssetIds;
+		compileFrameGraph(mainRenderTarget, referencedRenderTargetTextureAssetIds);
+
 		{ // Framebuffers
 			FramebufferManager& framebufferManager = compositorWorkspaceResourceManager.getFramebufferManager();
 			for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
@@ -487,7 +745,7 @@ namespace Renderer
 				for (ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
 				{
 					const CompositorFramebufferId compositorFramebufferId = compositorInstancePass->getCompositorResourcePass().getCompositorTarget().getCompositorFramebufferId();
-					if (isValid(compositorFramebufferId))
+					if (!compositorInstancePass->mCulled && isValid(compositorFramebufferId))
 					{
 						compositorInstancePass->mRenderTarget = framebufferManager.getFramebufferByCompositorFramebufferId(compositorFramebufferId, mainRenderTarget, mCurrentlyUsedNumberOfMultisamples, mResolutionScale);
 					}
@@ -504,7 +762,8 @@ namespace Renderer
 				for (const CompositorRenderTargetTexture& compositorRenderTargetTexture : compositorNodeResource.getRenderTargetTextures())
 				{
 					const RenderTargetTextureSignature& renderTargetTextureSignature = compositorRenderTargetTexture.getRenderTargetTextureSignature();
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) == 0)
+					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) == 0 &&
+						((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::TRANSIENT) == 0 || std::binary_search(referencedRenderTargetTextureAssetIds.cbegin(), referencedRenderTargetTextureAssetIds.cend(), compositorRenderTargetTexture.getAssetId())))
 					{
 						// Force creating the texture in case it doesn't exist yet
 						[[maybe_unused]] Rhi::ITexture* texture = renderTargetTextureManager.getTextureByAssetId(compositorRenderTargetTexture.getAssetId(), mainRenderTarget, mCurrentlyUsedNumberOfMultisamples, mResolutionScale, nullptr);
@@ -525,8 +784,12 @@ namespace Renderer
 			{
 				compositorInstancePass->mRenderTarget = nullptr;
 				compositorInstancePass->mNumberOfExecutionRequests = 0;
+				compositorInstancePass->mCulled = false;
 			}
 		}
+		mNumberOfCulledCompositorInstancePasses = 0;
+		mNumberOfAliasedRenderTargetTextures = 0;
+		mNumberOfAliasedRenderTargetTextureBytes = 0;
 
 		// Destroy RHI resources of framebuffers and render target textures
 		CompositorWorkspaceResourceManager& compositorWorkspaceResourceManager = mRenderer.getCompositorWorkspaceResourceManager();
@@ -543,6 +806,192 @@ namespace Renderer
 		mFramebufferManagerInitialized = false;
 	}
 
+	void CompositorWorkspaceInstance::compileFrameGraph(const Rhi::IRenderTarget& mainRenderTarget, std::vector<AssetId>& referencedRenderTargetTextureAssetIds)
+	{
+		RenderTargetTextureManager& renderTargetTextureManager = mRenderer.getCompositorWorkspaceResourceManager().getRenderTargetTextureManager();
+		const CompositorNodeResourceManager& compositorNodeResourceManager = mRenderer.getCompositorNodeResourceManager();
+
+		// Gather the framebuffer signatures of all compositor nodes
+		::detail::FrameGraphFramebufferSignatures frameGraphFramebufferSignatures;
+		for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			for (const CompositorFramebuffer& compositorFramebuffer : compositorNodeResourceManager.getById(compositorNodeInstance->getCompositorNodeResourceId()).getFramebuffers())
+			{
+				frameGraphFramebufferSignatures.emplace(compositorFramebuffer.getCompositorFramebufferId(), &compositorFramebuffer.getFramebufferSignature());
+			}
+		}
+
+		// Gather the texture accesses of the compositor instance passes in execution order
+		std::vector<ICompositorInstancePass*> compositorInstancePasses;
+		::detail::FrameGraphPassesAccesses frameGraphPassesAccesses;
+		for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			for (ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
+			{
+				compositorInstancePasses.push_back(compositorInstancePass);
+				frameGraphPassesAccesses.emplace_back();
+				::detail::gatherFrameGraphPassAccesses(compositorInstancePass->getCompositorResourcePass(), frameGraphFramebufferSignatures, frameGraphPassesAccesses.back());
+			}
+		}
+		const uint32_t numberOfCompositorInstancePasses = static_cast<uint32_t>(compositorInstancePasses.size());
+
+		#ifdef RHI_DEBUG
+			{ // Transient render target textures must only be accessed by the compositor passes referencing them explicitly, the frame graph knows nothing about other readers
+				// -> Materials of compute and debug GUI compositor passes are allowed to read transient render target textures, including their parent material
+				// -> Only the material resources existing at this point in time can be checked
+				const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
+				std::unordered_set<MaterialResourceId> compositorMaterialResourceIds;
+				for (const ICompositorInstancePass* compositorInstancePass : compositorInstancePasses)
+				{
+					const CompositorPassTypeId compositorPassTypeId = compositorInstancePass->getCompositorResourcePass().getTypeId();
+					if (CompositorResourcePassCompute::TYPE_ID == compositorPassTypeId || CompositorResourcePassDebugGui::TYPE_ID == compositorPassTypeId)
+					{
+						const MaterialResourceId materialResourceId = static_cast<const CompositorInstancePassCompute*>(compositorInstancePass)->getMaterialResourceId();
+						const MaterialResource* materialResource = materialResourceManager.tryGetById(materialResourceId);
+						if (nullptr != materialResource)
+						{
+							compositorMaterialResourceIds.insert(materialResourceId);
+							compositorMaterialResourceIds.insert(materialResource->getParentMaterialResourceId());
+						}
+					}
+				}
+				const uint32_t numberOfMaterialResources = materialResourceManager.getNumberOfResources();
+				for (uint32_t i = 0; i < numberOfMaterialResources; ++i)
+				{
+					const MaterialResource& materialResource = static_cast<const MaterialResource&>(materialResourceManager.getResourceByIndex(i));
+					RHI_ASSERT(mRenderer.getContext(), compositorMaterialResourceIds.find(materialResource.getId()) != compositorMaterialResourceIds.cend() || !::detail::isTransientRenderTargetTextureReadByMaterialResource(mRenderer, renderTargetTextureManager, materialResource), "Transient render target textures must not be read by materials outside of compute or debug GUI compositor passes")
+				}
+			}
+		#endif
+
+		{ // Dead compositor instance pass culling
+			// -> Walk backwards: A compositor instance pass is alive if it can't be culled, writes a non-transient texture or writes a transient render target texture read by a later alive compositor instance pass
+			std::unordered_set<uint32_t> readTransientAssetIds;	// Key = "Renderer::AssetId", only transient render target textures read by alive compositor instance passes
+			mNumberOfCulledCompositorInstancePasses = 0;
+			for (uint32_t passIndex = numberOfCompositorInstancePasses; passIndex > 0; --passIndex)
+			{
+				const ::detail::FrameGraphPassAccesses& frameGraphPassAccesses = frameGraphPassesAccesses[passIndex - 1];
+				bool alive = !frameGraphPassAccesses.cullable;
+				for (const AssetId& assetId : frameGraphPassAccesses.writtenTextureAssetIds)
+				{
+					if (!::detail::isTransientRenderTargetTexture(renderTargetTextureManager, assetId) || readTransientAssetIds.find(assetId) != readTransientAssetIds.cend())
+					{
+						alive = true;
+						break;
+					}
+				}
+				if (alive)
+				{
+					for (const AssetId& assetId : frameGraphPassAccesses.readTextureAssetIds)
+					{
+						if (::detail::isTransientRenderTargetTexture(renderTargetTextureManager, assetId))
+						{
+							readTransientAssetIds.insert(assetId);
+						}
+					}
+				}
+				else
+				{
+					++mNumberOfCulledCompositorInstancePasses;
+				}
+				compositorInstancePasses[passIndex - 1]->mCulled = !alive;
+			}
+		}
+
+		// Gather the render target texture lifetimes, sorted by the first alive compositor instance pass accessing the render target texture
+		::detail::FrameGraphTextureLifetimes frameGraphTextureLifetimes;
+		{
+			std::unordered_map<uint32_t, uint32_t> assetIdToLifetimeIndex;	// Key = "Renderer::AssetId"
+			for (uint32_t passIndex = 0; passIndex < numberOfCompositorInstancePasses; ++passIndex)
+			{
+				if (compositorInstancePasses[passIndex]->mCulled)
+				{
+					continue;
+				}
+				const ::detail::FrameGraphPassAccesses& frameGraphPassAccesses = frameGraphPassesAccesses[passIndex];
+				const ICompositorResourcePass& compositorResourcePass = compositorInstancePasses[passIndex]->getCompositorResourcePass();
+				const bool executedEachFrame = (!compositorResourcePass.getSkipFirstExecution() && isInvalid(compositorResourcePass.getNumberOfExecutions()));
+				for (const ::detail::FrameGraphTextureAssetIds* textureAssetIds : { &frameGraphPassAccesses.readTextureAssetIds, &frameGraphPassAccesses.writtenTextureAssetIds })
+				{
+					for (const AssetId& assetId : *textureAssetIds)
+					{
+						const RenderTargetTextureSignature* renderTargetTextureSignature = renderTargetTextureManager.getRenderTargetTextureSignatureByAssetId(assetId);
+						if (nullptr != renderTargetTextureSignature)
+						{
+							std::unordered_map<uint32_t, uint32_t>::const_iterator iterator = assetIdToLifetimeIndex.find(assetId);
+							if (assetIdToLifetimeIndex.cend() == iterator)
+							{
+								iterator = assetIdToLifetimeIndex.emplace(assetId, static_cast<uint32_t>(frameGraphTextureLifetimes.size())).first;
+								frameGraphTextureLifetimes.push_back({ assetId, passIndex, passIndex, (renderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::TRANSIENT) != 0 });
+							}
+							::detail::FrameGraphTextureLifetime& frameGraphTextureLifetime = frameGraphTextureLifetimes[iterator->second];
+							frameGraphTextureLifetime.lastPassIndex = passIndex;
+							if (!executedEachFrame)
+							{
+								frameGraphTextureLifetime.aliasable = false;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		{ // Let transient render target textures with non-overlapping lifetimes and identical resolved texture properties share RHI textures
+			// -> The RHI has no concept of placing textures into shared memory, so aliasing is done on RHI texture level
+			::detail::FrameGraphPhysicalTextures frameGraphPhysicalTextures;
+			mNumberOfAliasedRenderTargetTextures = 0;
+			mNumberOfAliasedRenderTargetTextureBytes = 0;
+			for (const ::detail::FrameGraphTextureLifetime& frameGraphTextureLifetime : frameGraphTextureLifetimes)
+			{
+				if (!frameGraphTextureLifetime.aliasable)
+				{
+					continue;
+				}
+
+				// Resolve the texture properties
+				const RenderTargetTextureSignature& renderTargetTextureSignature = *renderTargetTextureManager.getRenderTargetTextureSignatureByAssetId(frameGraphTextureLifetime.assetId);
+				::detail::FrameGraphPhysicalTexture frameGraphPhysicalTexture;
+				frameGraphPhysicalTexture.ownerAssetId		   = frameGraphTextureLifetime.assetId;
+				RenderTargetTextureManager::getTextureWidthAndHeight(renderTargetTextureSignature, mainRenderTarget, mResolutionScale, frameGraphPhysicalTexture.width, frameGraphPhysicalTexture.height);
+				frameGraphPhysicalTexture.textureFormat		   = renderTargetTextureSignature.getTextureFormat();
+				frameGraphPhysicalTexture.numberOfMultisamples = ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? mCurrentlyUsedNumberOfMultisamples : static_cast<uint8_t>(1);
+				frameGraphPhysicalTexture.generateMipmaps	   = ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0);
+				frameGraphPhysicalTexture.lastPassIndex		   = frameGraphTextureLifetime.lastPassIndex;
+
+				// Reuse a RHI texture which is no longer used when the render target texture is accessed the first time
+				bool aliased = false;
+				for (::detail::FrameGraphPhysicalTexture& usedFrameGraphPhysicalTexture : frameGraphPhysicalTextures)
+				{
+					if (usedFrameGraphPhysicalTexture.lastPassIndex < frameGraphTextureLifetime.firstPassIndex &&
+						usedFrameGraphPhysicalTexture.width == frameGraphPhysicalTexture.width && usedFrameGraphPhysicalTexture.height == frameGraphPhysicalTexture.height &&
+						usedFrameGraphPhysicalTexture.textureFormat == frameGraphPhysicalTexture.textureFormat &&
+						usedFrameGraphPhysicalTexture.numberOfMultisamples == frameGraphPhysicalTexture.numberOfMultisamples &&
+						usedFrameGraphPhysicalTexture.generateMipmaps == frameGraphPhysicalTexture.generateMipmaps &&
+						renderTargetTextureManager.setRenderTargetTextureAlias(frameGraphTextureLifetime.assetId, usedFrameGraphPhysicalTexture.ownerAssetId))
+					{
+						usedFrameGraphPhysicalTexture.lastPassIndex = frameGraphTextureLifetime.lastPassIndex;
+						++mNumberOfAliasedRenderTargetTextures;
+						mNumberOfAliasedRenderTargetTextureBytes += ::detail::getFrameGraphPhysicalTextureNumberOfBytes(frameGraphPhysicalTexture);
+						aliased = true;
+						break;
+					}
+				}
+				if (!aliased)
+				{
+					frameGraphPhysicalTextures.push_back(frameGraphPhysicalTexture);
+				}
+			}
+		}
+
+		// Tell the caller about the render target textures which are accessed by alive compositor instance passes
+		referencedRenderTargetTextureAssetIds.reserve(frameGraphTextureLifetimes.size());
+		for (const ::detail::FrameGraphTextureLifetime& frameGraphTextureLifetime : frameGraphTextureLifetimes)
+		{
+			referencedRenderTargetTextureAssetIds.push_back(frameGraphTextureLifetime.assetId);
+		}
+		std::sort(referencedRenderTargetTextureAssetIds.begin(), referencedRenderTargetTextureAssetIds.end());
+	}
+
 	void CompositorWorkspaceInstance::clearRenderQueueIndexRangesRenderableManagers()
 	{
 		// Forget about all previously gathered renderable managers
@@ -552,6 +1001,148 @@ namespace Renderer
 		}
 	}
 
+	void CompositorWorkspaceInstance::fillCompositorNodeInstanceCommandBuffers(Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData)
+	{
+		// Worker threads create RHI resources like resource groups or pipeline states, so concurrent filling requires native RHI multithreading
+		// -> The staged buffer managers require uniform and texture buffer support
+		// -> GPU profiler samples are taken while filling the command buffers, so there's no concurrent filling if the profiler is enabled
+		bool concurrentFilling = false;
+		#ifndef RENDERER_PROFILER
+		{
+			const Rhi::Capabilities& capabilities = mRenderer.getRhi().getCapabilities();
+			concurrentFilling = (capabilities.nativeMultithreading && capabilities.maximumUniformBufferSize > 0 && capabilities.maximumTextureBufferSize > 0);
+		}
+		#endif
+
+		// Process the compositor node instances in-order
+		// -> Compositor node instances which can't be filled concurrently are filled by the render thread, they might e.g. update data following compositor node instances depend on
+		// -> Runs of consecutive compositor node instances which can be filled concurrently are distributed in-order across the worker threads
+		DefaultThreadPool& defaultThreadPool = mRenderer.getDefaultThreadPool();
+		const size_t numberOfCompositorNodeInstances = mSequentialCompositorNodeInstances.size();
+		Rhi::IRenderTarget* currentRenderTarget = &renderTarget;
+		size_t compositorNodeInstanceIndex = 0;
+		while (compositorNodeInstanceIndex < numberOfCompositorNodeInstances)
+		{
+			// Get the number of consecutive compositor node instances which can be filled concurrently
+			size_t itemCount = 0;
+			if (concurrentFilling)
+			{
+				while (compositorNodeInstanceIndex + itemCount < numberOfCompositorNodeInstances && mSequentialCompositorNodeInstances[compositorNodeInstanceIndex + itemCount]->canFillCommandBufferConcurrently())
+				{
+					++itemCount;
+				}
+			}
+			size_t splitCount = 1;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = (itemCount > 1) ? defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount) : 1;
+			if (1 == threadCount)
+			{
+				// Just fill the compositor node instance directly inside the render thread, not worth the additional threading effort
+				CompositorNodeInstance* compositorNodeInstance = mSequentialCompositorNodeInstances[compositorNodeInstanceIndex];
+				Rhi::CommandBuffer& compositorNodeCommandBuffer = compositorNodeInstance->mCommandBuffer;
+				currentRenderTarget = &compositorNodeInstance->fillCommandBuffer(*currentRenderTarget, compositorContextData, compositorNodeCommandBuffer);
+				if (!compositorNodeCommandBuffer.isEmpty())
+				{
+					// Remove redundant binds which slipped through across render queue fills and merge adjacent indirect draws
+					mNumberOfEliminatedCommandPackets += compositorNodeCommandBuffer.removeRedundantCommands();
+				}
+				++compositorNodeInstanceIndex;
+			}
+			else
+			{
+				// Determine the RHI render target of each compositor node instance up-front, filling a compositor node instance updates the execution requests of its compositor instance passes
+				mCompositorNodeInstanceRenderTargets.resize(numberOfCompositorNodeInstances);
+				for (size_t i = compositorNodeInstanceIndex; i < compositorNodeInstanceIndex + itemCount; ++i)
+				{
+					mCompositorNodeInstanceRenderTargets[i] = currentRenderTarget;
+					currentRenderTarget = &mSequentialCompositorNodeInstances[i]->getOutputRenderTarget(*currentRenderTarget);
+				}
+
+				{ // Worker threads can't map RHI resources, so upload the dirty material buffer slots up-front
+					const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+					const uint32_t numberOfResources = materialBlueprintResourceManager.getNumberOfResources();
+					for (uint32_t i = 0; i < numberOfResources; ++i)
+					{
+						MaterialBufferManager* materialBufferManager = materialBlueprintResourceManager.getByIndex(i).getMaterialBufferManager();
+						if (nullptr != materialBufferManager)
+						{
+							materialBufferManager->uploadDirtySlots();
+						}
+					}
+				}
+
+				// Create the worker data, if required
+				while (mWorkers.size() < threadCount)
+				{
+					mWorkers.push_back({new UniformInstanceBufferManager(mRenderer, true), new TextureInstanceBufferManager(mRenderer, true), new IndirectBufferManager(mRenderer, true), 0, 0, 0});
+				}
+
+				// Multi-threaded
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					Worker& worker = mWorkers[threadIndex];
+					worker.startIndex = compositorNodeInstanceIndex;
+					worker.endIndex = compositorNodeInstanceIndex + numberOfItemsToProcess;
+					worker.numberOfEliminatedCommandPackets = 0;
+					defaultThreadPool.queueTask(std::bind(&CompositorWorkspaceInstance::fillConcurrentCompositorNodeInstanceCommandBuffers, this, threadIndex, std::cref(compositorContextData)));
+					itemCount -= splitCount;
+					compositorNodeInstanceIndex += numberOfItemsToProcess;
+				}
+
+				// Wait that all worker threads have done their part of the work
+				defaultThreadPool.process();
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					mNumberOfEliminatedCommandPackets += mWorkers[threadIndex].numberOfEliminatedCommandPackets;
+				}
+
+				// The worker threads bound their own material blueprint resources
+				compositorContextData.resetCurrentlyBoundMaterialBlueprintResource();
+			}
+		}
+	}
+
+	void CompositorWorkspaceInstance::fillConcurrentCompositorNodeInstanceCommandBuffers(size_t workerIndex, const CompositorContextData& compositorContextData)
+	{
+		// The currently bound material blueprint resource is tracked per worker thread, the compositor node instances of a worker are consecutive in dispatch order
+		Worker& worker = mWorkers[workerIndex];
+		const CompositorContextData workerCompositorContextData(compositorContextData, *worker.uniformInstanceBufferManager, *worker.textureInstanceBufferManager, *worker.indirectBufferManager);
+		for (size_t i = worker.startIndex; i < worker.endIndex; ++i)
+		{
+			CompositorNodeInstance* compositorNodeInstance = mSequentialCompositorNodeInstances[i];
+			Rhi::CommandBuffer& compositorNodeCommandBuffer = compositorNodeInstance->mCommandBuffer;
+			[[maybe_unused]] const Rhi::IRenderTarget& outputRenderTarget = compositorNodeInstance->fillCommandBuffer(*mCompositorNodeInstanceRenderTargets[i], workerCompositorContextData, compositorNodeCommandBuffer);
+			RHI_ASSERT(mRenderer.getContext(), i + 1 >= worker.endIndex || &outputRenderTarget == mCompositorNodeInstanceRenderTargets[i + 1], "The up-front determined compositor node instance render target doesn't match the filled one")
+			if (!compositorNodeCommandBuffer.isEmpty())
+			{
+				// Remove redundant binds which slipped through across render queue fills and merge adjacent indirect draws
+				worker.numberOfEliminatedCommandPackets += compositorNodeCommandBuffer.removeRedundantCommands();
+			}
+		}
+	}
+
+	void CompositorWorkspaceInstance::onPreCommandBufferDispatch()
+	{
+		// Update the RHI resources staged by the worker threads
+		for (Worker& worker : mWorkers)
+		{
+			worker.uniformInstanceBufferManager->onPreCommandBufferDispatch();
+			worker.textureInstanceBufferManager->onPreCommandBufferDispatch();
+			worker.indirectBufferManager->onPreCommandBufferDispatch();
+		}
+	}
+
+	void CompositorWorkspaceInstance::destroyWorkers()
+	{
+		for (Worker& worker : mWorkers)
+		{
+			delete worker.uniformInstanceBufferManager;
+			delete worker.textureInstanceBufferManager;
+			delete worker.indirectBufferManager;
+		}
+		mWorkers.clear();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -41,8 +41,12 @@ namespace Renderer
 	class IRenderer;
 	class ISceneItem;
 	class RenderableManager;
+	class CompositorContextData;
+	class IndirectBufferManager;
 	class CompositorNodeInstance;
 	class ICompositorInstancePass;
+	class UniformInstanceBufferManager;
+	class TextureInstanceBufferManager;
 	class CompositorInstancePassShadowMap;
 }
 
@@ -157,6 +161,26 @@ namespace Renderer
 			return mCommandBuffer;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfEliminatedCommandPackets() const	// Number of redundant command packets removed during the last execution
+		{
+			return mNumberOfEliminatedCommandPackets;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfCulledCompositorInstancePasses() const	// Number of compositor instance passes which don't contribute to the output and are hence not executed
+		{
+			return mNumberOfCulledCompositorInstancePasses;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfAliasedRenderTargetTextures() const	// Number of transient render target textures sharing the RHI texture of another transient render target texture
+		{
+			return mNumberOfAliasedRenderTargetTextures;
+		}
+
+		[[nodiscard]] inline uint64_t getNumberOfAliasedRenderTargetTextureBytes() const	// Estimated number of RHI texture bytes saved by render target texture aliasing
+		{
+			return mNumberOfAliasedRenderTargetTextureBytes;
+		}
+
 		#ifdef RHI_STATISTICS
 			[[nodiscard]] inline const Rhi::PipelineStatisticsQueryResult& getPipelineStatisticsQueryResult() const
 			{
@@ -182,8 +206,77 @@ namespace Renderer
 		void destroySequentialCompositorNodeInstances();
 		void createFramebuffersAndRenderTargetTextures(const Rhi::IRenderTarget& mainRenderTarget);
 		void destroyFramebuffersAndRenderTargetTextures(bool clearManagers = false);
+
+		/**
+		*  @brief
+		*    Compile the sequential compositor instance passes into a frame graph
+		*
+		*  @param[in] mainRenderTarget
+		*    Main render target, used to resolve the render target texture sizes
+		*  @param[out] referencedRenderTargetTextureAssetIds
+		*    Receives the sorted asset IDs of the render target textures accessed by alive compositor instance passes
+		*
+		*  @remarks
+		*    The texture accesses of the compositor passes are gathered from their compositor targets, material properties and copy or mipmap generation
+		*    textures. Compositor instance passes only writing transient render target textures nobody reads afterwards are culled. Transient render
+		*    target textures resolving to identical texture properties share one RHI texture if their lifetimes inside the frame don't overlap.
+		*    Must be called before any framebuffer or render target texture RHI resource gets created.
+		*/
+		void compileFrameGraph(const Rhi::IRenderTarget& mainRenderTarget, std::vector<AssetId>& referencedRenderTargetTextureAssetIds);
 		void clearRenderQueueIndexRangesRenderableManagers();
 
+		/**
+		*  @brief
+		*    Fill the command buffers of the sequential compositor node instances
+		*
+		*  @param[in] renderTarget
+		*    RHI render target to render into
+		*  @param[in] compositorContextData
+		*    Compositor context data
+		*
+		*  @remarks
+		*    If the RHI implementation supports native multithreading, compositor node instances which only contain compositor instance passes which can be filled
+		*    concurrently are distributed in-order across the default thread pool. Each worker thread fills into CPU memory of its own staged instance and indirect
+		*    buffer managers and the pass buffer managers stage their data as well, the RHI resources are updated by the render thread inside
+		*    "Renderer::CompositorWorkspaceInstance::onPreCommandBufferDispatch()". All other compositor node instances are filled by the render thread. When the
+		*    profiler is enabled the command buffers are always filled by the render thread since GPU samples are taken while filling the command buffers.
+		*/
+		void fillCompositorNodeInstanceCommandBuffers(Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData);
+
+		/**
+		*  @brief
+		*    Fill the command buffers of a range of concurrently filled compositor node instances, called by a worker thread
+		*
+		*  @param[in] workerIndex
+		*    Index of the worker data to use
+		*  @param[in] compositorContextData
+		*    Compositor context data of the render thread, copied per worker thread
+		*/
+		void fillConcurrentCompositorNodeInstanceCommandBuffers(size_t workerIndex, const CompositorContextData& compositorContextData);
+
+		/**
+		*  @brief
+		*    Update the RHI resources staged by the worker threads, must be called by the render thread before the command buffer is dispatched
+		*/
+		void onPreCommandBufferDispatch();
+		void destroyWorkers();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Worker final
+		{
+			UniformInstanceBufferManager* uniformInstanceBufferManager;	///< Staged uniform instance buffer manager, always valid, we're responsible to destroy the instance if we no longer need it
+			TextureInstanceBufferManager* textureInstanceBufferManager;	///< Staged texture instance buffer manager, always valid, we're responsible to destroy the instance if we no longer need it
+			IndirectBufferManager*		  indirectBufferManager;		///< Staged indirect buffer manager, always valid, we're responsible to destroy the instance if we no longer need it
+			size_t						  startIndex;					///< Index of the first concurrent compositor node instance filled by the worker during the current execution
+			size_t						  endIndex;						///< Index one past the last concurrent compositor node instance filled by the worker during the current execution
+			uint32_t					  numberOfEliminatedCommandPackets;	///< Number of redundant command packets removed by the worker during the current execution
+		};
+		typedef std::vector<Worker> Workers;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -198,12 +291,19 @@ namespace Renderer
 		CompositorWorkspaceResourceId	 mCompositorWorkspaceResourceId;
 		CompositorNodeInstances			 mSequentialCompositorNodeInstances;	///< We're responsible to destroy the compositor node instances if we no longer need them
 		bool							 mFramebufferManagerInitialized;
+		uint32_t						 mNumberOfCulledCompositorInstancePasses;	///< Result of the last frame graph compilation
+		uint32_t						 mNumberOfAliasedRenderTargetTextures;		///< Result of the last frame graph compilation
+		uint64_t						 mNumberOfAliasedRenderTargetTextureBytes;	///< Result of the last frame graph compilation
 		RenderQueueIndexRanges			 mRenderQueueIndexRanges;				///< The render queue index ranges layout is fixed during runtime
 
 		// The rest is temporary "CompositorWorkspaceInstance::execute()" data to e.g. avoid reallocations
 		Rhi::IRenderTarget*				 mExecutionRenderTarget;				///< Only valid during compositor workspace instance execution
 		std::vector<ISceneItem*>		 mExecuteOnRenderingSceneItems;			///< Scene items which requested an execute call on rendering, no duplicates allowed
 		Rhi::CommandBuffer				 mCommandBuffer;						///< RHI command buffer
+		uint32_t						 mNumberOfEliminatedCommandPackets;		///< Number of redundant command packets removed from the compositor node instance command buffers
+		std::vector<Rhi::IRenderTarget*> mCompositorNodeInstanceRenderTargets;	///< RHI render target given to each sequential compositor node instance, only used when filling concurrently
+		std::vector<size_t>				 mConcurrentCompositorNodeInstanceIndices;	///< In-order indices of the sequential compositor node instances which are filled concurrently
+		Workers							 mWorkers;								///< Worker data, kept across executions to reuse the staged buffer managers
 		CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;		///< Can be a null pointer, don't destroy the instance
 		#ifdef RHI_STATISTICS
 			Rhi::IQueryPoolPtr				   mPipelineStatisticsQueryPoolPtr;					///< Double buffered asynchronous pipeline statistics query pool, can be a null pointer
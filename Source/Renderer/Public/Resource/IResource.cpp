@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/IResource.h"
 #include "Renderer/Public/Resource/IResourceListener.h"
+#include "Renderer/Public/Resource/IResourceManager.h"
 
 #include <algorithm>
 
@@ -87,6 +88,35 @@ namespace Renderer
 				resourceListener.mResourceConnections.erase(connectionIterator);
 			}
 			mSortedResourceListeners.erase(iterator);
+
+			// Inform the resource manager in case the resource is no longer referenced
+			if (0 == getReferenceCount())
+			{
+				mResourceManager->onResourceUnreferenced(*this);
+			}
+		}
+	}
+
+	void IResource::releasePinnedReference()
+	{
+		ASSERT(mNumberOfPinnedReferences > 0, "Invalid number of pinned references")
+		--mNumberOfPinnedReferences;
+
+		// Inform the resource manager in case the resource is no longer referenced
+		if (0 == getReferenceCount())
+		{
+			mResourceManager->onResourceUnreferenced(*this);
+		}
+	}
+
+
+	void IResource::setNumberOfResidentBytes(uint64_t numberOfResidentBytes)
+	{
+		if (mNumberOfResidentBytes != numberOfResidentBytes)
+		{
+			const uint64_t previousNumberOfResidentBytes = mNumberOfResidentBytes;
+			mNumberOfResidentBytes = numberOfResidentBytes;
+			mResourceManager->onResourceResidentBytesChanged(*this, previousNumberOfResidentBytes);
 		}
 	}
 
@@ -106,6 +136,11 @@ namespace Renderer
 		std::swap(mResourceLoaderTypeId,	resource.mResourceLoaderTypeId);
 		std::swap(mLoadingState,			resource.mLoadingState);
 		std::swap(mSortedResourceListeners,	resource.mSortedResourceListeners);	// This is fine, resource listeners store a resource ID instead of a raw pointer
+		std::swap(mNumberOfPinnedReferences,	resource.mNumberOfPinnedReferences);
+		std::swap(mNumberOfResidentBytes,	resource.mNumberOfResidentBytes);
+		std::swap(mPreviousDeferredUnloadResourceId,	resource.mPreviousDeferredUnloadResourceId);	// This is fine, the deferred unload queue links resource IDs instead of raw pointers
+		std::swap(mNextDeferredUnloadResourceId,		resource.mNextDeferredUnloadResourceId);
+		std::swap(mDeferredUnloadQueued,				resource.mDeferredUnloadQueued);
 
 		// Done
 		return *this;
@@ -152,6 +187,11 @@ namespace Renderer
 		setInvalid(mAssetId);
 		setInvalid(mResourceLoaderTypeId);
 		mSortedResourceListeners.clear();
+		mNumberOfPinnedReferences = 0;
+		mNumberOfResidentBytes = 0;
+		setInvalid(mPreviousDeferredUnloadResourceId);
+		setInvalid(mNextDeferredUnloadResourceId);
+		mDeferredUnloadQueued = false;
 	}
 
 
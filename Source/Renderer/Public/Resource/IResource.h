@@ -88,7 +88,7 @@ namespace Renderer
 			UNLOADED,	///< Not loaded
 			LOADING,	///< Loading is in progress
 			LOADED,		///< Fully loaded
-			UNLOADING,	///< Currently unloading	// TODO(co) Currently unused
+			UNLOADING,	///< Currently unloading, set while a resource manager evicts the resident data of an unreferenced resource
 			FAILED		///< The last loading attempt failed
 		};
 
@@ -155,7 +155,50 @@ namespace Renderer
 		}
 
 		RENDERER_API_EXPORT void connectResourceListener(IResourceListener& resourceListener);	// No guaranteed resource listener caller order, if already connected nothing happens (no double registration)
-		RENDERER_API_EXPORT void disconnectResourceListener(IResourceListener& resourceListener);
+		RENDERER_API_EXPORT void disconnectResourceListener(IResourceListener& resourceListener);	// When the last reference gets released, the resource manager is informed so it can unload the resource later on
+
+		/**
+		*  @brief
+		*    Return the reference count
+		*
+		*  @return
+		*    The reference count, this is the number of connected resource listeners plus the number of pinned references
+		*
+		*  @note
+		*    - Users which only store the resource ID without connecting a resource listener must pin a reference, else the resource might get unloaded by the resource manager as soon as the last resource listener gets disconnected
+		*/
+		[[nodiscard]] inline uint32_t getReferenceCount() const
+		{
+			return static_cast<uint32_t>(mSortedResourceListeners.size()) + mNumberOfPinnedReferences;
+		}
+
+		/**
+		*  @brief
+		*    Pin a reference, for users which store the resource ID without connecting a resource listener
+		*
+		*  @note
+		*    - Each pinned reference must be released via "Renderer::IResource::releasePinnedReference()"
+		*/
+		inline void addPinnedReference()
+		{
+			++mNumberOfPinnedReferences;
+		}
+
+		RENDERER_API_EXPORT void releasePinnedReference();	// When the last reference gets released, the resource manager is informed so it can unload the resource later on
+
+		/**
+		*  @brief
+		*    Return the number of bytes of resident resource data
+		*
+		*  @return
+		*    The number of bytes of resident resource data (e.g. RHI texture or vertex buffer data), 0 if unknown
+		*/
+		[[nodiscard]] inline uint64_t getNumberOfResidentBytes() const
+		{
+			return mNumberOfResidentBytes;
+		}
+
+		RENDERER_API_EXPORT void setNumberOfResidentBytes(uint64_t numberOfResidentBytes);	// Usually set by the resource loader, the resource manager is informed so it can keep track of the total number of resident bytes
 
 
 	//[-------------------------------------------------------]
@@ -170,7 +213,12 @@ namespace Renderer
 			mResourceId(getInvalid<ResourceId>()),
 			mAssetId(getInvalid<AssetId>()),
 			mResourceLoaderTypeId(getInvalid<ResourceLoaderTypeId>()),
-			mLoadingState(LoadingState::UNLOADED)
+			mLoadingState(LoadingState::UNLOADED),
+			mNumberOfPinnedReferences(0),
+			mNumberOfResidentBytes(0),
+			mPreviousDeferredUnloadResourceId(getInvalid<ResourceId>()),
+			mNextDeferredUnloadResourceId(getInvalid<ResourceId>()),
+			mDeferredUnloadQueued(false)
 		{
 			// Nothing here
 		}
@@ -185,6 +233,9 @@ namespace Renderer
 			ASSERT(isInvalid(mResourceLoaderTypeId), "Invalid resource loader type ID")
 			ASSERT(LoadingState::UNLOADED == mLoadingState || LoadingState::FAILED == mLoadingState, "Invalid loading state")
 			ASSERT(mSortedResourceListeners.empty(), "Invalid sorted resource listeners")
+			ASSERT(0 == mNumberOfPinnedReferences, "Invalid number of pinned references")
+			ASSERT(0 == mNumberOfResidentBytes, "Invalid number of resident bytes")
+			ASSERT(!mDeferredUnloadQueued, "Invalid deferred unload queue state")
 		}
 
 		explicit IResource(const IResource&) = delete;
@@ -208,6 +259,39 @@ namespace Renderer
 
 		void setLoadingState(LoadingState loadingState);
 
+		//[-------------------------------------------------------]
+		//[ Intrusive deferred unload queue, see "Renderer::ResourceManagerTemplate::enqueueDeferredUnload()" ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool isDeferredUnloadQueued() const
+		{
+			return mDeferredUnloadQueued;
+		}
+
+		inline void setDeferredUnloadQueued(bool deferredUnloadQueued)
+		{
+			mDeferredUnloadQueued = deferredUnloadQueued;
+		}
+
+		[[nodiscard]] inline ResourceId getPreviousDeferredUnloadResourceId() const
+		{
+			return mPreviousDeferredUnloadResourceId;
+		}
+
+		inline void setPreviousDeferredUnloadResourceId(ResourceId resourceId)
+		{
+			mPreviousDeferredUnloadResourceId = resourceId;
+		}
+
+		[[nodiscard]] inline ResourceId getNextDeferredUnloadResourceId() const
+		{
+			return mNextDeferredUnloadResourceId;
+		}
+
+		inline void setNextDeferredUnloadResourceId(ResourceId resourceId)
+		{
+			mNextDeferredUnloadResourceId = resourceId;
+		}
+
 		//[-------------------------------------------------------]
 		//[ "Renderer::PackedElementManager" management           ]
 		//[-------------------------------------------------------]
@@ -221,6 +305,9 @@ namespace Renderer
 			ASSERT(isInvalid(mResourceLoaderTypeId), "Invalid resource loader type ID")
 			ASSERT(LoadingState::UNLOADED == mLoadingState, "Invalid loading state")
 			ASSERT(mSortedResourceListeners.empty(), "Invalid sorted resource listeners")
+			ASSERT(0 == mNumberOfPinnedReferences, "Invalid number of pinned references")
+			ASSERT(0 == mNumberOfResidentBytes, "Invalid number of resident bytes")
+			ASSERT(!mDeferredUnloadQueued, "Invalid deferred unload queue state")
 
 			// Set data
 			mResourceId = resourceId;
@@ -248,7 +335,12 @@ namespace Renderer
 		AssetId					mAssetId;				///< In case the resource is an instance of an asset, this is the ID of this asset
 		ResourceLoaderTypeId	mResourceLoaderTypeId;
 		LoadingState			mLoadingState;
-		SortedResourceListeners mSortedResourceListeners;
+		SortedResourceListeners mSortedResourceListeners;	///< The number of connected resource listeners plus the number of pinned references is the reference count
+		uint32_t				mNumberOfPinnedReferences;	///< Number of references of users which store the resource ID without connecting a resource listener
+		uint64_t				mNumberOfResidentBytes;		///< Number of bytes of resident resource data, 0 if unknown
+		ResourceId				mPreviousDeferredUnloadResourceId;	///< Previous (less recently used) resource inside the deferred unload queue, invalid if this is the front or the resource isn't queued
+		ResourceId				mNextDeferredUnloadResourceId;		///< Next (more recently used) resource inside the deferred unload queue, invalid if this is the back or the resource isn't queued
+		bool					mDeferredUnloadQueued;				///< "true" if the resource is linked into the deferred unload queue of its resource manager
 
 
 	};
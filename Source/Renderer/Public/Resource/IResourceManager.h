@@ -69,6 +69,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 		friend class RendererImpl;		// Needs to be able to destroy resource manager instances
 		friend class ResourceStreamer;	// Needs to be able to create resource loader instances
+		friend class IResource;			// Informs the resource manager about unreferenced resources
 
 
 	//[-------------------------------------------------------]
@@ -112,6 +113,38 @@ namespace Renderer
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) = 0;
 
+		/**
+		*  @brief
+		*    Called when the last reference of a resource got released, this is either the last resource listener or the last pinned reference
+		*
+		*  @param[in] resource
+		*    The resource which is no longer referenced
+		*
+		*  @note
+		*    - Resource managers supporting memory budgets queue the resource for a deferred unload which is processed inside "Renderer::IResourceManager::update()"
+		*/
+		inline virtual void onResourceUnreferenced([[maybe_unused]] IResource& resource)
+		{
+			// Nothing here, by default resources stay resident
+		}
+
+		/**
+		*  @brief
+		*    Called when the number of bytes of resident resource data of a resource changed
+		*
+		*  @param[in] resource
+		*    The resource whose number of resident bytes changed, already holds the new number
+		*  @param[in] previousNumberOfResidentBytes
+		*    The previous number of resident bytes of the resource
+		*
+		*  @note
+		*    - Resource managers supporting memory budgets keep a running total so they don't need to scan all resources each update
+		*/
+		inline virtual void onResourceResidentBytesChanged([[maybe_unused]] IResource& resource, [[maybe_unused]] uint64_t previousNumberOfResidentBytes)
+		{
+			// Nothing here, by default there's no resident bytes bookkeeping
+		}
+
 
 	};
 
@@ -78,8 +78,7 @@ namespace Renderer
 		}
 
 		// Read properties
-		// TODO(co) Get rid of the evil const-cast
-		MaterialProperties::SortedPropertyVector& sortedPropertyVector = const_cast<MaterialProperties::SortedPropertyVector&>(mMaterialResource->mMaterialProperties.getSortedPropertyVector());
+		MaterialProperties::SortedPropertyVector& sortedPropertyVector = mMaterialResource->mMaterialProperties.getSortedPropertyVector();
 		if (materialHeader.numberOfProperties > 0)
 		{
 			sortedPropertyVector.resize(materialHeader.numberOfProperties);
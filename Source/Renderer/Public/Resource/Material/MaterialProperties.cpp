@@ -50,16 +50,16 @@ namespace Renderer
 		{
 			// Add new material property
 			iterator = mSortedPropertyVector.insert(iterator, MaterialProperty(materialPropertyId, materialPropertyUsage, materialPropertyValue));
+			if (MaterialProperty::Usage::SHADER_COMBINATION == materialPropertyUsage)
+			{
+				++mShaderCombinationGenerationCounter;
+			}
 			if (changeOverwrittenState)
 			{
 				MaterialProperty* materialProperty = &*iterator;
 				materialProperty->mOverwritten = true;
 				return materialProperty;
 			}
-			if (MaterialProperty::Usage::SHADER_COMBINATION == materialPropertyUsage)
-			{
-				++mShaderCombinationGenerationCounter;
-			}
 			return &*iterator;
 		}
 
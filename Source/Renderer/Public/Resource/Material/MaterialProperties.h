@@ -105,6 +105,21 @@ namespace Renderer
 			return mSortedPropertyVector;
 		}
 
+		/**
+		*  @brief
+		*    Return the properties for direct modification, e.g. by resource loaders
+		*
+		*  @return
+		*    The properties
+		*
+		*  @note
+		*    - Doesn't update the shader combination generation counter, the caller is responsible for keeping the properties sorted
+		*/
+		[[nodiscard]] inline SortedPropertyVector& getSortedPropertyVector()
+		{
+			return mSortedPropertyVector;
+		}
+
 		/**
 		*  @brief
 		*    Remove all material properties
@@ -24,6 +24,7 @@
 #include "Renderer/Public/Resource/Material/MaterialResource.h"
 #include "Renderer/Public/Resource/Material/MaterialTechnique.h"
 #include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/ResourceManagerTemplate.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 
 #include <algorithm>
@@ -116,8 +117,9 @@ namespace Renderer
 				parentMaterialResource.mSortedChildMaterialResourceIds.insert(iterator, materialResourceId);
 
 				// Setup material resource
-				setAssetId(parentMaterialResource.getAssetId());
-				mMaterialProperties = parentMaterialResource.mMaterialProperties;
+				// -> The material properties are inherited from the parent material resource, there's no need to copy them
+				materialResourceManager.mInternalResourceManager->setResourceAssetId(*this, parentMaterialResource.getAssetId());
+				mMaterialProperties.removeAllProperties();
 				for (MaterialTechnique* materialTechnique : parentMaterialResource.mSortedMaterialTechniqueVector)
 				{
 					mSortedMaterialTechniqueVector.push_back(new MaterialTechnique(materialTechnique->getMaterialTechniqueId(), *this, materialTechnique->getMaterialBlueprintResourceId()));
@@ -131,6 +133,11 @@ namespace Renderer
 		}
 	}
 
+	const MaterialResource* MaterialResource::getParentMaterialResource() const
+	{
+		return isValid(mParentMaterialResourceId) ? &getResourceManager<MaterialResourceManager>().getById(mParentMaterialResourceId) : nullptr;
+	}
+
 	MaterialTechnique* MaterialResource::getMaterialTechniqueById(MaterialTechniqueId materialTechniqueId) const
 	{
 		SortedMaterialTechniqueVector::const_iterator iterator = std::lower_bound(mSortedMaterialTechniqueVector.cbegin(), mSortedMaterialTechniqueVector.cend(), materialTechniqueId, ::detail::OrderByMaterialTechniqueId());
@@ -146,6 +153,27 @@ namespace Renderer
 		mSortedMaterialTechniqueVector.clear();
 	}
 
+	uint32_t MaterialResource::getShaderCombinationGenerationCounter() const
+	{
+		const MaterialResource* parentMaterialResource = getParentMaterialResource();
+		return (nullptr != parentMaterialResource) ? (mMaterialProperties.getShaderCombinationGenerationCounter() + parentMaterialResource->getShaderCombinationGenerationCounter()) : mMaterialProperties.getShaderCombinationGenerationCounter();
+	}
+
+	const MaterialProperty* MaterialResource::getPropertyById(MaterialPropertyId materialPropertyId) const
+	{
+		const MaterialProperty* materialProperty = mMaterialProperties.getPropertyById(materialPropertyId);
+		if (nullptr == materialProperty)
+		{
+			// Fallback to the parent material resource
+			const MaterialResource* parentMaterialResource = getParentMaterialResource();
+			if (nullptr != parentMaterialResource)
+			{
+				materialProperty = parentMaterialResource->getPropertyById(materialPropertyId);
+			}
+		}
+		return materialProperty;
+	}
+
 	void MaterialResource::releaseTextures()
 	{
 		// TODO(co) Cleanup
@@ -164,6 +192,7 @@ namespace Renderer
 		// Sanity checks
 		RHI_ASSERT(getContext(), isInvalid(mParentMaterialResourceId), "Invalid parent material resource ID")
 		RHI_ASSERT(getContext(), mSortedChildMaterialResourceIds.empty(), "Invalid sorted child material resource IDs")
+		RHI_ASSERT(getContext(), mSortedPendingChildMaterialPropertyIds.empty(), "Invalid sorted pending child material property IDs")
 		RHI_ASSERT(getContext(), mSortedMaterialTechniqueVector.empty(), "Invalid sorted material technique vector")
 		RHI_ASSERT(getContext(), mMaterialProperties.getSortedPropertyVector().empty(), "Invalid material properties")
 		RHI_ASSERT(getContext(), mAttachedRenderables.empty(), "Invalid attached renderables")
@@ -184,6 +213,7 @@ namespace Renderer
 		// -> Lucky us that we're usually not referencing by using raw-pointers, so a simple swap does the trick
 		std::swap(mParentMaterialResourceId,	   materialResource.mParentMaterialResourceId);
 		std::swap(mSortedChildMaterialResourceIds, materialResource.mSortedChildMaterialResourceIds);
+		std::swap(mSortedPendingChildMaterialPropertyIds, materialResource.mSortedPendingChildMaterialPropertyIds);
 		std::swap(mSortedMaterialTechniqueVector,  materialResource.mSortedMaterialTechniqueVector);
 		std::swap(mMaterialProperties,			   materialResource.mMaterialProperties);
 		std::swap(mAttachedRenderables,			   materialResource.mAttachedRenderables);
@@ -217,6 +247,7 @@ namespace Renderer
 			}
 			mSortedChildMaterialResourceIds.clear();
 		}
+		mSortedPendingChildMaterialPropertyIds.clear();
 
 		// Cleanup
 		destroyAllMaterialTechniques();
@@ -228,124 +259,173 @@ namespace Renderer
 
 	bool MaterialResource::setPropertyByIdInternal(MaterialPropertyId materialPropertyId, const MaterialPropertyValue& materialPropertyValue, MaterialProperty::Usage materialPropertyUsage, bool changeOverwrittenState)
 	{
+		// A child material resource overwriting an inherited material property for the first time takes over the usage of the inherited material property
+		if (MaterialProperty::Usage::UNKNOWN == materialPropertyUsage && isValid(mParentMaterialResourceId) && nullptr == mMaterialProperties.getPropertyById(materialPropertyId))
+		{
+			const MaterialProperty* materialProperty = getParentMaterialResource()->getPropertyById(materialPropertyId);
+			if (nullptr != materialProperty)
+			{
+				materialPropertyUsage = materialProperty->getUsage();
+			}
+		}
+
 		// Call the base implementation
-		MaterialProperty* materialProperty = mMaterialProperties.setPropertyById(materialPropertyId, materialPropertyValue, materialPropertyUsage, changeOverwrittenState);
+		const MaterialProperty* materialProperty = mMaterialProperties.setPropertyById(materialPropertyId, materialPropertyValue, materialPropertyUsage, changeOverwrittenState);
 		if (nullptr != materialProperty)
 		{
-			// Perform derived work, if required to do so
-			switch (materialProperty->getUsage())
-			{
-				case MaterialProperty::Usage::SHADER_UNIFORM:
-					for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
-					{
-						materialTechnique->scheduleForShaderUniformUpdate();
-					}
-					break;
+			// Material property change detected
+			onPropertyChanged(*materialProperty);
+			return true;
+		}
 
-				case MaterialProperty::Usage::SHADER_COMBINATION:
-					// Handled by "Renderer::MaterialProperties::setPropertyById()"
-					break;
+		// No material property change detected
+		return false;
+	}
 
-				case MaterialProperty::Usage::RASTERIZER_STATE:
-				case MaterialProperty::Usage::DEPTH_STENCIL_STATE:
-				case MaterialProperty::Usage::BLEND_STATE:
-					// TODO(co) Optimization: The calculation of the FNV1a hash of "Rhi::SerializedGraphicsPipelineState" is pretty fast, but maybe it makes sense to schedule the calculation in case many material properties are changed in a row?
-					for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
-					{
-						materialTechnique->calculateSerializedGraphicsPipelineStateHash();
-					}
-					break;
+	void MaterialResource::onPropertyChanged(const MaterialProperty& materialProperty)
+	{
+		const MaterialPropertyId materialPropertyId = materialProperty.getMaterialPropertyId();
 
-				case MaterialProperty::Usage::TEXTURE_REFERENCE:
-					for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
-					{
-						materialTechnique->clearTextures();
-					}
-					break;
+		// Perform derived work, if required to do so
+		switch (materialProperty.getUsage())
+		{
+			case MaterialProperty::Usage::SHADER_UNIFORM:
+				for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
+				{
+					materialTechnique->scheduleForShaderUniformUpdate();
+				}
+				break;
+
+			case MaterialProperty::Usage::SHADER_COMBINATION:
+				// Handled by "Renderer::MaterialProperties::setPropertyById()"
+				break;
 
-				case MaterialProperty::Usage::STATIC:
-					// Initial cached material data gathering is performed inside "Renderer::Renderable::setMaterialResourceId()"
+			case MaterialProperty::Usage::RASTERIZER_STATE:
+			case MaterialProperty::Usage::DEPTH_STENCIL_STATE:
+			case MaterialProperty::Usage::BLEND_STATE:
+				// TODO(co) Optimization: The calculation of the FNV1a hash of "Rhi::SerializedGraphicsPipelineState" is pretty fast, but maybe it makes sense to schedule the calculation in case many material properties are changed in a row?
+				for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
+				{
+					materialTechnique->calculateSerializedGraphicsPipelineStateHash();
+				}
+				break;
 
-					// Optional "RenderQueueIndex" (e.g. compositor materials usually don't need this property)
-					if (RENDER_QUEUE_INDEX_PROPERTY_ID == materialPropertyId)
+			case MaterialProperty::Usage::TEXTURE_REFERENCE:
+				for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
+				{
+					materialTechnique->clearTextures();
+				}
+				break;
+
+			case MaterialProperty::Usage::STATIC:
+				// Initial cached material data gathering is performed inside "Renderer::Renderable::setMaterialResourceId()"
+
+				// Optional "RenderQueueIndex" (e.g. compositor materials usually don't need this property)
+				if (RENDER_QUEUE_INDEX_PROPERTY_ID == materialPropertyId)
+				{
+					const int renderQueueIndex = materialProperty.getIntegerValue();
+
+					// Sanity checks
+					RHI_ASSERT(getContext(), renderQueueIndex >= 0, "Invalid render queue index")
+					RHI_ASSERT(getContext(), renderQueueIndex <= 255, "Invalid render queue index")
+
+					// Update the cached material data of all attached renderables
+					for (Renderable* renderable : mAttachedRenderables)
 					{
-						const int renderQueueIndex = materialProperty->getIntegerValue();
-
-						// Sanity checks
-						RHI_ASSERT(getContext(), renderQueueIndex >= 0, "Invalid render queue index")
-						RHI_ASSERT(getContext(), renderQueueIndex <= 255, "Invalid render queue index")
-
-						// Update the cached material data of all attached renderables
-						for (Renderable* renderable : mAttachedRenderables)
-						{
-							renderable->mRenderQueueIndex = static_cast<uint8_t>(renderQueueIndex);
-
-							// In here we don't care about the fact that one and the same renderable manager instance might
-							// update cached renderables data. It's not performance critical in here and resolving this will
-							// require additional logic which itself has an performance impact. So keep it simple.
-							renderable->getRenderableManager().updateCachedRenderablesData();
-						}
+						renderable->mRenderQueueIndex = static_cast<uint8_t>(renderQueueIndex);
+
+						// In here we don't care about the fact that one and the same renderable manager instance might
+						// update cached renderables data. It's not performance critical in here and resolving this will
+						// require additional logic which itself has an performance impact. So keep it simple.
+						renderable->getRenderableManager().updateCachedRenderablesData();
 					}
+				}
 
-					// Optional "CastShadows" (e.g. compositor materials usually don't need this property)
-					else if (CAST_SHADOWS_PROPERTY_ID == materialPropertyId)
+				// Optional "CastShadows" (e.g. compositor materials usually don't need this property)
+				else if (CAST_SHADOWS_PROPERTY_ID == materialPropertyId)
+				{
+					// Update the cached material data of all attached renderables
+					const bool castShadows = materialProperty.getBooleanValue();
+					for (Renderable* renderable : mAttachedRenderables)
 					{
-						// Update the cached material data of all attached renderables
-						const bool castShadows = materialProperty->getBooleanValue();
-						for (Renderable* renderable : mAttachedRenderables)
-						{
-							renderable->mCastShadows = castShadows;
-
-							// In here we don't care about the fact that one and the same renderable manager instance might
-							// update cached renderables data. It's not performance critical in here and resolving this will
-							// require additional logic which itself has an performance impact. So keep it simple.
-							renderable->getRenderableManager().updateCachedRenderablesData();
-						}
+						renderable->mCastShadows = castShadows;
+
+						// In here we don't care about the fact that one and the same renderable manager instance might
+						// update cached renderables data. It's not performance critical in here and resolving this will
+						// require additional logic which itself has an performance impact. So keep it simple.
+						renderable->getRenderableManager().updateCachedRenderablesData();
 					}
+				}
 
-					// Optional "UseAlphaMap"
-					else if (USE_ALPHA_MAP_PROPERTY_ID == materialPropertyId)
+				// Optional "UseAlphaMap"
+				else if (USE_ALPHA_MAP_PROPERTY_ID == materialPropertyId)
+				{
+					// Update the cached material data of all attached renderables
+					const bool useAlphaMap = materialProperty.getBooleanValue();
+					for (Renderable* renderable : mAttachedRenderables)
 					{
-						// Update the cached material data of all attached renderables
-						const bool useAlphaMap = materialProperty->getBooleanValue();
-						for (Renderable* renderable : mAttachedRenderables)
-						{
-							renderable->mUseAlphaMap = useAlphaMap;
-
-							// In here we don't care about the fact that one and the same renderable manager instance might
-							// update cached renderables data. It's not performance critical in here and resolving this will
-							// require additional logic which itself has an performance impact. So keep it simple.
-							renderable->getRenderableManager().updateCachedRenderablesData();
-						}
+						renderable->mUseAlphaMap = useAlphaMap;
+
+						// In here we don't care about the fact that one and the same renderable manager instance might
+						// update cached renderables data. It's not performance critical in here and resolving this will
+						// require additional logic which itself has an performance impact. So keep it simple.
+						renderable->getRenderableManager().updateCachedRenderablesData();
 					}
-					break;
-
-				case MaterialProperty::Usage::UNKNOWN:
-				case MaterialProperty::Usage::SAMPLER_STATE:
-				case MaterialProperty::Usage::GLOBAL_REFERENCE:
-				case MaterialProperty::Usage::UNKNOWN_REFERENCE:
-				case MaterialProperty::Usage::PASS_REFERENCE:
-				case MaterialProperty::Usage::MATERIAL_REFERENCE:
-				case MaterialProperty::Usage::INSTANCE_REFERENCE:
-				case MaterialProperty::Usage::GLOBAL_REFERENCE_FALLBACK:
-				default:
-					// Nothing here
-					break;
-			}
+				}
+				break;
+
+			case MaterialProperty::Usage::UNKNOWN:
+			case MaterialProperty::Usage::SAMPLER_STATE:
+			case MaterialProperty::Usage::GLOBAL_REFERENCE:
+			case MaterialProperty::Usage::UNKNOWN_REFERENCE:
+			case MaterialProperty::Usage::PASS_REFERENCE:
+			case MaterialProperty::Usage::MATERIAL_REFERENCE:
+			case MaterialProperty::Usage::INSTANCE_REFERENCE:
+			case MaterialProperty::Usage::GLOBAL_REFERENCE_FALLBACK:
+			default:
+				// Nothing here
+				break;
+		}
 
-			// Inform child material resources, if required
-			const MaterialResourceManager& materialResourceManager = static_cast<MaterialResourceManager&>(getResourceManager());
-			for (MaterialResourceId materialResourceId : mSortedChildMaterialResourceIds)
+		// Inform child material resources, if required
+		// -> Material properties are usually animated per frame: Only record the change, the child material resources are informed
+		//    once per frame via "Renderer::MaterialResourceManager::propagatePendingMaterialProperties()" which is called before rendering
+		if (!mSortedChildMaterialResourceIds.empty())
+		{
+			SortedMaterialPropertyIds::iterator iterator = std::lower_bound(mSortedPendingChildMaterialPropertyIds.begin(), mSortedPendingChildMaterialPropertyIds.end(), materialPropertyId);
+			if (iterator == mSortedPendingChildMaterialPropertyIds.end() || *iterator != materialPropertyId)
 			{
-				materialResourceManager.getById(materialResourceId).setPropertyByIdInternal(materialPropertyId, materialPropertyValue, materialPropertyUsage, false);
+				if (mSortedPendingChildMaterialPropertyIds.empty())
+				{
+					getResourceManager<MaterialResourceManager>().mMaterialResourceIdsWithPendingProperties.push_back(getId());
+				}
+				mSortedPendingChildMaterialPropertyIds.insert(iterator, materialPropertyId);
 			}
-
-			// Material property change detected
-			return true;
 		}
+	}
 
-		// No material property change detected
-		return false;
+	void MaterialResource::propagatePendingPropertiesToChildren()
+	{
+		// Child material resources read inherited material properties directly from this material resource, so only the child material resources
+		// which don't overwrite a changed material property have to update their material techniques and attached renderables. Child material
+		// resources which are parent material resources themselves record the change as well, the material resource manager takes care of those.
+		const MaterialResourceManager& materialResourceManager = getResourceManager<MaterialResourceManager>();
+		for (MaterialPropertyId materialPropertyId : mSortedPendingChildMaterialPropertyIds)
+		{
+			const MaterialProperty* materialProperty = getPropertyById(materialPropertyId);
+			if (nullptr != materialProperty)
+			{
+				for (MaterialResourceId materialResourceId : mSortedChildMaterialResourceIds)
+				{
+					MaterialResource& childMaterialResource = materialResourceManager.getById(materialResourceId);
+					if (nullptr == childMaterialResource.mMaterialProperties.getPropertyById(materialPropertyId))
+					{
+						childMaterialResource.onPropertyChanged(*materialProperty);
+					}
+				}
+			}
+		}
+		mSortedPendingChildMaterialPropertyIds.clear();
 	}
 
 
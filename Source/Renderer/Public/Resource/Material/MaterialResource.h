@@ -126,9 +126,19 @@ namespace Renderer
 		*  @note
 		*    - Parent material resource must be fully loaded
 		*    - All property values will be reset
+		*    - A child material resource only stores the material properties it overwrites, all other material properties are inherited from the parent material resource
 		*/
 		RENDERER_API_EXPORT void setParentMaterialResourceId(MaterialResourceId parentMaterialResourceId);
 
+		/**
+		*  @brief
+		*    Return the parent material resource
+		*
+		*  @return
+		*    The parent material resource, null pointer if there's no parent, don't destroy the returned instance
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT const MaterialResource* getParentMaterialResource() const;
+
 		/**
 		*  @brief
 		*    Return the sorted material technique vector
@@ -171,7 +181,7 @@ namespace Renderer
 		*    Return the material properties
 		*
 		*  @return
-		*    The material properties
+		*    The material properties, doesn't include the material properties inherited from the parent material resource
 		*/
 		[[nodiscard]] inline const MaterialProperties& getMaterialProperties() const
 		{
@@ -183,13 +193,22 @@ namespace Renderer
 		*    Return the material properties as sorted vector
 		*
 		*  @return
-		*    The material properties as sorted vector
+		*    The material properties as sorted vector, doesn't include the material properties inherited from the parent material resource
 		*/
 		[[nodiscard]] inline const MaterialProperties::SortedPropertyVector& getSortedPropertyVector() const
 		{
 			return mMaterialProperties.getSortedPropertyVector();
 		}
 
+		/**
+		*  @brief
+		*    Return the shader combination generation counter
+		*
+		*  @return
+		*    The shader combination generation counter, includes the shader combination generation counters of the parent material resources
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT uint32_t getShaderCombinationGenerationCounter() const;
+
 		/**
 		*  @brief
 		*    Remove all material properties
@@ -208,11 +227,11 @@ namespace Renderer
 		*
 		*  @return
 		*    The requested material property, null pointer on error, don't destroy the returned instance
+		*
+		*  @note
+		*    - Material properties which aren't overwritten by this material resource are looked up inside the parent material resource
 		*/
-		[[nodiscard]] inline const MaterialProperty* getPropertyById(MaterialPropertyId materialPropertyId) const
-		{
-			return mMaterialProperties.getPropertyById(materialPropertyId);
-		}
+		[[nodiscard]] RENDERER_API_EXPORT const MaterialProperty* getPropertyById(MaterialPropertyId materialPropertyId) const;
 
 		/**
 		*  @brief
@@ -263,6 +282,7 @@ namespace Renderer
 			// Sanity checks
 			RHI_ASSERT(getContext(), isInvalid(mParentMaterialResourceId), "Invalid parent material resource ID")
 			RHI_ASSERT(getContext(), mSortedChildMaterialResourceIds.empty(), "Invalid sorted child material resource IDs")
+			RHI_ASSERT(getContext(), mSortedPendingChildMaterialPropertyIds.empty(), "Invalid sorted pending child material property IDs")
 			RHI_ASSERT(getContext(), mSortedMaterialTechniqueVector.empty(), "Invalid sorted material technique vector")
 			RHI_ASSERT(getContext(), mMaterialProperties.getSortedPropertyVector().empty(), "Invalid material properties")
 
@@ -290,12 +310,31 @@ namespace Renderer
 		*/
 		RENDERER_API_EXPORT bool setPropertyByIdInternal(MaterialPropertyId materialPropertyId, const MaterialPropertyValue& materialPropertyValue, MaterialProperty::Usage materialPropertyUsage, bool changeOverwrittenState);
 
+		/**
+		*  @brief
+		*    Update the material techniques and attached renderables after a material property change and record the change for the child material resources
+		*
+		*  @param[in] materialProperty
+		*    The changed material property, can be inherited from the parent material resource
+		*/
+		void onPropertyChanged(const MaterialProperty& materialProperty);
+
+		/**
+		*  @brief
+		*    Inform the child material resources about the recorded material property changes they inherit
+		*
+		*  @see
+		*    - "Renderer::MaterialResourceManager::propagatePendingMaterialProperties()"
+		*/
+		void propagatePendingPropertiesToChildren();
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
 		typedef std::vector<MaterialResourceId> SortedChildMaterialResourceIds;
+		typedef std::vector<MaterialPropertyId> SortedMaterialPropertyIds;
 		typedef std::vector<Renderable*>		AttachedRenderables;
 
 
@@ -305,6 +344,7 @@ namespace Renderer
 	private:
 		MaterialResourceId			   mParentMaterialResourceId;
 		SortedChildMaterialResourceIds mSortedChildMaterialResourceIds;
+		SortedMaterialPropertyIds	   mSortedPendingChildMaterialPropertyIds;	///< IDs of the changed material properties the child material resources still have to be informed about
 		SortedMaterialTechniqueVector  mSortedMaterialTechniqueVector;
 		MaterialProperties			   mMaterialProperties;
 		AttachedRenderables			   mAttachedRenderables;
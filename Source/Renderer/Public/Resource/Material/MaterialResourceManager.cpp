@@ -62,9 +62,7 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), nullptr == getMaterialResourceByAssetId(assetId), "Material resource is not allowed to exist, yet")
 
 		// Create the material resource instance
-		MaterialResource& materialResource = mInternalResourceManager->getResources().addElement();
-		materialResource.setResourceManager(this);
-		materialResource.setAssetId(assetId);
+		MaterialResource& materialResource = mInternalResourceManager->addResource(assetId);
 		#ifdef RHI_DEBUG
 		{
 			const AssetManager& assetManager = mRenderer.getAssetManager();
@@ -120,9 +118,7 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), mInternalResourceManager->getResources().getElementById(parentMaterialResourceId).getLoadingState() == IResource::LoadingState::LOADED, "Invalid parent material resource ID")
 
 		// Create the material resource instance
-		MaterialResource& materialResource = mInternalResourceManager->getResources().addElement();
-		materialResource.setResourceManager(this);
-		materialResource.setAssetId(assetId);
+		MaterialResource& materialResource = mInternalResourceManager->addResource(assetId);
 		materialResource.setParentMaterialResourceId(parentMaterialResourceId);
 		#ifdef RHI_DEBUG
 			materialResource.setDebugName((std::string(mInternalResourceManager->getResources().getElementById(parentMaterialResourceId).getDebugName()) + "[Clone]").c_str());
@@ -135,7 +131,7 @@ namespace Renderer
 
 	void MaterialResourceManager::destroyMaterialResource(MaterialResourceId materialResourceId)
 	{
-		mInternalResourceManager->getResources().removeElement(materialResourceId);
+		mInternalResourceManager->removeResource(materialResourceId);
 	}
 
 	void MaterialResourceManager::setInvalidResourceId(MaterialResourceId& materialResourceId, IResourceListener& resourceListener) const
@@ -201,6 +197,20 @@ namespace Renderer
 		delete mInternalResourceManager;
 	}
 
+	void MaterialResourceManager::propagatePendingMaterialPropertiesInternal()
+	{
+		// Child material resources which are parent material resources themselves might register while we're in here, so don't use iterators
+		for (size_t i = 0; i < mMaterialResourceIdsWithPendingProperties.size(); ++i)
+		{
+			MaterialResource* materialResource = tryGetById(mMaterialResourceIdsWithPendingProperties[i]);
+			if (nullptr != materialResource)
+			{
+				materialResource->propagatePendingPropertiesToChildren();
+			}
+		}
+		mMaterialResourceIdsWithPendingProperties.clear();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -29,6 +29,14 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ResourceManager.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -67,6 +75,7 @@ namespace Renderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class RendererImpl;
+		friend class MaterialResource;	// Must keep the asset ID index in sync when changing the parent material resource
 
 
 	//[-------------------------------------------------------]
@@ -93,6 +102,27 @@ namespace Renderer
 		RENDERER_API_EXPORT void destroyMaterialResource(MaterialResourceId materialResourceId);
 		RENDERER_API_EXPORT void setInvalidResourceId(MaterialResourceId& materialResourceId, IResourceListener& resourceListener) const;
 
+		/**
+		*  @brief
+		*    Inform child material resources about the material property changes of their parent material resources
+		*
+		*  @remarks
+		*    Child material resources only store the material properties they overwrite and read all other material properties from
+		*    their parent material resource, so parent changes never copy material property values. Material properties are usually
+		*    animated per frame, so instead of updating the material techniques and attached renderables of the whole material resource
+		*    hierarchy for each single change, parent material resources only record which properties have been changed and the child
+		*    material resources not overwriting them are updated once per frame. Called automatically inside "Renderer::MaterialResourceManager::update()"
+		*    and before rendering inside "Renderer::CompositorWorkspaceInstance::execute()", so changes done after the renderer update
+		*    are still visible in the same frame. Call it manually in case child material resources must see the parent changes immediately.
+		*/
+		inline void propagatePendingMaterialProperties()
+		{
+			if (!mMaterialResourceIdsWithPendingProperties.empty())
+			{
+				propagatePendingMaterialPropertiesInternal();
+			}
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -106,7 +136,7 @@ namespace Renderer
 
 		inline virtual void update() override
 		{
-			// Nothing here
+			propagatePendingMaterialProperties();
 		}
 
 
@@ -125,13 +155,22 @@ namespace Renderer
 		virtual ~MaterialResourceManager() override;
 		explicit MaterialResourceManager(const MaterialResourceManager&) = delete;
 		MaterialResourceManager& operator=(const MaterialResourceManager&) = delete;
+		RENDERER_API_EXPORT void propagatePendingMaterialPropertiesInternal();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<MaterialResourceId> MaterialResourceIds;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRenderer& mRenderer;	///< Renderer instance, do not destroy the instance
+		IRenderer&			mRenderer;									///< Renderer instance, do not destroy the instance
+		MaterialResourceIds	mMaterialResourceIdsWithPendingProperties;	///< IDs of the material resources with material property changes their child material resources still have to be informed about, might contain IDs of meanwhile destroyed material resources
 
 		// Internal resource manager implementation
 		ResourceManagerTemplate<MaterialResource, MaterialResourceLoader, MaterialResourceId, 4096>* mInternalResourceManager;
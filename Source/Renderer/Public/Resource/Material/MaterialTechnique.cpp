@@ -102,7 +102,7 @@ namespace Renderer
 		}
 	}
 
-	void MaterialTechnique::fillGraphicsCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup)
+	void MaterialTechnique::fillGraphicsCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup, const void*& lastBoundMaterialPool)
 	{
 		// Sanity check
 		RHI_ASSERT(renderer.getContext(), isValid(mMaterialBlueprintResourceId), "Invalid material blueprint resource ID")
@@ -112,7 +112,7 @@ namespace Renderer
 			MaterialBufferManager* materialBufferManager = getMaterialBufferManager();
 			if (nullptr != materialBufferManager)
 			{
-				materialBufferManager->fillGraphicsCommandBuffer(*this, commandBuffer);
+				materialBufferManager->fillGraphicsCommandBuffer(*this, commandBuffer, lastBoundMaterialPool);
 			}
 		}
 
@@ -120,7 +120,7 @@ namespace Renderer
 		fillCommandBuffer(renderer, resourceGroupRootParameterIndex, resourceGroup);
 	}
 
-	void MaterialTechnique::fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup)
+	void MaterialTechnique::fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup, const void*& lastBoundMaterialPool)
 	{
 		// Sanity check
 		RHI_ASSERT(renderer.getContext(), isValid(mMaterialBlueprintResourceId), "Invalid material blueprint resource ID")
@@ -130,7 +130,7 @@ namespace Renderer
 			MaterialBufferManager* materialBufferManager = getMaterialBufferManager();
 			if (nullptr != materialBufferManager)
 			{
-				materialBufferManager->fillComputeCommandBuffer(*this, commandBuffer);
+				materialBufferManager->fillComputeCommandBuffer(*this, commandBuffer, lastBoundMaterialPool);
 			}
 		}
 
@@ -213,76 +213,81 @@ namespace Renderer
 
 			// Apply material properties
 			// -> Renderer toolkit counterpart is "RendererToolkit::JsonMaterialBlueprintHelper::readPipelineStateObject()"
+			// -> Inherited material properties are only applied in case they're not overwritten
 			const MaterialProperties& materialBlueprintMaterialProperties = materialBlueprintResource->getMaterialProperties();
-			const MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector = getMaterialResource().getSortedPropertyVector();
-			const size_t numberOfMaterialProperties = sortedMaterialPropertyVector.size();
-			for (size_t i = 0; i < numberOfMaterialProperties; ++i)
+			const MaterialResource& materialResource = getMaterialResource();
+			for (const MaterialResource* currentMaterialResource = &materialResource; nullptr != currentMaterialResource; currentMaterialResource = currentMaterialResource->getParentMaterialResource())
 			{
-				// A material can have multiple material techniques, do only apply material properties which are known to the material blueprint resource
-				const MaterialProperty& materialProperty = sortedMaterialPropertyVector[i];
-				if (nullptr != materialBlueprintMaterialProperties.getPropertyById(materialProperty.getMaterialPropertyId()))
+				const MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector = currentMaterialResource->getSortedPropertyVector();
+				const size_t numberOfMaterialProperties = sortedMaterialPropertyVector.size();
+				for (size_t i = 0; i < numberOfMaterialProperties; ++i)
 				{
-					switch (materialProperty.getUsage())
+					// A material can have multiple material techniques, do only apply material properties which are known to the material blueprint resource
+					const MaterialProperty& materialProperty = sortedMaterialPropertyVector[i];
+					if (nullptr != materialBlueprintMaterialProperties.getPropertyById(materialProperty.getMaterialPropertyId()) && materialResource.getPropertyById(materialProperty.getMaterialPropertyId()) == &materialProperty)
 					{
-						case MaterialProperty::Usage::UNKNOWN:
-						case MaterialProperty::Usage::STATIC:
-						case MaterialProperty::Usage::SHADER_UNIFORM:
-						case MaterialProperty::Usage::SHADER_COMBINATION:
-							// Nothing here
-							break;
-
-						case MaterialProperty::Usage::RASTERIZER_STATE:
-							// TODO(co) Implement all rasterizer state properties
-							if (materialProperty.getMaterialPropertyId() == ::detail::CullMode)
-							{
-								serializedGraphicsPipelineState.rasterizerState.cullMode = materialProperty.getCullModeValue();
-							}
-							else
-							{
-								RHI_ASSERT(getMaterialResourceManager().getRenderer().getContext(), false, "TODO(co) Rasterizer state not implemented, yet")
-							}
-							break;
-
-						case MaterialProperty::Usage::DEPTH_STENCIL_STATE:
-							// TODO(co) Implement all depth stencil state properties
-							switch (materialProperty.getMaterialPropertyId())
-							{
-								case ::detail::DepthEnable:
-									serializedGraphicsPipelineState.depthStencilState.depthEnable = materialProperty.getBooleanValue();
-									break;
-
-								case ::detail::DepthWriteMask:
-									serializedGraphicsPipelineState.depthStencilState.depthWriteMask = materialProperty.getDepthWriteMaskValue();
-									break;
-
-								default:
-									RHI_ASSERT(getMaterialResourceManager().getRenderer().getContext(), false, "TODO(co) Depth stencil state not implemented, yet")
-									break;
-							}
-							break;
-
-						case MaterialProperty::Usage::BLEND_STATE:
-							// TODO(co) Implement all blend state properties
-							if (materialProperty.getMaterialPropertyId() == ::detail::AlphaToCoverageEnable)
-							{
-								serializedGraphicsPipelineState.blendState.alphaToCoverageEnable = materialProperty.getBooleanValue();
-							}
-							else
-							{
-								RHI_ASSERT(getMaterialResourceManager().getRenderer().getContext(), false, "TODO(co) Blend state not implemented, yet")
-							}
-							break;
-
-						case MaterialProperty::Usage::SAMPLER_STATE:
-						case MaterialProperty::Usage::TEXTURE_REFERENCE:
-						case MaterialProperty::Usage::GLOBAL_REFERENCE:
-						case MaterialProperty::Usage::UNKNOWN_REFERENCE:
-						case MaterialProperty::Usage::PASS_REFERENCE:
-						case MaterialProperty::Usage::MATERIAL_REFERENCE:
-						case MaterialProperty::Usage::INSTANCE_REFERENCE:
-						case MaterialProperty::Usage::GLOBAL_REFERENCE_FALLBACK:
-							// Nothing here
-							break;
+						switch (materialProperty.getUsage())
+						{
+							case MaterialProperty::Usage::UNKNOWN:
+							case MaterialProperty::Usage::STATIC:
+							case MaterialProperty::Usage::SHADER_UNIFORM:
+							case MaterialProperty::Usage::SHADER_COMBINATION:
+								// Nothing here
+								break;
+
+							case MaterialProperty::Usage::RASTERIZER_STATE:
+								// TODO(co) Implement all rasterizer state properties
+								if (materialProperty.getMaterialPropertyId() == ::detail::CullMode)
+								{
+									serializedGraphicsPipelineState.rasterizerState.cullMode = materialProperty.getCullModeValue();
+								}
+								else
+								{
+									RHI_ASSERT(getMaterialResourceManager().getRenderer().getContext(), false, "TODO(co) Rasterizer state not implemented, yet")
+								}
+								break;
+
+							case MaterialProperty::Usage::DEPTH_STENCIL_STATE:
+								// TODO(co) Implement all depth stencil state properties
+								switch (materialProperty.getMaterialPropertyId())
+								{
+									case ::detail::DepthEnable:
+										serializedGraphicsPipelineState.depthStencilState.depthEnable = materialProperty.getBooleanValue();
+										break;
+
+									case ::detail::DepthWriteMask:
+										serializedGraphicsPipelineState.depthStencilState.depthWriteMask = materialProperty.getDepthWriteMaskValue();
+										break;
+
+									default:
+										RHI_ASSERT(getMaterialResourceManager().getRenderer().getContext(), false, "TODO(co) Depth stencil state not implemented, yet")
+										break;
+								}
+								break;
+
+							case MaterialProperty::Usage::BLEND_STATE:
+								// TODO(co) Implement all blend state properties
+								if (materialProperty.getMaterialPropertyId() == ::detail::AlphaToCoverageEnable)
+								{
+									serializedGraphicsPipelineState.blendState.alphaToCoverageEnable = materialProperty.getBooleanValue();
+								}
+								else
+								{
+									RHI_ASSERT(getMaterialResourceManager().getRenderer().getContext(), false, "TODO(co) Blend state not implemented, yet")
+								}
+								break;
+
+							case MaterialProperty::Usage::SAMPLER_STATE:
+							case MaterialProperty::Usage::TEXTURE_REFERENCE:
+							case MaterialProperty::Usage::GLOBAL_REFERENCE:
+							case MaterialProperty::Usage::UNKNOWN_REFERENCE:
+							case MaterialProperty::Usage::PASS_REFERENCE:
+							case MaterialProperty::Usage::MATERIAL_REFERENCE:
+							case MaterialProperty::Usage::INSTANCE_REFERENCE:
+							case MaterialProperty::Usage::GLOBAL_REFERENCE_FALLBACK:
+								// Nothing here
+								break;
+						}
 					}
 				}
 			}
@@ -310,6 +315,9 @@ namespace Renderer
 
 	void MaterialTechnique::fillCommandBuffer(const IRenderer& renderer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup)
 	{
+		// The textures and the resource group are gathered lazily, compositor nodes might be recorded concurrently
+		const std::lock_guard<std::mutex> commandBufferFillMutexLock(renderer.getMaterialBlueprintResourceManager().getCommandBufferFillMutex());
+
 		// Set textures
 		const Textures& textures = getTextures(renderer);
 		if (textures.empty())
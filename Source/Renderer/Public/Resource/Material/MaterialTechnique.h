@@ -138,11 +138,18 @@ namespace Renderer
 		*    Structured buffer root parameter index
 		*  @param[in] structuredBufferPtr
 		*    RHI structured buffer pointer
+		*
+		*  @note
+		*    - Setting a different structured buffer rebuilds the resource group
 		*/
 		inline void setStructuredBufferPtr(uint32_t structuredBufferRootParameterIndex, Rhi::IStructuredBufferPtr& structuredBufferPtr)
 		{
-			mStructuredBufferRootParameterIndex = structuredBufferRootParameterIndex;
-			mStructuredBufferPtr = structuredBufferPtr;
+			if (mStructuredBufferRootParameterIndex != structuredBufferRootParameterIndex || mStructuredBufferPtr != structuredBufferPtr)
+			{
+				mStructuredBufferRootParameterIndex = structuredBufferRootParameterIndex;
+				mStructuredBufferPtr = structuredBufferPtr;
+				makeResourceGroupDirty();
+			}
 		}
 
 		/**
@@ -169,8 +176,10 @@ namespace Renderer
 		*    Root parameter index to bind the resource group to, can be "Renderer::getInvalid<uint32_t>()"
 		*  @param[out] resourceGroup
 		*    RHI resource group to set, must be valid
+		*  @param[in, out] lastBoundMaterialPool
+		*    Material pool last bound into the given command buffer, null pointer after the material blueprint resource has been bound
 		*/
-		void fillGraphicsCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup);
+		void fillGraphicsCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup, const void*& lastBoundMaterialPool);
 
 		/**
 		*  @brief
@@ -184,8 +193,10 @@ namespace Renderer
 		*    Root parameter index to bind the resource group to, can be "Renderer::getInvalid<uint32_t>()"
 		*  @param[out] resourceGroup
 		*    RHI resource group to set, must be valid
+		*  @param[in, out] lastBoundMaterialPool
+		*    Material pool last bound into the given command buffer, null pointer after the material blueprint resource has been bound
 		*/
-		void fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup);
+		void fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup, const void*& lastBoundMaterialPool);
 
 
 	//[-------------------------------------------------------]
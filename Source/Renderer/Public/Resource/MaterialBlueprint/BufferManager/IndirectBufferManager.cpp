@@ -59,9 +59,10 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	IndirectBufferManager::IndirectBufferManager(const IRenderer& renderer) :
+	IndirectBufferManager::IndirectBufferManager(const IRenderer& renderer, bool staged) :
 		mRenderer(renderer),
 		mMaximumIndirectBufferSize(std::min(renderer.getRhi().getCapabilities().maximumIndirectBufferSize, ::detail::DEFAULT_INDIRECT_BUFFER_NUMBER_OF_BYTES)),
+		mStaged(staged),
 		mCurrentIndirectBuffer(nullptr),
 		mPreviouslyRequestedNumberOfBytes(0)
 	{
@@ -94,6 +95,7 @@ namespace Renderer
 		{
 			// Advance indirect buffer offset using the previously requested number of bytes which are consumed now
 			mCurrentIndirectBuffer->indirectBufferOffset += mPreviouslyRequestedNumberOfBytes;
+			mPreviouslyRequestedNumberOfBytes = 0;
 			if ((mCurrentIndirectBuffer->indirectBufferOffset + numberOfBytes) > mMaximumIndirectBufferSize)
 			{
 				// Out of space
@@ -113,7 +115,7 @@ namespace Renderer
 			else
 			{
 				// Use existing free indirect buffer instance
-				mUsedIndirectBuffers.push_back(mFreeIndirectBuffers.back());
+				mUsedIndirectBuffers.push_back(std::move(mFreeIndirectBuffers.back()));
 				mFreeIndirectBuffers.pop_back();
 			}
 			mCurrentIndirectBuffer = &mUsedIndirectBuffers.back();
@@ -125,10 +127,19 @@ namespace Renderer
 				RHI_ASSERT(mRenderer.getContext(), nullptr == mCurrentIndirectBuffer->mappedData, "Invalid current indirect buffer")
 
 				// Map
-				Rhi::MappedSubresource mappedSubresource;
-				if (mRenderer.getRhi().map(*mCurrentIndirectBuffer->indirectBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				if (mStaged)
 				{
-					mCurrentIndirectBuffer->mappedData = static_cast<uint8_t*>(mappedSubresource.data);
+					// RHI resources can only be mapped by the render thread, so fill CPU memory which is uploaded inside "Renderer::IndirectBufferManager::onPreCommandBufferDispatch()"
+					mCurrentIndirectBuffer->stagingData.resize(mMaximumIndirectBufferSize);
+					mCurrentIndirectBuffer->mappedData = mCurrentIndirectBuffer->stagingData.data();
+				}
+				else
+				{
+					Rhi::MappedSubresource mappedSubresource;
+					if (mRenderer.getRhi().map(*mCurrentIndirectBuffer->indirectBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+					{
+						mCurrentIndirectBuffer->mappedData = static_cast<uint8_t*>(mappedSubresource.data);
+					}
 				}
 				RHI_ASSERT(mRenderer.getContext(), nullptr != mCurrentIndirectBuffer->mappedData, "Invalid current indirect buffer")
 			}
@@ -146,8 +157,27 @@ namespace Renderer
 			unmapCurrentIndirectBuffer();
 		}
 
+		// Upload the staged indirect buffers
+		if (mStaged)
+		{
+			Rhi::IRhi& rhi = mRenderer.getRhi();
+			for (IndirectBuffer& indirectBuffer : mUsedIndirectBuffers)
+			{
+				if (indirectBuffer.numberOfStagedBytes > 0)
+				{
+					Rhi::MappedSubresource mappedSubresource;
+					if (rhi.map(*indirectBuffer.indirectBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+					{
+						memcpy(mappedSubresource.data, indirectBuffer.stagingData.data(), indirectBuffer.numberOfStagedBytes);
+						rhi.unmap(*indirectBuffer.indirectBuffer, 0);
+					}
+					indirectBuffer.numberOfStagedBytes = 0;
+				}
+			}
+		}
+
 		// Free all used indirect buffers
-		mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), mUsedIndirectBuffers.begin(), mUsedIndirectBuffers.end());
+		mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), std::make_move_iterator(mUsedIndirectBuffers.begin()), std::make_move_iterator(mUsedIndirectBuffers.end()));
 		mUsedIndirectBuffers.clear();
 	}
 
@@ -162,7 +192,14 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mCurrentIndirectBuffer->mappedData, "Invalid current indirect buffer")
 
 		// Unmap
-		mRenderer.getRhi().unmap(*mCurrentIndirectBuffer->indirectBuffer, 0);
+		if (mStaged)
+		{
+			mCurrentIndirectBuffer->numberOfStagedBytes = mCurrentIndirectBuffer->indirectBufferOffset + mPreviouslyRequestedNumberOfBytes;
+		}
+		else
+		{
+			mRenderer.getRhi().unmap(*mCurrentIndirectBuffer->indirectBuffer, 0);
+		}
 		mCurrentIndirectBuffer->indirectBufferOffset = 0;
 		mCurrentIndirectBuffer->mappedData = nullptr;
 		mCurrentIndirectBuffer = nullptr;
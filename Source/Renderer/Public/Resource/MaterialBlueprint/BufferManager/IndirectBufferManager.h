@@ -78,10 +78,13 @@ namespace Renderer
 			Rhi::IIndirectBuffer* indirectBuffer;		///< RHI indirect buffer instance, always valid
 			uint32_t			  indirectBufferOffset;	///< Current indirect buffer offset
 			uint8_t*			  mappedData;			///< Currently mapped data, don't destroy the data
+			std::vector<uint8_t>  stagingData;			///< Only used in staged mode
+			uint32_t			  numberOfStagedBytes;	///< Only used in staged mode, number of bytes to upload inside "Renderer::IndirectBufferManager::onPreCommandBufferDispatch()"
 			explicit IndirectBuffer(Rhi::IIndirectBuffer* _indirectBuffer) :
 				indirectBuffer(_indirectBuffer),
 				indirectBufferOffset(0),
-				mappedData(nullptr)
+				mappedData(nullptr),
+				numberOfStagedBytes(0)
 			{}
 		};
 
@@ -96,8 +99,10 @@ namespace Renderer
 		*
 		*  @param[in] renderer
 		*    Renderer instance to use, must stay valid as long as the indirect buffer manager instance exists
+		*  @param[in] staged
+		*    If "true", the indirect buffers are filled into CPU memory and uploaded inside "Renderer::IndirectBufferManager::onPreCommandBufferDispatch()", this way the indirect buffers can be filled by a worker thread
 		*/
-		explicit IndirectBufferManager(const IRenderer& renderer);
+		explicit IndirectBufferManager(const IRenderer& renderer, bool staged = false);
 
 		/**
 		*  @brief
@@ -132,6 +137,9 @@ namespace Renderer
 		/**
 		*  @brief
 		*    Called pre command buffer dispatch
+		*
+		*  @note
+		*    - Must be called by the render thread since RHI resources are mapped
 		*/
 		void onPreCommandBufferDispatch();
 
@@ -158,6 +166,7 @@ namespace Renderer
 	private:
 		const IRenderer& mRenderer;
 		uint32_t		 mMaximumIndirectBufferSize;	///< Maximum indirect buffer size in bytes
+		const bool		 mStaged;						///< Fill the indirect buffers into CPU memory which is uploaded inside "Renderer::IndirectBufferManager::onPreCommandBufferDispatch()"?
 		IndirectBuffers	 mFreeIndirectBuffers;
 		IndirectBuffers	 mUsedIndirectBuffers;
 		IndirectBuffer*	 mCurrentIndirectBuffer;		///< Currently filled indirect buffer, can be a null pointer, don't destroy the instance since it's just a reference
@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
@@ -134,7 +135,8 @@ namespace Renderer
 		if (nullptr != lightTextureBuffer)
 		{
 			// TODO(co) We probably need to move the light buffer manager into the material blueprint resource
-			// Create resource group instance, if needed
+			// Create resource group instance, if needed, compositor nodes might be recorded concurrently
+			const std::lock_guard<std::mutex> commandBufferFillMutexLock(mRenderer.getMaterialBlueprintResourceManager().getCommandBufferFillMutex());
 			if (nullptr == mResourceGroup)
 			{
 				// TODO(co) We probably should put the clusters 3D texture resource into the light buffer manager resource group as well
@@ -159,7 +161,8 @@ namespace Renderer
 		if (nullptr != lightTextureBuffer)
 		{
 			// TODO(co) We probably need to move the light buffer manager into the material blueprint resource
-			// Create resource group instance, if needed
+			// Create resource group instance, if needed, compositor nodes might be recorded concurrently
+			const std::lock_guard<std::mutex> commandBufferFillMutexLock(mRenderer.getMaterialBlueprintResourceManager().getCommandBufferFillMutex());
 			if (nullptr == mResourceGroup)
 			{
 				// TODO(co) We probably should put the clusters 3D texture resource into the light buffer manager resource group as well
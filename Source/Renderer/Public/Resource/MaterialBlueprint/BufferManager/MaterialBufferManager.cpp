@@ -47,9 +47,7 @@ namespace Renderer
 		mRenderer(renderer),
 		mMaterialBlueprintResource(materialBlueprintResource),
 		mSlotsPerPool(0),
-		mBufferSize(0),
-		mLastGraphicsBoundPool(nullptr),
-		mLastComputeBoundPool(nullptr)
+		mBufferSize(0)
 	{
 		const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
 		RHI_ASSERT(mRenderer.getContext(), nullptr != materialUniformBuffer, "Invalid material uniform buffer")
@@ -147,59 +145,43 @@ namespace Renderer
 		}
 	}
 
-	void MaterialBufferManager::resetLastGraphicsBoundPool()
+	void MaterialBufferManager::fillGraphicsCommandBuffer(const MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer, const void*& lastBoundMaterialPool) const
 	{
-		mLastGraphicsBoundPool = nullptr;
-		if (!mDirtyMaterialBufferSlots.empty())
+		if (lastBoundMaterialPool != materialBufferSlot.mAssignedMaterialPool)
 		{
-			uploadDirtySlots();
-		}
-	}
-
-	void MaterialBufferManager::resetLastComputeBoundPool()
-	{
-		mLastComputeBoundPool = nullptr;
-		if (!mDirtyMaterialBufferSlots.empty())
-		{
-			uploadDirtySlots();
-		}
-	}
-
-	void MaterialBufferManager::fillGraphicsCommandBuffer(MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer)
-	{
-		if (mLastGraphicsBoundPool != materialBufferSlot.mAssignedMaterialPool)
-		{
-			mLastGraphicsBoundPool = static_cast<BufferPool*>(materialBufferSlot.mAssignedMaterialPool);
-			RHI_ASSERT(mRenderer.getContext(), nullptr != mLastGraphicsBoundPool, "Invalid last graphics bound pool")
+			lastBoundMaterialPool = materialBufferSlot.mAssignedMaterialPool;
+			RHI_ASSERT(mRenderer.getContext(), nullptr != lastBoundMaterialPool, "Invalid last graphics bound pool")
 
 			// Set resource group
 			const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
 			RHI_ASSERT(mRenderer.getContext(), nullptr != materialUniformBuffer, "Invalid material uniform buffer")
-			Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, mLastGraphicsBoundPool->resourceGroup);
+			Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, static_cast<const BufferPool*>(lastBoundMaterialPool)->resourceGroup);
 		}
 	}
 
-	void MaterialBufferManager::fillComputeCommandBuffer(MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer)
+	void MaterialBufferManager::fillComputeCommandBuffer(const MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer, const void*& lastBoundMaterialPool) const
 	{
-		if (mLastComputeBoundPool != materialBufferSlot.mAssignedMaterialPool)
+		if (lastBoundMaterialPool != materialBufferSlot.mAssignedMaterialPool)
 		{
-			mLastComputeBoundPool = static_cast<BufferPool*>(materialBufferSlot.mAssignedMaterialPool);
-			RHI_ASSERT(mRenderer.getContext(), nullptr != mLastComputeBoundPool, "Invalid last compute bound pool")
+			lastBoundMaterialPool = materialBufferSlot.mAssignedMaterialPool;
+			RHI_ASSERT(mRenderer.getContext(), nullptr != lastBoundMaterialPool, "Invalid last compute bound pool")
 
 			// Set resource group
 			const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
 			RHI_ASSERT(mRenderer.getContext(), nullptr != materialUniformBuffer, "Invalid material uniform buffer")
-			Rhi::Command::SetComputeResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, mLastComputeBoundPool->resourceGroup);
+			Rhi::Command::SetComputeResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, static_cast<const BufferPool*>(lastBoundMaterialPool)->resourceGroup);
 		}
 	}
 
-
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
 	void MaterialBufferManager::uploadDirtySlots()
 	{
-		RHI_ASSERT(mRenderer.getContext(), !mDirtyMaterialBufferSlots.empty(), "Invalid dirty material buffer slots")
+		// Nothing to do?
+		if (mDirtyMaterialBufferSlots.empty())
+		{
+			return;
+		}
+
+		// Get relevant data
 		const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
 		RHI_ASSERT(mRenderer.getContext(), nullptr != materialUniformBuffer, "Invalid material uniform buffer")
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>();
@@ -117,18 +117,6 @@ namespace Renderer
 		*/
 		void scheduleForUpdate(MaterialBufferSlot& materialBufferSlot);
 
-		/**
-		*  @brief
-		*    Reset last graphics bound pool and update the dirty slots
-		*/
-		void resetLastGraphicsBoundPool();
-
-		/**
-		*  @brief
-		*    Reset last compute bound pool and update the dirty slots
-		*/
-		void resetLastComputeBoundPool();
-
 		/**
 		*  @brief
 		*    Fill slot to graphics command buffer
@@ -137,8 +125,10 @@ namespace Renderer
 		*    Graphics material buffer slot to bind
 		*  @param[out] commandBuffer
 		*    RHI command buffer to fill
+		*  @param[in, out] lastBoundMaterialPool
+		*    Material pool last bound into the given command buffer, null pointer after the material blueprint resource has been bound, updated by this method
 		*/
-		void fillGraphicsCommandBuffer(MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer);
+		void fillGraphicsCommandBuffer(const MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer, const void*& lastBoundMaterialPool) const;
 
 		/**
 		*  @brief
@@ -148,8 +138,19 @@ namespace Renderer
 		*    Compute material buffer slot to bind
 		*  @param[out] commandBuffer
 		*    RHI command buffer to fill
+		*  @param[in, out] lastBoundMaterialPool
+		*    Material pool last bound into the given command buffer, null pointer after the material blueprint resource has been bound, updated by this method
 		*/
-		void fillComputeCommandBuffer(MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer);
+		void fillComputeCommandBuffer(const MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer, const void*& lastBoundMaterialPool) const;
+
+		/**
+		*  @brief
+		*    Update the slots scheduled for update, if there are any
+		*
+		*  @note
+		*    - Must be called by the render thread since RHI resources are mapped
+		*/
+		void uploadDirtySlots();
 
 
 	//[-------------------------------------------------------]
@@ -158,7 +159,6 @@ namespace Renderer
 	private:
 		explicit MaterialBufferManager(const MaterialBufferManager&) = delete;
 		MaterialBufferManager& operator=(const MaterialBufferManager&) = delete;
-		void uploadDirtySlots();
 
 
 	//[-------------------------------------------------------]
@@ -191,8 +191,6 @@ namespace Renderer
 		uint32_t						 mBufferSize;
 		MaterialBufferSlots				 mDirtyMaterialBufferSlots;
 		MaterialBufferSlots				 mMaterialBufferSlots;
-		const BufferPool*				 mLastGraphicsBoundPool;
-		const BufferPool*				 mLastComputeBoundPool;
 		ScratchBuffer					 mScratchBuffer;
 
 
@@ -45,23 +45,20 @@ namespace Renderer
 		mBufferManager(renderer.getBufferManager()),
 		mMaterialBlueprintResource(materialBlueprintResource),
 		mMaterialBlueprintResourceManager(renderer.getMaterialBlueprintResourceManager()),
-		mPassData
-		{
+		mPassDatas
+		{ {
 			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY },	// cameraRelativeWorldSpaceToClipSpaceMatrixReversedZ (glm::mat4)
 			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY },	// previousCameraRelativeWorldSpaceToClipSpaceMatrixReversedZ (glm::mat4)
 			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY },	// cameraRelativeWorldSpaceToViewSpaceMatrix (glm::mat4)
 			{ Math::QUAT_IDENTITY, Math::QUAT_IDENTITY },	// cameraRelativeWorldSpaceToViewSpaceQuaternion (glm::quat)
 			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY },	// previousCameraRelativeWorldSpaceToViewSpaceMatrix (glm::mat4)
 			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY },	// viewSpaceToClipSpaceMatrix (glm::mat4)
-			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY }	// viewSpaceToClipSpaceMatrixReversedZ (glm::mat4)
-		},
-		mCurrentUniformBufferIndex(0)
+			{ Math::MAT4_IDENTITY, Math::MAT4_IDENTITY },	// viewSpaceToClipSpaceMatrixReversedZ (glm::mat4)
+			Math::DVEC3_ZERO								// worldSpaceCameraPosition (glm::dvec3)
+		} },
+		mNumberOfFilledPassBuffers(0)
 	{
-		const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
-		if (nullptr != passUniformBuffer)
-		{
-			mScratchBuffer.resize(passUniformBuffer->uniformBufferNumberOfBytes);
-		}
+		// Nothing here
 	}
 
 	PassBufferManager::~PassBufferManager()
@@ -74,7 +71,7 @@ namespace Renderer
 		}
 	}
 
-	void PassBufferManager::fillBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, const MaterialResource& materialResource)
+	uint32_t PassBufferManager::fillBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, const MaterialResource& materialResource)
 	{
 		// Even if there's no pass uniform buffer, there must still be a pass buffer manager filling "Renderer::PassBufferManager::PassData" which is used to fill the instances texture buffer
 
@@ -82,16 +79,33 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), isValid(mMaterialBlueprintResource.getComputeShaderBlueprintResourceId()) || nullptr != renderTarget, "Graphics pipeline used but render target is invalid")
 		RHI_ASSERT(mRenderer.getContext(), isInvalid(mMaterialBlueprintResource.getComputeShaderBlueprintResourceId()) || nullptr == renderTarget, "Compute pipeline used but render target is valid")
 
+		// The material blueprint resource listener is shared, so compositor nodes recorded concurrently are serialized in here
+		const std::lock_guard<std::mutex> commandBufferFillMutexLock(mMaterialBlueprintResourceManager.getCommandBufferFillMutex());
+
+		// Get the pass data to fill, each pass buffer index has its own pass data so concurrently recorded command buffers don't overwrite each other
+		const uint32_t passBufferIndex = mNumberOfFilledPassBuffers;
+		++mNumberOfFilledPassBuffers;
+		if (passBufferIndex >= static_cast<uint32_t>(mPassDatas.size()))
+		{
+			const PassData passData = mPassDatas.front();
+			mPassDatas.push_back(passData);
+		}
+
 		// Tell the material blueprint resource listener that we're about to fill a pass uniform buffer
 		IMaterialBlueprintResourceListener& materialBlueprintResourceListener = mMaterialBlueprintResourceManager.getMaterialBlueprintResourceListener();
-		materialBlueprintResourceListener.beginFillPass(mRenderer, renderTarget, compositorContextData, mPassData);
+		materialBlueprintResourceListener.beginFillPass(mRenderer, renderTarget, compositorContextData, mPassDatas[passBufferIndex]);
 
 		// Get the pass uniform buffer containing the description of the element properties
 		const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
 		if (nullptr != passUniformBuffer)
 		{
-			// Startup the pass uniform buffer update
-			uint8_t* scratchBufferPointer = mScratchBuffer.data();
+			// Startup the pass uniform buffer update, the data is staged since mapping RHI resources is only allowed on the render thread
+			const uint32_t uniformBufferNumberOfBytes = passUniformBuffer->uniformBufferNumberOfBytes;
+			if (mStagingBuffer.size() < static_cast<size_t>(passBufferIndex + 1) * uniformBufferNumberOfBytes)
+			{
+				mStagingBuffer.resize(static_cast<size_t>(passBufferIndex + 1) * uniformBufferNumberOfBytes);
+			}
+			uint8_t* scratchBufferPointer = mStagingBuffer.data() + static_cast<size_t>(passBufferIndex) * uniformBufferNumberOfBytes;
 
 			{ // Fill the pass uniform buffer by using the material blueprint resource
 				const MaterialProperties& globalMaterialProperties = mMaterialBlueprintResourceManager.getGlobalMaterialProperties();
@@ -180,50 +194,65 @@ namespace Renderer
 			}
 
 			// Create new uniform buffer, if necessary
-			if (mCurrentUniformBufferIndex >= static_cast<uint32_t>(mUniformBuffers.size()))
+			if (passBufferIndex >= static_cast<uint32_t>(mUniformBuffers.size()))
 			{
 				// Don't directly pass along data or the GPU driver might get confused about the usage and might output performance warnings
-				Rhi::IResource* uniformBuffer = mBufferManager.createUniformBuffer(passUniformBuffer->uniformBufferNumberOfBytes, nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Pass buffer manager"));
+				Rhi::IResource* uniformBuffer = mBufferManager.createUniformBuffer(uniformBufferNumberOfBytes, nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Pass buffer manager"));
 				Rhi::IResourceGroup* resourceGroup = mMaterialBlueprintResource.getRootSignaturePtr()->createResourceGroup(passUniformBuffer->rootParameterIndex, 1, &uniformBuffer, nullptr RHI_RESOURCE_DEBUG_NAME("Pass buffer manager"));
 				mUniformBuffers.emplace_back(static_cast<Rhi::IUniformBuffer*>(uniformBuffer), resourceGroup);
 			}
-
-			{ // Update the uniform buffer by using our scratch buffer
-				Rhi::IUniformBuffer* uniformBuffer = mUniformBuffers[mCurrentUniformBufferIndex].uniformBuffer;
-				Rhi::MappedSubresource mappedSubresource;
-				Rhi::IRhi& rhi = mRenderer.getRhi();
-				if (rhi.map(*uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
-				{
-					memcpy(mappedSubresource.data, mScratchBuffer.data(), static_cast<uint32_t>(mScratchBuffer.size()));
-					rhi.unmap(*uniformBuffer, 0);
-				}
-			}
-			++mCurrentUniformBufferIndex;
 		}
+
+		// Done
+		return passBufferIndex;
 	}
 
-	void PassBufferManager::fillGraphicsCommandBuffer(Rhi::CommandBuffer& commandBuffer) const
+	void PassBufferManager::fillGraphicsCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer) const
 	{
 		// Set resource group
-		if (!mUniformBuffers.empty())
+		const std::lock_guard<std::mutex> commandBufferFillMutexLock(mMaterialBlueprintResourceManager.getCommandBufferFillMutex());
+		if (passBufferIndex < static_cast<uint32_t>(mUniformBuffers.size()))
 		{
 			const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
 			if (nullptr != passUniformBuffer)
 			{
-				Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, mUniformBuffers[mCurrentUniformBufferIndex - 1].resourceGroup);
+				Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, mUniformBuffers[passBufferIndex].resourceGroup);
 			}
 		}
 	}
 
-	void PassBufferManager::fillComputeCommandBuffer(Rhi::CommandBuffer& commandBuffer) const
+	void PassBufferManager::fillComputeCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer) const
 	{
 		// Set resource group
-		if (!mUniformBuffers.empty())
+		const std::lock_guard<std::mutex> commandBufferFillMutexLock(mMaterialBlueprintResourceManager.getCommandBufferFillMutex());
+		if (passBufferIndex < static_cast<uint32_t>(mUniformBuffers.size()))
 		{
 			const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
 			if (nullptr != passUniformBuffer)
 			{
-				Rhi::Command::SetComputeResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, mUniformBuffers[mCurrentUniformBufferIndex - 1].resourceGroup);
+				Rhi::Command::SetComputeResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, mUniformBuffers[passBufferIndex].resourceGroup);
+			}
+		}
+	}
+
+	void PassBufferManager::onPreCommandBufferDispatch()
+	{
+		// Upload the staged pass uniform buffer data of all pass buffers filled since the last command buffer dispatch
+		const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
+		if (nullptr != passUniformBuffer)
+		{
+			RHI_ASSERT(mRenderer.getContext(), mNumberOfFilledPassBuffers <= static_cast<uint32_t>(mUniformBuffers.size()), "Invalid number of filled pass buffers")
+			const uint32_t uniformBufferNumberOfBytes = passUniformBuffer->uniformBufferNumberOfBytes;
+			Rhi::IRhi& rhi = mRenderer.getRhi();
+			for (uint32_t passBufferIndex = 0; passBufferIndex < mNumberOfFilledPassBuffers; ++passBufferIndex)
+			{
+				Rhi::IUniformBuffer* uniformBuffer = mUniformBuffers[passBufferIndex].uniformBuffer;
+				Rhi::MappedSubresource mappedSubresource;
+				if (rhi.map(*uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					memcpy(mappedSubresource.data, mStagingBuffer.data() + static_cast<size_t>(passBufferIndex) * uniformBufferNumberOfBytes, uniformBufferNumberOfBytes);
+					rhi.unmap(*uniformBuffer, 0);
+				}
 			}
 		}
 	}
@@ -101,6 +101,7 @@ namespace Renderer
 			glm::mat4 previousCameraRelativeWorldSpaceToViewSpaceMatrix[2];
 			glm::mat4 viewSpaceToClipSpaceMatrix[2];
 			glm::mat4 viewSpaceToClipSpaceMatrixReversedZ[2];
+			glm::dvec3 worldSpaceCameraPosition;	///< 64 bit world space position of the camera, used by the instance buffer filling for camera relative rendering
 		};
 
 
@@ -135,38 +136,60 @@ namespace Renderer
 		*    Compositor context data
 		*  @param[in] materialResource
 		*    Currently used material resource
+		*
+		*  @return
+		*    Index of the filled pass buffer, to be passed into the other pass buffer methods
+		*
+		*  @note
+		*    - Thread-safe, the pass uniform buffer data is staged and uploaded inside "Renderer::PassBufferManager::onPreCommandBufferDispatch()"
 		*/
-		void fillBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, const MaterialResource& materialResource);
+		[[nodiscard]] uint32_t fillBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, const MaterialResource& materialResource);
 
 		/**
 		*  @brief
 		*    Return the pass data
 		*
+		*  @param[in] passBufferIndex
+		*    Pass buffer index as returned by "Renderer::PassBufferManager::fillBuffer()"
+		*
 		*  @return
 		*    The pass data filled inside "Renderer::PassBufferManager::fillBuffer()"
+		*
+		*  @note
+		*    - The command buffer fill mutex of the material blueprint resource manager must be locked while accessing the pass data
 		*/
-		[[nodiscard]] inline const PassData& getPassData() const
+		[[nodiscard]] inline const PassData& getPassData(uint32_t passBufferIndex) const
 		{
-			return mPassData;
+			return mPassDatas[passBufferIndex];
 		}
 
 		/**
 		*  @brief
-		*    Bind the currently used pass buffer into the given graphics command buffer
+		*    Bind the given pass buffer into the given graphics command buffer
 		*
+		*  @param[in] passBufferIndex
+		*    Pass buffer index as returned by "Renderer::PassBufferManager::fillBuffer()"
 		*  @param[out] commandBuffer
 		*    RHI command buffer to fill
 		*/
-		void fillGraphicsCommandBuffer(Rhi::CommandBuffer& commandBuffer) const;
+		void fillGraphicsCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer) const;
 
 		/**
 		*  @brief
-		*    Bind the currently used pass buffer into the given compute command buffer
+		*    Bind the given pass buffer into the given compute command buffer
 		*
+		*  @param[in] passBufferIndex
+		*    Pass buffer index as returned by "Renderer::PassBufferManager::fillBuffer()"
 		*  @param[out] commandBuffer
 		*    RHI command buffer to fill
 		*/
-		void fillComputeCommandBuffer(Rhi::CommandBuffer& commandBuffer) const;
+		void fillComputeCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer) const;
+
+		/**
+		*  @brief
+		*    Called pre command buffer dispatch, uploads the staged pass uniform buffer data
+		*/
+		void onPreCommandBufferDispatch();
 
 		/**
 		*  @brief
@@ -174,7 +197,7 @@ namespace Renderer
 		*/
 		inline void onPostCommandBufferDispatch()
 		{
-			mCurrentUniformBufferIndex = 0;
+			mNumberOfFilledPassBuffers = 0;
 		}
 
 
@@ -204,7 +227,8 @@ namespace Renderer
 			}
 		};
 		typedef std::vector<UniformBuffer> UniformBuffers;
-		typedef std::vector<uint8_t>	   ScratchBuffer;
+		typedef std::vector<PassData>	   PassDatas;
+		typedef std::vector<uint8_t>	   StagingBuffer;
 
 
 	//[-------------------------------------------------------]
@@ -215,10 +239,10 @@ namespace Renderer
 		Rhi::IBufferManager&					mBufferManager;
 		const MaterialBlueprintResource&		mMaterialBlueprintResource;
 		const MaterialBlueprintResourceManager&	mMaterialBlueprintResourceManager;
-		PassData								mPassData;
+		PassDatas								mPassDatas;					///< Pass data per filled pass buffer, there's always at least one element
 		UniformBuffers							mUniformBuffers;
-		uint32_t								mCurrentUniformBufferIndex;
-		ScratchBuffer							mScratchBuffer;
+		uint32_t								mNumberOfFilledPassBuffers;	///< Number of pass buffers filled since the last command buffer dispatch
+		StagingBuffer							mStagingBuffer;				///< Pass uniform buffer data per filled pass buffer, uploaded inside "Renderer::PassBufferManager::onPreCommandBufferDispatch()"
 
 
 	};
@@ -51,10 +51,11 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	TextureInstanceBufferManager::TextureInstanceBufferManager(IRenderer& renderer) :
+	TextureInstanceBufferManager::TextureInstanceBufferManager(IRenderer& renderer, bool staged) :
 		mRenderer(renderer),
 		mMaximumUniformBufferSize(std::min(renderer.getRhi().getCapabilities().maximumUniformBufferSize, 64u * 1024u)),		// Default uniform buffer number of bytes: 64 KiB
 		mMaximumTextureBufferSize(std::min(renderer.getRhi().getCapabilities().maximumTextureBufferSize, 512u * 1024u)),	// Default texture buffer number of bytes: 512 KiB
+		mStaged(staged),
 		// Current instance buffer related data
 		mCurrentInstanceBufferIndex(getInvalid<size_t>()),
 		mCurrentInstanceBuffer(nullptr),
@@ -113,7 +114,7 @@ namespace Renderer
 		}
 	}
 
-	uint32_t TextureInstanceBufferManager::fillBuffer(const glm::dvec3& worldSpaceCameraPosition, const MaterialBlueprintResource& materialBlueprintResource, PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer& instanceUniformBuffer, const Renderable& renderable, MaterialTechnique& materialTechnique, Rhi::CommandBuffer& commandBuffer)
+	uint32_t TextureInstanceBufferManager::fillBuffer(const glm::dvec3& worldSpaceCameraPosition, const MaterialBlueprintResource& materialBlueprintResource, PassBufferManager* passBufferManager, uint32_t passBufferIndex, const MaterialBlueprintResource::UniformBuffer& instanceUniformBuffer, const Renderable& renderable, MaterialTechnique& materialTechnique, Rhi::CommandBuffer& commandBuffer)
 	{
 		// Sanity checks
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mCurrentInstanceBuffer, "Invalid current instance buffer")
@@ -134,7 +135,8 @@ namespace Renderer
 		const SkeletonResourceId skeletonResourceId = renderable.getSkeletonResourceId();
 		const SkeletonResource* skeletonResource = isValid(skeletonResourceId) ? &mRenderer.getSkeletonResourceManager().getById(skeletonResourceId) : nullptr;
 		static const PassBufferManager::PassData passData = {};
-		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData() : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
+		const std::lock_guard<std::mutex> commandBufferFillMutexLock(materialBlueprintResourceManager.getCommandBufferFillMutex());	// The material blueprint resource listener and the pass data are shared with concurrently recorded compositor nodes
+		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData(passBufferIndex) : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
 
 		{ // Handle instance buffer overflow
 			// Calculate number of additionally needed uniform buffer bytes
@@ -291,6 +293,31 @@ namespace Renderer
 		if (isValid(mCurrentInstanceBufferIndex))
 		{
 			unmapCurrentInstanceBuffer();
+
+			// Upload the staged instance buffers
+			if (mStaged)
+			{
+				Rhi::IRhi& rhi = mRenderer.getRhi();
+				for (InstanceBuffer& instanceBuffer : mInstanceBuffers)
+				{
+					if (instanceBuffer.numberOfStagedUniformBufferBytes > 0 || instanceBuffer.numberOfStagedTextureBufferBytes > 0)
+					{
+						Rhi::MappedSubresource mappedSubresource;
+						if (rhi.map(*instanceBuffer.uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+						{
+							memcpy(mappedSubresource.data, instanceBuffer.uniformBufferStagingData.data(), instanceBuffer.numberOfStagedUniformBufferBytes);
+							rhi.unmap(*instanceBuffer.uniformBuffer, 0);
+						}
+						if (rhi.map(*instanceBuffer.textureBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+						{
+							memcpy(mappedSubresource.data, instanceBuffer.textureBufferStagingData.data(), instanceBuffer.numberOfStagedTextureBufferBytes);
+							rhi.unmap(*instanceBuffer.textureBuffer, 0);
+						}
+						instanceBuffer.numberOfStagedUniformBufferBytes = 0;
+						instanceBuffer.numberOfStagedTextureBufferBytes = 0;
+					}
+				}
+			}
 			mCurrentInstanceBufferIndex = 0;
 			mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
 		}
@@ -337,17 +364,29 @@ namespace Renderer
 			RHI_ASSERT(mRenderer.getContext(), 0 == mStartInstanceLocation, "Invalid start instance location")
 
 			// Map instance buffer
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			Rhi::MappedSubresource mappedSubresource;
-			if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			if (mStaged)
 			{
-				mStartUniformBufferPointer = mCurrentUniformBufferPointer = static_cast<uint8_t*>(mappedSubresource.data);
+				// RHI resources can only be mapped by the render thread, so fill CPU memory which is uploaded inside "Renderer::TextureInstanceBufferManager::onPreCommandBufferDispatch()"
+				mCurrentInstanceBuffer->uniformBufferStagingData.resize(mMaximumUniformBufferSize);
+				mCurrentInstanceBuffer->textureBufferStagingData.resize(mMaximumTextureBufferSize / sizeof(float));
+				mStartUniformBufferPointer = mCurrentUniformBufferPointer = mCurrentInstanceBuffer->uniformBufferStagingData.data();
+				mStartTextureBufferPointer = mCurrentTextureBufferPointer = mCurrentInstanceBuffer->textureBufferStagingData.data();
+				mCurrentInstanceBuffer->mapped = true;
 			}
-			RHI_ASSERT(mRenderer.getContext(), nullptr != mStartUniformBufferPointer, "Invalid start uniform buffer pointer")
-			if (rhi.map(*mCurrentInstanceBuffer->textureBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			else
 			{
-				mStartTextureBufferPointer = mCurrentTextureBufferPointer = static_cast<float*>(mappedSubresource.data);
-				mCurrentInstanceBuffer->mapped = true;
+				Rhi::IRhi& rhi = mRenderer.getRhi();
+				Rhi::MappedSubresource mappedSubresource;
+				if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					mStartUniformBufferPointer = mCurrentUniformBufferPointer = static_cast<uint8_t*>(mappedSubresource.data);
+				}
+				RHI_ASSERT(mRenderer.getContext(), nullptr != mStartUniformBufferPointer, "Invalid start uniform buffer pointer")
+				if (rhi.map(*mCurrentInstanceBuffer->textureBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					mStartTextureBufferPointer = mCurrentTextureBufferPointer = static_cast<float*>(mappedSubresource.data);
+					mCurrentInstanceBuffer->mapped = true;
+				}
 			}
 			RHI_ASSERT(mRenderer.getContext(), nullptr != mStartTextureBufferPointer, "Invalid start texture buffer pointer")
 		}
@@ -365,9 +404,17 @@ namespace Renderer
 			// RHI_ASSERT(mRenderer.getContext(), 0 == mStartInstanceLocation, "Invalid start instance location")	// Not done by intent
 
 			// Unmap instance buffer
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
-			rhi.unmap(*mCurrentInstanceBuffer->textureBuffer, 0);
+			if (mStaged)
+			{
+				mCurrentInstanceBuffer->numberOfStagedUniformBufferBytes = static_cast<uint32_t>(mCurrentUniformBufferPointer - mStartUniformBufferPointer);
+				mCurrentInstanceBuffer->numberOfStagedTextureBufferBytes = static_cast<uint32_t>(mCurrentTextureBufferPointer - mStartTextureBufferPointer) * sizeof(float);
+			}
+			else
+			{
+				Rhi::IRhi& rhi = mRenderer.getRhi();
+				rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
+				rhi.unmap(*mCurrentInstanceBuffer->textureBuffer, 0);
+			}
 			mCurrentInstanceBuffer->mapped = false;
 			mStartUniformBufferPointer = nullptr;
 			mCurrentUniformBufferPointer = nullptr;
@@ -42,9 +42,10 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	UniformInstanceBufferManager::UniformInstanceBufferManager(IRenderer& renderer) :
+	UniformInstanceBufferManager::UniformInstanceBufferManager(IRenderer& renderer, bool staged) :
 		mRenderer(renderer),
 		mMaximumUniformBufferSize(std::min(renderer.getRhi().getCapabilities().maximumUniformBufferSize, 64u * 1024u)),	// Default uniform buffer number of bytes: 64 KiB
+		mStaged(staged),
 		// Current instance buffer related data
 		mCurrentInstanceBufferIndex(getInvalid<size_t>()),
 		mCurrentInstanceBuffer(nullptr),
@@ -95,7 +96,7 @@ namespace Renderer
 		}
 	}
 
-	uint32_t UniformInstanceBufferManager::fillBuffer(const MaterialBlueprintResource& materialBlueprintResource, PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer& instanceUniformBuffer, const Renderable& renderable, MaterialTechnique& materialTechnique, Rhi::CommandBuffer& commandBuffer)
+	uint32_t UniformInstanceBufferManager::fillBuffer(const MaterialBlueprintResource& materialBlueprintResource, PassBufferManager* passBufferManager, uint32_t passBufferIndex, const MaterialBlueprintResource::UniformBuffer& instanceUniformBuffer, const Renderable& renderable, MaterialTechnique& materialTechnique, Rhi::CommandBuffer& commandBuffer)
 	{
 		// Sanity checks
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mCurrentInstanceBuffer, "Invalid current instance buffer")
@@ -112,7 +113,8 @@ namespace Renderer
 		const MaterialBlueprintResource::UniformBufferElementProperties& uniformBufferElementProperties = instanceUniformBuffer.uniformBufferElementProperties;
 		const size_t numberOfUniformBufferElementProperties = uniformBufferElementProperties.size();
 		static const PassBufferManager::PassData passData = {};
-		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData() : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
+		const std::lock_guard<std::mutex> commandBufferFillMutexLock(materialBlueprintResourceManager.getCommandBufferFillMutex());	// The material blueprint resource listener and the pass data are shared with concurrently recorded compositor nodes
+		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData(passBufferIndex) : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
 
 		{ // Handle instance buffer overflow
 			// Calculate number of additionally needed uniform buffer bytes
@@ -228,6 +230,25 @@ namespace Renderer
 		if (isValid(mCurrentInstanceBufferIndex))
 		{
 			unmapCurrentInstanceBuffer();
+
+			// Upload the staged instance buffers
+			if (mStaged)
+			{
+				Rhi::IRhi& rhi = mRenderer.getRhi();
+				for (InstanceBuffer& instanceBuffer : mInstanceBuffers)
+				{
+					if (instanceBuffer.numberOfStagedUniformBufferBytes > 0)
+					{
+						Rhi::MappedSubresource mappedSubresource;
+						if (rhi.map(*instanceBuffer.uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+						{
+							memcpy(mappedSubresource.data, instanceBuffer.uniformBufferStagingData.data(), instanceBuffer.numberOfStagedUniformBufferBytes);
+							rhi.unmap(*instanceBuffer.uniformBuffer, 0);
+						}
+						instanceBuffer.numberOfStagedUniformBufferBytes = 0;
+					}
+				}
+			}
 			mCurrentInstanceBufferIndex = 0;
 			mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
 		}
@@ -268,13 +289,23 @@ namespace Renderer
 			RHI_ASSERT(mRenderer.getContext(), 0 == mStartInstanceLocation, "Invalid start instance location")
 
 			// Map instance buffer
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			Rhi::MappedSubresource mappedSubresource;
-			if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			if (mStaged)
 			{
-				mStartUniformBufferPointer = mCurrentUniformBufferPointer = static_cast<uint8_t*>(mappedSubresource.data);
+				// RHI resources can only be mapped by the render thread, so fill CPU memory which is uploaded inside "Renderer::UniformInstanceBufferManager::onPreCommandBufferDispatch()"
+				mCurrentInstanceBuffer->uniformBufferStagingData.resize(mMaximumUniformBufferSize);
+				mStartUniformBufferPointer = mCurrentUniformBufferPointer = mCurrentInstanceBuffer->uniformBufferStagingData.data();
 				mCurrentInstanceBuffer->mapped = true;
 			}
+			else
+			{
+				Rhi::IRhi& rhi = mRenderer.getRhi();
+				Rhi::MappedSubresource mappedSubresource;
+				if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					mStartUniformBufferPointer = mCurrentUniformBufferPointer = static_cast<uint8_t*>(mappedSubresource.data);
+					mCurrentInstanceBuffer->mapped = true;
+				}
+			}
 			RHI_ASSERT(mRenderer.getContext(), mCurrentInstanceBuffer->mapped, "Current instance buffer isn't mapped")
 		}
 	}
@@ -289,8 +320,15 @@ namespace Renderer
 			// RHI_ASSERT(mRenderer.getContext(), 0 == mStartInstanceLocation, "Invalid start instance location")	// Not done by intent
 
 			// Unmap instance buffer
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
+			if (mStaged)
+			{
+				mCurrentInstanceBuffer->numberOfStagedUniformBufferBytes = static_cast<uint32_t>(mCurrentUniformBufferPointer - mStartUniformBufferPointer);
+			}
+			else
+			{
+				Rhi::IRhi& rhi = mRenderer.getRhi();
+				rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
+			}
 			mCurrentInstanceBuffer->mapped = false;
 			mStartUniformBufferPointer = nullptr;
 			mCurrentUniformBufferPointer = nullptr;
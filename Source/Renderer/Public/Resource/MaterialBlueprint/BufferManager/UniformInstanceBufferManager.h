@@ -76,8 +76,10 @@ namespace Renderer
 		*
 		*  @param[in] renderer
 		*    Renderer instance to use
+		*  @param[in] staged
+		*    If "true", the instance buffers are filled into CPU memory and uploaded inside "Renderer::UniformInstanceBufferManager::onPreCommandBufferDispatch()", this way the instance buffers can be filled by a worker thread
 		*/
-		explicit UniformInstanceBufferManager(IRenderer& renderer);
+		explicit UniformInstanceBufferManager(IRenderer& renderer, bool staged = false);
 
 		/**
 		*  @brief
@@ -104,6 +106,8 @@ namespace Renderer
 		*    Material blueprint resource
 		*  @param[in] passBufferManager
 		*    Pass buffer manager instance to use, can be a null pointer
+		*  @param[in] passBufferIndex
+		*    Pass buffer index as returned by "Renderer::PassBufferManager::fillBuffer()", only used if a pass buffer manager is given
 		*  @param[in] instanceUniformBuffer
 		*    Instance uniform buffer instance to use
 		*  @param[in] renderable
@@ -116,11 +120,14 @@ namespace Renderer
 		*  @return
 		*    Start instance location, used for draw ID (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		*/
-		[[nodiscard]] uint32_t fillBuffer(const MaterialBlueprintResource& materialBlueprintResource, PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer& instanceUniformBuffer, const Renderable& renderable, MaterialTechnique& materialTechnique, Rhi::CommandBuffer& commandBuffer);
+		[[nodiscard]] uint32_t fillBuffer(const MaterialBlueprintResource& materialBlueprintResource, PassBufferManager* passBufferManager, uint32_t passBufferIndex, const MaterialBlueprintResource::UniformBuffer& instanceUniformBuffer, const Renderable& renderable, MaterialTechnique& materialTechnique, Rhi::CommandBuffer& commandBuffer);
 
 		/**
 		*  @brief
 		*    Called pre command buffer dispatch
+		*
+		*  @note
+		*    - Must be called by the render thread since RHI resources are mapped
 		*/
 		void onPreCommandBufferDispatch();
 
@@ -145,10 +152,13 @@ namespace Renderer
 			Rhi::IUniformBuffer* uniformBuffer;	///< Uniform buffer instance, always valid
 			Rhi::IResourceGroup* resourceGroup;	///< Resource group instance, can be a null pointer
 			bool				 mapped;
+			std::vector<uint8_t> uniformBufferStagingData;	///< Only used in staged mode
+			uint32_t			 numberOfStagedUniformBufferBytes;
 			explicit InstanceBuffer(Rhi::IUniformBuffer& _uniformBuffer) :
 				uniformBuffer(&_uniformBuffer),
 				resourceGroup(nullptr),
-				mapped(false)
+				mapped(false),
+				numberOfStagedUniformBufferBytes(0)
 			{
 				// Nothing here
 			}
@@ -163,6 +173,7 @@ namespace Renderer
 	private:
 		IRenderer&		mRenderer;						///< Renderer instance to use
 		const uint32_t	mMaximumUniformBufferSize;		///< Maximum uniform buffer size in bytes
+		const bool		mStaged;						///< Fill the instance buffers into CPU memory which is uploaded inside "Renderer::UniformInstanceBufferManager::onPreCommandBufferDispatch()"?
 		InstanceBuffers	mInstanceBuffers;				///< Instance buffers
 		// Current instance buffer related data
 		size_t			mCurrentInstanceBufferIndex;	///< Current instance buffer index, can be invalid if there's currently no current instance buffer
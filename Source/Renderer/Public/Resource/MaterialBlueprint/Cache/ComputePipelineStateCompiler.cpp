@@ -161,7 +161,7 @@ namespace Renderer
 			ShaderCache* shaderCache = mRenderer.getShaderBlueprintResourceManager().getShaderCacheManager().getComputeShaderCache(computePipelineStateCache.getComputePipelineStateSignature(), materialBlueprintResource, rootSignaturePtr->getRhi().getDefaultShaderLanguage());
 			if (nullptr != shaderCache)
 			{
-				Rhi::IShader* shader = shaderCache->getShaderPtr();
+				Rhi::IShader* shader = shaderCache->getShader();
 				if (nullptr != shader)
 				{
 					computePipelineStateCache.mComputePipelineStateObjectPtr = createComputePipelineState(materialBlueprintResource, *shader);
@@ -219,15 +219,16 @@ namespace Renderer
 						// Get the shader cache identifier, often but not always identical to the shader combination ID
 						const ShaderCacheId shaderCacheId = computePipelineStateSignature.getShaderCombinationId();
 
-						// Does the shader cache already exist?
-						ShaderCache* shaderCache = nullptr;
-						std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
-						ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
-						if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
+						// Does the shader cache already exist? Lookups don't need the shader cache manager mutex.
+						ShaderCache* shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
+						std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex, std::defer_lock);
+						if (nullptr == shaderCache)
 						{
-							shaderCache = shaderCacheIdIterator->second;
+							// Look it up again while holding the shader cache manager mutex, another thread might have created the shader cache in between
+							shaderCacheManagerMutexLock.lock();
+							shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
 						}
-						else
+						if (nullptr == shaderCache)
 						{
 							// Try to create the new compute shader cache instance
 							const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(shaderBlueprintResourceId);
@@ -251,13 +252,13 @@ namespace Renderer
 									// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 									// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 									const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-									ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-									if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
+									ShaderCache* masterShaderCache = shaderCacheManager.tryGetShaderCacheByShaderSourceCodeId(shaderSourceCodeId);
+									if (nullptr != masterShaderCache)
 									{
 										// Reuse already existing shader instance
 										// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-										shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-										shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+										shaderCache = new ShaderCache(shaderCacheId, masterShaderCache);
+										shaderCacheManager.mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
 									}
 									else
 									{
@@ -265,8 +266,8 @@ namespace Renderer
 										shaderCache = new ShaderCache(shaderCacheId);
 										shaderCache->mAssetIds = buildShader.assetIds;
 										shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
-										shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-										shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+										shaderCacheManager.mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
+										shaderCacheManager.mShaderCacheByShaderSourceCodeId.insert(shaderSourceCodeId, shaderCache);
 										compilerRequest.shaderSourceCode = sourceCode;
 									}
 								}
@@ -316,7 +317,7 @@ namespace Renderer
 				ShaderCache* shaderCache = compilerRequest.shaderCache;
 				if (nullptr != shaderCache)
 				{
-					Rhi::IShader* shader = shaderCache->getShaderPtr();
+					Rhi::IShader* shader = shaderCache->getShader();
 					if (nullptr == shader)
 					{
 						// The shader instance is not ready, do we need to compile it right now or is this the job of a shader cache master?
@@ -332,7 +333,7 @@ namespace Renderer
 							// Create the shader instance
 							shader = shaderLanguage.createComputeShaderFromSourceCode(shaderSourceCode.c_str(), &shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("Compute pipeline state compiler"));
 							RHI_ASSERT(mRenderer.getContext(), nullptr != shader, "Invalid shader")	// TODO(co) Error handling
-							shaderCache->mShaderPtr = shader;
+							shaderCache->setShader(shader);
 
 							// Create the compute pipeline state object (PSO)
 							compilerRequest.computePipelineStateObject = createComputePipelineState(materialBlueprintResourceManager.getById(compilerRequest.computePipelineStateCache.getComputePipelineStateSignature().getMaterialBlueprintResourceId()), *shader);
@@ -79,6 +79,11 @@ namespace Renderer
 		}
 		else
 		{
+			// Synchronous, but if the RHI is compiling and linking in the background a fallback spares us from stalling until the graphics program is ready
+			if (mMaterialBlueprintResource.getRootSignaturePtr()->getRhi().getCapabilities().parallelShaderCompilation && !shaderProperties.getSortedPropertyVector().empty())
+			{
+				fallbackGraphicsPipelineStateCache = getFallbackGraphicsPipelineStateCache(serializedGraphicsPipelineStateHash, shaderProperties);
+			}
 			allowEmergencySynchronousCompilation = true;
 		}
 
@@ -93,7 +98,15 @@ namespace Renderer
 			// Asynchronous, the light side
 			graphicsPipelineStateCache->mGraphicsPipelineStateObjectPtr = fallbackGraphicsPipelineStateCache->mGraphicsPipelineStateObjectPtr;
 			graphicsPipelineStateCache->mIsUsingFallback = true;
-			graphicsPipelineStateCompiler.addAsynchronousCompilerRequest(*graphicsPipelineStateCache);
+			if (graphicsPipelineStateCompiler.isAsynchronousCompilationEnabled())
+			{
+				graphicsPipelineStateCompiler.addAsynchronousCompilerRequest(*graphicsPipelineStateCache);
+			}
+			else
+			{
+				// Synchronous graphics program creation, the graphics pipeline state goes live once the RHI is done with the graphics program
+				graphicsPipelineStateCompiler.instantSynchronousCompilerRequest(mMaterialBlueprintResource, *graphicsPipelineStateCache);
+			}
 		}
 		else if (allowEmergencySynchronousCompilation)
 		{
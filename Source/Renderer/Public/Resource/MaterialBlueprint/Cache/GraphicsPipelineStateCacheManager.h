@@ -119,7 +119,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class MaterialBlueprintResource;	// Is creating and using a graphics program cache manager instance
+		friend class MaterialBlueprintResource;			// Is creating and using a graphics program cache manager instance
+		friend class MaterialBlueprintResourceManager;	// Is recording the pipeline state usage
 
 
 	//[-------------------------------------------------------]
@@ -69,6 +69,30 @@ namespace Renderer
 		}
 	}
 
+	void GraphicsPipelineStateCompiler::setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads)
+	{
+		if (mNumberOfBuilderThreads != numberOfBuilderThreads)
+		{
+			// Builder threads shutdown
+			mShutdownBuilderThread = true;
+			mBuilderConditionVariable.notify_all();
+			for (std::thread& thread : mBuilderThreads)
+			{
+				thread.join();
+			}
+
+			// Create the builder threads building the shader source code
+			mNumberOfBuilderThreads = numberOfBuilderThreads;
+			mBuilderThreads.clear();
+			mBuilderThreads.reserve(mNumberOfBuilderThreads);
+			mShutdownBuilderThread = false;
+			for (uint32_t i = 0; i < mNumberOfBuilderThreads; ++i)
+			{
+				mBuilderThreads.push_back(std::thread(&GraphicsPipelineStateCompiler::builderThreadWorker, this));
+			}
+		}
+	}
+
 	void GraphicsPipelineStateCompiler::setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads)
 	{
 		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
@@ -112,6 +136,32 @@ namespace Renderer
 			RHI_ASSERT(mRenderer.getContext(), 0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
 			--mNumberOfInFlightCompilerRequests;
 		}
+
+		// Poll the graphics programs the RHI is finishing in the background, the graphics pipeline state goes live as soon as its graphics program is ready
+		if (!mPendingGraphicsProgramQueue.empty())
+		{
+			const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+			const size_t numberOfPendingCompilerRequests = mPendingGraphicsProgramQueue.size();
+			for (size_t i = 0; i < numberOfPendingCompilerRequests; ++i)
+			{
+				// Get the compiler request, if the graphics program isn't ready yet it's put back at the end of the queue
+				CompilerRequest compilerRequest(mPendingGraphicsProgramQueue.front());
+				mPendingGraphicsProgramQueue.pop_front();
+				if (compilerRequest.graphicsProgram->isReady())
+				{
+					GraphicsPipelineStateCache& graphicsPipelineStateCache = compilerRequest.graphicsPipelineStateCache;
+					const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = graphicsPipelineStateCache.getGraphicsPipelineStateSignature();
+					graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResourceManager.getById(graphicsPipelineStateSignature.getMaterialBlueprintResourceId()), graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *compilerRequest.graphicsProgram);
+					graphicsPipelineStateCache.mIsUsingFallback = false;
+					RHI_ASSERT(mRenderer.getContext(), 0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
+					--mNumberOfInFlightCompilerRequests;
+				}
+				else
+				{
+					mPendingGraphicsProgramQueue.emplace_back(compilerRequest);
+				}
+			}
+		}
 	}
 
 
@@ -121,22 +171,21 @@ namespace Renderer
 	GraphicsPipelineStateCompiler::GraphicsPipelineStateCompiler(IRenderer& renderer) :
 		mRenderer(renderer),
 		mAsynchronousCompilationEnabled(renderer.getRhi().getCapabilities().nativeMultithreading),
+		mNumberOfBuilderThreads(0),
 		mNumberOfCompilerThreads(0),
 		mNumberOfInFlightCompilerRequests(0),
 		mShutdownBuilderThread(false),
-		mBuilderThread(&GraphicsPipelineStateCompiler::builderThreadWorker, this),
 		mShutdownCompilerThread(false)
 	{
 		// Create and start the threads
+		setNumberOfBuilderThreads(2);
 		setNumberOfCompilerThreads(2);
 	}
 
 	GraphicsPipelineStateCompiler::~GraphicsPipelineStateCompiler()
 	{
-		// Builder thread shutdown
-		mShutdownBuilderThread = true;
-		mBuilderConditionVariable.notify_one();
-		mBuilderThread.join();
+		// Builder threads shutdown
+		setNumberOfBuilderThreads(0);
 
 		// Compiler threads shutdown
 		setNumberOfCompilerThreads(0);
@@ -163,7 +212,20 @@ namespace Renderer
 			const Rhi::IGraphicsProgramPtr& graphicsProgramPtr = graphicsProgramCache->getGraphicsProgramPtr();
 			if (nullptr != graphicsProgramPtr)
 			{
-				graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramPtr);
+				if (graphicsPipelineStateCache.mIsUsingFallback && !graphicsProgramPtr->isReady())
+				{
+					// The RHI is still compiling and linking the graphics program in the background, keep using the fallback instead of stalling
+					CompilerRequest compilerRequest(graphicsPipelineStateCache);
+					compilerRequest.graphicsProgram = graphicsProgramPtr;
+					++mNumberOfInFlightCompilerRequests;
+					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+					mPendingGraphicsProgramQueue.emplace_back(compilerRequest);
+				}
+				else
+				{
+					graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramPtr);
+					graphicsPipelineStateCache.mIsUsingFallback = false;
+				}
 			}
 		}
 	}
@@ -223,32 +285,29 @@ namespace Renderer
 						graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId = GraphicsProgramCacheManager::generateGraphicsProgramCacheId(graphicsPipelineStateSignature);
 					}
 					{ // In flight graphics program caches handling
+						// -> Checking and claiming must be one step, else two builder threads might end up building the same graphics program cache
 						std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
-						if (mInFlightGraphicsProgramCaches.find(graphicsProgramCacheId) != mInFlightGraphicsProgramCaches.end())
-						{
-							needToWaitForGraphicsProgramCache = true;
-						}
+						needToWaitForGraphicsProgramCache = !mInFlightGraphicsProgramCaches.insert(graphicsProgramCacheId).second;
 					}
 					if (!needToWaitForGraphicsProgramCache)
 					{
-						std::unique_lock<std::mutex> graphicsProgramCacheManagerMutexLock(graphicsProgramCacheManager.mMutex);
-						const GraphicsProgramCacheManager::GraphicsProgramCacheById::const_iterator iterator = graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId);
-						if (graphicsProgramCacheManager.mGraphicsProgramCacheById.cend() != iterator)
+						GraphicsProgramCache* graphicsProgramCache = nullptr;
+						if (graphicsProgramCacheManager.mGraphicsProgramCacheById.tryGet(graphicsProgramCacheId, graphicsProgramCache))
 						{
 							// Shortcut since the graphics program cache entry already exists: Just create the graphics pipeline state and be done with it
 
 							// Create the graphics pipeline state object (PSO)
-							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *iterator->second->getGraphicsProgramPtr());
+							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramCache->getGraphicsProgramPtr());
 							pushToCompilerQueue = false;
+
+							{ // The graphics program cache isn't in flight after all
+								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
+								mInFlightGraphicsProgramCaches.erase(graphicsProgramCacheId);
+							}
 						}
 						else
 						{
-							// Build the shader source code for the required combination
-							graphicsProgramCacheManagerMutexLock.unlock();
-							{ // Graphics program cache is now in flight
-								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
-								mInFlightGraphicsProgramCaches.insert(graphicsProgramCacheId);
-							}
+							// Build the shader source code for the required combination, the graphics program cache is now in flight
 							for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 							{
 								// Get the shader blueprint resource ID
@@ -259,21 +318,37 @@ namespace Renderer
 									// Get the shader cache identifier, often but not always identical to the shader combination ID
 									const ShaderCacheId shaderCacheId = graphicsPipelineStateSignature.getShaderCombinationId(graphicsShaderType);
 
-									// Does the shader cache already exist?
-									ShaderCache* shaderCache = nullptr;
-									std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
-									ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
-									if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
+									// Does the shader cache already exist? Lookups don't need the shader cache manager mutex.
+									// -> If another builder thread is currently building the shader cache, wait for it instead of building the same shader source code twice
+									ShaderCache* shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
+									bool buildShaderCache = false;
+									if (nullptr == shaderCache)
 									{
-										shaderCache = shaderCacheIdIterator->second;
+										// The builder thread registers the shader cache before it's no longer in flight, so looking it up while holding the in flight mutex can't miss a notification
+										std::unique_lock<std::mutex> inFlightShaderCachesMutexLock(mInFlightShaderCachesMutex);
+										for (;;)
+										{
+											shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
+											if (nullptr != shaderCache)
+											{
+												break;
+											}
+											if (mInFlightShaderCaches.insert(shaderCacheId).second)
+											{
+												// Claimed the shader cache, build it
+												buildShaderCache = true;
+												break;
+											}
+											mInFlightShaderCachesConditionVariable.wait(inFlightShaderCachesMutexLock);
+										}
 									}
-									else
+									if (buildShaderCache)
 									{
 										// Try to create the new graphics shader cache instance
 										const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(shaderBlueprintResourceId);
 										if (nullptr != shaderBlueprintResource)
 										{
-											// Build the shader source code
+											// Build the shader source code, no lock held so the builder threads can work in parallel
 											ShaderBuilder::BuildShader buildShader;
 											shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResource, graphicsPipelineStateSignature.getShaderProperties(), buildShader);
 											std::string& sourceCode = buildShader.sourceCode;
@@ -291,23 +366,30 @@ namespace Renderer
 												// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 												// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 												const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-												ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-												if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
-												{
-													// Reuse already existing shader instance
-													// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-													shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-													shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-												}
-												else
+												std::lock_guard<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+												// -> Look the shader cache up again while holding the shader cache manager mutex, the synchronous "Renderer::ShaderCacheManager::getGraphicsShaderCache()"
+												//    doesn't know about in flight shader caches and might have created it in between
+												shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
+												if (nullptr == shaderCache)
 												{
-													// Create the new shader cache instance
-													shaderCache = new ShaderCache(shaderCacheId);
-													shaderCache->mAssetIds = buildShader.assetIds;
-													shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
-													shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-													shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
-													compilerRequest.shaderSourceCode[i] = sourceCode;
+													ShaderCache* masterShaderCache = shaderCacheManager.tryGetShaderCacheByShaderSourceCodeId(shaderSourceCodeId);
+													if (nullptr != masterShaderCache)
+													{
+														// Reuse already existing shader instance
+														// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
+														shaderCache = new ShaderCache(shaderCacheId, masterShaderCache);
+														shaderCacheManager.mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
+													}
+													else
+													{
+														// Create the new shader cache instance
+														shaderCache = new ShaderCache(shaderCacheId);
+														shaderCache->mAssetIds = buildShader.assetIds;
+														shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
+														shaderCacheManager.mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
+														shaderCacheManager.mShaderCacheByShaderSourceCodeId.insert(shaderSourceCodeId, shaderCache);
+														compilerRequest.shaderSourceCode[i] = sourceCode;
+													}
 												}
 											}
 										}
@@ -316,6 +398,12 @@ namespace Renderer
 											// TODO(co) Error handling
 											RHI_ASSERT(mRenderer.getContext(), false, "Invalid shader blueprint resource")
 										}
+
+										{ // The shader cache is no longer in flight, wake up builder threads waiting for it
+											std::lock_guard<std::mutex> inFlightShaderCachesMutexLock(mInFlightShaderCachesMutex);
+											mInFlightShaderCaches.erase(shaderCacheId);
+										}
+										mInFlightShaderCachesConditionVariable.notify_all();
 									}
 									compilerRequest.shaderCache[i] = shaderCache;
 								}
@@ -380,7 +468,7 @@ namespace Renderer
 					ShaderCache* shaderCache = compilerRequest.shaderCache[i];
 					if (nullptr != shaderCache)
 					{
-						shaders[i] = shaderCache->getShaderPtr();
+						shaders[i] = shaderCache->getShader();
 						if (nullptr == shaders[i])
 						{
 							// The shader instance is not ready, do we need to compile it right now or is this the job of a shader cache master?
@@ -422,7 +510,8 @@ namespace Renderer
 										break;
 								}
 								RHI_ASSERT(mRenderer.getContext(), nullptr != shader, "Invalid shader")	// TODO(co) Error handling
-								shaderCache->mShaderPtr = shaders[i] = shader;
+								shaderCache->setShader(shader);
+								shaders[i] = shader;
 							}
 						}
 					}
@@ -454,8 +543,8 @@ namespace Renderer
 							const GraphicsProgramCacheId graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId;
 							RHI_ASSERT(mRenderer.getContext(), isValid(graphicsProgramCacheId), "Invalid graphics program cache ID")
 							std::unique_lock<std::mutex> mutexLock(graphicsProgramCacheManager.mMutex);
-							RHI_ASSERT(mRenderer.getContext(), graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId) == graphicsProgramCacheManager.mGraphicsProgramCacheById.cend(), "Invalid graphics program cache ID")	// TODO(co) Error handling
-							graphicsProgramCacheManager.mGraphicsProgramCacheById.emplace(graphicsProgramCacheId, new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram));
+							[[maybe_unused]] const bool inserted = graphicsProgramCacheManager.mGraphicsProgramCacheById.insert(graphicsProgramCacheId, new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram));
+							RHI_ASSERT(mRenderer.getContext(), inserted, "Invalid graphics program cache ID")	// TODO(co) Error handling
 
 							{ // The graphics program cache is no longer in flight
 								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
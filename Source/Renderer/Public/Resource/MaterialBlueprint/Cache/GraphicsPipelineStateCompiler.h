@@ -81,6 +81,7 @@ namespace Renderer
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
 	typedef uint32_t GraphicsProgramCacheId;	///< Graphics program cache identifier, result of hashing the shader combination IDs of the referenced shaders
+	typedef uint32_t ShaderCacheId;				///< Shader cache identifier, often but not always identical to the shader combination ID
 
 
 	//[-------------------------------------------------------]
@@ -92,10 +93,13 @@ namespace Renderer
 	*
 	*  @remarks
 	*    A graphics pipeline state must master the following stages in order to archive the inner wisdom:
-	*    1. Asynchronous shader building
+	*    1. Asynchronous shader building, a shader cache is built by only one builder thread at a time
 	*    2. Asynchronous shader compilation
 	*    3. Synchronous RHI implementation dispatch TODO(co) Asynchronous RHI implementation dispatch if supported by the RHI implementation
 	*
+	*    Without asynchronous compilation (e.g. OpenGL) but with "Rhi::Capabilities::parallelShaderCompilation", the driver compiles and links in the
+	*    background: A graphics pipeline state cache with a fallback then waits inside the pending graphics program queue until its graphics program is ready.
+	*
 	*  @note
 	*    - Takes care of asynchronous graphics pipeline state compilation
 	*/
@@ -121,6 +125,13 @@ namespace Renderer
 
 		void setAsynchronousCompilationEnabled(bool enabled);
 
+		[[nodiscard]] inline uint32_t getNumberOfBuilderThreads() const
+		{
+			return mNumberOfBuilderThreads;
+		}
+
+		void setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads);
+
 		[[nodiscard]] inline uint32_t getNumberOfCompilerThreads() const
 		{
 			return mNumberOfCompilerThreads;
@@ -143,10 +154,16 @@ namespace Renderer
 			flushQueue(mCompilerMutex, mCompilerQueue);
 		}
 
+		inline void flushPendingGraphicsProgramQueue()
+		{
+			flushQueue(mDispatchMutex, mPendingGraphicsProgramQueue);
+		}
+
 		inline void flushAllQueues()
 		{
 			flushBuilderQueue();
 			flushCompilerQueue();
+			flushPendingGraphicsProgramQueue();
 		}
 
 		void dispatch();
@@ -164,11 +181,13 @@ namespace Renderer
 			GraphicsProgramCacheId		 graphicsProgramCacheId;
 			ShaderCache*				 shaderCache[NUMBER_OF_GRAPHICS_SHADER_TYPES];
 			std::string					 shaderSourceCode[NUMBER_OF_GRAPHICS_SHADER_TYPES];
+			Rhi::IGraphicsProgram*		 graphicsProgram;				///< Only used by the pending graphics program queue, owned by the graphics program cache
 			Rhi::IGraphicsPipelineState* graphicsPipelineStateObject;
 
 			inline explicit CompilerRequest(GraphicsPipelineStateCache& _graphicsPipelineStateCache) :
 				graphicsPipelineStateCache(_graphicsPipelineStateCache),
 				graphicsProgramCacheId(getInvalid<GraphicsProgramCacheId>()),
+				graphicsProgram(nullptr),
 				graphicsPipelineStateObject(nullptr)
 			{
 				for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
@@ -179,6 +198,7 @@ namespace Renderer
 			inline explicit CompilerRequest(const CompilerRequest& compilerRequest) :
 				graphicsPipelineStateCache(compilerRequest.graphicsPipelineStateCache),
 				graphicsProgramCacheId(compilerRequest.graphicsProgramCacheId),
+				graphicsProgram(compilerRequest.graphicsProgram),
 				graphicsPipelineStateObject(compilerRequest.graphicsPipelineStateObject)
 			{
 				for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
@@ -190,9 +210,11 @@ namespace Renderer
 			CompilerRequest& operator=(const CompilerRequest&) = delete;
 		};
 
+		typedef std::vector<std::thread> BuilderThreads;
 		typedef std::vector<std::thread> CompilerThreads;
 		typedef std::deque<CompilerRequest> CompilerRequests;
 		typedef std::unordered_set<GraphicsProgramCacheId> InFlightGraphicsProgramCaches;
+		typedef std::unordered_set<ShaderCacheId> InFlightShaderCaches;
 
 
 	//[-------------------------------------------------------]
@@ -217,17 +239,21 @@ namespace Renderer
 	private:
 		IRenderer&					  mRenderer;	///< Renderer instance, do not destroy the instance
 		bool						  mAsynchronousCompilationEnabled;
+		uint32_t					  mNumberOfBuilderThreads;
 		uint32_t					  mNumberOfCompilerThreads;
 		std::atomic<uint32_t>		  mNumberOfInFlightCompilerRequests;
 		std::mutex					  mInFlightGraphicsProgramCachesMutex;
 		InFlightGraphicsProgramCaches mInFlightGraphicsProgramCaches;
+		std::mutex					  mInFlightShaderCachesMutex;
+		InFlightShaderCaches		  mInFlightShaderCaches;	///< Shader caches a builder thread is currently building the shader source code for
+		std::condition_variable		  mInFlightShaderCachesConditionVariable;	///< Notified as soon as a shader cache is no longer in flight, protected by "mInFlightShaderCachesMutex"
 
 		// Asynchronous building (moderate cost)
 		std::atomic<bool>		mShutdownBuilderThread;
 		std::mutex				mBuilderMutex;
 		std::condition_variable	mBuilderConditionVariable;
 		CompilerRequests		mBuilderQueue;
-		std::thread				mBuilderThread;
+		BuilderThreads			mBuilderThreads;
 
 		// Asynchronous compilation (nuts cost)
 		std::atomic<bool>		mShutdownCompilerThread;
@@ -239,6 +265,7 @@ namespace Renderer
 		// Synchronous dispatch
 		std::mutex		 mDispatchMutex;
 		CompilerRequests mDispatchQueue;
+		CompilerRequests mPendingGraphicsProgramQueue;	///< Synchronous compiler requests waiting for the RHI to finish the graphics program in the background, protected by "mDispatchMutex"
 
 
 	};
@@ -0,0 +1,278 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsProgramBinaryCacheManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
+#include "Renderer/Public/Asset/AssetManager.h"
+#include "Renderer/Public/Core/File/IFile.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+#include "Renderer/Public/Core/Math/Math.h"
+#include "Renderer/Public/IRenderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline uint64_t getGraphicsProgramBinaryKey(Renderer::AssetId materialBlueprintAssetId, Renderer::GraphicsProgramCacheId graphicsProgramCacheId)
+		{
+			return (static_cast<uint64_t>(materialBlueprintAssetId) << 32u) | graphicsProgramCacheId;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	Rhi::IGraphicsProgram* GraphicsProgramBinaryCacheManager::createGraphicsProgram(AssetId materialBlueprintAssetId, GraphicsProgramCacheId graphicsProgramCacheId, Rhi::IShaderLanguage& shaderLanguage, const Rhi::IRootSignature& rootSignature, const Rhi::VertexAttributes& vertexAttributes)
+	{
+		Rhi::IGraphicsProgram* graphicsProgram = nullptr;
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		GraphicsProgramBinaryByKey::iterator iterator = mGraphicsProgramBinaryByKey.find(::detail::getGraphicsProgramBinaryKey(materialBlueprintAssetId, graphicsProgramCacheId));
+		if (iterator != mGraphicsProgramBinaryByKey.end() && nullptr == iterator->second->graphicsProgramPtr)
+		{
+			graphicsProgram = shaderLanguage.createGraphicsProgramFromBinary(rootSignature, vertexAttributes, iterator->second->graphicsProgramBinary RHI_RESOURCE_DEBUG_NAME("Graphics program binary cache manager"));
+			if (nullptr == graphicsProgram)
+			{
+				// The RHI rejected the graphics program binary, usually due to a driver update: Forget about it, the caller is going to store a fresh one
+				delete iterator->second;
+				mGraphicsProgramBinaryByKey.erase(iterator);
+				mCacheNeedsSaving = true;
+			}
+		}
+
+		// Done
+		return graphicsProgram;
+	}
+
+	void GraphicsProgramBinaryCacheManager::storeGraphicsProgram(AssetId materialBlueprintAssetId, GraphicsProgramCacheId graphicsProgramCacheId, Rhi::IGraphicsProgram& graphicsProgram, const AssetIds& assetIds)
+	{
+		GraphicsProgramBinary* graphicsProgramBinary = new GraphicsProgramBinary();
+		graphicsProgramBinary->assetIds = assetIds;
+		graphicsProgramBinary->combinedAssetFileHashes = calculateCombinedAssetFileHashes(assetIds);
+		graphicsProgramBinary->graphicsProgramPtr = &graphicsProgram;
+
+		// Replace a possibly existing graphics program binary
+		const uint64_t key = ::detail::getGraphicsProgramBinaryKey(materialBlueprintAssetId, graphicsProgramCacheId);
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		GraphicsProgramBinaryByKey::iterator iterator = mGraphicsProgramBinaryByKey.find(key);
+		if (iterator != mGraphicsProgramBinaryByKey.end())
+		{
+			if (nullptr == iterator->second->graphicsProgramPtr)
+			{
+				mPendingGraphicsProgramBinaryKeys.push_back(key);
+			}
+			delete iterator->second;
+			iterator->second = graphicsProgramBinary;
+		}
+		else
+		{
+			mGraphicsProgramBinaryByKey.emplace(key, graphicsProgramBinary);
+			mPendingGraphicsProgramBinaryKeys.push_back(key);
+		}
+		mCacheNeedsSaving = true;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	uint64_t GraphicsProgramBinaryCacheManager::calculateCombinedAssetFileHashes(const AssetIds& assetIds) const
+	{
+		const AssetManager& assetManager = mMaterialBlueprintResourceManager.getRenderer().getAssetManager();
+		uint64_t combinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
+		for (AssetId assetId : assetIds)
+		{
+			const Asset* asset = assetManager.tryGetAssetByAssetId(assetId);
+			if (nullptr != asset)
+			{
+				combinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), combinedAssetFileHashes);
+			}
+		}
+		return combinedAssetFileHashes;
+	}
+
+	void GraphicsProgramBinaryCacheManager::fetchGraphicsProgramBinaries(bool waitForGraphicsPrograms)
+	{
+		// Fetch the graphics program binaries of the graphics programs the RHI finished compiling and linking, this way we only keep
+		// a graphics program alive until its graphics program binary is known and not until the cache is saved
+		// -> "mMutex" must already be locked by the caller
+		size_t index = 0;
+		while (index < mPendingGraphicsProgramBinaryKeys.size())
+		{
+			GraphicsProgramBinaryByKey::iterator iterator = mGraphicsProgramBinaryByKey.find(mPendingGraphicsProgramBinaryKeys[index]);
+			if (iterator != mGraphicsProgramBinaryByKey.end())
+			{
+				GraphicsProgramBinary* graphicsProgramBinary = iterator->second;
+				ASSERT(nullptr != graphicsProgramBinary->graphicsProgramPtr, "Invalid graphics program")
+				if (!waitForGraphicsPrograms && 1 != graphicsProgramBinary->graphicsProgramPtr->getRefCount() && !graphicsProgramBinary->graphicsProgramPtr->isReady())
+				{
+					// Still in use and the RHI is still compiling and linking it in the background, check again later on
+					++index;
+					continue;
+				}
+
+				// If we're the last one holding a reference, fetching the graphics program binary might block but the graphics program is about to be destroyed anyway
+				const bool result = graphicsProgramBinary->graphicsProgramPtr->getGraphicsProgramBinary(graphicsProgramBinary->graphicsProgramBinary);
+				graphicsProgramBinary->graphicsProgramPtr = nullptr;
+				if (!result || 0 == graphicsProgramBinary->graphicsProgramBinary.getNumberOfBytes())
+				{
+					// No error, the RHI is free to not provide a graphics program binary for e.g. task and mesh shader based graphics programs
+					delete graphicsProgramBinary;
+					mGraphicsProgramBinaryByKey.erase(iterator);
+				}
+			}
+
+			// Unordered removal, the processing order doesn't matter
+			mPendingGraphicsProgramBinaryKeys[index] = mPendingGraphicsProgramBinaryKeys.back();
+			mPendingGraphicsProgramBinaryKeys.pop_back();
+		}
+	}
+
+	void GraphicsProgramBinaryCacheManager::update()
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		if (!mPendingGraphicsProgramBinaryKeys.empty())
+		{
+			fetchGraphicsProgramBinaries(false);
+		}
+	}
+
+	void GraphicsProgramBinaryCacheManager::clearCache()
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		for (auto& graphicsProgramBinaryElement : mGraphicsProgramBinaryByKey)
+		{
+			delete graphicsProgramBinaryElement.second;
+		}
+		mGraphicsProgramBinaryByKey.clear();
+		mPendingGraphicsProgramBinaryKeys.clear();
+		mCacheNeedsSaving = false;
+	}
+
+	void GraphicsProgramBinaryCacheManager::loadCache(IFile& file)
+	{
+		clearCache();
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+
+		// Load graphics program binaries
+		uint32_t numberOfGraphicsProgramBinaries = getInvalid<uint32_t>();
+		file.read(&numberOfGraphicsProgramBinaries, sizeof(uint32_t));
+		mGraphicsProgramBinaryByKey.reserve(numberOfGraphicsProgramBinaries);
+		std::vector<uint8_t> bytes;
+		AssetIds assetIds;
+		for (uint32_t i = 0; i < numberOfGraphicsProgramBinaries; ++i)
+		{
+			uint64_t key = getInvalid<uint64_t>();
+			file.read(&key, sizeof(uint64_t));
+
+			// Load list of IDs of the assets (material blueprint, shader blueprint, shader piece) which took part in the graphics program creation
+			uint32_t numberOfAssetIds = getInvalid<uint32_t>();
+			file.read(&numberOfAssetIds, sizeof(uint32_t));
+			ASSERT(0 != numberOfAssetIds, "Invalid number of asset IDs")
+			assetIds.resize(numberOfAssetIds);
+			file.read(assetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
+			uint64_t combinedAssetFileHashes = getInvalid<uint64_t>();
+			file.read(&combinedAssetFileHashes, sizeof(uint64_t));
+			uint32_t numberOfBytes = getInvalid<uint32_t>();
+			file.read(&numberOfBytes, sizeof(uint32_t));
+
+			// Check whether or not the graphics program binary is still valid
+			if (calculateCombinedAssetFileHashes(assetIds) != combinedAssetFileHashes)
+			{
+				// Graphics program binary is out-of-date, the next save will drop it
+				file.skip(numberOfBytes);
+				mCacheNeedsSaving = true;
+			}
+			else
+			{
+				// Graphics program binary is still valid, whether or not the RHI accepts it is checked when it's used
+				GraphicsProgramBinary* graphicsProgramBinary = new GraphicsProgramBinary();
+				graphicsProgramBinary->assetIds = assetIds;
+				graphicsProgramBinary->combinedAssetFileHashes = combinedAssetFileHashes;
+				bytes.resize(numberOfBytes);
+				file.read(bytes.data(), numberOfBytes);
+				graphicsProgramBinary->graphicsProgramBinary.setBytecodeCopy(numberOfBytes, bytes.data());
+				mGraphicsProgramBinaryByKey.emplace(key, graphicsProgramBinary);
+			}
+		}
+	}
+
+	void GraphicsProgramBinaryCacheManager::saveCache(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+
+		// Fetch the graphics program binaries which aren't known yet
+		fetchGraphicsProgramBinaries(true);
+
+		// Save graphics program binaries
+		const uint32_t numberOfGraphicsProgramBinaries = static_cast<uint32_t>(mGraphicsProgramBinaryByKey.size());
+		file.write(&numberOfGraphicsProgramBinaries, sizeof(uint32_t));
+		for (const auto& graphicsProgramBinaryElement : mGraphicsProgramBinaryByKey)
+		{
+			const GraphicsProgramBinary* graphicsProgramBinary = graphicsProgramBinaryElement.second;
+			file.write(&graphicsProgramBinaryElement.first, sizeof(uint64_t));
+
+			// Write list of IDs of the assets (material blueprint, shader blueprint, shader piece) which took part in the graphics program creation
+			const uint32_t numberOfAssetIds = static_cast<uint32_t>(graphicsProgramBinary->assetIds.size());
+			file.write(&numberOfAssetIds, sizeof(uint32_t));
+			file.write(graphicsProgramBinary->assetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
+			file.write(&graphicsProgramBinary->combinedAssetFileHashes, sizeof(uint64_t));
+
+			// Write graphics program binary
+			const uint32_t numberOfBytes = graphicsProgramBinary->graphicsProgramBinary.getNumberOfBytes();
+			file.write(&numberOfBytes, sizeof(uint32_t));
+			file.write(graphicsProgramBinary->graphicsProgramBinary.getBytecode(), numberOfBytes);
+		}
+
+		// Done
+		mCacheNeedsSaving = false;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
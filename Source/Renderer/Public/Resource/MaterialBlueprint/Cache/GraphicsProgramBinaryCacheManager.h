@@ -0,0 +1,227 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Manager.h"
+#include "Renderer/Public/Core/StringId.h"
+#include "Renderer/Public/Core/Platform/PlatformTypes.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_UInt_is_zero': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_UInt_is_zero': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+	#include <vector>
+	#include <unordered_map>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IFile;
+	class MaterialBlueprintResourceManager;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef StringId			 AssetId;					///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef std::vector<AssetId> AssetIds;
+	typedef uint32_t			 GraphicsProgramCacheId;	///< Graphics program cache identifier, result of hashing the shader combination IDs of the referenced shaders
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/*
+	*  @brief
+	*    Graphics program binary cache manager
+	*
+	*  @remarks
+	*    Keeps the RHI graphics program binaries (e.g. OpenGL "GL_ARB_get_program_binary") of linked graphics programs so the next run can
+	*    skip shader compilation and program linking. Graphics program binaries are keyed by the material blueprint asset ID and the graphics
+	*    program cache ID. They're only valid for the RHI and driver which created them, so they're stored inside a local cache file of their
+	*    own instead of being part of the pipeline state object cache which can be shipped.
+	*
+	*  @note
+	*    - Only used if "Rhi::Capabilities::graphicsProgramBinary" is true
+	*    - Asset changes are detected by using the file hashes of the assets which took part in the graphics program creation, the RHI
+	*      rejects graphics program binaries of other drivers
+	*/
+	class GraphicsProgramBinaryCacheManager final : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class MaterialBlueprintResourceManager;	// Is creating and using a graphics program binary cache manager instance
+		friend class RendererImpl;						// Is loading and saving the graphics program binary cache
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the owner material blueprint resource manager
+		*
+		*  @return
+		*    The owner material blueprint resource manager
+		*/
+		[[nodiscard]] inline MaterialBlueprintResourceManager& getMaterialBlueprintResourceManager() const
+		{
+			return mMaterialBlueprintResourceManager;
+		}
+
+		/**
+		*  @brief
+		*    Create a graphics program by using a cached graphics program binary; synchronous processing
+		*
+		*  @param[in] materialBlueprintAssetId
+		*    Asset ID of the material blueprint the graphics program is created for
+		*  @param[in] graphicsProgramCacheId
+		*    Graphics program cache ID
+		*  @param[in] shaderLanguage
+		*    RHI shader language to use
+		*  @param[in] rootSignature
+		*    RHI root signature
+		*  @param[in] vertexAttributes
+		*    RHI vertex attributes
+		*
+		*  @return
+		*    The created graphics program, null pointer if there's no cached graphics program binary or the RHI rejected it
+		*
+		*  @note
+		*    - A graphics program binary rejected by the RHI is removed from the cache
+		*/
+		[[nodiscard]] Rhi::IGraphicsProgram* createGraphicsProgram(AssetId materialBlueprintAssetId, GraphicsProgramCacheId graphicsProgramCacheId, Rhi::IShaderLanguage& shaderLanguage, const Rhi::IRootSignature& rootSignature, const Rhi::VertexAttributes& vertexAttributes);
+
+		/**
+		*  @brief
+		*    Store the graphics program binary of a freshly created graphics program; synchronous processing
+		*
+		*  @note
+		*    - The graphics program binary is fetched as soon as the RHI finished compiling and linking the graphics program in the background (see "Renderer::MaterialBlueprintResourceManager::update()"), the graphics program is only kept alive until then
+		*
+		*  @param[in] materialBlueprintAssetId
+		*    Asset ID of the material blueprint the graphics program was created for
+		*  @param[in] graphicsProgramCacheId
+		*    Graphics program cache ID
+		*  @param[in] graphicsProgram
+		*    RHI graphics program to store the graphics program binary of
+		*  @param[in] assetIds
+		*    IDs of the assets (material blueprint, shader blueprint, shader piece) which took part in the graphics program creation
+		*/
+		void storeGraphicsProgram(AssetId materialBlueprintAssetId, GraphicsProgramCacheId graphicsProgramCacheId, Rhi::IGraphicsProgram& graphicsProgram, const AssetIds& assetIds);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct GraphicsProgramBinary final
+		{
+			AssetIds			assetIds;					///< IDs of the assets (material blueprint, shader blueprint, shader piece) which took part in the graphics program creation
+			uint64_t			combinedAssetFileHashes;	///< Combination of the file hash of all assets which took part in the graphics program creation
+			Rhi::ShaderBytecode	graphicsProgramBinary;		///< Opaque RHI graphics program binary
+			Rhi::IGraphicsProgramPtr graphicsProgramPtr;	///< Graphics program to fetch the graphics program binary from as soon as it's ready, null pointer if the graphics program binary is already known
+		};
+		typedef std::unordered_map<uint64_t, GraphicsProgramBinary*> GraphicsProgramBinaryByKey;	///< Key = material blueprint asset ID in the upper and graphics program cache ID in the lower 32 bits
+		typedef std::vector<uint64_t> GraphicsProgramBinaryKeys;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		inline explicit GraphicsProgramBinaryCacheManager(MaterialBlueprintResourceManager& materialBlueprintResourceManager) :
+			mMaterialBlueprintResourceManager(materialBlueprintResourceManager),
+			mCacheNeedsSaving(false)
+		{
+			// Nothing here
+		}
+
+		inline ~GraphicsProgramBinaryCacheManager()
+		{
+			clearCache();
+		}
+
+		explicit GraphicsProgramBinaryCacheManager(const GraphicsProgramBinaryCacheManager&) = delete;
+		GraphicsProgramBinaryCacheManager& operator=(const GraphicsProgramBinaryCacheManager&) = delete;
+		[[nodiscard]] uint64_t calculateCombinedAssetFileHashes(const AssetIds& assetIds) const;
+		void fetchGraphicsProgramBinaries(bool waitForGraphicsPrograms);
+		void update();
+		void clearCache();
+		void loadCache(IFile& file);
+
+		[[nodiscard]] inline bool doesCacheNeedSaving() const
+		{
+			return mCacheNeedsSaving;
+		}
+
+		void saveCache(IFile& file);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		MaterialBlueprintResourceManager& mMaterialBlueprintResourceManager;	///< Owner material blueprint resource manager
+		GraphicsProgramBinaryByKey		  mGraphicsProgramBinaryByKey;			///< Manages the graphics program binaries, we're responsible for destroying the instances
+		GraphicsProgramBinaryKeys		  mPendingGraphicsProgramBinaryKeys;	///< Keys of the graphics program binaries which still need to be fetched from their graphics program
+		bool							  mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
+		std::mutex						  mMutex;								///< Mutex due to "Renderer::GraphicsProgramCacheManager" interaction
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
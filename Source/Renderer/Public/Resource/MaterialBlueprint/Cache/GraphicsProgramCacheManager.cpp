@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsProgramCacheManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsProgramCache.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsProgramBinaryCacheManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderCache.h"
@@ -65,60 +66,82 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	GraphicsProgramCache* GraphicsProgramCacheManager::getGraphicsProgramCacheByGraphicsPipelineStateSignature(const GraphicsPipelineStateSignature& graphicsPipelineStateSignature)
 	{
-		// Does the graphics program cache already exist?
+		// Does the graphics program cache already exist? Lookups don't need the mutex.
 		GraphicsProgramCache* graphicsProgramCache = nullptr;
 		const GraphicsProgramCacheId graphicsProgramCacheId = generateGraphicsProgramCacheId(graphicsPipelineStateSignature);
-		std::unique_lock<std::mutex> mutexLock(mMutex);
-		GraphicsProgramCacheById::const_iterator iterator = mGraphicsProgramCacheById.find(graphicsProgramCacheId);
-		if (iterator != mGraphicsProgramCacheById.cend())
+		if (mGraphicsProgramCacheById.tryGet(graphicsProgramCacheId, graphicsProgramCache))
 		{
-			graphicsProgramCache = iterator->second;
+			return graphicsProgramCache;
 		}
-		else
+
+		// Look it up again while holding the mutex, another thread might have created the graphics program cache in between
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		if (!mGraphicsProgramCacheById.tryGet(graphicsProgramCacheId, graphicsProgramCache))
 		{
 			// Create the RHI program: Decide which shader language should be used (for example "GLSL" or "HLSL")
 			const MaterialBlueprintResource& materialBlueprintResource = mGraphicsPipelineStateCacheManager.getMaterialBlueprintResource();
 			const Rhi::IRootSignaturePtr& rootSignaturePtr = materialBlueprintResource.getRootSignaturePtr();
 			Rhi::IShaderLanguage& shaderLanguage = rootSignaturePtr->getRhi().getDefaultShaderLanguage();
-			const IRenderer& renderer = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRenderer();
-
-			// Create the shaders
-			ShaderCacheManager& shaderCacheManager = renderer.getShaderBlueprintResourceManager().getShaderCacheManager();
-			Rhi::IShader* shaders[NUMBER_OF_GRAPHICS_SHADER_TYPES] = {};
-			for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
+			const MaterialBlueprintResourceManager& materialBlueprintResourceManager = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>();
+			const IRenderer& renderer = materialBlueprintResourceManager.getRenderer();
+			const Rhi::VertexAttributes& vertexAttributes = renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+
+			// Try to restore the graphics program from a previously stored graphics program binary, this way we don't even need to touch the shaders
+			GraphicsProgramBinaryCacheManager* graphicsProgramBinaryCacheManager = materialBlueprintResourceManager.getGraphicsProgramBinaryCacheManager();
+			Rhi::IGraphicsProgram* graphicsProgram = nullptr;
+			if (nullptr != graphicsProgramBinaryCacheManager)
 			{
-				ShaderCache* shaderCache = shaderCacheManager.getGraphicsShaderCache(graphicsPipelineStateSignature, materialBlueprintResource, shaderLanguage, static_cast<GraphicsShaderType>(i));
-				if (nullptr != shaderCache)
+				graphicsProgram = graphicsProgramBinaryCacheManager->createGraphicsProgram(materialBlueprintResource.getAssetId(), graphicsProgramCacheId, shaderLanguage, *rootSignaturePtr, vertexAttributes);
+			}
+			if (nullptr == graphicsProgram)
+			{
+				// Create the shaders
+				ShaderCacheManager& shaderCacheManager = renderer.getShaderBlueprintResourceManager().getShaderCacheManager();
+				Rhi::IShader* shaders[NUMBER_OF_GRAPHICS_SHADER_TYPES] = {};
+				AssetIds assetIds;
+				assetIds.push_back(materialBlueprintResource.getAssetId());
+				for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 				{
-					shaders[i] = shaderCache->getShaderPtr();
+					ShaderCache* shaderCache = shaderCacheManager.getGraphicsShaderCache(graphicsPipelineStateSignature, materialBlueprintResource, shaderLanguage, static_cast<GraphicsShaderType>(i));
+					if (nullptr != shaderCache)
+					{
+						shaders[i] = shaderCache->getShader();
+						const AssetIds& shaderCacheAssetIds = shaderCache->getAssetIds();
+						assetIds.insert(assetIds.end(), shaderCacheAssetIds.cbegin(), shaderCacheAssetIds.cend());
+					}
+					else
+					{
+						// No error, just means there's no shader cache because e.g. there's no shader of the requested type
+					}
 				}
-				else
+
+				// Create the graphics program
+				graphicsProgram = shaderLanguage.createGraphicsProgram(*rootSignaturePtr, vertexAttributes,
+					static_cast<Rhi::IVertexShader*>(shaders[static_cast<int>(GraphicsShaderType::Vertex)]),
+					static_cast<Rhi::ITessellationControlShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationControl)]),
+					static_cast<Rhi::ITessellationEvaluationShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationEvaluation)]),
+					static_cast<Rhi::IGeometryShader*>(shaders[static_cast<int>(GraphicsShaderType::Geometry)]),
+					static_cast<Rhi::IFragmentShader*>(shaders[static_cast<int>(GraphicsShaderType::Fragment)])
+					RHI_RESOURCE_DEBUG_NAME("Graphics program cache manager")
+				);
+
+				// Store the graphics program binary so the next run can skip shader compilation and program linking
+				if (nullptr != graphicsProgram && nullptr != graphicsProgramBinaryCacheManager)
 				{
-					// No error, just means there's no shader cache because e.g. there's no shader of the requested type
+					graphicsProgramBinaryCacheManager->storeGraphicsProgram(materialBlueprintResource.getAssetId(), graphicsProgramCacheId, *graphicsProgram, assetIds);
 				}
 			}
 
-			// Create the graphics program
-			Rhi::IGraphicsProgram* graphicsProgram = shaderLanguage.createGraphicsProgram(*rootSignaturePtr,
-				renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes(),
-				static_cast<Rhi::IVertexShader*>(shaders[static_cast<int>(GraphicsShaderType::Vertex)]),
-				static_cast<Rhi::ITessellationControlShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationControl)]),
-				static_cast<Rhi::ITessellationEvaluationShader*>(shaders[static_cast<int>(GraphicsShaderType::TessellationEvaluation)]),
-				static_cast<Rhi::IGeometryShader*>(shaders[static_cast<int>(GraphicsShaderType::Geometry)]),
-				static_cast<Rhi::IFragmentShader*>(shaders[static_cast<int>(GraphicsShaderType::Fragment)])
-				RHI_RESOURCE_DEBUG_NAME("Graphics program cache manager")
-			);
-
 			// Create the new graphics program cache instance
 			if (nullptr != graphicsProgram)
 			{
 				graphicsProgramCache = new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram);
-				mGraphicsProgramCacheById.emplace(graphicsProgramCacheId, graphicsProgramCache);
+				mGraphicsProgramCacheById.insert(graphicsProgramCacheId, graphicsProgramCache);
 			}
 			else
 			{
 				// TODO(co) Error handling
-				RHI_ASSERT(materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getContext(), false, "Invalid graphics program")
+				RHI_ASSERT(renderer.getContext(), false, "Invalid graphics program")
 			}
 		}
 
@@ -129,10 +152,10 @@ namespace Renderer
 	void GraphicsProgramCacheManager::clearCache()
 	{
 		std::unique_lock<std::mutex> mutexLock(mMutex);
-		for (auto& graphicsProgramCacheElement : mGraphicsProgramCacheById)
+		mGraphicsProgramCacheById.forEach([](GraphicsProgramCacheId, GraphicsProgramCache* graphicsProgramCache)
 		{
-			delete graphicsProgramCacheElement.second;
-		}
+			delete graphicsProgramCache;
+		});
 		mGraphicsProgramCacheById.clear();
 	}
 
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Core/Manager.h"
 #include "Renderer/Public/Core/Platform/PlatformTypes.h"
+#include "Renderer/Public/Core/Thread/ShardedHashMap.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -38,7 +39,6 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
 	#include <mutex>
-	#include <unordered_map>
 PRAGMA_WARNING_POP
 
 
@@ -138,6 +138,23 @@ namespace Renderer
 		*/
 		void clearCache();
 
+		/**
+		*  @brief
+		*    Return the lock statistics of the graphics program cache ID lookups, can be used to monitor the contention during permutation storms
+		*
+		*  @return
+		*    The lock statistics, only a snapshot since the builder threads might be still running
+		*/
+		[[nodiscard]] inline ShardedHashMapStatistics getGraphicsProgramCacheLookupStatistics() const
+		{
+			return mGraphicsProgramCacheById.getStatistics();
+		}
+
+		inline void resetGraphicsProgramCacheLookupStatistics()
+		{
+			mGraphicsProgramCacheById.resetStatistics();
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -162,7 +179,7 @@ namespace Renderer
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::unordered_map<GraphicsProgramCacheId, GraphicsProgramCache*> GraphicsProgramCacheById;
+		typedef ShardedHashMap<GraphicsProgramCacheId, GraphicsProgramCache*> GraphicsProgramCacheById;
 
 
 	//[-------------------------------------------------------]
@@ -171,7 +188,7 @@ namespace Renderer
 	private:
 		GraphicsPipelineStateCacheManager& mGraphicsPipelineStateCacheManager;	///< Owner graphics pipeline state cache manager
 		GraphicsProgramCacheById		   mGraphicsProgramCacheById;
-		std::mutex						   mMutex;								///< Mutex due to "Renderer::GraphicsPipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
+		std::mutex						   mMutex;								///< Mutex due to "Renderer::GraphicsPipelineStateCompiler" interaction, only serializes the creation of new graphics program caches so checking and inserting is one step, lookups go through the concurrent map without it
 
 
 	};
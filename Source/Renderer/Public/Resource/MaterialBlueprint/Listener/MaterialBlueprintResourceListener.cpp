@@ -356,6 +356,7 @@ namespace Renderer
 		mPassData = &passData;
 		mCompositorContextData = &compositorContextData;
 		mWorldSpaceCameraPosition = compositorContextData.getWorldSpaceCameraPosition();
+		passData.worldSpaceCameraPosition = mWorldSpaceCameraPosition;
 
 		// Get the render target with and height
 		if (nullptr != renderTarget)
@@ -1077,9 +1078,9 @@ namespace Renderer
 				// -> 0 = World space x position
 				// -> 1 = World space y position
 				// -> 2 = World space z position
-				*reinterpret_cast<float*>(integerBuffer)	 = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.x - mWorldSpaceCameraPosition.x);
-				*reinterpret_cast<float*>(integerBuffer + 1) = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.y - mWorldSpaceCameraPosition.y);
-				*reinterpret_cast<float*>(integerBuffer + 2) = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.z - mWorldSpaceCameraPosition.z);
+				*reinterpret_cast<float*>(integerBuffer)	 = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.x - mPassData->worldSpaceCameraPosition.x);
+				*reinterpret_cast<float*>(integerBuffer + 1) = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.y - mPassData->worldSpaceCameraPosition.y);
+				*reinterpret_cast<float*>(integerBuffer + 2) = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.z - mPassData->worldSpaceCameraPosition.z);
 
 				// 3 = w = The assigned material slot inside the material uniform buffer
 				integerBuffer[3] = mMaterialTechnique->getAssignedMaterialSlot();
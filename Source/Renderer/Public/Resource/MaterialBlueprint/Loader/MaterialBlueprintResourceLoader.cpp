@@ -64,8 +64,7 @@ namespace Renderer
 		mMemoryFile.read(&materialBlueprintHeader, sizeof(v1MaterialBlueprint::MaterialBlueprintHeader));
 
 		{ // Read properties
-			// TODO(co) Get rid of the evil const-cast
-			MaterialProperties::SortedPropertyVector& sortedPropertyVector = const_cast<MaterialProperties::SortedPropertyVector&>(mMaterialBlueprintResource->mMaterialProperties.getSortedPropertyVector());
+			MaterialProperties::SortedPropertyVector& sortedPropertyVector = mMaterialBlueprintResource->mMaterialProperties.getSortedPropertyVector();
 			if (materialBlueprintHeader.numberOfProperties > 0)
 			{
 				sortedPropertyVector.resize(materialBlueprintHeader.numberOfProperties);
@@ -395,7 +394,9 @@ namespace Renderer
 		}
 
 		{ // Get the textures
+			// -> The material blueprint resource references the texture resources by ID without a resource listener, so pin them to ensure they're not unloaded by the texture resource manager
 			TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
+			mMaterialBlueprintResource->releasePinnedTextureResources();
 			MaterialBlueprintResource::Textures& textures = mMaterialBlueprintResource->mTextures;
 			const size_t numberOfTextures = textures.size();
 			const v1MaterialBlueprint::Texture* materialBlueprintTexture = mMaterialBlueprintTextures;
@@ -410,6 +411,11 @@ namespace Renderer
 				if (materialProperty.getValueType() == MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID)
 				{
 					textureResourceManager.loadTextureResourceByAssetId(materialProperty.getTextureAssetIdValue(), texture.fallbackTextureAssetId, texture.textureResourceId, nullptr, texture.rgbHardwareGammaCorrection);
+					if (isValid(texture.textureResourceId))
+					{
+						textureResourceManager.getById(texture.textureResourceId).addPinnedReference();
+						mMaterialBlueprintResource->mPinnedTextureResourceIds.push_back(texture.textureResourceId);
+					}
 				}
 			}
 		}
@@ -27,6 +27,8 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/MaterialBufferManager.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/ShaderPiece/ShaderPieceResourceManager.h"
+#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
+#include "Renderer/Public/Resource/Texture/TextureResource.h"
 #include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/Asset/AssetManager.h"
 #include "Renderer/Public/IRenderer.h"
@@ -251,7 +253,7 @@ namespace Renderer
 		}
 	}
 
-	void MaterialBlueprintResource::fillGraphicsCommandBuffer(Rhi::CommandBuffer& commandBuffer)
+	void MaterialBlueprintResource::fillGraphicsCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer)
 	{
 		// Set the used graphics root signature
 		Rhi::Command::SetGraphicsRootSignature::create(commandBuffer, mRootSignaturePtr);
@@ -259,13 +261,14 @@ namespace Renderer
 		// Bind pass buffer manager, if required
 		if (nullptr != mPassBufferManager)
 		{
-			mPassBufferManager->fillGraphicsCommandBuffer(commandBuffer);
+			mPassBufferManager->fillGraphicsCommandBuffer(passBufferIndex, commandBuffer);
 		}
 
 		// Set our sampler states
 		if (!mSamplerStates.empty())
 		{
-			// Create sampler resource group, if needed
+			// Create sampler resource group, if needed, compositor nodes might be recorded concurrently
+			const std::lock_guard<std::mutex> commandBufferFillMutexLock(getResourceManager<MaterialBlueprintResourceManager>().getCommandBufferFillMutex());
 			if (nullptr == mSamplerStateGroup)
 			{
 				std::vector<Rhi::IResource*> resources;
@@ -284,13 +287,14 @@ namespace Renderer
 		}
 
 		// It's valid if a graphics material blueprint resource doesn't contain a material uniform buffer (usually the case for compositor material blueprint resources)
+		// -> Concurrently recorded compositor nodes find no dirty slots in here, the compositor workspace instance uploads them on the render thread up-front
 		if (nullptr != mMaterialBufferManager)
 		{
-			mMaterialBufferManager->resetLastGraphicsBoundPool();
+			mMaterialBufferManager->uploadDirtySlots();
 		}
 	}
 
-	void MaterialBlueprintResource::fillComputeCommandBuffer(Rhi::CommandBuffer& commandBuffer)
+	void MaterialBlueprintResource::fillComputeCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer)
 	{
 		// Set the used compute root signature
 		Rhi::Command::SetComputeRootSignature::create(commandBuffer, mRootSignaturePtr);
@@ -298,13 +302,14 @@ namespace Renderer
 		// Bind pass buffer manager, if required
 		if (nullptr != mPassBufferManager)
 		{
-			mPassBufferManager->fillComputeCommandBuffer(commandBuffer);
+			mPassBufferManager->fillComputeCommandBuffer(passBufferIndex, commandBuffer);
 		}
 
 		// Set our sampler states
 		if (!mSamplerStates.empty())
 		{
-			// Create sampler resource group, if needed
+			// Create sampler resource group, if needed, compositor nodes might be recorded concurrently
+			const std::lock_guard<std::mutex> commandBufferFillMutexLock(getResourceManager<MaterialBlueprintResourceManager>().getCommandBufferFillMutex());
 			if (nullptr == mSamplerStateGroup)
 			{
 				std::vector<Rhi::IResource*> resources;
@@ -325,7 +330,7 @@ namespace Renderer
 		// It's valid if a compute material blueprint resource doesn't contain a material uniform buffer (usually the case for compositor material blueprint resources)
 		if (nullptr != mMaterialBufferManager)
 		{
-			mMaterialBufferManager->resetLastComputeBoundPool();
+			mMaterialBufferManager->uploadDirtySlots();
 		}
 	}
 
@@ -559,6 +564,7 @@ namespace Renderer
 	void MaterialBlueprintResource::deinitializeElement()
 	{
 		// TODO(co) Reset everything
+		releasePinnedTextureResources();
 		setInvalid(mVertexAttributesResourceId);
 		memset(mGraphicsShaderBlueprintResourceId, static_cast<int>(getInvalid<ShaderBlueprintResourceId>()), sizeof(ShaderBlueprintResourceId) * NUMBER_OF_GRAPHICS_SHADER_TYPES);
 		setInvalid(mComputeShaderBlueprintResourceId);
@@ -567,6 +573,21 @@ namespace Renderer
 		IResource::deinitializeElement();
 	}
 
+	void MaterialBlueprintResource::releasePinnedTextureResources()
+	{
+		// The texture resource manager is destroyed after the material blueprint resource manager
+		const TextureResourceManager& textureResourceManager = getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getTextureResourceManager();
+		for (TextureResourceId textureResourceId : mPinnedTextureResourceIds)
+		{
+			TextureResource* textureResource = textureResourceManager.tryGetById(textureResourceId);
+			if (nullptr != textureResource)
+			{
+				textureResource->releasePinnedReference();
+			}
+		}
+		mPinnedTextureResourceIds.clear();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
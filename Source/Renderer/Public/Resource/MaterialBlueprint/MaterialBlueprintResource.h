@@ -511,19 +511,23 @@ namespace Renderer
 		*  @brief
 		*    Bind the graphics material blueprint resource into the given command buffer
 		*
+		*  @param[in] passBufferIndex
+		*    Pass buffer index as returned by "Renderer::PassBufferManager::fillBuffer()", ignored if there's no pass buffer manager
 		*  @param[out] commandBuffer
 		*    RHI command buffer to fill
 		*/
-		RENDERER_API_EXPORT void fillGraphicsCommandBuffer(Rhi::CommandBuffer& commandBuffer);
+		RENDERER_API_EXPORT void fillGraphicsCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer);
 
 		/**
 		*  @brief
 		*    Bind the compute material blueprint resource into the given command buffer
 		*
+		*  @param[in] passBufferIndex
+		*    Pass buffer index as returned by "Renderer::PassBufferManager::fillBuffer()", ignored if there's no pass buffer manager
 		*  @param[out] commandBuffer
 		*    RHI command buffer to fill
 		*/
-		RENDERER_API_EXPORT void fillComputeCommandBuffer(Rhi::CommandBuffer& commandBuffer);
+		RENDERER_API_EXPORT void fillComputeCommandBuffer(uint32_t passBufferIndex, Rhi::CommandBuffer& commandBuffer);
 
 		/**
 		*  @brief
@@ -575,6 +579,18 @@ namespace Renderer
 		void initializeElement(MaterialBlueprintResourceId materialBlueprintResourceId);
 		void deinitializeElement();
 
+		/**
+		*  @brief
+		*    Release the pinned references to the texture resources of the material blueprint textures
+		*/
+		void releasePinnedTextureResources();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<TextureResourceId> TextureResourceIds;
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -597,6 +613,7 @@ namespace Renderer
 		TextureBuffers mTextureBuffers;
 		SamplerStates  mSamplerStates;
 		Textures	   mTextures;
+		TextureResourceIds mPinnedTextureResourceIds;	///< IDs of the texture resources of the material blueprint textures the material blueprint resource holds a pinned reference to, the texture resources are referenced by ID without a resource listener
 		// Resource groups
 		Rhi::IResourceGroupPtr mSamplerStateGroup;
 		// Ease-of-use direct access
@@ -28,15 +28,23 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/UniformInstanceBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/TextureInstanceBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/PassBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/MaterialBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsProgramBinaryCacheManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateCache.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/Cache/ComputePipelineStateCache.h"
 #include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
 #include "Renderer/Public/Resource/Material/MaterialTechnique.h"
 #include "Renderer/Public/Resource/Material/MaterialResource.h"
 #include "Renderer/Public/Resource/ResourceManagerTemplate.h"
 #include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/File/MemoryFile.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/Context.h"
 
+#include <unordered_set>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -56,6 +64,15 @@ namespace
 			uint32_t		  numberOfBytes;
 		};
 
+		struct RecordedPipelineState final
+		{
+			Renderer::AssetId								 materialBlueprintAssetId;				///< Material blueprint asset ID, unlike the material blueprint resource ID it's valid across sessions
+			uint32_t										 serializedGraphicsPipelineStateHash;	///< FNV1a hash of "Rhi::SerializedGraphicsPipelineState", invalid for compute pipeline states
+			Renderer::ShaderProperties::SortedPropertyVector sortedPropertyVector;
+		};
+		typedef std::vector<RecordedPipelineState> RecordedPipelineStates;
+		typedef std::unordered_map<uint32_t, Rhi::SerializedGraphicsPipelineState> RecordedSerializedGraphicsPipelineStates;	///< Key = FNV1a hash of "Rhi::SerializedGraphicsPipelineState"
+
 
 		//[-------------------------------------------------------]
 		//[ Global variables                                      ]
@@ -63,6 +80,57 @@ namespace
 		static Renderer::MaterialBlueprintResourceListener defaultMaterialBlueprintResourceListener;
 
 
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] uint64_t getRecordedPipelineStateKey(const RecordedPipelineState& recordedPipelineState)
+		{
+			const uint32_t materialBlueprintAssetId = recordedPipelineState.materialBlueprintAssetId;
+			uint64_t key = Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&materialBlueprintAssetId), sizeof(uint32_t), Renderer::Math::FNV1a_INITIAL_HASH_64);
+			key = Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&recordedPipelineState.serializedGraphicsPipelineStateHash), sizeof(uint32_t), key);
+			if (!recordedPipelineState.sortedPropertyVector.empty())
+			{
+				key = Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(recordedPipelineState.sortedPropertyVector.data()), static_cast<uint32_t>(sizeof(Renderer::ShaderProperties::Property) * recordedPipelineState.sortedPropertyVector.size()), key);
+			}
+			return key;
+		}
+
+		void readRecordedPipelineStates(Renderer::IFile& file, RecordedSerializedGraphicsPipelineStates& recordedSerializedGraphicsPipelineStates, RecordedPipelineStates& recordedPipelineStates)
+		{
+			{ // Read the serialized graphics pipeline states
+				uint32_t numberOfElements = Renderer::getInvalid<uint32_t>();
+				file.read(&numberOfElements, sizeof(uint32_t));
+				recordedSerializedGraphicsPipelineStates.reserve(numberOfElements);
+				for (uint32_t i = 0; i < numberOfElements; ++i)
+				{
+					uint32_t key = Renderer::getInvalid<uint32_t>();
+					file.read(&key, sizeof(uint32_t));
+					Rhi::SerializedGraphicsPipelineState serializedGraphicsPipelineState = {};
+					file.read(&serializedGraphicsPipelineState, sizeof(Rhi::SerializedGraphicsPipelineState));
+					recordedSerializedGraphicsPipelineStates.emplace(key, serializedGraphicsPipelineState);
+				}
+			}
+
+			{ // Read the recorded pipeline states
+				uint32_t numberOfElements = 0;
+				file.read(&numberOfElements, sizeof(uint32_t));
+				recordedPipelineStates.resize(numberOfElements);
+				for (RecordedPipelineState& recordedPipelineState : recordedPipelineStates)
+				{
+					file.read(&recordedPipelineState.materialBlueprintAssetId, sizeof(uint32_t));
+					file.read(&recordedPipelineState.serializedGraphicsPipelineStateHash, sizeof(uint32_t));
+					uint32_t numberOfShaderProperties = 0;
+					file.read(&numberOfShaderProperties, sizeof(uint32_t));
+					recordedPipelineState.sortedPropertyVector.resize(numberOfShaderProperties);
+					if (numberOfShaderProperties > 0)
+					{
+						file.read(recordedPipelineState.sortedPropertyVector.data(), sizeof(Renderer::ShaderProperties::Property) * numberOfShaderProperties);
+					}
+				}
+			}
+		}
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -98,9 +166,7 @@ namespace Renderer
 		bool load = (reload && nullptr != asset);
 		if (nullptr == materialBlueprintResource && nullptr != asset)
 		{
-			materialBlueprintResource = &mInternalResourceManager->getResources().addElement();
-			materialBlueprintResource->setResourceManager(this);
-			materialBlueprintResource->setAssetId(assetId);
+			materialBlueprintResource = &mInternalResourceManager->addResource(assetId);
 			materialBlueprintResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			load = true;
 		}
@@ -165,6 +231,17 @@ namespace Renderer
 
 	void MaterialBlueprintResourceManager::onPreCommandBufferDispatch()
 	{
+		{ // Upload the staged pass buffer data of all material blueprint resources
+			const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+			for (uint32_t i = 0; i < numberOfElements; ++i)
+			{
+				PassBufferManager* passBufferManager = mInternalResourceManager->getResources().getElementByIndex(i).getPassBufferManager();
+				if (nullptr != passBufferManager)
+				{
+					passBufferManager->onPreCommandBufferDispatch();
+				}
+			}
+		}
 		if (nullptr != mUniformInstanceBufferManager)
 		{
 			mUniformInstanceBufferManager->onPreCommandBufferDispatch();
@@ -318,6 +395,12 @@ namespace Renderer
 		}
 		mGlobalMaterialProperties.setPropertyById(STRING_ID("GlobalTimeInSeconds"), MaterialPropertyValue::fromFloat(timeManager.getGlobalTimeInSeconds()), MaterialProperty::Usage::SHADER_UNIFORM);
 		mGlobalMaterialProperties.setPropertyById(STRING_ID("GlobalFramesPerSecond"), MaterialPropertyValue::fromFloat(timeManager.getFramesPerSecond()), MaterialProperty::Usage::SHADER_UNIFORM);
+
+		// Fetch the graphics program binaries of graphics programs the RHI finished in the meantime
+		if (nullptr != mGraphicsProgramBinaryCacheManager)
+		{
+			mGraphicsProgramBinaryCacheManager->update();
+		}
 	}
 
 
@@ -342,7 +425,8 @@ namespace Renderer
 		mUniformInstanceBufferManager(nullptr),
 		mTextureInstanceBufferManager(nullptr),
 		mIndirectBufferManager(nullptr),
-		mLightBufferManager(nullptr)
+		mLightBufferManager(nullptr),
+		mGraphicsProgramBinaryCacheManager(nullptr)
 	{
 		// Create internal resource manager
 		mInternalResourceManager = new ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>(renderer, *this);
@@ -360,6 +444,12 @@ namespace Renderer
 			mLightBufferManager = new LightBufferManager(renderer);
 		}
 
+		// Create graphics program binary cache manager, if the RHI is able to provide graphics program binaries
+		if (capabilities.graphicsProgramBinary)
+		{
+			mGraphicsProgramBinaryCacheManager = new GraphicsProgramBinaryCacheManager(*this);
+		}
+
 		// Update at once to have all managed global material properties known from the start
 		update();
 		mGlobalMaterialProperties.setPropertyById(STRING_ID("GlobalNumberOfMultisamples"), MaterialPropertyValue::fromInteger(0), MaterialProperty::Usage::SHADER_COMBINATION);
@@ -373,6 +463,9 @@ namespace Renderer
 		delete mIndirectBufferManager;
 		delete mLightBufferManager;
 
+		// Destroy graphics program binary cache manager
+		delete mGraphicsProgramBinaryCacheManager;
+
 		// Shutdown material blueprint resource listener (we know there must be such an instance)
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mMaterialBlueprintResourceListener, "Invalid material blueprint resource listener")
 		mMaterialBlueprintResourceListener->onShutdown(mRenderer);
@@ -458,8 +551,8 @@ namespace Renderer
 					{
 						RHI_LOG(mRenderer.getContext(), COMPATIBILITY_WARNING, "The pipeline state object cache contains an unknown material blueprint asset. Might have happened due to renaming or removal which can be considered normal during development, but not in shipped builds.")
 
-						// TODO(co) Enable file skip after "Renderer::MaterialBlueprintResource::savePipelineStateObjectCache()" has been implemented
-						// file.skip(materialBlueprintCacheEntry.numberOfBytes);
+						// Skip the cache entry, a recorded pipeline state usage might e.g. have been recorded using a different set of assets
+						file.skip(materialBlueprintCacheEntry.numberOfBytes);
 					}
 				}
 			}
@@ -513,18 +606,149 @@ namespace Renderer
 					firstMaterialBlueprintCacheEntryIndex = static_cast<uint32_t>(memoryFile.getNumberOfBytes() - sizeof(::detail::MaterialBlueprintCacheEntry));
 				}
 			}
-			::detail::MaterialBlueprintCacheEntry* firstMaterialBlueprintCacheEntry = reinterpret_cast< ::detail::MaterialBlueprintCacheEntry*>(&memoryFile.getByteVector()[firstMaterialBlueprintCacheEntryIndex]);
 
 			// Loop through all material blueprint resources and write the cache entries
+			// -> Writing might reallocate the memory file byte vector, so don't keep a pointer to the header around
 			for (uint32_t i = 0; i < numberOfElements; ++i)
 			{
 				const uint32_t fileStart = static_cast<uint32_t>(memoryFile.getNumberOfBytes());
 				mInternalResourceManager->getResources().getElementByIndex(i).savePipelineStateObjectCache(memoryFile);
+				::detail::MaterialBlueprintCacheEntry* firstMaterialBlueprintCacheEntry = reinterpret_cast< ::detail::MaterialBlueprintCacheEntry*>(&memoryFile.getByteVector()[firstMaterialBlueprintCacheEntryIndex]);
 				firstMaterialBlueprintCacheEntry[i].numberOfBytes = static_cast<uint32_t>(memoryFile.getNumberOfBytes() - fileStart);
 			}
 		}
 	}
 
+	void MaterialBlueprintResourceManager::loadPipelineStateUsage(IFile& file)
+	{
+		::detail::RecordedSerializedGraphicsPipelineStates recordedSerializedGraphicsPipelineStates;
+		::detail::RecordedPipelineStates recordedPipelineStates;
+		::detail::readRecordedPipelineStates(file, recordedSerializedGraphicsPipelineStates, recordedPipelineStates);
+		for (const auto& elementPair : recordedSerializedGraphicsPipelineStates)
+		{
+			addSerializedGraphicsPipelineState(elementPair.first, elementPair.second);
+		}
+
+		// Request the recorded material blueprint resources and wait until they're loaded
+		std::unordered_map<uint32_t, MaterialBlueprintResourceId> materialBlueprintResourceIdByAssetId;
+		for (const ::detail::RecordedPipelineState& recordedPipelineState : recordedPipelineStates)
+		{
+			if (materialBlueprintResourceIdByAssetId.find(recordedPipelineState.materialBlueprintAssetId) == materialBlueprintResourceIdByAssetId.cend())
+			{
+				MaterialBlueprintResourceId materialBlueprintResourceId = getInvalid<MaterialBlueprintResourceId>();
+				if (nullptr != mRenderer.getAssetManager().tryGetAssetByAssetId(recordedPipelineState.materialBlueprintAssetId))
+				{
+					loadMaterialBlueprintResourceByAssetId(recordedPipelineState.materialBlueprintAssetId, materialBlueprintResourceId, nullptr, false, getInvalid<ResourceLoaderTypeId>(), false);
+				}
+				else
+				{
+					RHI_LOG(mRenderer.getContext(), COMPATIBILITY_WARNING, "The recorded pipeline state usage contains an unknown material blueprint asset. Might have happened due to renaming or removal which can be considered normal during development, but not in shipped builds.")
+				}
+				materialBlueprintResourceIdByAssetId.emplace(recordedPipelineState.materialBlueprintAssetId, materialBlueprintResourceId);
+			}
+		}
+		mRenderer.flushAllQueues();
+
+		// Request the recorded pipeline state caches, without a fallback pipeline state cache they're compiled synchronously
+		ShaderProperties shaderProperties;
+		for (const ::detail::RecordedPipelineState& recordedPipelineState : recordedPipelineStates)
+		{
+			const MaterialBlueprintResourceId materialBlueprintResourceId = materialBlueprintResourceIdByAssetId[recordedPipelineState.materialBlueprintAssetId];
+			MaterialBlueprintResource* materialBlueprintResource = isValid(materialBlueprintResourceId) ? &mInternalResourceManager->getResources().getElementById(materialBlueprintResourceId) : nullptr;
+			if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
+			{
+				shaderProperties.getSortedPropertyVector() = recordedPipelineState.sortedPropertyVector;
+				const bool pipelineStateCacheAvailable = isValid(recordedPipelineState.serializedGraphicsPipelineStateHash) ?
+					(nullptr != materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(recordedPipelineState.serializedGraphicsPipelineStateHash, shaderProperties, true)) :
+					(nullptr != materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(shaderProperties, true));
+				if (!pipelineStateCacheAvailable)
+				{
+					RHI_LOG(mRenderer.getContext(), WARNING, "Failed to precompile a recorded pipeline state of the material blueprint asset %u", static_cast<uint32_t>(recordedPipelineState.materialBlueprintAssetId))
+				}
+			}
+		}
+	}
+
+	void MaterialBlueprintResourceManager::savePipelineStateUsage(IFile* recordedFile, MemoryFile& memoryFile)
+	{
+		// Start with the previously recorded pipeline state usage, this way the pipeline state usage of all sessions is accumulated instead of only keeping the last session
+		::detail::RecordedSerializedGraphicsPipelineStates recordedSerializedGraphicsPipelineStates;
+		::detail::RecordedPipelineStates recordedPipelineStates;
+		if (nullptr != recordedFile)
+		{
+			::detail::readRecordedPipelineStates(*recordedFile, recordedSerializedGraphicsPipelineStates, recordedPipelineStates);
+		}
+		std::unordered_set<uint64_t> recordedPipelineStateKeys;
+		recordedPipelineStateKeys.reserve(recordedPipelineStates.size());
+		for (const ::detail::RecordedPipelineState& recordedPipelineState : recordedPipelineStates)
+		{
+			recordedPipelineStateKeys.insert(::detail::getRecordedPipelineStateKey(recordedPipelineState));
+		}
+
+		{ // Add the serialized graphics pipeline states of this session
+			std::lock_guard<std::mutex> serializedGraphicsPipelineStatesMutexLock(mSerializedGraphicsPipelineStatesMutex);
+			for (const auto& elementPair : mSerializedGraphicsPipelineStates)
+			{
+				recordedSerializedGraphicsPipelineStates.emplace(elementPair.first, elementPair.second);
+			}
+		}
+
+		{ // Add the pipeline states of this session
+			::detail::RecordedPipelineState recordedPipelineState;
+			const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+			for (uint32_t i = 0; i < numberOfElements; ++i)
+			{
+				const MaterialBlueprintResource& materialBlueprintResource = mInternalResourceManager->getResources().getElementByIndex(i);
+				recordedPipelineState.materialBlueprintAssetId = materialBlueprintResource.getAssetId();
+				for (const auto& elementPair : materialBlueprintResource.mGraphicsPipelineStateCacheManager.mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId)
+				{
+					const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = elementPair.second->getGraphicsPipelineStateSignature();
+					recordedPipelineState.serializedGraphicsPipelineStateHash = graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash();
+					recordedPipelineState.sortedPropertyVector = graphicsPipelineStateSignature.getShaderProperties().getSortedPropertyVector();
+					if (recordedPipelineStateKeys.insert(::detail::getRecordedPipelineStateKey(recordedPipelineState)).second)
+					{
+						recordedPipelineStates.push_back(recordedPipelineState);
+					}
+				}
+				recordedPipelineState.serializedGraphicsPipelineStateHash = getInvalid<uint32_t>();
+				for (const auto& elementPair : materialBlueprintResource.mComputePipelineStateCacheManager.mComputePipelineStateCacheByComputePipelineStateSignatureId)
+				{
+					recordedPipelineState.sortedPropertyVector = elementPair.second->getComputePipelineStateSignature().getShaderProperties().getSortedPropertyVector();
+					if (recordedPipelineStateKeys.insert(::detail::getRecordedPipelineStateKey(recordedPipelineState)).second)
+					{
+						recordedPipelineStates.push_back(recordedPipelineState);
+					}
+				}
+			}
+		}
+
+		{ // Write the serialized graphics pipeline states
+			const uint32_t numberOfElements = static_cast<uint32_t>(recordedSerializedGraphicsPipelineStates.size());
+			memoryFile.write(&numberOfElements, sizeof(uint32_t));
+			for (const auto& elementPair : recordedSerializedGraphicsPipelineStates)
+			{
+				memoryFile.write(&elementPair.first, sizeof(uint32_t));
+				memoryFile.write(&elementPair.second, sizeof(Rhi::SerializedGraphicsPipelineState));
+			}
+		}
+
+		{ // Write the recorded pipeline states
+			const uint32_t numberOfElements = static_cast<uint32_t>(recordedPipelineStates.size());
+			memoryFile.write(&numberOfElements, sizeof(uint32_t));
+			for (const ::detail::RecordedPipelineState& recordedPipelineState : recordedPipelineStates)
+			{
+				memoryFile.write(&recordedPipelineState.materialBlueprintAssetId, sizeof(uint32_t));
+				memoryFile.write(&recordedPipelineState.serializedGraphicsPipelineStateHash, sizeof(uint32_t));
+				const uint32_t numberOfShaderProperties = static_cast<uint32_t>(recordedPipelineState.sortedPropertyVector.size());
+				memoryFile.write(&numberOfShaderProperties, sizeof(uint32_t));
+				if (numberOfShaderProperties > 0)
+				{
+					memoryFile.write(recordedPipelineState.sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * numberOfShaderProperties);
+				}
+			}
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
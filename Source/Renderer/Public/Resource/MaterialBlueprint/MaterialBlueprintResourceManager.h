@@ -59,6 +59,7 @@ namespace Renderer
 	class UniformInstanceBufferManager;
 	class TextureInstanceBufferManager;
 	class MaterialBlueprintResourceLoader;
+	class GraphicsProgramBinaryCacheManager;
 	class IMaterialBlueprintResourceListener;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
@@ -158,9 +159,28 @@ namespace Renderer
 		/**
 		*  @brief
 		*    Called pre command buffer dispatch
+		*
+		*  @note
+		*    - Uploads the staged data of the pass buffer managers of all material blueprint resources
 		*/
 		void onPreCommandBufferDispatch();
 
+		/**
+		*  @brief
+		*    Return the command buffer fill mutex
+		*
+		*  @return
+		*    The mutex serializing the access to the shared material blueprint state while filling command buffers
+		*
+		*  @note
+		*    - Compositor nodes might be recorded concurrently, the mutex guards the material blueprint resource listener, the pass buffer managers, the lazily created resource groups and the pipeline state caches
+		*    - Not recursive, so don't call methods which acquire the lock on their own while holding it
+		*/
+		[[nodiscard]] inline std::mutex& getCommandBufferFillMutex() const
+		{
+			return mCommandBufferFillMutex;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Default texture filtering                             ]
 		//[-------------------------------------------------------]
@@ -207,6 +227,11 @@ namespace Renderer
 			return *mLightBufferManager;
 		}
 
+		[[nodiscard]] inline GraphicsProgramBinaryCacheManager* getGraphicsProgramBinaryCacheManager() const
+		{
+			return mGraphicsProgramBinaryCacheManager;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -246,6 +271,12 @@ namespace Renderer
 		[[nodiscard]] bool doesPipelineStateObjectCacheNeedSaving() const;
 		void savePipelineStateObjectCache(MemoryFile& memoryFile);
 
+		//[-------------------------------------------------------]
+		//[ Pipeline state usage                                  ]
+		//[-------------------------------------------------------]
+		void loadPipelineStateUsage(IFile& file);
+		void savePipelineStateUsage(IFile* recordedFile, MemoryFile& memoryFile);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -259,10 +290,12 @@ namespace Renderer
 		uint8_t								mDefaultMaximumTextureAnisotropy;			///< Default maximum texture anisotropy
 		std::mutex							mSerializedGraphicsPipelineStatesMutex;		///< "Renderer::GraphicsPipelineStateCompiler" is running asynchronous, hence we need to synchronize the serialized graphics pipeline states access
 		SerializedGraphicsPipelineStates	mSerializedGraphicsPipelineStates;			///< Serialized pipeline states
+		mutable std::mutex					mCommandBufferFillMutex;					///< Compositor nodes might be recorded concurrently, hence we need to synchronize the access to the shared state used while filling command buffers
 		UniformInstanceBufferManager*		mUniformInstanceBufferManager;				///< Uniform instance buffer manager, always valid in a sane none-legacy environment
 		TextureInstanceBufferManager*		mTextureInstanceBufferManager;				///< Texture instance buffer manager, always valid in a sane none-legacy environment
 		IndirectBufferManager*				mIndirectBufferManager;						///< Indirect buffer manager, always valid in a sane none-legacy environment
 		LightBufferManager*					mLightBufferManager;						///< Light buffer manager, always valid in a sane none-legacy environment
+		GraphicsProgramBinaryCacheManager*	mGraphicsProgramBinaryCacheManager;			///< Graphics program binary cache manager, only valid if "Rhi::Capabilities::graphicsProgramBinary" is true
 
 		// Internal resource manager implementation
 		ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>* mInternalResourceManager;
@@ -178,6 +178,7 @@ namespace Renderer
 			createVertexArrays();
 		}
 		mMeshResource->setVertexArray(mVertexArray, mPositionOnlyVertexArray);
+		mMeshResource->setNumberOfResidentBytes(static_cast<uint64_t>(mNumberOfUsedVertexBufferDataBytes) + mNumberOfUsedIndexBufferDataBytes + mNumberOfUsedPositionOnlyIndexBufferDataBytes);
 
 		{ // Create sub-meshes
 			MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
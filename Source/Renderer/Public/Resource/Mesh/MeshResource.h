@@ -301,6 +301,16 @@ namespace Renderer
 			IResource::deinitializeElement();
 		}
 
+		//[-------------------------------------------------------]
+		//[ "Renderer::ResourceManagerTemplate" management        ]
+		//[-------------------------------------------------------]
+		inline void unloadResidentData()
+		{
+			// Only release the RHI vertex and index data, the bounding volumes and sub-meshes are tiny and are updated when the mesh gets loaded again
+			mVertexArray = nullptr;
+			mPositionOnlyVertexArray = nullptr;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -117,6 +117,21 @@ namespace Renderer
 		setInvalid(meshResourceId);
 	}
 
+	uint64_t MeshResourceManager::getNumberOfResidentBytes() const
+	{
+		return mInternalResourceManager->getNumberOfResidentBytes();
+	}
+
+	uint64_t MeshResourceManager::getMemoryBudget() const
+	{
+		return mInternalResourceManager->getMemoryBudget();
+	}
+
+	void MeshResourceManager::setMemoryBudget(uint64_t memoryBudget)
+	{
+		mInternalResourceManager->setMemoryBudget(memoryBudget);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -148,7 +163,7 @@ namespace Renderer
 
 	void MeshResourceManager::update()
 	{
-		// Nothing here
+		mInternalResourceManager->processDeferredUnloads();
 	}
 
 
@@ -174,6 +189,16 @@ namespace Renderer
 		}
 	}
 
+	void MeshResourceManager::onResourceUnreferenced(IResource& resource)
+	{
+		mInternalResourceManager->enqueueDeferredUnload(static_cast<MeshResource&>(resource));
+	}
+
+	void MeshResourceManager::onResourceResidentBytesChanged(IResource& resource, uint64_t previousNumberOfResidentBytes)
+	{
+		mInternalResourceManager->updateNumberOfResidentBytes(previousNumberOfResidentBytes, resource.getNumberOfResidentBytes());
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
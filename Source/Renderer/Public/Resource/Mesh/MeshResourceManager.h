@@ -94,6 +94,30 @@ namespace Renderer
 		[[nodiscard]] RENDERER_API_EXPORT MeshResourceId createEmptyMeshResourceByAssetId(AssetId assetId);	// Mesh resource is not allowed to exist, yet, prefer asynchronous mesh resource loading over this method
 		RENDERER_API_EXPORT void setInvalidResourceId(MeshResourceId& textureResourceId, IResourceListener& resourceListener) const;
 
+		/**
+		*  @brief
+		*    Return the number of bytes of resident mesh data
+		*
+		*  @return
+		*    The number of bytes of resident RHI vertex and index buffer data of all loaded mesh resources, meshes created during runtime don't report their size
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT uint64_t getNumberOfResidentBytes() const;
+
+		[[nodiscard]] RENDERER_API_EXPORT uint64_t getMemoryBudget() const;
+
+		/**
+		*  @brief
+		*    Set the memory budget
+		*
+		*  @param[in] memoryBudget
+		*    Memory budget in bytes, invalid means unlimited (default)
+		*
+		*  @note
+		*    - While the number of resident bytes exceeds the memory budget, the least recently used mesh resources which are no longer referenced by a resource listener get unloaded inside "update()"
+		*    - Referenced mesh resources are never unloaded, so the memory budget is a soft limit
+		*/
+		RENDERER_API_EXPORT void setMemoryBudget(uint64_t memoryBudget);
+
 		[[nodiscard]] inline const Rhi::IVertexBufferPtr& getDrawIdVertexBufferPtr() const
 		{
 			return mDrawIdVertexBufferPtr;
@@ -122,6 +146,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
+		virtual void onResourceUnreferenced(IResource& resource) override;
+		virtual void onResourceResidentBytesChanged(IResource& resource, uint64_t previousNumberOfResidentBytes) override;
 
 
 	//[-------------------------------------------------------]
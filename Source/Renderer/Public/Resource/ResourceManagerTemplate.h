@@ -32,6 +32,15 @@
 #include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_UInt_is_zero': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_UInt_is_zero': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
+	#include <unordered_map>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -64,6 +73,10 @@ namespace Renderer
 	/**
 	*  @brief
 	*    Internal resource manager template; not public used to keep template instantiation overhead under control
+	*
+	*  @note
+	*    - Resources must be added and removed via "addResource()" and "removeResource()" instead of directly using the packed element manager, else the asset ID index gets out of sync
+	*    - Unreferenced resources are evicted in least recently used order as soon as the number of resident bytes exceeds the memory budget, see "processDeferredUnloads()"
 	*/
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS>
 	class ResourceManagerTemplate : private Manager
@@ -83,7 +96,11 @@ namespace Renderer
 	public:
 		inline ResourceManagerTemplate(IRenderer& renderer, IResourceManager& resourceManager) :
 			mRenderer(renderer),
-			mResourceManager(resourceManager)
+			mResourceManager(resourceManager),
+			mMemoryBudget(getInvalid<uint64_t>()),
+			mNumberOfResidentBytes(0),
+			mDeferredUnloadFrontResourceId(getInvalid<ID_TYPE>()),
+			mDeferredUnloadBackResourceId(getInvalid<ID_TYPE>())
 		{
 			// Nothing here
 		}
@@ -110,21 +127,10 @@ namespace Renderer
 			return new LOADER_TYPE(mResourceManager, mRenderer);
 		}
 
-		[[nodiscard]] inline TYPE* getResourceByAssetId(AssetId assetId) const	// Considered to be inefficient, avoid method whenever possible
+		[[nodiscard]] inline TYPE* getResourceByAssetId(AssetId assetId) const	// In case multiple resources are using the same asset ID, the first added one is returned
 		{
-			// TODO(co) Implement more efficient solution later on
-			const uint32_t numberOfElements = mResources.getNumberOfElements();
-			for (uint32_t i = 0; i < numberOfElements; ++i)
-			{
-				TYPE& resource = mResources.getElementByIndex(i);
-				if (resource.getAssetId() == assetId)
-				{
-					return &resource;
-				}
-			}
-
-			// There's no resource using the given asset ID
-			return nullptr;
+			const typename AssetIdIndex::const_iterator iterator = mAssetIdIndex.find(assetId);
+			return (mAssetIdIndex.cend() != iterator) ? &mResources.getElementById(iterator->second.resourceId) : nullptr;
 		}
 
 		[[nodiscard]] inline TYPE& createEmptyResourceByAssetId(AssetId assetId)	// Resource is not allowed to exist, yet
@@ -133,14 +139,58 @@ namespace Renderer
 			RHI_ASSERT(mRenderer.getContext(), nullptr == getResourceByAssetId(assetId), "The resource isn't allowed to exist, yet")
 
 			// Create the resource instance
+			return addResource(assetId);
+		}
+
+		/**
+		*  @brief
+		*    Add a resource instance and register it inside the asset ID index
+		*
+		*  @param[in] assetId
+		*    ID of the asset the resource is an instance of, can be invalid
+		*
+		*  @return
+		*    The added resource instance
+		*/
+		[[nodiscard]] inline TYPE& addResource(AssetId assetId)
+		{
 			TYPE& resource = mResources.addElement();
 			resource.setResourceManager(&mResourceManager);
 			resource.setAssetId(assetId);
-
-			// Done
+			registerAssetId(resource);
 			return resource;
 		}
 
+		/**
+		*  @brief
+		*    Unregister a resource instance from the asset ID index and remove it
+		*
+		*  @param[in] resourceId
+		*    ID of the resource to remove, must be valid
+		*/
+		inline void removeResource(ID_TYPE resourceId)
+		{
+			TYPE& resource = mResources.getElementById(resourceId);
+			unregisterAssetId(resource);
+			unlinkDeferredUnload(resource);
+			mNumberOfResidentBytes -= resource.getNumberOfResidentBytes();
+			mResources.removeElement(resourceId);
+		}
+
+		/**
+		*  @brief
+		*    Change the asset ID of a resource instance while keeping the asset ID index in sync
+		*/
+		inline void setResourceAssetId(TYPE& resource, AssetId assetId)
+		{
+			if (resource.getAssetId() != assetId)
+			{
+				unregisterAssetId(resource);
+				resource.setAssetId(assetId);
+				registerAssetId(resource);
+			}
+		}
+
 		inline void loadResourceByAssetId(AssetId assetId, ID_TYPE& resourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId)	// Asynchronous
 		{
 			// Choose default resource loader type ID, if necessary
@@ -158,12 +208,16 @@ namespace Renderer
 			bool load = (reload && nullptr != asset);
 			if (nullptr == resource && nullptr != asset)
 			{
-				resource = &mResources.addElement();
-				resource->setResourceManager(&mResourceManager);
-				resource->setAssetId(assetId);
+				resource = &addResource(assetId);
 				resource->setResourceLoaderTypeId(resourceLoaderTypeId);
 				load = true;
 			}
+			else if (nullptr != resource && nullptr != asset && IResource::LoadingState::UNLOADED == resource->getLoadingState())
+			{
+				// The resident data of the resource has been evicted, load it again using the resource loader type the resource was originally loaded with (e.g. resources generated during runtime like OpenVR render model textures)
+				resourceLoaderTypeId = resource->getResourceLoaderTypeId();
+				load = true;
+			}
 
 			// Before connecting a resource listener, ensure we set the output resource ID at once so it can already directly be used inside the resource listener
 			if (nullptr != resource)
@@ -190,24 +244,148 @@ namespace Renderer
 		inline void reloadResourceByAssetId(AssetId assetId)
 		{
 			// TODO(co) Experimental implementation (take care of resource cleanup etc.)
-			const uint32_t numberOfElements = mResources.getNumberOfElements();
-			for (uint32_t i = 0; i < numberOfElements; ++i)
+			// -> Resources with evicted resident data are loaded again by the next load request anyway, reloading them now would make them resident without being queued for a deferred unload
+			const TYPE* resource = getResourceByAssetId(assetId);
+			if (nullptr != resource && IResource::LoadingState::UNLOADED != resource->getLoadingState())
 			{
-				const TYPE& resource = mResources.getElementByIndex(i);
-				if (resource.getAssetId() == assetId)
-				{
-					ID_TYPE resourceId = getInvalid<ID_TYPE>();
-					loadResourceByAssetId(assetId, resourceId, nullptr, true, resource.getResourceLoaderTypeId());
-					break;
-				}
+				ID_TYPE resourceId = getInvalid<ID_TYPE>();
+				loadResourceByAssetId(assetId, resourceId, nullptr, true, resource->getResourceLoaderTypeId());
 			}
 		}
 
-		[[nodiscard]] inline Resources& getResources()
+		[[nodiscard]] inline Resources& getResources()	// Don't add or remove elements directly, see "addResource()" and "removeResource()"
 		{
 			return mResources;
 		}
 
+		//[-------------------------------------------------------]
+		//[ Memory budget and deferred unload                     ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline uint64_t getMemoryBudget() const
+		{
+			return mMemoryBudget;
+		}
+
+		inline void setMemoryBudget(uint64_t memoryBudget)	// Invalid means unlimited, which is the default
+		{
+			mMemoryBudget = memoryBudget;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of bytes of resident resource data of all resources
+		*
+		*  @return
+		*    The number of bytes of resident resource data, resources not reporting their resident data size are not taken into account
+		*
+		*  @note
+		*    - Running total kept up-to-date by "updateNumberOfResidentBytes()", no resource scan
+		*/
+		[[nodiscard]] inline uint64_t getNumberOfResidentBytes() const
+		{
+			return mNumberOfResidentBytes;
+		}
+
+		/**
+		*  @brief
+		*    Update the running total of resident bytes, usually called inside "Renderer::IResourceManager::onResourceResidentBytesChanged()"
+		*
+		*  @param[in] previousNumberOfResidentBytes
+		*    Previous number of resident bytes of the resource
+		*  @param[in] numberOfResidentBytes
+		*    New number of resident bytes of the resource
+		*/
+		inline void updateNumberOfResidentBytes(uint64_t previousNumberOfResidentBytes, uint64_t numberOfResidentBytes)
+		{
+			RHI_ASSERT(mRenderer.getContext(), mNumberOfResidentBytes >= previousNumberOfResidentBytes, "Invalid number of resident bytes")
+			mNumberOfResidentBytes = mNumberOfResidentBytes - previousNumberOfResidentBytes + numberOfResidentBytes;
+		}
+
+		/**
+		*  @brief
+		*    Queue an unreferenced resource for a deferred unload
+		*
+		*  @param[in] resource
+		*    Resource whose last reference was just released
+		*
+		*  @note
+		*    - The queue is an intrusive doubly linked list through the resources, ordered by the time the resources became unreferenced, so the front is the least recently used resource
+		*    - A resource is at most once inside the queue, so the queue never holds more entries than there are resources
+		*    - If the resource gets referenced again, it's unlinked as soon as "processDeferredUnloads()" reaches it
+		*/
+		inline void enqueueDeferredUnload(TYPE& resource)
+		{
+			// Move to the back in case the resource is already queued
+			unlinkDeferredUnload(resource);
+
+			// Link at the back
+			const ID_TYPE resourceId = resource.getId();
+			resource.setDeferredUnloadQueued(true);
+			resource.setPreviousDeferredUnloadResourceId(mDeferredUnloadBackResourceId);
+			if (isValid(mDeferredUnloadBackResourceId))
+			{
+				mResources.getElementById(mDeferredUnloadBackResourceId).setNextDeferredUnloadResourceId(resourceId);
+			}
+			else
+			{
+				mDeferredUnloadFrontResourceId = resourceId;
+			}
+			mDeferredUnloadBackResourceId = resourceId;
+		}
+
+		/**
+		*  @brief
+		*    Process the deferred unload queue, usually called once per frame inside "Renderer::IResourceManager::update()"
+		*
+		*  @note
+		*    - While the number of resident bytes exceeds the memory budget, the least recently used unreferenced resources get unloaded
+		*    - Only resources which can be loaded again from their asset are unloaded, the resource instance and its ID stay valid and the next load request will load the resource again
+		*    - Resources which are still loading stay queued and are unloaded once they're loaded
+		*    - The resource type must implement "unloadResidentData()"
+		*/
+		inline void processDeferredUnloads()
+		{
+			// Evict the least recently used unreferenced resources until we're within the memory budget again
+			ID_TYPE resourceId = mDeferredUnloadFrontResourceId;
+			while (isValid(resourceId) && isValid(mMemoryBudget) && mNumberOfResidentBytes > mMemoryBudget)
+			{
+				TYPE& resource = mResources.getElementById(resourceId);
+				resourceId = static_cast<ID_TYPE>(resource.getNextDeferredUnloadResourceId());
+				if (0 == resource.getReferenceCount())
+				{
+					const IResource::LoadingState loadingState = resource.getLoadingState();
+					if (IResource::LoadingState::LOADING == loadingState || IResource::LoadingState::UNLOADING == loadingState)
+					{
+						// Still in-flight inside the resource streamer, keep the resource queued
+						continue;
+					}
+					if (IResource::LoadingState::LOADED == loadingState && resource.getNumberOfResidentBytes() > 0 && nullptr != mRenderer.getAssetManager().tryGetAssetByAssetId(resource.getAssetId()))
+					{
+						// Unload the resident resource data
+						resource.setLoadingState(IResource::LoadingState::UNLOADING);
+						resource.unloadResidentData();
+						resource.setNumberOfResidentBytes(0);
+						resource.setLoadingState(IResource::LoadingState::UNLOADED);
+					}
+				}
+
+				// The resource is either unloaded, referenced again or can't be unloaded at all
+				unlinkDeferredUnload(resource);
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct AssetIdIndexEntry final
+		{
+			ID_TYPE  resourceId;		///< ID of the first added resource using the asset ID
+			uint32_t numberOfResources;	///< Number of resources using the asset ID, e.g. cloned material resources share the asset ID of their parent
+		};
+		typedef std::unordered_map<uint32_t, AssetIdIndexEntry> AssetIdIndex;	///< Key = "Renderer::AssetId"
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -216,14 +394,85 @@ namespace Renderer
 		explicit ResourceManagerTemplate(const ResourceManagerTemplate&) = delete;
 		ResourceManagerTemplate& operator=(const ResourceManagerTemplate&) = delete;
 
+		inline void registerAssetId(const TYPE& resource)
+		{
+			const std::pair<typename AssetIdIndex::iterator, bool> result = mAssetIdIndex.emplace(resource.getAssetId(), AssetIdIndexEntry{ resource.getId(), 1 });
+			if (!result.second)
+			{
+				++result.first->second.numberOfResources;
+			}
+		}
+
+		inline void unregisterAssetId(const TYPE& resource)
+		{
+			const typename AssetIdIndex::iterator iterator = mAssetIdIndex.find(resource.getAssetId());
+			RHI_ASSERT(mRenderer.getContext(), mAssetIdIndex.end() != iterator, "The resource isn't registered inside the asset ID index")
+			if (mAssetIdIndex.end() != iterator)
+			{
+				AssetIdIndexEntry& assetIdIndexEntry = iterator->second;
+				if (0 == --assetIdIndexEntry.numberOfResources)
+				{
+					mAssetIdIndex.erase(iterator);
+				}
+				else if (assetIdIndexEntry.resourceId == resource.getId())
+				{
+					// The asset ID is shared with other resources, hand over to one of them
+					// -> Linear search, but only in the rare case of a shared asset ID
+					const uint32_t numberOfElements = mResources.getNumberOfElements();
+					for (uint32_t i = 0; i < numberOfElements; ++i)
+					{
+						const TYPE& otherResource = mResources.getElementByIndex(i);
+						if (otherResource.getAssetId() == resource.getAssetId() && otherResource.getId() != resource.getId())
+						{
+							assetIdIndexEntry.resourceId = otherResource.getId();
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		inline void unlinkDeferredUnload(TYPE& resource)
+		{
+			if (resource.isDeferredUnloadQueued())
+			{
+				const ID_TYPE previousResourceId = static_cast<ID_TYPE>(resource.getPreviousDeferredUnloadResourceId());
+				const ID_TYPE nextResourceId = static_cast<ID_TYPE>(resource.getNextDeferredUnloadResourceId());
+				if (isValid(previousResourceId))
+				{
+					mResources.getElementById(previousResourceId).setNextDeferredUnloadResourceId(nextResourceId);
+				}
+				else
+				{
+					mDeferredUnloadFrontResourceId = nextResourceId;
+				}
+				if (isValid(nextResourceId))
+				{
+					mResources.getElementById(nextResourceId).setPreviousDeferredUnloadResourceId(previousResourceId);
+				}
+				else
+				{
+					mDeferredUnloadBackResourceId = previousResourceId;
+				}
+				resource.setPreviousDeferredUnloadResourceId(getInvalid<ResourceId>());
+				resource.setNextDeferredUnloadResourceId(getInvalid<ResourceId>());
+				resource.setDeferredUnloadQueued(false);
+			}
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRenderer&		  mRenderer;	///< Renderer instance, do not destroy the instance
-		IResourceManager& mResourceManager;
-		Resources		  mResources;
+		IRenderer&			mRenderer;				///< Renderer instance, do not destroy the instance
+		IResourceManager&	mResourceManager;
+		Resources			mResources;
+		AssetIdIndex		mAssetIdIndex;			///< Asset ID to resource ID index, kept in sync with "mResources" so "getResourceByAssetId()" doesn't need to scan all resources
+		uint64_t			mMemoryBudget;					///< Memory budget in bytes for resident resource data, invalid means unlimited
+		uint64_t			mNumberOfResidentBytes;			///< Running total of the resident bytes of all resources
+		ID_TYPE				mDeferredUnloadFrontResourceId;	///< Least recently used unreferenced resource, invalid if the deferred unload queue is empty
+		ID_TYPE				mDeferredUnloadBackResourceId;	///< Most recently used unreferenced resource, invalid if the deferred unload queue is empty
 
 
 	};
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Asset/Asset.h"
+#include "Renderer/Public/Core/Thread/ThreadPool.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -145,6 +146,18 @@ namespace Renderer
 			return mNumberOfInFlightLoadRequests;
 		}
 
+		/**
+		*  @brief
+		*    Return the thread pool resource loaders can use for data-parallel work inside "Renderer::IResourceLoader::onProcessing()"
+		*
+		*  @note
+		*    - Only use it from inside the asynchronous processing stage: The thread pool itself isn't thread-safe and the renderer default thread pool belongs to the main thread
+		*/
+		[[nodiscard]] inline ThreadPool<void>& getProcessingThreadPool()
+		{
+			return mProcessingThreadPool;
+		}
+
 		void commitLoadRequest(const LoadRequest& loadRequest);
 		void flushAllQueues();
 
@@ -206,6 +219,7 @@ namespace Renderer
 		std::mutex				mProcessingMutex;
 		std::condition_variable mProcessingConditionVariable;
 		LoadRequests			mProcessingQueue;
+		ThreadPool<void>		mProcessingThreadPool;	///< Must be declared before "mProcessingThread" since the processing thread starts running inside the constructor
 		std::thread				mProcessingThread;
 		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
 		std::mutex	 mDispatchMutex;
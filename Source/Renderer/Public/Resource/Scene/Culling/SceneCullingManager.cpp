@@ -31,6 +31,7 @@
 #include "Renderer/Public/Core/Thread/ThreadPool.h"
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/Core/Math/Frustum.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
 #ifdef RENDERER_OPENVR
 	#include "Renderer/Public/Vr/IVrManager.h"
 #endif
@@ -50,7 +51,8 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		static constexpr size_t SCENE_ITEMS_SPLIT_COUNT = 256;	///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+		static constexpr size_t	  SCENE_ITEMS_SPLIT_COUNT					= 256;	///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+		static constexpr uint32_t NUMBER_OF_FRAMES_UNTIL_STATIC_SHADOW_CASTER	= 30;	///< Number of rendered frames without transform change until a scene item is considered to be a static shadow caster
 		typedef xsimd::batch_bool<float, 4> bool4;
 		typedef xsimd::simd_type<float> float4;
 		static const float4 FLOAT4_ALL_ZERO(0.0f);
@@ -87,6 +89,15 @@ namespace
 			return Renderer::Math::makeMultipleOf(value, xsimd::simd_type<float>::size);
 		}
 
+		[[nodiscard]] uint64_t getStaticShadowCasterHash(const Renderer::RenderableManager& renderableManager)
+		{
+			// SplitMix64 finalizer of the renderable manager address, well distributed so the sum of hashes is a usable set signature
+			uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&renderableManager));
+			hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+			hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+			return hash ^ (hash >> 31);
+		}
+
 		[[nodiscard]] uint32_t removeNotVisible(const Renderer::SceneItemSet& sceneItemSet, uint32_t count, const uint32_t* inputIndirection, uint32_t* outputIndirection)
 		{
 			const uint32_t* RESTRICT visibilityFlag = sceneItemSet.visibilityFlag.data();
@@ -126,6 +137,56 @@ namespace
 			return numberOfVisibleItems;
 		}
 
+		void resizeSceneItemSet(Renderer::SceneItemSet& sceneItemSet, uint32_t numberOfAlignedSceneItems)
+		{
+			// TODO(co) We need to ensure that scene item set fits the SIMD lane count, this is only done at the culling kickoff
+			if (sceneItemSet.minimumX.size() != numberOfAlignedSceneItems)
+			{
+				// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
+				const uint32_t size = numberOfAlignedSceneItems + xsimd::simd_type<float>::size;
+
+				// Minimum object space bounding box corner position
+				sceneItemSet.minimumX.resize(size);
+				sceneItemSet.minimumY.resize(size);
+				sceneItemSet.minimumZ.resize(size);
+
+				// Maximum object space bounding box corner position
+				sceneItemSet.maximumX.resize(size);
+				sceneItemSet.maximumY.resize(size);
+				sceneItemSet.maximumZ.resize(size);
+
+				// Object space to world space matrix
+				sceneItemSet.worldXX.resize(size);
+				sceneItemSet.worldXY.resize(size);
+				sceneItemSet.worldXZ.resize(size);
+				sceneItemSet.worldXW.resize(size);
+				sceneItemSet.worldYX.resize(size);
+				sceneItemSet.worldYY.resize(size);
+				sceneItemSet.worldYZ.resize(size);
+				sceneItemSet.worldYW.resize(size);
+				sceneItemSet.worldZX.resize(size);
+				sceneItemSet.worldZY.resize(size);
+				sceneItemSet.worldZZ.resize(size);
+				sceneItemSet.worldZW.resize(size);
+				sceneItemSet.worldWX.resize(size);
+				sceneItemSet.worldWY.resize(size);
+				sceneItemSet.worldWZ.resize(size);
+				sceneItemSet.worldWW.resize(size);
+
+				// World space center position of bounding sphere
+				sceneItemSet.spherePositionX.resize(size);
+				sceneItemSet.spherePositionY.resize(size);
+				sceneItemSet.spherePositionZ.resize(size);
+
+				// Negative world space radius of bounding sphere
+				sceneItemSet.negativeRadius.resize(size);
+
+				sceneItemSet.visibilityFlag.resize(size);
+				sceneItemSet.transformChangeFrameNumber.resize(size);
+				sceneItemSet.sceneItemVector.resize(size);
+			}
+		}
+
 		[[nodiscard]] SimdVector simdMultiply(const SimdVector& v, const SimdMatrix& m)
 		{
 			float4 x = v.x * m.x.x;     x = v.y * m.y.x + x;    x = v.z * m.z.x + x;    x = v.w * m.w.x + x;
@@ -546,6 +607,39 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void SceneCullingManager::cullSceneItemSetSpheres(const Frustum& frustum, SceneItemSet& sceneItemSet)
+	{
+		// Pad the bounding spheres to the SIMD lane count, plus one SIMD lane for prefetching
+		const size_t size = ::detail::alignToSimdLaneCount(sceneItemSet.numberOfSceneItems) + xsimd::simd_type<float>::size;
+		if (sceneItemSet.spherePositionX.size() < size)
+		{
+			sceneItemSet.spherePositionX.resize(size);
+			sceneItemSet.spherePositionY.resize(size);
+			sceneItemSet.spherePositionZ.resize(size);
+			sceneItemSet.negativeRadius.resize(size);
+		}
+		sceneItemSet.visibilityFlag.resize(sceneItemSet.spherePositionX.size());
+
+		// Splat out the planes to be able to do plane-sphere test with SIMD, the bounding spheres are already in the frustum space
+		::detail::SimdPlane planes[Frustum::NUMBER_OF_PLANES];
+		for (uint32_t planeIndex = 0; planeIndex < Frustum::NUMBER_OF_PLANES; ++planeIndex)
+		{
+			const Plane& plane = frustum.planes[planeIndex];
+			planes[planeIndex].normalX = ::detail::float4(plane.normal.x);
+			planes[planeIndex].normalY = ::detail::float4(plane.normal.y);
+			planes[planeIndex].normalZ = ::detail::float4(plane.normal.z);
+			planes[planeIndex].d = ::detail::float4(plane.d);
+		}
+		const ::detail::float4 originFloat4[3] = { ::detail::FLOAT4_ALL_ZERO, ::detail::FLOAT4_ALL_ZERO, ::detail::FLOAT4_ALL_ZERO };
+
+		// Single-threaded, this is called from within the rendering of a scene item
+		::detail::simdSphereCulling(originFloat4, planes, sceneItemSet, 0, sceneItemSet.numberOfSceneItems, sceneItemSet.visibilityFlag.data());
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -669,51 +763,7 @@ namespace Renderer
 		// Make sure to align the size to the SIMD lane count
 		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
 
-		// TODO(co) We need to ensure that scene item set fits the SIMD lane count, this is only done at this place for the culling kickoff
-		if (mCullableSceneItemSet->minimumX.size() != n_aligned_objects)
-		{
-			// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
-			const uint32_t size = n_aligned_objects + xsimd::simd_type<float>::size;
-
-			// Minimum object space bounding box corner position
-			mCullableSceneItemSet->minimumX.resize(size);
-			mCullableSceneItemSet->minimumY.resize(size);
-			mCullableSceneItemSet->minimumZ.resize(size);
-
-			// Maximum object space bounding box corner position
-			mCullableSceneItemSet->maximumX.resize(size);
-			mCullableSceneItemSet->maximumY.resize(size);
-			mCullableSceneItemSet->maximumZ.resize(size);
-
-			// Object space to world space matrix
-			mCullableSceneItemSet->worldXX.resize(size);
-			mCullableSceneItemSet->worldXY.resize(size);
-			mCullableSceneItemSet->worldXZ.resize(size);
-			mCullableSceneItemSet->worldXW.resize(size);
-			mCullableSceneItemSet->worldYX.resize(size);
-			mCullableSceneItemSet->worldYY.resize(size);
-			mCullableSceneItemSet->worldYZ.resize(size);
-			mCullableSceneItemSet->worldYW.resize(size);
-			mCullableSceneItemSet->worldZX.resize(size);
-			mCullableSceneItemSet->worldZY.resize(size);
-			mCullableSceneItemSet->worldZZ.resize(size);
-			mCullableSceneItemSet->worldZW.resize(size);
-			mCullableSceneItemSet->worldWX.resize(size);
-			mCullableSceneItemSet->worldWY.resize(size);
-			mCullableSceneItemSet->worldWZ.resize(size);
-			mCullableSceneItemSet->worldWW.resize(size);
-
-			// World space center position of bounding sphere
-			mCullableSceneItemSet->spherePositionX.resize(size);
-			mCullableSceneItemSet->spherePositionY.resize(size);
-			mCullableSceneItemSet->spherePositionZ.resize(size);
-
-			// Negative world space radius of bounding sphere
-			mCullableSceneItemSet->negativeRadius.resize(size);
-
-			mCullableSceneItemSet->visibilityFlag.resize(size);
-			mCullableSceneItemSet->sceneItemVector.resize(size);
-		}
+		::detail::resizeSceneItemSet(*mCullableSceneItemSet, n_aligned_objects);
 
 		// Get the thread pool instance
 		DefaultThreadPool& defaultThreadPool = renderer.getDefaultThreadPool();
@@ -823,6 +873,146 @@ namespace Renderer
 		}
 	}
 
+	void SceneCullingManager::cullShadowCascades(const CompositorContextData& compositorContextData, const glm::vec3& worldSpaceLightDirection, const glm::mat4* cameraRelativeWorldSpaceToClipSpaceMatrices, uint8_t numberOfShadowCascades, uint64_t* staticShadowCasterSignatures)
+	{
+		// Each shadow cascade is a light space orthographic volume, a shadow caster is relevant for a shadow cascade if the bounding sphere of the shadow
+		// caster extruded along the light direction intersects the volume. Frustum planes whose inside is in light direction can always be reached by
+		// such an extruded bounding sphere and are hence disabled, the remaining frustum planes are tested using the usual SIMD frustum-sphere culling.
+		// -> All shadow cascades are culled at once, each shadow cascade writes into its own visibility flag vector so there's no need for synchronization
+		const IRenderer& renderer = compositorContextData.getCompositorWorkspaceInstance()->getRenderer();
+		RHI_ASSERT(renderer.getContext(), nullptr != cameraRelativeWorldSpaceToClipSpaceMatrices, "Invalid camera relative world space to clip space matrices")
+		RHI_ASSERT(renderer.getContext(), numberOfShadowCascades > 0 && numberOfShadowCascades <= 8, "Invalid number of shadow cascades")
+		RHI_ASSERT(renderer.getContext(), nullptr != staticShadowCasterSignatures, "Invalid static shadow caster signatures")
+
+		// Get the camera scene item
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		RHI_ASSERT(renderer.getContext(), nullptr != cameraSceneItem, "Invalid camera")
+		const glm::vec3 worldSpaceCameraPositionFloat = cameraSceneItem->getWorldSpaceCameraPosition();
+		::detail::float4 worldSpaceCameraPositionFloat4[3] = { ::detail::float4(worldSpaceCameraPositionFloat.x), ::detail::float4(worldSpaceCameraPositionFloat.y), ::detail::float4(worldSpaceCameraPositionFloat.z) };
+
+		// Splat out the planes of each shadow cascade to be able to do plane-sphere test with SIMD
+		::detail::SimdPlane planes[8][Frustum::NUMBER_OF_PLANES];
+		for (uint8_t shadowCascadeIndex = 0; shadowCascadeIndex < numberOfShadowCascades; ++shadowCascadeIndex)
+		{
+			const Frustum frustum(cameraRelativeWorldSpaceToClipSpaceMatrices[shadowCascadeIndex]);
+			for (uint32_t planeIndex = 0; planeIndex < Frustum::NUMBER_OF_PLANES; ++planeIndex)
+			{
+				// Plane normals point into the frustum, small epsilon so the planes parallel to the light direction aren't disabled due to floating point inaccuracy
+				const Plane& plane = frustum.planes[planeIndex];
+				::detail::SimdPlane& simdPlane = planes[shadowCascadeIndex][planeIndex];
+				if (glm::dot(plane.normal, worldSpaceLightDirection) > 0.01f)
+				{
+					// Disabled plane: Every bounding sphere is in front of it
+					simdPlane.normalX = ::detail::FLOAT4_ALL_ZERO;
+					simdPlane.normalY = ::detail::FLOAT4_ALL_ZERO;
+					simdPlane.normalZ = ::detail::FLOAT4_ALL_ZERO;
+					simdPlane.d = ::detail::float4(std::numeric_limits<float>::max());
+				}
+				else
+				{
+					simdPlane.normalX = ::detail::float4(plane.normal.x);
+					simdPlane.normalY = ::detail::float4(plane.normal.y);
+					simdPlane.normalZ = ::detail::float4(plane.normal.z);
+					simdPlane.d = ::detail::float4(plane.d);
+				}
+			}
+		}
+
+		// Make sure to align the size to the SIMD lane count
+		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
+		::detail::resizeSceneItemSet(*mCullableSceneItemSet, n_aligned_objects);
+		mCullableSceneItemSet->shadowCascadeVisibilityFlags.resize(numberOfShadowCascades);
+		for (SceneItemSet::IntegerVector& shadowCascadeVisibilityFlag : mCullableSceneItemSet->shadowCascadeVisibilityFlags)
+		{
+			shadowCascadeVisibilityFlag.resize(mCullableSceneItemSet->minimumX.size());
+		}
+
+		{ // Do SIMD multi-threaded frustum-sphere culling of all shadow cascades
+			DefaultThreadPool& defaultThreadPool = renderer.getDefaultThreadPool();
+			const size_t numberOfSceneItems = mCullableSceneItemSet->numberOfSceneItems;
+			size_t splitCount = ::detail::SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(numberOfSceneItems, splitCount);
+			if (1 == threadCount)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				for (uint8_t shadowCascadeIndex = 0; shadowCascadeIndex < numberOfShadowCascades; ++shadowCascadeIndex)
+				{
+					::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes[shadowCascadeIndex], *mCullableSceneItemSet, 0, numberOfSceneItems, mCullableSceneItemSet->shadowCascadeVisibilityFlags[shadowCascadeIndex].data());
+				}
+			}
+			else
+			{
+				// Multi-threaded
+				for (uint8_t shadowCascadeIndex = 0; shadowCascadeIndex < numberOfShadowCascades; ++shadowCascadeIndex)
+				{
+					size_t itemCount = numberOfSceneItems;
+					size_t threadSceneItemIndexOffset = 0;
+					for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+					{
+						const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+						defaultThreadPool.queueTask(std::bind(::detail::simdSphereCulling, worldSpaceCameraPositionFloat4, planes[shadowCascadeIndex], std::cref(*mCullableSceneItemSet), threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->shadowCascadeVisibilityFlags[shadowCascadeIndex].data()));
+						itemCount -= splitCount;
+						threadSceneItemIndexOffset += splitCount;
+					}
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+		}
+
+		// Update the cached shadow cascade masks and static shadow caster states of the renderable managers
+		// -> The static shadow caster signature of a shadow cascade changes as soon as a static shadow caster appears in or vanishes from it,
+		//    this includes scene item destruction as well as visibility or cast shadows changes, the caller compares it to the one its cache was rendered with
+		const uint32_t numberOfRenderedFrames = static_cast<uint32_t>(renderer.getTimeManager().getNumberOfRenderedFrames());
+		const uint32_t* transformChangeFrameNumber = mCullableSceneItemSet->transformChangeFrameNumber.data();
+		for (uint8_t shadowCascadeIndex = 0; shadowCascadeIndex < numberOfShadowCascades; ++shadowCascadeIndex)
+		{
+			staticShadowCasterSignatures[shadowCascadeIndex] = 0;
+		}
+		for (uint32_t i = 0; i < mCullableSceneItemSet->numberOfSceneItems; ++i)
+		{
+			const bool staticShadowCaster = (numberOfRenderedFrames - transformChangeFrameNumber[i] >= ::detail::NUMBER_OF_FRAMES_UNTIL_STATIC_SHADOW_CASTER);
+			RenderableManager* renderableManager = const_cast<RenderableManager*>(mCullableSceneItemSet->sceneItemVector[i]->getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+			if (nullptr != renderableManager)
+			{
+				uint8_t shadowCascadeMask = 0;
+				for (uint8_t shadowCascadeIndex = 0; shadowCascadeIndex < numberOfShadowCascades; ++shadowCascadeIndex)
+				{
+					if (0 != mCullableSceneItemSet->shadowCascadeVisibilityFlags[shadowCascadeIndex][i])
+					{
+						shadowCascadeMask |= static_cast<uint8_t>(1u << shadowCascadeIndex);
+					}
+				}
+				if (staticShadowCaster && renderableManager->isVisible() && renderableManager->getCastShadows() && !renderableManager->getRenderables().empty())
+				{
+					// Order independent sum of the renderable manager hashes
+					const uint64_t hash = ::detail::getStaticShadowCasterHash(*renderableManager);
+					for (uint8_t shadowCascadeIndex = 0; shadowCascadeIndex < numberOfShadowCascades; ++shadowCascadeIndex)
+					{
+						if (0 != (shadowCascadeMask & (1u << shadowCascadeIndex)))
+						{
+							staticShadowCasterSignatures[shadowCascadeIndex] += hash;
+						}
+					}
+				}
+				renderableManager->setCachedShadowCascadeMask(shadowCascadeMask);
+				renderableManager->setCachedStaticShadowCaster(staticShadowCaster);
+			}
+		}
+
+		// The always-visible stuff is relevant for all shadow cascades and is never considered to be static
+		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		{
+			RenderableManager* renderableManager = const_cast<RenderableManager*>(sceneItem->getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+			if (nullptr != renderableManager)
+			{
+				renderableManager->setCachedShadowCascadeMask(0xFF);
+				renderableManager->setCachedStaticShadowCaster(false);
+			}
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -30,6 +30,12 @@
 #include "Renderer/Public/Core/Manager.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/fwd.hpp>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -40,6 +46,7 @@ namespace Rhi
 }
 namespace Renderer
 {
+	class Frustum;
 	class ISceneItem;
 	struct SceneItemSet;
 	class CompositorContextData;
@@ -74,6 +81,26 @@ namespace Renderer
 		typedef std::vector<ISceneItem*> SceneItems;	// TODO(co) No raw-pointers (but no smart pointers either, use handles)
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    SIMD frustum-sphere culling of a scene item set which isn't managed by the scene culling manager
+		*
+		*  @param[in] frustum
+		*    Frustum to cull against, must be in the same space as the bounding spheres
+		*  @param[in, out] sceneItemSet
+		*    Only the bounding spheres and the number of scene items are used, the visibility flags receive the result
+		*
+		*  @note
+		*    - Used by scene items culling parts of themselves, e.g. "Renderer::TerrainSceneItem" culling its tiles
+		*    - The bounding sphere and visibility flag vectors are padded to the SIMD lane count as needed
+		*/
+		static void cullSceneItemSetSpheres(const Frustum& frustum, SceneItemSet& sceneItemSet);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -82,6 +109,28 @@ namespace Renderer
 		~SceneCullingManager();
 		void gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems);
 
+		/**
+		*  @brief
+		*    Cull the cullable scene items against the light space volumes of shadow cascades
+		*
+		*  @param[in] compositorContextData
+		*    Compositor context data, the camera scene item is used for camera relative rendering
+		*  @param[in] worldSpaceLightDirection
+		*    Normalized world space direction the light is traveling, the scene item bounds are extruded along this direction since casters between the light and a shadow cascade volume still cast shadows into it
+		*  @param[in] cameraRelativeWorldSpaceToClipSpaceMatrices
+		*    Camera relative world space to clip space matrix of each shadow cascade, must be valid
+		*  @param[in] numberOfShadowCascades
+		*    Number of shadow cascades, must be within 1..8
+		*  @param[out] staticShadowCasterSignatures
+		*    Receives the static shadow caster signature of each shadow cascade, the signature changes as soon as the set of static shadow casters inside the shadow cascade changes
+		*
+		*  @note
+		*    - Updates the cached shadow cascade mask of the renderable managers, see "Renderer::RenderableManager::getCachedShadowCascadeMask()"
+		*    - Updates the cached static shadow caster state of the renderable managers, see "Renderer::RenderableManager::getCachedStaticShadowCaster()"
+		*    - All shadow cascades are culled in parallel using the SIMD frustum-sphere culling
+		*/
+		void cullShadowCascades(const CompositorContextData& compositorContextData, const glm::vec3& worldSpaceLightDirection, const glm::mat4* cameraRelativeWorldSpaceToClipSpaceMatrices, uint8_t numberOfShadowCascades, uint64_t* staticShadowCasterSignatures);
+
 		[[nodiscard]] inline SceneItemSet& getCullableSceneItemSet() const
 		{
 			// We know that this pointer is always valid
@@ -133,6 +133,11 @@ namespace Renderer
 
 		// Flag to indicate if an object is culled or not
 		IntegerVector visibilityFlag;
+		// Flag to indicate if an object is inside a shadow cascade or not, one vector per shadow cascade (see "Renderer::SceneCullingManager::cullShadowCascades()")
+		std::vector<IntegerVector> shadowCascadeVisibilityFlags;
+
+		// Lower 32 bits of the number of the rendered frame the transform changed the last time, used to detect static shadow casters (see "Renderer::SceneCullingManager::cullShadowCascades()")
+		IntegerVector transformChangeFrameNumber;
 
 		// The type and ID of an object
 		SceneItemVector sceneItemVector;
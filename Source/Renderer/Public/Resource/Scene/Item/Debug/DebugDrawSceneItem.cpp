@@ -531,8 +531,7 @@ namespace Renderer
 			materialData.materialBlueprintAssetId = v1SceneMaterialData->materialBlueprintAssetId;
 
 			{ // Read material properties
-				// TODO(co) Get rid of the evil const-cast
-				MaterialProperties::SortedPropertyVector& sortedPropertyVector = const_cast<MaterialProperties::SortedPropertyVector&>(materialData.materialProperties.getSortedPropertyVector());
+				MaterialProperties::SortedPropertyVector& sortedPropertyVector = materialData.materialProperties.getSortedPropertyVector();
 				sortedPropertyVector.resize(v1SceneMaterialData->numberOfMaterialProperties);
 				memcpy(reinterpret_cast<char*>(sortedPropertyVector.data()), currentData + sizeof(v1Scene::MaterialData), sizeof(MaterialProperty) * v1SceneMaterialData->numberOfMaterialProperties);
 			}
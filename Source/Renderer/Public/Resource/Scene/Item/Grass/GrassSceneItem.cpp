@@ -22,10 +22,77 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/Grass/GrassSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialResource.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Public/Core/Math/Frustum.h"
 #include "Renderer/Public/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5219)	// warning C5219: implicit conversion from 'const int' to 'const _Ty', possible loss of data
+	#include <random>
+	#include <limits>
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t GRASS_RANDOM_SEED = 42;	///< Fixed random seed so the grass blades are scattered identically each time
+		static constexpr uint32_t NUMBER_OF_GRASS_VERTICES = 12;	///< Twelve vertices per grass blade (two quads), must match the grass vertex shader
+		static constexpr uint32_t USE_TERRAIN_HEIGHT_MAP_PROPERTY_ID = STRING_ID("UseTerrainHeightMap");
+		static constexpr uint32_t TERRAIN_WORLD_POSITION_PROPERTY_ID = STRING_ID("TerrainWorldPosition");
+		static constexpr uint32_t TERRAIN_WORLD_SIZE_PROPERTY_ID	 = STRING_ID("TerrainWorldSize");
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return whether or not an axis aligned bounding box is completely outside a frustum
+		*
+		*  @note
+		*    - Conservative, boxes near frustum corners might be reported as not being outside although they are
+		*/
+		[[nodiscard]] bool isGrassCellOutsideFrustum(const Renderer::Frustum& frustum, const glm::vec3& minimum, const glm::vec3& maximum)
+		{
+			for (const Renderer::Plane& plane : frustum.planes)
+			{
+				// Test the box corner which is farthest along the plane normal, plane normals point into the frustum
+				const glm::vec3 positiveVertex((plane.normal.x >= 0.0f) ? maximum.x : minimum.x, (plane.normal.y >= 0.0f) ? maximum.y : minimum.y, (plane.normal.z >= 0.0f) ? maximum.z : minimum.z);
+				if (glm::dot(plane.normal, positiveVertex) + plane.d < 0.0f)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -34,6 +101,61 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void GrassSceneItem::setFieldProperties(const FieldProperties& fieldProperties)
+	{
+		// Sanity checks
+		RHI_ASSERT(getContext(), fieldProperties.size.x > 0.0f && fieldProperties.size.y > 0.0f, "Invalid grass field size")
+		RHI_ASSERT(getContext(), fieldProperties.cellSize > 0.0f, "Invalid grass cell size")
+		RHI_ASSERT(getContext(), fieldProperties.grassPerSquareMeter >= 0.0f, "Invalid number of grass blades per square meter")
+		RHI_ASSERT(getContext(), fieldProperties.minimumGrassSize > 0.0f && fieldProperties.maximumGrassSize >= fieldProperties.minimumGrassSize, "Invalid grass size")
+		RHI_ASSERT(getContext(), fieldProperties.lodStartDistance >= 0.0f && fieldProperties.lodEndDistance > fieldProperties.lodStartDistance, "Invalid grass level of detail distances")
+
+		// Set field properties and scatter the grass blades again
+		mFieldProperties = fieldProperties;
+		scatterGrass();
+		updateSceneItemSetBoundingBox();
+	}
+
+	void GrassSceneItem::setDensityMap(uint32_t width, uint32_t height, const uint8_t* densityMap)
+	{
+		if (nullptr != densityMap && width > 0 && height > 0)
+		{
+			mDensityMap.assign(densityMap, densityMap + static_cast<size_t>(width) * height);
+			mDensityMapWidth = width;
+			mDensityMapHeight = height;
+		}
+		else
+		{
+			mDensityMap.clear();
+			mDensityMapWidth = 0;
+			mDensityMapHeight = 0;
+		}
+		scatterGrass();
+	}
+
+	void GrassSceneItem::setMaximumNumberOfVisibleGrass(uint32_t maximumNumberOfVisibleGrass)
+	{
+		RHI_ASSERT(getContext(), maximumNumberOfVisibleGrass > 0, "The maximum number of visible grass blades must be positive")
+		RHI_ASSERT(getContext(), maximumNumberOfVisibleGrass <= std::numeric_limits<uint32_t>::max() / ::detail::NUMBER_OF_GRASS_VERTICES, "The number of grass vertices must fit into 32 bit")
+		if (nullptr != mStructuredBufferPtr && mMaximumNumberOfVisibleGrass != maximumNumberOfVisibleGrass)
+		{
+			mMaximumNumberOfVisibleGrass = maximumNumberOfVisibleGrass;
+			createStructuredBuffer();
+
+			// Tell the used material resource about our new structured buffer, if it's already there
+			if (!mRenderableManager.getRenderables().empty())
+			{
+				mRenderableManager.getRenderables()[0].setNumberOfIndices(0);
+				mNumberOfVisibleGrass = 0;
+				setMaterialTechniquesStructuredBuffer();
+			}
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ISceneItem methods           ]
 	//[-------------------------------------------------------]
@@ -51,9 +173,10 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
-	void GrassSceneItem::onExecuteOnRendering([[maybe_unused]] const Rhi::IRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
+	void GrassSceneItem::onExecuteOnRendering(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
 	{
-		// TODO(co) Implement me
+		// The visible grass blades depend on the view, so they're streamed in right before each view renders the grass
+		const_cast<GrassSceneItem*>(this)->updateVisibleGrass(renderTarget, compositorContextData);
 	}
 
 
@@ -63,7 +186,7 @@ namespace Renderer
 	void GrassSceneItem::initialize()
 	{
 		// Call the base implementation
-		if (mMaximumNumberOfGrass > 0)
+		if (mMaximumNumberOfVisibleGrass > 0)
 		{
 			MaterialSceneItem::initialize();
 		}
@@ -71,22 +194,22 @@ namespace Renderer
 
 	void GrassSceneItem::onMaterialResourceCreated()
 	{
-		// Setup renderable manager
+		// Setup renderable manager: Twelve vertices per grass (two quads), grass index = vertex index / 12
+		// -> Non-instanced draw, the draw ID vertex buffer is indexed per instance and would limit the number of visible grass blades
+		// -> The number of vertices is set to twelve times the number of visible grass blades during runtime
 		#ifdef RHI_DEBUG
 			const char* debugName = "Grass";
 			mRenderableManager.setDebugName(debugName);
 		#endif
 		const IRenderer& renderer = getSceneResource().getRenderer();
-		const MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
-		const MaterialResourceId materialResourceId = getMaterialResourceId();
-		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, getInvalid<SkeletonResourceId>(), false, mIndirectBufferPtr, 0, 1 RHI_RESOURCE_DEBUG_NAME(debugName));
+		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), renderer.getMaterialResourceManager(), getMaterialResourceId(), getInvalid<SkeletonResourceId>(), false, 0, 0, 1 RHI_RESOURCE_DEBUG_NAME(debugName));
 		mRenderableManager.updateCachedRenderablesData();
 
 		// Tell the used material resource about our structured buffer
-		for (MaterialTechnique* materialTechnique : materialResourceManager.getById(materialResourceId).getSortedMaterialTechniqueVector())
-		{
-			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
-		}
+		setMaterialTechniquesStructuredBuffer();
+
+		// The material might place the grass blades on a terrain height map
+		updateSceneItemSetBoundingBox();
 
 		// We need "Renderer::ISceneItem::onExecuteOnRendering()" calls during runtime
 		setCallExecuteOnRendering(true);
@@ -94,55 +217,258 @@ namespace Renderer
 
 
 	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	GrassSceneItem::GrassSceneItem(SceneResource& sceneResource) :
-		MaterialSceneItem(sceneResource, false),	// TODO(co) Set bounding box
-		mMaximumNumberOfGrass(3)	// TODO(co) Make this dynamic
+		MaterialSceneItem(sceneResource),
+		mDensityMapWidth(0),
+		mDensityMapHeight(0),
+		mNumberOfCellsX(0),
+		mNumberOfCellsZ(0),
+		mMinimumGroundHeight(0.0f),
+		mMaximumGroundHeight(0.0f),
+		mMaximumNumberOfVisibleGrass(65536),
+		mNumberOfVisibleGrass(0)
 	{
+		// Default field properties
+		mFieldProperties.minimumPosition	 = glm::vec2(-12.0f, 4.0f);
+		mFieldProperties.size				 = glm::vec2(32.0f, 32.0f);
+		mFieldProperties.groundHeight		 = -1.781f;
+		mFieldProperties.cellSize			 = 4.0f;
+		mFieldProperties.grassPerSquareMeter = 32.0f;
+		mFieldProperties.minimumGrassSize	 = 0.5f;
+		mFieldProperties.maximumGrassSize	 = 1.5f;
+		mFieldProperties.color				 = glm::vec3(1.0f, 1.0f, 1.0f);
+		mFieldProperties.colorVariance		 = 0.2f;
+		mFieldProperties.lodStartDistance	 = 20.0f;
+		mFieldProperties.lodEndDistance		 = 40.0f;
+
 		// The RHI implementation must support structured buffers
 		const IRenderer& renderer = getSceneResource().getRenderer();
 		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize > 0)
 		{
-			// Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			// TODO(co) Make this dynamic
-			const GrassDataStruct grassData[3] =
+			scatterGrass();
+			createStructuredBuffer();
+		}
+		else
+		{
+			mMaximumNumberOfVisibleGrass = 0;
+			RHI_LOG_ONCE(renderer.getContext(), COMPATIBILITY_WARNING, "The renderer grass scene item needs a RHI implementation with structured buffer support")
+		}
+		updateSceneItemSetBoundingBox();
+	}
+
+	void GrassSceneItem::createStructuredBuffer()
+	{
+		// Create the dynamic structured buffer, the visible grass blades are streamed into it per view
+		mStructuredBufferPtr = getSceneResource().getRenderer().getBufferManager().createStructuredBuffer(sizeof(GrassDataStruct) * mMaximumNumberOfVisibleGrass, nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
+	}
+
+	void GrassSceneItem::setMaterialTechniquesStructuredBuffer()
+	{
+		for (MaterialTechnique* materialTechnique : getSceneResource().getRenderer().getMaterialResourceManager().getById(getMaterialResourceId()).getSortedMaterialTechniqueVector())
+		{
+			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
+		}
+	}
+
+	void GrassSceneItem::scatterGrass()
+	{
+		mGrassDataVector.clear();
+		mCells.clear();
+
+		// Setup the cell grid
+		const float cellSize = mFieldProperties.cellSize;
+		mNumberOfCellsX = std::max(static_cast<uint32_t>(std::ceil(mFieldProperties.size.x / cellSize)), 1u);
+		mNumberOfCellsZ = std::max(static_cast<uint32_t>(std::ceil(mFieldProperties.size.y / cellSize)), 1u);
+		mCells.resize(static_cast<size_t>(mNumberOfCellsX) * mNumberOfCellsZ);
+
+		// Scatter the grass blades cell by cell, candidates are rejected depending on the density map
+		std::mt19937 randomGenerator(::detail::GRASS_RANDOM_SEED);
+		std::uniform_real_distribution<float> randomDistribution(0.0f, 1.0f);
+		const glm::vec2& minimumPosition = mFieldProperties.minimumPosition;
+		const glm::vec2& size = mFieldProperties.size;
+		for (uint32_t z = 0; z < mNumberOfCellsZ; ++z)
+		{
+			for (uint32_t x = 0; x < mNumberOfCellsX; ++x)
 			{
+				Cell& cell = mCells[static_cast<size_t>(z) * mNumberOfCellsX + x];
+				cell.firstGrass = static_cast<uint32_t>(mGrassDataVector.size());
+
+				// The last cell of a row or column might be smaller
+				const glm::vec2 cellMinimum(minimumPosition.x + static_cast<float>(x) * cellSize, minimumPosition.y + static_cast<float>(z) * cellSize);
+				const glm::vec2 cellSizeClamped(std::min(cellSize, minimumPosition.x + size.x - cellMinimum.x), std::min(cellSize, minimumPosition.y + size.y - cellMinimum.y));
+				const uint32_t numberOfCandidates = static_cast<uint32_t>(mFieldProperties.grassPerSquareMeter * cellSizeClamped.x * cellSizeClamped.y + 0.5f);
+				for (uint32_t i = 0; i < numberOfCandidates; ++i)
 				{
-					{ 3.0f, -1.781f, 20.0f, 0.5f },
-					{ 1.0f,  1.0f,   1.0f, 0.4f }
-				},
-				{
-					{ 5.0f, -1.781f, 19.0f, 1.0f },
-					{ 1.0f,  1.0f,   1.0f, 0.8f }
-				},
-				{
-					{ 4.0f, -1.781f, 21.0f, 1.5f },
-					{ 1.0f,  1.0f,   1.0f, 1.2f }
+					const float positionX = cellMinimum.x + randomDistribution(randomGenerator) * cellSizeClamped.x;
+					const float positionZ = cellMinimum.y + randomDistribution(randomGenerator) * cellSizeClamped.y;
+
+					// Nearest density map sample
+					if (!mDensityMap.empty())
+					{
+						const uint32_t densityMapX = std::min(static_cast<uint32_t>((positionX - minimumPosition.x) / size.x * static_cast<float>(mDensityMapWidth)), mDensityMapWidth - 1);
+						const uint32_t densityMapY = std::min(static_cast<uint32_t>((positionZ - minimumPosition.y) / size.y * static_cast<float>(mDensityMapHeight)), mDensityMapHeight - 1);
+						const float density = static_cast<float>(mDensityMap[static_cast<size_t>(densityMapY) * mDensityMapWidth + densityMapX]) / 255.0f;
+						if (randomDistribution(randomGenerator) >= density)
+						{
+							continue;
+						}
+					}
+
+					// Add grass blade
+					const float brightness = 1.0f + (randomDistribution(randomGenerator) * 2.0f - 1.0f) * mFieldProperties.colorVariance;
+					const GrassDataStruct grassDataStruct =
+					{
+						{ positionX, mFieldProperties.groundHeight, positionZ, glm::mix(mFieldProperties.minimumGrassSize, mFieldProperties.maximumGrassSize, randomDistribution(randomGenerator)) },
+						{ mFieldProperties.color.r * brightness, mFieldProperties.color.g * brightness, mFieldProperties.color.b * brightness, randomDistribution(randomGenerator) * glm::two_pi<float>() }
+					};
+					mGrassDataVector.push_back(grassDataStruct);
 				}
-			};
-			Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+				cell.numberOfGrass = static_cast<uint32_t>(mGrassDataVector.size()) - cell.firstGrass;
+			}
+		}
+	}
+
+	void GrassSceneItem::getGroundHeightRange(float& minimumGroundHeight, float& maximumGroundHeight) const
+	{
+		// Flat ground plane by default
+		minimumGroundHeight = maximumGroundHeight = mFieldProperties.groundHeight;
 
-			// Create the structured buffer
-			mStructuredBufferPtr = bufferManager.createStructuredBuffer(sizeof(GrassDataStruct) * mMaximumNumberOfGrass, grassData, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
+		// The grass vertex shader places the grass blades on the terrain height map, if the material asks for it
+		// -> The terrain world position and size material properties are in world space, the grass scene item has neither rotation nor scale
+		if (!mRenderableManager.getRenderables().empty())
+		{
+			const MaterialResource& materialResource = getSceneResource().getRenderer().getMaterialResourceManager().getById(getMaterialResourceId());
+			const MaterialProperty* useTerrainHeightMapMaterialProperty = materialResource.getPropertyById(::detail::USE_TERRAIN_HEIGHT_MAP_PROPERTY_ID);
+			const MaterialProperty* terrainWorldPositionMaterialProperty = materialResource.getPropertyById(::detail::TERRAIN_WORLD_POSITION_PROPERTY_ID);
+			const MaterialProperty* terrainWorldSizeMaterialProperty = materialResource.getPropertyById(::detail::TERRAIN_WORLD_SIZE_PROPERTY_ID);
+			if (nullptr != useTerrainHeightMapMaterialProperty && useTerrainHeightMapMaterialProperty->getBooleanValue() && nullptr != terrainWorldPositionMaterialProperty && nullptr != terrainWorldSizeMaterialProperty)
+			{
+				minimumGroundHeight = static_cast<float>(static_cast<double>(terrainWorldPositionMaterialProperty->getFloat3Value()[1]) - mRenderableManager.getTransform().position.y);
+				maximumGroundHeight = minimumGroundHeight + terrainWorldSizeMaterialProperty->getFloat3Value()[1];
+			}
+		}
+	}
+
+	void GrassSceneItem::updateSceneItemSetBoundingBox()
+	{
+		getGroundHeightRange(mMinimumGroundHeight, mMaximumGroundHeight);
+		if (nullptr != mSceneItemSet)
+		{
+			// Object space grass field bounding box, the grass blade quads extend the grass blade size horizontally
+			const float maximumGrassSize = mFieldProperties.maximumGrassSize;
+			const glm::vec3 minimumPosition(mFieldProperties.minimumPosition.x - maximumGrassSize, mMinimumGroundHeight, mFieldProperties.minimumPosition.y - maximumGrassSize);
+			const glm::vec3 maximumPosition(mFieldProperties.minimumPosition.x + mFieldProperties.size.x + maximumGrassSize, mMaximumGroundHeight + maximumGrassSize, mFieldProperties.minimumPosition.y + mFieldProperties.size.y + maximumGrassSize);
+
+			{ // Set minimum object space bounding box corner position
+				mSceneItemSet->minimumX[mSceneItemSetIndex] = minimumPosition.x;
+				mSceneItemSet->minimumY[mSceneItemSetIndex] = minimumPosition.y;
+				mSceneItemSet->minimumZ[mSceneItemSetIndex] = minimumPosition.z;
+			}
 
-			{ // Create the indirect buffer: Twelve vertices per grass (two quads), grass index = instance index
-				const Rhi::DrawArguments drawArguments =
+			{ // Set maximum object space bounding box corner position
+				mSceneItemSet->maximumX[mSceneItemSetIndex] = maximumPosition.x;
+				mSceneItemSet->maximumY[mSceneItemSetIndex] = maximumPosition.y;
+				mSceneItemSet->maximumZ[mSceneItemSetIndex] = maximumPosition.z;
+			}
+
+			// Set negative world space radius of bounding sphere
+			// -> The bounding sphere is centered at the scene item origin since "Renderer::SceneNode::updateSceneItemTransform()" places it at the scene node position
+			const glm::vec3 farthestCorner = glm::max(glm::abs(minimumPosition), glm::abs(maximumPosition));
+			mSceneItemSet->negativeRadius[mSceneItemSetIndex] = -glm::length(farthestCorner);
+
+			// The bounding box changed, so the grass is no longer considered to be a static shadow caster
+			onSceneItemSetTransformChange();
+		}
+	}
+
+	void GrassSceneItem::updateVisibleGrass(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData)
+	{
+		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		if (nullptr == cameraSceneItem || renderables.empty())
+		{
+			return;
+		}
+
+		// The ground height range changes if the terrain material properties or the scene node position change
+		{
+			float minimumGroundHeight = 0.0f;
+			float maximumGroundHeight = 0.0f;
+			getGroundHeightRange(minimumGroundHeight, maximumGroundHeight);
+			if (mMinimumGroundHeight != minimumGroundHeight || mMaximumGroundHeight != maximumGroundHeight)
+			{
+				updateSceneItemSetBoundingBox();
+			}
+		}
+
+		// Cell culling is disabled for single pass stereo rendering, "Renderer::SceneCullingManager" doesn't cull in this case either
+		const bool cellCulling = !compositorContextData.getSinglePassStereoInstancing();
+
+		// Calculate the frustum using a camera relative world space to clip space matrix
+		uint32_t renderTargetWidth = 1;
+		uint32_t renderTargetHeight = 1;
+		renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+		const Frustum frustum(cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight)) * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+
+		// Gather the visible cells, the cell bounding boxes are camera relative and the grass blade quads extend the grass blade size horizontally
+		const glm::vec3 cameraRelativeOrigin = mRenderableManager.getTransform().position - compositorContextData.getWorldSpaceCameraPosition();
+		const float cellSize = mFieldProperties.cellSize;
+		const float maximumGrassSize = mFieldProperties.maximumGrassSize;
+		const float lodStartDistance = mFieldProperties.lodStartDistance;
+		const float lodEndDistance = mFieldProperties.lodEndDistance;
+		mVisibleCells.clear();
+		for (uint32_t z = 0; z < mNumberOfCellsZ; ++z)
+		{
+			for (uint32_t x = 0; x < mNumberOfCellsX; ++x)
+			{
+				const uint32_t cellIndex = z * mNumberOfCellsX + x;
+				if (mCells[cellIndex].numberOfGrass > 0)
 				{
-					12,						// vertexCountPerInstance (uint32_t)
-					mMaximumNumberOfGrass,	// instanceCount (uint32_t)
-					0,						// startVertexLocation (uint32_t)
-					0						// startInstanceLocation (uint32_t)
-				};
-				mIndirectBufferPtr = bufferManager.createIndirectBuffer(sizeof(Rhi::DrawArguments), &drawArguments, Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::DRAW_ARGUMENTS, Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("Grass"));
+					const glm::vec3 cellMinimum(cameraRelativeOrigin.x + mFieldProperties.minimumPosition.x + static_cast<float>(x) * cellSize - maximumGrassSize, cameraRelativeOrigin.y + mMinimumGroundHeight, cameraRelativeOrigin.z + mFieldProperties.minimumPosition.y + static_cast<float>(z) * cellSize - maximumGrassSize);
+					const glm::vec3 cellMaximum(cellMinimum.x + cellSize + maximumGrassSize * 2.0f, cameraRelativeOrigin.y + mMaximumGroundHeight + maximumGrassSize, cellMinimum.z + cellSize + maximumGrassSize * 2.0f);
+
+					// Distance between the camera and the nearest point of the cell bounding box, cells beyond the level of detail end distance have no grass left
+					const float distance = glm::length(glm::clamp(glm::vec3(0.0f), cellMinimum, cellMaximum));
+					if (distance < lodEndDistance && !(cellCulling && ::detail::isGrassCellOutsideFrustum(frustum, cellMinimum, cellMaximum)))
+					{
+						mVisibleCells.push_back({distance, cellIndex});
+					}
+				}
 			}
 		}
-		else
+
+		// Front-to-back so the nearest cells win if the maximum number of visible grass blades is reached, in addition this is beneficial for early depth test
+		std::sort(mVisibleCells.begin(), mVisibleCells.end(), [](const VisibleCell& left, const VisibleCell& right) { return (left.distance < right.distance); });
+
+		// Stream the level of detail subset of the visible cells into the structured buffer
+		uint32_t numberOfVisibleGrass = 0;
+		if (!mVisibleCells.empty())
 		{
-			mMaximumNumberOfGrass = 0;
-			RHI_LOG_ONCE(renderer.getContext(), COMPATIBILITY_WARNING, "The renderer grass scene item needs a RHI implementation with structured buffer support")
+			Rhi::IRhi& rhi = getSceneResource().getRenderer().getRhi();
+			Rhi::MappedSubresource mappedSubresource;
+			if (rhi.map(*mStructuredBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			{
+				GrassDataStruct* grassDataStructs = static_cast<GrassDataStruct*>(mappedSubresource.data);
+				for (const VisibleCell& visibleCell : mVisibleCells)
+				{
+					// The grass blades inside a cell are in random order, so the first grass blades are an uniform subset of the cell
+					const Cell& cell = mCells[visibleCell.cellIndex];
+					const float lodFactor = (visibleCell.distance <= lodStartDistance) ? 1.0f : (1.0f - (visibleCell.distance - lodStartDistance) / (lodEndDistance - lodStartDistance));
+					const uint32_t numberOfGrass = std::min(static_cast<uint32_t>(std::ceil(lodFactor * static_cast<float>(cell.numberOfGrass))), mMaximumNumberOfVisibleGrass - numberOfVisibleGrass);
+					memcpy(&grassDataStructs[numberOfVisibleGrass], &mGrassDataVector[cell.firstGrass], sizeof(GrassDataStruct) * numberOfGrass);
+					numberOfVisibleGrass += numberOfGrass;
+					if (numberOfVisibleGrass == mMaximumNumberOfVisibleGrass)
+					{
+						break;
+					}
+				}
+				rhi.unmap(*mStructuredBufferPtr, 0);
+			}
 		}
+		mNumberOfVisibleGrass = numberOfVisibleGrass;
+		renderables[0].setNumberOfIndices(numberOfVisibleGrass * ::detail::NUMBER_OF_GRASS_VERTICES);
 	}
 
 
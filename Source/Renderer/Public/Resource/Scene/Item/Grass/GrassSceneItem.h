@@ -29,6 +29,18 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/MaterialSceneItem.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(5214)	// warning C5214: applying '*=' to an operand with a volatile qualified type is deprecated in C++20 (compiling source file E:\private\unrimp\Source\RendererToolkit\Private\AssetCompiler\TextureAssetCompiler.cpp)
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+#include <vector>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -44,8 +56,20 @@ namespace Renderer
 	*  @brief
 	*    Grass scene item
 	*
-	*  @todo
-	*    - TODO(co) Work-in-progress
+	*  @remarks
+	*    The grass blades are scattered once over a rectangular grass field using an optional density map and are stored sorted by
+	*    spatial cells. Per view, the cells are culled against the camera frustum and a level of detail is selected by distance:
+	*    Since the grass blades inside a cell are in random order, the first n grass blades of a cell are an uniform subset of the cell.
+	*    The selected grass blades of the visible cells are streamed front-to-back into a dynamic structured buffer, this way the CPU
+	*    only touches the grass blades which are actually drawn instead of all grass blades.
+	*
+	*    By default the grass blades are placed on a plane at the ground height. If the material property "UseTerrainHeightMap" is set,
+	*    the grass vertex shader places the grass blades on the terrain height map instead, the terrain height map is only available on
+	*    the GPU. The material properties "TerrainWorldPosition", "TerrainWorldSize" and "TerrainWorldRotation" must match the terrain,
+	*    the world space height range of the terrain is used for culling in this case.
+	*
+	*    Each grass blade is drawn using twelve vertices of a non-instanced draw call, so the number of visible grass blades isn't
+	*    limited by the size of the draw ID vertex buffer.
 	*/
 	class GrassSceneItem final : public MaterialSceneItem
 	{
@@ -67,6 +91,85 @@ namespace Renderer
 			float PositionSize[4];	// Object space grass xyz-position, w = grass size
 			float ColorRotation[4];	// Linear RGB grass color and rotation in radians
 		};
+		struct FieldProperties final
+		{
+			glm::vec2 minimumPosition;		///< Object space xz-position of the minimum grass field corner
+			glm::vec2 size;					///< Size of the grass field in meter along the object space x- and z-axis
+			float	  groundHeight;			///< Object space y-position of the ground the grass blades are placed on, unused if the grass blades are placed on the terrain height map
+			float	  cellSize;				///< Size of the spatial cells in meter, the cells are the unit of culling and level of detail selection
+			float	  grassPerSquareMeter;	///< Number of grass blades per square meter at full density
+			float	  minimumGrassSize;		///< Minimum grass blade size in meter
+			float	  maximumGrassSize;		///< Maximum grass blade size in meter, must be equal or greater as the minimum grass blade size
+			glm::vec3 color;				///< Linear RGB grass color
+			float	  colorVariance;		///< Random brightness variance of the grass color, 0 = none
+			float	  lodStartDistance;		///< Distance in meter at which the grass density starts to fade out
+			float	  lodEndDistance;		///< Distance in meter at which the grass density reaches zero, must be greater as the level of detail start distance
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline const FieldProperties& getFieldProperties() const
+		{
+			return mFieldProperties;
+		}
+
+		/**
+		*  @brief
+		*    Set the grass field properties
+		*
+		*  @param[in] fieldProperties
+		*    Grass field properties to set
+		*
+		*  @note
+		*    - Scatters the grass blades again, don't call this method each frame
+		*/
+		RENDERER_API_EXPORT void setFieldProperties(const FieldProperties& fieldProperties);
+
+		/**
+		*  @brief
+		*    Set the grass density map
+		*
+		*  @param[in] width
+		*    Density map width, the density map covers the grass field along the object space x-axis
+		*  @param[in] height
+		*    Density map height, the density map covers the grass field along the object space z-axis
+		*  @param[in] densityMap
+		*    Density map with "width * height" 8 bit density values, 255 = full density, data is copied, null pointer for full density everywhere
+		*
+		*  @note
+		*    - Scatters the grass blades again, don't call this method each frame
+		*/
+		RENDERER_API_EXPORT void setDensityMap(uint32_t width, uint32_t height, const uint8_t* densityMap);
+
+		[[nodiscard]] inline uint32_t getMaximumNumberOfVisibleGrass() const
+		{
+			return mMaximumNumberOfVisibleGrass;
+		}
+
+		/**
+		*  @brief
+		*    Set the maximum number of visible grass blades
+		*
+		*  @param[in] maximumNumberOfVisibleGrass
+		*    Maximum number of visible grass blades, must be positive, defines the size of the structured buffer the visible grass blades are streamed into
+		*
+		*  @note
+		*    - Ignored if the RHI implementation has no structured buffer support
+		*/
+		RENDERER_API_EXPORT void setMaximumNumberOfVisibleGrass(uint32_t maximumNumberOfVisibleGrass);
+
+		[[nodiscard]] inline uint32_t getNumberOfGrass() const
+		{
+			return static_cast<uint32_t>(mGrassDataVector.size());
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfVisibleGrass() const
+		{
+			return mNumberOfVisibleGrass;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -109,15 +212,52 @@ namespace Renderer
 
 		explicit GrassSceneItem(const GrassSceneItem&) = delete;
 		GrassSceneItem& operator=(const GrassSceneItem&) = delete;
+		void createStructuredBuffer();
+		void setMaterialTechniquesStructuredBuffer();
+		void scatterGrass();
+		void getGroundHeightRange(float& minimumGroundHeight, float& maximumGroundHeight) const;
+		void updateSceneItemSetBoundingBox();
+		void updateVisibleGrass(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Cell final
+		{
+			uint32_t firstGrass;		///< Index of the first grass blade of the cell inside "Renderer::GrassSceneItem::mGrassDataVector"
+			uint32_t numberOfGrass;		///< Number of grass blades inside the cell
+		};
+		struct VisibleCell final
+		{
+			float	 distance;			///< Distance between the camera and the cell in meter
+			uint32_t cellIndex;
+		};
+		typedef std::vector<GrassDataStruct> GrassDataVector;
+		typedef std::vector<Cell>			 Cells;
+		typedef std::vector<VisibleCell>	 VisibleCells;
+		typedef std::vector<uint8_t>		 DensityMap;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint32_t				  mMaximumNumberOfGrass;	///< Maximum number of grass
-		Rhi::IStructuredBufferPtr mStructuredBufferPtr;		///< Structured buffer the data of the individual grass ("Renderer::GrassSceneItem::GrassDataStruct")
-		Rhi::IIndirectBufferPtr   mIndirectBufferPtr;		///< Indirect buffer holding data related to the current grass "Rhi::DrawArguments" draw call
+		FieldProperties			  mFieldProperties;
+		DensityMap				  mDensityMap;					///< 8 bit density values, empty for full density everywhere
+		uint32_t				  mDensityMapWidth;
+		uint32_t				  mDensityMapHeight;
+		GrassDataVector			  mGrassDataVector;				///< All grass blades sorted by cell, the grass blades inside a cell are in random order
+		Cells					  mCells;						///< Cells in row-major order, x-axis first
+		uint32_t				  mNumberOfCellsX;
+		uint32_t				  mNumberOfCellsZ;
+		float					  mMinimumGroundHeight;			///< Object space minimum y-position of the grass blade roots the scene item set bounding box was calculated with
+		float					  mMaximumGroundHeight;			///< Object space maximum y-position of the grass blade roots the scene item set bounding box was calculated with
+		VisibleCells			  mVisibleCells;				///< Scratch buffer for the visible cells of the current view, member to avoid reallocations
+		uint32_t				  mMaximumNumberOfVisibleGrass;	///< Maximum number of visible grass blades
+		uint32_t				  mNumberOfVisibleGrass;		///< Number of visible grass blades of the last view
+		Rhi::IStructuredBufferPtr mStructuredBufferPtr;			///< Dynamic structured buffer the data of the individual visible grass blades are streamed into ("Renderer::GrassSceneItem::GrassDataStruct")
 
 
 	};
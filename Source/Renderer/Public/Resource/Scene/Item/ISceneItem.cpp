@@ -25,6 +25,41 @@
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/IRenderer.h"
+
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		template <typename VECTOR>
+		void removeSceneItemSetElement(VECTOR& vector, uint32_t index, uint32_t lastIndex)
+		{
+			// Move the last element into the gap, don't shrink the vector in case it was resized for SIMD lane alignment during culling
+			vector[index] = vector[lastIndex];
+			if (vector.size() == lastIndex + 1)
+			{
+				vector.pop_back();
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -96,6 +131,7 @@ namespace Renderer
 			mSceneItemSet->negativeRadius.push_back(-1.0f);
 
 			mSceneItemSet->visibilityFlag.push_back(0);
+			mSceneItemSet->transformChangeFrameNumber.push_back(static_cast<uint32_t>(mSceneResource.getRenderer().getTimeManager().getNumberOfRenderedFrames()));
 			mSceneItemSet->sceneItemVector.push_back(this);
 			++mSceneItemSet->numberOfSceneItems;
 		}
@@ -107,7 +143,68 @@ namespace Renderer
 
 	ISceneItem::~ISceneItem()
 	{
-		// Nothing here
+		// Remove the scene item from the scene culling, else the scene culling would access a destroyed scene item
+		if (nullptr != mSceneItemSet)
+		{
+			// Swap with the last scene item
+			const uint32_t lastIndex = mSceneItemSet->numberOfSceneItems - 1;
+			if (mSceneItemSetIndex != lastIndex)
+			{
+				mSceneItemSet->sceneItemVector[lastIndex]->mSceneItemSetIndex = mSceneItemSetIndex;
+			}
+			::detail::removeSceneItemSetElement(mSceneItemSet->minimumX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->minimumY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->minimumZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->maximumX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->maximumY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->maximumZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldXX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldXY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldXZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldXW, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldYX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldYY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldYZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldYW, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldZX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldZY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldZZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldZW, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldWX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldWY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldWZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->worldWW, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->spherePositionX, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->spherePositionY, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->spherePositionZ, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->negativeRadius, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->visibilityFlag, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->transformChangeFrameNumber, mSceneItemSetIndex, lastIndex);
+			::detail::removeSceneItemSetElement(mSceneItemSet->sceneItemVector, mSceneItemSetIndex, lastIndex);
+			if (mSceneItemSet->sceneItemVector.size() > lastIndex)
+			{
+				mSceneItemSet->sceneItemVector[lastIndex] = nullptr;
+			}
+			--mSceneItemSet->numberOfSceneItems;
+		}
+		else
+		{
+			SceneCullingManager::SceneItems& uncullableSceneItems = mSceneResource.getSceneCullingManager().getUncullableSceneItems();
+			SceneCullingManager::SceneItems::iterator iterator = std::find(uncullableSceneItems.begin(), uncullableSceneItems.end(), this);
+			if (uncullableSceneItems.end() != iterator)
+			{
+				uncullableSceneItems.erase(iterator);
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void ISceneItem::onSceneItemSetTransformChange()
+	{
+		mSceneItemSet->transformChangeFrameNumber[mSceneItemSetIndex] = static_cast<uint32_t>(mSceneResource.getRenderer().getTimeManager().getNumberOfRenderedFrames());
 	}
 
 
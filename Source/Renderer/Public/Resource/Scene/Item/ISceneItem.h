@@ -68,7 +68,9 @@ namespace Renderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class SceneNode;						// TODO(co) Remove this
+		friend class GrassSceneItem;				// Needs to be able to set the scene item set bounding box
 		friend class MeshSceneItem;					// TODO(co) Remove this
+		friend class ParticlesSceneItem;			// Needs to be able to set the scene item set bounding box
 		friend class SceneResource;					// Needs to be able to destroy scene items
 		friend class CompositorWorkspaceInstance;	// Needs to be able to call "Renderer::ISceneItem::onExecuteOnRendering()"
 
@@ -173,6 +175,13 @@ namespace Renderer
 		}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		void onSceneItemSetTransformChange();	// The scene item is no longer considered to be a static shadow caster, must be inside a scene item set
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
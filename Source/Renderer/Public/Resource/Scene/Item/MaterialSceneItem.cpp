@@ -53,8 +53,7 @@ namespace Renderer
 		mMaterialBlueprintAssetId = materialData->materialBlueprintAssetId;
 
 		{ // Read material properties
-			// TODO(co) Get rid of the evil const-cast
-			MaterialProperties::SortedPropertyVector& sortedPropertyVector = const_cast<MaterialProperties::SortedPropertyVector&>(mMaterialProperties.getSortedPropertyVector());
+			MaterialProperties::SortedPropertyVector& sortedPropertyVector = mMaterialProperties.getSortedPropertyVector();
 			sortedPropertyVector.resize(materialData->numberOfMaterialProperties);
 			memcpy(reinterpret_cast<char*>(sortedPropertyVector.data()), data + sizeof(v1Scene::MaterialData), sizeof(MaterialProperty) * materialData->numberOfMaterialProperties);
 		}
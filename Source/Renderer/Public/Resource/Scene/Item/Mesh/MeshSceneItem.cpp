@@ -182,6 +182,9 @@ namespace Renderer
 						}
 						mSceneItemSet->negativeRadius[mSceneItemSetIndex] = -boundingSphereRadius;
 					}
+
+					// The shadow caster shape changed, the scene item is no longer considered to be a static shadow caster
+					onSceneItemSetTransformChange();
 				}
 
 				// Fill renderable manager
@@ -22,10 +22,24 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/Particles/ParticlesSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialResource.h"
+#include "Renderer/Public/Core/Thread/ThreadPool.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5219)	// warning C5219: implicit conversion from 'const int' to 'const _Ty', possible loss of data
+	#include <limits>
+	#include <random>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -35,25 +49,498 @@ namespace Renderer
 
 
 	//[-------------------------------------------------------]
-	//[ Public virtual Renderer::ISceneItem methods           ]
+	//[ Structures                                            ]
 	//[-------------------------------------------------------]
-	const RenderableManager* ParticlesSceneItem::getRenderableManager() const
+	/**
+	*  @brief
+	*    Structure-of-arrays particle pool, the alive particles are densely packed at the front
+	*
+	*  @note
+	*    - The capacity is a multiple of the SIMD lane count so the SIMD kernels can process the last incomplete package without special treatment
+	*/
+	struct ParticlePool final
+	{
+		typedef SceneItemSet::FloatVector FloatVector;
+		FloatVector			  positionX;		///< Object space particle position
+		FloatVector			  positionY;
+		FloatVector			  positionZ;
+		FloatVector			  velocityX;		///< Object space particle velocity in meter per second
+		FloatVector			  velocityY;
+		FloatVector			  velocityZ;
+		FloatVector			  normalizedAge;	///< Particle age in relation to the particle lifetime, a particle is dead as soon as it reaches one
+		FloatVector			  inverseLifetime;	///< One divided by the particle lifetime in seconds
+		uint32_t			  numberOfAliveParticles;
+		float				  emissionAccumulator;	///< Fractional number of particles which still have to be emitted
+		std::mt19937		  randomGenerator;
+		std::vector<glm::vec3> threadBoundingBoxes;	///< Object space minimum and maximum bounding box corner per worker thread
+
+		inline ParticlePool() :
+			numberOfAliveParticles(0),
+			emissionAccumulator(0.0f)
+		{
+			// Nothing here
+		}
+
+		void resize(uint32_t maximumNumberOfParticles)
+		{
+			const size_t capacity = Math::makeMultipleOf(maximumNumberOfParticles, static_cast<uint32_t>(xsimd::simd_type<float>::size));
+			positionX.resize(capacity, 0.0f);
+			positionY.resize(capacity, 0.0f);
+			positionZ.resize(capacity, 0.0f);
+			velocityX.resize(capacity, 0.0f);
+			velocityY.resize(capacity, 0.0f);
+			velocityZ.resize(capacity, 0.0f);
+			normalizedAge.resize(capacity, 0.0f);
+			inverseLifetime.resize(capacity, 0.0f);
+			numberOfAliveParticles = std::min(numberOfAliveParticles, maximumNumberOfParticles);
+		}
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t PARTICLES_PACKAGE_SIZE	  = 4096;	///< Number of particles inside a package the default thread pool works on, multiple of the SIMD lane count
+		static constexpr float	  MAXIMUM_PARTICLES_TIME_STEP = 0.1f;	///< Maximum simulated time step in seconds, avoids that particles explode after a hitch
+		static constexpr size_t	  PARTICLES_SIMD_SIZE		  = xsimd::simd_type<float>::size;
+		typedef xsimd::simd_type<float> ParticlesFloat4;
+		static_assert(0 == PARTICLES_PACKAGE_SIZE % PARTICLES_SIMD_SIZE, "The particles package size must be a multiple of the SIMD lane count");
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Range of alive particles of a particles scene item, the packages of all particles scene items are processed together
+		*/
+		struct ParticlesPackage final
+		{
+			uint32_t  particlesSceneItemIndex;	///< Index of the particles scene item the particles belong to
+			uint32_t  startIndex;				///< Index of the first particle, multiple of the SIMD lane count
+			uint32_t  endIndex;					///< Index one behind the last particle
+			glm::vec3 minimumPosition;			///< Object space minimum bounding box corner of the packed particles
+			glm::vec3 maximumPosition;			///< Object space maximum bounding box corner of the packed particles
+		};
+		typedef std::vector<ParticlesPackage> ParticlesPackages;
+
+		/**
+		*  @brief
+		*    Particles scene item data the particles packages are working on
+		*/
+		struct ParticlesEmitter final
+		{
+			Renderer::ParticlePool*									particlePool;
+			const Renderer::ParticlesSceneItem::EmitterProperties*	emitterProperties;
+			uint32_t												maximumNumberOfParticles;
+			Renderer::ParticlesSceneItem::ParticleDataStruct*		particleDataStructs;	///< Mapped structured buffer, null pointer if the structured buffer isn't mapped
+		};
+		typedef std::vector<ParticlesEmitter> ParticlesEmitters;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Distribute the processing of the given number of items over the default thread pool
+		*
+		*  @param[in] defaultThreadPool
+		*    Default thread pool to use
+		*  @param[in] numberOfItems
+		*    Number of items to process, e.g. particles packages or particles scene items
+		*  @param[in] function
+		*    Function with the signature "void(size_t startIndex, size_t endIndex)"
+		*/
+		template <typename Function>
+		void processParticlesDataParallel(Renderer::DefaultThreadPool& defaultThreadPool, size_t numberOfItems, const Function& function)
+		{
+			size_t itemCount = numberOfItems;
+			size_t splitCount = 1;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (threadCount <= 1)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				function(0, itemCount);
+			}
+			else
+			{
+				// Multi-threaded
+				size_t threadItemIndexOffset = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					defaultThreadPool.queueTask(std::bind(function, threadItemIndexOffset, threadItemIndexOffset + numberOfItemsToProcess));
+					itemCount -= splitCount;
+					threadItemIndexOffset += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+		}
+
+		/**
+		*  @brief
+		*    SIMD particle integration and aging kernel
+		*
+		*  @note
+		*    - Semi-implicit Euler integration: The velocity is updated first, the position is updated using the new velocity
+		*    - Processes whole SIMD packages, the end index is rounded up to the SIMD lane count
+		*/
+		void simdIntegrateParticles(Renderer::ParticlePool& particlePool, const glm::vec3& velocityChange, float dragFactor, float pastSecondsSinceLastFrame, size_t startIndex, size_t endIndex)
+		{
+			// Get pointers to the necessary members of the particle pool
+			float* RESTRICT positionXData = particlePool.positionX.data();
+			float* RESTRICT positionYData = particlePool.positionY.data();
+			float* RESTRICT positionZData = particlePool.positionZ.data();
+			float* RESTRICT velocityXData = particlePool.velocityX.data();
+			float* RESTRICT velocityYData = particlePool.velocityY.data();
+			float* RESTRICT velocityZData = particlePool.velocityZ.data();
+			float* RESTRICT normalizedAgeData = particlePool.normalizedAge.data();
+			const float* RESTRICT inverseLifetimeData = particlePool.inverseLifetime.data();
+
+			// Replicate the constants
+			const ParticlesFloat4 velocityChangeX(velocityChange.x);
+			const ParticlesFloat4 velocityChangeY(velocityChange.y);
+			const ParticlesFloat4 velocityChangeZ(velocityChange.z);
+			const ParticlesFloat4 dragFactorFloat4(dragFactor);
+			const ParticlesFloat4 pastSecondsFloat4(pastSecondsSinceLastFrame);
+
+			// Integrate and age the particles
+			for (size_t particleIndex = startIndex; particleIndex < endIndex; particleIndex += PARTICLES_SIMD_SIZE)
+			{
+				const ParticlesFloat4 velocityX = (xsimd::load_aligned(&velocityXData[particleIndex]) + velocityChangeX) * dragFactorFloat4;
+				const ParticlesFloat4 velocityY = (xsimd::load_aligned(&velocityYData[particleIndex]) + velocityChangeY) * dragFactorFloat4;
+				const ParticlesFloat4 velocityZ = (xsimd::load_aligned(&velocityZData[particleIndex]) + velocityChangeZ) * dragFactorFloat4;
+				xsimd::store_aligned(&velocityXData[particleIndex], velocityX);
+				xsimd::store_aligned(&velocityYData[particleIndex], velocityY);
+				xsimd::store_aligned(&velocityZData[particleIndex], velocityZ);
+				xsimd::store_aligned(&positionXData[particleIndex], xsimd::load_aligned(&positionXData[particleIndex]) + velocityX * pastSecondsFloat4);
+				xsimd::store_aligned(&positionYData[particleIndex], xsimd::load_aligned(&positionYData[particleIndex]) + velocityY * pastSecondsFloat4);
+				xsimd::store_aligned(&positionZData[particleIndex], xsimd::load_aligned(&positionZData[particleIndex]) + velocityZ * pastSecondsFloat4);
+				xsimd::store_aligned(&normalizedAgeData[particleIndex], xsimd::load_aligned(&normalizedAgeData[particleIndex]) + xsimd::load_aligned(&inverseLifetimeData[particleIndex]) * pastSecondsFloat4);
+			}
+		}
+
+		void removeDeadParticles(Renderer::ParticlePool& particlePool)
+		{
+			// Swap dead particles with the last alive particle to keep the alive particles densely packed
+			uint32_t numberOfAliveParticles = particlePool.numberOfAliveParticles;
+			uint32_t particleIndex = 0;
+			while (particleIndex < numberOfAliveParticles)
+			{
+				if (particlePool.normalizedAge[particleIndex] >= 1.0f)
+				{
+					--numberOfAliveParticles;
+					particlePool.positionX[particleIndex]		= particlePool.positionX[numberOfAliveParticles];
+					particlePool.positionY[particleIndex]		= particlePool.positionY[numberOfAliveParticles];
+					particlePool.positionZ[particleIndex]		= particlePool.positionZ[numberOfAliveParticles];
+					particlePool.velocityX[particleIndex]		= particlePool.velocityX[numberOfAliveParticles];
+					particlePool.velocityY[particleIndex]		= particlePool.velocityY[numberOfAliveParticles];
+					particlePool.velocityZ[particleIndex]		= particlePool.velocityZ[numberOfAliveParticles];
+					particlePool.normalizedAge[particleIndex]	= particlePool.normalizedAge[numberOfAliveParticles];
+					particlePool.inverseLifetime[particleIndex] = particlePool.inverseLifetime[numberOfAliveParticles];
+				}
+				else
+				{
+					++particleIndex;
+				}
+			}
+			particlePool.numberOfAliveParticles = numberOfAliveParticles;
+		}
+
+		void emitParticles(Renderer::ParticlePool& particlePool, const Renderer::ParticlesSceneItem::EmitterProperties& emitterProperties, uint32_t numberOfParticlesToEmit)
+		{
+			std::uniform_real_distribution<float> randomDistributionFull(-1.0f, 1.0f);
+			std::uniform_real_distribution<float> randomDistributionHalf(0.0f, 1.0f);
+			const uint32_t endIndex = particlePool.numberOfAliveParticles + numberOfParticlesToEmit;
+			for (uint32_t particleIndex = particlePool.numberOfAliveParticles; particleIndex < endIndex; ++particleIndex)
+			{
+				particlePool.positionX[particleIndex] = emitterProperties.halfExtent.x * randomDistributionFull(particlePool.randomGenerator);
+				particlePool.positionY[particleIndex] = emitterProperties.halfExtent.y * randomDistributionFull(particlePool.randomGenerator);
+				particlePool.positionZ[particleIndex] = emitterProperties.halfExtent.z * randomDistributionFull(particlePool.randomGenerator);
+				particlePool.velocityX[particleIndex] = emitterProperties.velocity.x + emitterProperties.velocityVariance.x * randomDistributionFull(particlePool.randomGenerator);
+				particlePool.velocityY[particleIndex] = emitterProperties.velocity.y + emitterProperties.velocityVariance.y * randomDistributionFull(particlePool.randomGenerator);
+				particlePool.velocityZ[particleIndex] = emitterProperties.velocity.z + emitterProperties.velocityVariance.z * randomDistributionFull(particlePool.randomGenerator);
+				particlePool.normalizedAge[particleIndex] = 0.0f;
+				particlePool.inverseLifetime[particleIndex] = 1.0f / glm::mix(emitterProperties.minimumLifetime, emitterProperties.maximumLifetime, randomDistributionHalf(particlePool.randomGenerator));
+			}
+			particlePool.numberOfAliveParticles = endIndex;
+		}
+
+		void removeDeadAndEmitParticles(Renderer::ParticlePool& particlePool, const Renderer::ParticlesSceneItem::EmitterProperties& emitterProperties, uint32_t maximumNumberOfParticles, float pastSecondsSinceLastFrame)
+		{
+			// Remove the dead particles
+			if (particlePool.numberOfAliveParticles > 0)
+			{
+				removeDeadParticles(particlePool);
+			}
+
+			// Emit new particles
+			particlePool.emissionAccumulator += emitterProperties.emissionRate * pastSecondsSinceLastFrame;
+			const uint32_t numberOfFreeParticles = maximumNumberOfParticles - particlePool.numberOfAliveParticles;
+			const uint32_t numberOfParticlesToEmit = std::min(static_cast<uint32_t>(particlePool.emissionAccumulator), numberOfFreeParticles);
+			if (numberOfParticlesToEmit > 0)
+			{
+				emitParticles(particlePool, emitterProperties, numberOfParticlesToEmit);
+			}
+
+			// Don't let the emission pile up while the particle pool is full
+			particlePool.emissionAccumulator = (numberOfParticlesToEmit < numberOfFreeParticles) ? (particlePool.emissionAccumulator - static_cast<float>(numberOfParticlesToEmit)) : 0.0f;
+		}
+
+		void packParticles(const Renderer::ParticlePool& particlePool, const Renderer::ParticlesSceneItem::EmitterProperties& emitterProperties, Renderer::ParticlesSceneItem::ParticleDataStruct* RESTRICT particleDataStructs, ParticlesPackage& particlesPackage)
+		{
+			glm::vec3 minimumPosition(std::numeric_limits<float>::max());
+			glm::vec3 maximumPosition(std::numeric_limits<float>::lowest());
+			for (uint32_t particleIndex = particlesPackage.startIndex; particleIndex < particlesPackage.endIndex; ++particleIndex)
+			{
+				// Interpolate size and color over the particle lifetime
+				const float normalizedAge = particlePool.normalizedAge[particleIndex];
+				const glm::vec3 position(particlePool.positionX[particleIndex], particlePool.positionY[particleIndex], particlePool.positionZ[particleIndex]);
+				const float size = glm::mix(emitterProperties.startSize, emitterProperties.endSize, normalizedAge);
+				const glm::vec4 color = glm::mix(emitterProperties.startColor, emitterProperties.endColor, normalizedAge);
+
+				// Write the particle data
+				Renderer::ParticlesSceneItem::ParticleDataStruct& particleDataStruct = particleDataStructs[particleIndex];
+				particleDataStruct.PositionSize[0] = position.x;
+				particleDataStruct.PositionSize[1] = position.y;
+				particleDataStruct.PositionSize[2] = position.z;
+				particleDataStruct.PositionSize[3] = size;
+				particleDataStruct.Color[0] = color.r;
+				particleDataStruct.Color[1] = color.g;
+				particleDataStruct.Color[2] = color.b;
+				particleDataStruct.Color[3] = color.a;
+
+				// Grow the bounding box, the billboard can face into any direction
+				minimumPosition = glm::min(minimumPosition, position - size);
+				maximumPosition = glm::max(maximumPosition, position + size);
+			}
+			particlesPackage.minimumPosition = minimumPosition;
+			particlesPackage.maximumPosition = maximumPosition;
+		}
+
+		void gatherParticlesPackages(const ParticlesEmitters& particlesEmitters, ParticlesPackages& particlesPackages)
+		{
+			particlesPackages.clear();
+			const uint32_t numberOfParticlesEmitters = static_cast<uint32_t>(particlesEmitters.size());
+			for (uint32_t particlesSceneItemIndex = 0; particlesSceneItemIndex < numberOfParticlesEmitters; ++particlesSceneItemIndex)
+			{
+				const uint32_t numberOfAliveParticles = particlesEmitters[particlesSceneItemIndex].particlePool->numberOfAliveParticles;
+				for (uint32_t startIndex = 0; startIndex < numberOfAliveParticles; startIndex += PARTICLES_PACKAGE_SIZE)
+				{
+					particlesPackages.push_back({ particlesSceneItemIndex, startIndex, std::min(startIndex + PARTICLES_PACKAGE_SIZE, numberOfAliveParticles), glm::vec3(), glm::vec3() });
+				}
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void ParticlesSceneItem::updateParticlesSceneItems(const IRenderer& renderer, ParticlesSceneItem* const* particlesSceneItems, uint32_t numberOfParticlesSceneItems, float pastSecondsSinceLastFrame)
+	{
+		DefaultThreadPool& defaultThreadPool = renderer.getDefaultThreadPool();
+		pastSecondsSinceLastFrame = std::min(pastSecondsSinceLastFrame, ::detail::MAXIMUM_PARTICLES_TIME_STEP);
+
+		// Gather the particles scene items which can be simulated
+		::detail::ParticlesEmitters particlesEmitters;
+		particlesEmitters.reserve(numberOfParticlesSceneItems);
+		for (uint32_t i = 0; i < numberOfParticlesSceneItems; ++i)
+		{
+			const ParticlesSceneItem* particlesSceneItem = particlesSceneItems[i];
+			if (nullptr != particlesSceneItem->mStructuredBufferPtr)
+			{
+				particlesEmitters.push_back({ particlesSceneItem->mParticlePool, &particlesSceneItem->mEmitterProperties, particlesSceneItem->mMaximumNumberOfParticles, nullptr });
+			}
+		}
+		if (particlesEmitters.empty())
+		{
+			// Nothing to do in here
+			return;
+		}
+
+		// Integrate and age the alive particles, the particles packages of all particles scene items are processed together
+		::detail::ParticlesPackages particlesPackages;
+		::detail::gatherParticlesPackages(particlesEmitters, particlesPackages);
+		::detail::processParticlesDataParallel(defaultThreadPool, particlesPackages.size(), [&particlesEmitters, &particlesPackages, pastSecondsSinceLastFrame](size_t startIndex, size_t endIndex)
+			{
+				for (size_t i = startIndex; i < endIndex; ++i)
+				{
+					const ::detail::ParticlesPackage& particlesPackage = particlesPackages[i];
+					const ::detail::ParticlesEmitter& particlesEmitter = particlesEmitters[particlesPackage.particlesSceneItemIndex];
+					const EmitterProperties& emitterProperties = *particlesEmitter.emitterProperties;
+					const glm::vec3 velocityChange = emitterProperties.acceleration * pastSecondsSinceLastFrame;
+					const float dragFactor = 1.0f / (1.0f + emitterProperties.drag * pastSecondsSinceLastFrame);
+					::detail::simdIntegrateParticles(*particlesEmitter.particlePool, velocityChange, dragFactor, pastSecondsSinceLastFrame, particlesPackage.startIndex, particlesPackage.endIndex);
+				}
+			});
+
+		// Remove dead particles and emit new particles, each particles scene item is processed by a single thread since it has its own random generator
+		::detail::processParticlesDataParallel(defaultThreadPool, particlesEmitters.size(), [&particlesEmitters, pastSecondsSinceLastFrame](size_t startIndex, size_t endIndex)
+			{
+				for (size_t i = startIndex; i < endIndex; ++i)
+				{
+					const ::detail::ParticlesEmitter& particlesEmitter = particlesEmitters[i];
+					::detail::removeDeadAndEmitParticles(*particlesEmitter.particlePool, *particlesEmitter.emitterProperties, particlesEmitter.maximumNumberOfParticles, pastSecondsSinceLastFrame);
+				}
+			});
+
+		// Map the structured buffers, the worker threads don't touch the RHI
+		Rhi::IRhi& rhi = renderer.getRhi();
+		{
+			size_t particlesEmitterIndex = 0;
+			for (uint32_t i = 0; i < numberOfParticlesSceneItems; ++i)
+			{
+				const ParticlesSceneItem* particlesSceneItem = particlesSceneItems[i];
+				if (nullptr != particlesSceneItem->mStructuredBufferPtr)
+				{
+					Rhi::MappedSubresource mappedSubresource;
+					if (particlesSceneItem->mParticlePool->numberOfAliveParticles > 0 && rhi.map(*particlesSceneItem->mStructuredBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+					{
+						particlesEmitters[particlesEmitterIndex].particleDataStructs = static_cast<ParticleDataStruct*>(mappedSubresource.data);
+					}
+					++particlesEmitterIndex;
+				}
+			}
+		}
+
+		// Pack the alive particles into the structured buffers and calculate the bounding boxes
+		::detail::gatherParticlesPackages(particlesEmitters, particlesPackages);
+		::detail::processParticlesDataParallel(defaultThreadPool, particlesPackages.size(), [&particlesEmitters, &particlesPackages](size_t startIndex, size_t endIndex)
+			{
+				for (size_t i = startIndex; i < endIndex; ++i)
+				{
+					::detail::ParticlesPackage& particlesPackage = particlesPackages[i];
+					const ::detail::ParticlesEmitter& particlesEmitter = particlesEmitters[particlesPackage.particlesSceneItemIndex];
+					if (nullptr != particlesEmitter.particleDataStructs)
+					{
+						::detail::packParticles(*particlesEmitter.particlePool, *particlesEmitter.emitterProperties, particlesEmitter.particleDataStructs, particlesPackage);
+					}
+				}
+			});
+
+		// Unmap the structured buffers, update the renderables and feed the bounding boxes into the culling, the emitter box is always part of the bounding box
+		size_t particlesEmitterIndex = 0;
+		size_t particlesPackageIndex = 0;
+		for (uint32_t i = 0; i < numberOfParticlesSceneItems; ++i)
+		{
+			ParticlesSceneItem& particlesSceneItem = *particlesSceneItems[i];
+			if (nullptr != particlesSceneItem.mStructuredBufferPtr)
+			{
+				const ::detail::ParticlesEmitter& particlesEmitter = particlesEmitters[particlesEmitterIndex];
+				glm::vec3 minimumPosition = -particlesSceneItem.mEmitterProperties.halfExtent;
+				glm::vec3 maximumPosition = particlesSceneItem.mEmitterProperties.halfExtent;
+				uint32_t numberOfVertices = 0;
+				if (nullptr != particlesEmitter.particleDataStructs)
+				{
+					rhi.unmap(*particlesSceneItem.mStructuredBufferPtr, 0);
+					numberOfVertices = particlesEmitter.particlePool->numberOfAliveParticles * 6;
+				}
+				for (; particlesPackageIndex < particlesPackages.size() && particlesPackages[particlesPackageIndex].particlesSceneItemIndex == particlesEmitterIndex; ++particlesPackageIndex)
+				{
+					if (nullptr != particlesEmitter.particleDataStructs)
+					{
+						minimumPosition = glm::min(minimumPosition, particlesPackages[particlesPackageIndex].minimumPosition);
+						maximumPosition = glm::max(maximumPosition, particlesPackages[particlesPackageIndex].maximumPosition);
+					}
+				}
+				if (!particlesSceneItem.mRenderableManager.getRenderables().empty())
+				{
+					particlesSceneItem.mRenderableManager.getRenderables()[0].setNumberOfIndices(numberOfVertices);
+				}
+				particlesSceneItem.setSceneItemSetBoundingBox(minimumPosition, maximumPosition);
+				++particlesEmitterIndex;
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void ParticlesSceneItem::setMaximumNumberOfParticles(uint32_t maximumNumberOfParticles)
 	{
 		// Sanity checks
-		RHI_ASSERT(getContext(), Math::QUAT_IDENTITY == mRenderableManager.getTransform().rotation, "No rotation is supported to keep things simple")
-		RHI_ASSERT(getContext(), Math::VEC3_ONE == mRenderableManager.getTransform().scale, "No scale is supported to keep things simple")
+		RHI_ASSERT(getContext(), maximumNumberOfParticles > 0, "The maximum number of particles must be positive")
+		RHI_ASSERT(getContext(), maximumNumberOfParticles <= std::numeric_limits<uint32_t>::max() / 6, "The number of particle vertices must fit into 32 bit")
 
-		// Call the base implementation
-		return MaterialSceneItem::getRenderableManager();
+		// Reallocate the particle pool and the structured buffer
+		if (nullptr != mStructuredBufferPtr && mMaximumNumberOfParticles != maximumNumberOfParticles)
+		{
+			mMaximumNumberOfParticles = maximumNumberOfParticles;
+			mParticlePool->resize(mMaximumNumberOfParticles);
+			createStructuredBuffer();
+
+			// Tell the used material resource about our new structured buffer, if it's already there
+			// -> "Renderer::MaterialTechnique::setStructuredBufferPtr()" drops the cached resource group referencing the old structured buffer
+			if (!mRenderableManager.getRenderables().empty())
+			{
+				setMaterialTechniquesStructuredBuffer();
+			}
+		}
+	}
+
+	uint32_t ParticlesSceneItem::getNumberOfAliveParticles() const
+	{
+		return mParticlePool->numberOfAliveParticles;
+	}
+
+	void ParticlesSceneItem::setEmitterProperties(const EmitterProperties& emitterProperties)
+	{
+		// Sanity checks
+		RHI_ASSERT(getContext(), emitterProperties.emissionRate >= 0.0f, "Invalid particles emission rate")
+		RHI_ASSERT(getContext(), emitterProperties.minimumLifetime > 0.0f, "Invalid minimum particle lifetime")
+		RHI_ASSERT(getContext(), emitterProperties.maximumLifetime >= emitterProperties.minimumLifetime, "Invalid maximum particle lifetime")
+		RHI_ASSERT(getContext(), emitterProperties.drag >= 0.0f, "Invalid particles drag")
+
+		// Set emitter properties, the emitter box is always part of the bounding box
+		mEmitterProperties = emitterProperties;
+		setSceneItemSetBoundingBox(-mEmitterProperties.halfExtent, mEmitterProperties.halfExtent);
 	}
 
 
 	//[-------------------------------------------------------]
-	//[ Protected virtual Renderer::ISceneItem methods        ]
+	//[ Public virtual Renderer::ISceneItem methods           ]
 	//[-------------------------------------------------------]
-	void ParticlesSceneItem::onExecuteOnRendering([[maybe_unused]] const Rhi::IRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
+	const RenderableManager* ParticlesSceneItem::getRenderableManager() const
 	{
-		// TODO(co) Implement me
+		// Sanity checks
+		RHI_ASSERT(getContext(), Math::QUAT_IDENTITY == mRenderableManager.getTransform().rotation, "No rotation is supported to keep things simple")
+		RHI_ASSERT(getContext(), Math::VEC3_ONE == mRenderableManager.getTransform().scale, "No scale is supported to keep things simple")
+
+		// Call the base implementation
+		return MaterialSceneItem::getRenderableManager();
 	}
 
 
@@ -71,80 +558,52 @@ namespace Renderer
 
 	void ParticlesSceneItem::onMaterialResourceCreated()
 	{
-		// Setup renderable manager: Six vertices per particle, particle index = instance index
+		// Setup renderable manager: Six vertices per particle, particle index = vertex index / 6
+		// -> A single non-instanced draw call, so the draw ID stays constant and isn't limited by the size of the draw ID vertex buffer
+		// -> The number of vertices is set to six times the number of alive particles during runtime
 		#ifdef RHI_DEBUG
 			const char* debugName = "Particles";
 			mRenderableManager.setDebugName(debugName);
 		#endif
 		const IRenderer& renderer = getSceneResource().getRenderer();
 		const MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
-		const MaterialResourceId materialResourceId = getMaterialResourceId();
-		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, getInvalid<SkeletonResourceId>(), false, 0, 6, mMaximumNumberOfParticles RHI_RESOURCE_DEBUG_NAME(debugName));
+		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, getMaterialResourceId(), getInvalid<SkeletonResourceId>(), false, 0, 0, 1 RHI_RESOURCE_DEBUG_NAME(debugName));
 		mRenderableManager.updateCachedRenderablesData();
 
 		// Tell the used material resource about our structured buffer
-		for (MaterialTechnique* materialTechnique : materialResourceManager.getById(materialResourceId).getSortedMaterialTechniqueVector())
-		{
-			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
-		}
-
-		// We need "Renderer::ISceneItem::onExecuteOnRendering()" calls during runtime
-		setCallExecuteOnRendering(true);
+		setMaterialTechniquesStructuredBuffer();
 	}
 
 
 	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	ParticlesSceneItem::ParticlesSceneItem(SceneResource& sceneResource) :
-		MaterialSceneItem(sceneResource, false),	// TODO(co) Set bounding box
-		mMaximumNumberOfParticles(8)				// TODO(co) Make this dynamic
+		MaterialSceneItem(sceneResource),
+		mMaximumNumberOfParticles(1024),
+		mParticlePool(new ParticlePool())
 	{
+		// Default emitter properties: A slowly rising and fading fountain
+		mEmitterProperties.emissionRate		= 100.0f;
+		mEmitterProperties.minimumLifetime	= 2.0f;
+		mEmitterProperties.maximumLifetime	= 4.0f;
+		mEmitterProperties.halfExtent		= glm::vec3(0.1f, 0.0f, 0.1f);
+		mEmitterProperties.velocity			= glm::vec3(0.0f, 1.5f, 0.0f);
+		mEmitterProperties.velocityVariance = glm::vec3(0.5f, 0.25f, 0.5f);
+		mEmitterProperties.acceleration		= glm::vec3(0.0f, -0.5f, 0.0f);
+		mEmitterProperties.drag				= 0.1f;
+		mEmitterProperties.startSize		= 0.1f;
+		mEmitterProperties.endSize			= 0.4f;
+		mEmitterProperties.startColor		= glm::vec4(1.0f, 1.0f, 1.0f, 0.6f);
+		mEmitterProperties.endColor			= glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+		setSceneItemSetBoundingBox(-mEmitterProperties.halfExtent, mEmitterProperties.halfExtent);
+
 		// The RHI implementation must support structured buffers
 		const IRenderer& renderer = getSceneResource().getRenderer();
 		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize > 0)
 		{
-			// Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			// TODO(co) Make this dynamic
-			const ParticleDataStruct particlesData[8] =
-			{
-				{
-					{ 4.88f,  1.4f, -1.44f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ -6.2f,  1.4f, -1.44f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ 4.88f,  1.4f,   2.2f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ -6.2f,  1.4f,   2.2f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ -12.0f, 1.39f,  -4.0f, 1.0f },
-					{  1.0f,  0.0f,   0.0f, 1.0f }
-				},
-				{
-					{ 11.2f, 1.39f,  -4.0f, 1.0f },
-					{  0.0f,  1.0f,   0.0f, 1.0f }
-				},
-				{
-					{ -12.0f, 1.39f,   4.5f, 1.0f },
-					{  0.0f,  0.0f,   1.0f, 1.0f }
-				},
-				{
-					{ 11.2f, 1.39f,   4.5f, 1.0f },
-					{  1.0f,  1.0f,   1.0f, 1.0f }
-				}
-			};
-
-			// Create the structured buffer
-			mStructuredBufferPtr = renderer.getBufferManager().createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, particlesData, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
+			mParticlePool->resize(mMaximumNumberOfParticles);
+			createStructuredBuffer();
 		}
 		else
 		{
@@ -153,6 +612,50 @@ namespace Renderer
 		}
 	}
 
+	ParticlesSceneItem::~ParticlesSceneItem()
+	{
+		delete mParticlePool;
+	}
+
+	void ParticlesSceneItem::createStructuredBuffer()
+	{
+		// Create the dynamic structured buffer, it's filled with the alive particles once per frame
+		mStructuredBufferPtr = getSceneResource().getRenderer().getBufferManager().createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
+	}
+
+	void ParticlesSceneItem::setMaterialTechniquesStructuredBuffer()
+	{
+		for (MaterialTechnique* materialTechnique : getSceneResource().getRenderer().getMaterialResourceManager().getById(getMaterialResourceId()).getSortedMaterialTechniqueVector())
+		{
+			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
+		}
+	}
+
+	void ParticlesSceneItem::setSceneItemSetBoundingBox(const glm::vec3& minimumPosition, const glm::vec3& maximumPosition)
+	{
+		if (nullptr != mSceneItemSet)
+		{
+			{ // Set minimum object space bounding box corner position
+				mSceneItemSet->minimumX[mSceneItemSetIndex] = minimumPosition.x;
+				mSceneItemSet->minimumY[mSceneItemSetIndex] = minimumPosition.y;
+				mSceneItemSet->minimumZ[mSceneItemSetIndex] = minimumPosition.z;
+			}
+
+			{ // Set maximum object space bounding box corner position
+				mSceneItemSet->maximumX[mSceneItemSetIndex] = maximumPosition.x;
+				mSceneItemSet->maximumY[mSceneItemSetIndex] = maximumPosition.y;
+				mSceneItemSet->maximumZ[mSceneItemSetIndex] = maximumPosition.z;
+			}
+
+			// Set negative world space radius of bounding sphere
+			// -> The bounding sphere is centered at the scene item origin so "Renderer::SceneNode::updateSceneItemTransform()" can keep placing it at the scene node position
+			mSceneItemSet->negativeRadius[mSceneItemSetIndex] = -std::sqrt(std::max(glm::dot(minimumPosition, minimumPosition), glm::dot(maximumPosition, maximumPosition)));
+
+			// The scene item is no longer considered to be a static shadow caster
+			onSceneItemSetTransformChange();
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
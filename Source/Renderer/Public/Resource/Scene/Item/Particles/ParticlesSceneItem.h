@@ -29,6 +29,26 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/MaterialSceneItem.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(5214)	// warning C5214: applying '*=' to an operand with a volatile qualified type is deprecated in C++20 (compiling source file E:\private\unrimp\Source\RendererToolkit\Private\AssetCompiler\TextureAssetCompiler.cpp)
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IRenderer;
+	struct ParticlePool;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -44,8 +64,21 @@ namespace Renderer
 	*  @brief
 	*    Particles scene item
 	*
-	*  @todo
-	*    - TODO(co) Particles rendering part is implemented, implement GPU based particles simulation as well
+	*  @remarks
+	*    The particles are simulated on the CPU inside a structure-of-arrays particle pool: integration and aging are SIMD kernels,
+	*    emission and the removal of dead particles are cheap scalar passes. "Renderer::SceneResourceManager::update()" simulates
+	*    all particles scene items of all loaded scene resources once per frame via "Renderer::ParticlesSceneItem::updateParticlesSceneItems()",
+	*    the work of all emitters is distributed together over the default thread pool. Particles scene items which are culled
+	*    are simulated as well, so an emitter which comes into view is already in its steady state. The alive particles are packed
+	*    into a dynamic structured buffer and the resulting bounding box is used for culling, the emitter box is always part of
+	*    the bounding box so an emitter without alive particles isn't culled away forever.
+	*
+	*    The particles are drawn by a single non-instanced draw call with six vertices per particle, the particle index is the
+	*    vertex index divided by six. This way the draw ID stays constant and the number of particles isn't limited by the size
+	*    of the draw ID vertex buffer.
+	*
+	*    The particles are simulated in object space relative to the scene item origin, this means the particles follow the
+	*    scene node the particles scene item is attached to.
 	*/
 	class ParticlesSceneItem final : public MaterialSceneItem
 	{
@@ -67,25 +100,89 @@ namespace Renderer
 			float PositionSize[4];	// Object space particle xyz-position, w = particle size
 			float Color[4];			// Linear space RGB particle color and opacity
 		};
+		struct EmitterProperties final
+		{
+			float	  emissionRate;			///< Number of emitted particles per second
+			float	  minimumLifetime;		///< Minimum particle lifetime in seconds, must be positive
+			float	  maximumLifetime;		///< Maximum particle lifetime in seconds, must be equal or greater as the minimum lifetime
+			glm::vec3 halfExtent;			///< Object space half extent of the box the particles are emitted in, centered at the scene item origin
+			glm::vec3 velocity;				///< Initial object space particle velocity in meter per second
+			glm::vec3 velocityVariance;		///< Random per axis variance of the initial particle velocity in meter per second
+			glm::vec3 acceleration;			///< Constant object space acceleration in meter per second squared, e.g. gravity
+			float	  drag;					///< Linear velocity damping per second, 0 = no damping
+			float	  startSize;			///< Particle size when emitted
+			float	  endSize;				///< Particle size at the end of its lifetime
+			glm::vec4 startColor;			///< Linear space RGB particle color and opacity when emitted
+			glm::vec4 endColor;				///< Linear space RGB particle color and opacity at the end of its lifetime
+		};
 
 
 	//[-------------------------------------------------------]
-	//[ Public virtual Renderer::ISceneItem methods           ]
+	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
 	public:
-		[[nodiscard]] inline virtual SceneItemTypeId getSceneItemTypeId() const override
+		/**
+		*  @brief
+		*    Simulate the given particles scene items for one frame
+		*
+		*  @param[in] renderer
+		*    Renderer instance to use
+		*  @param[in] particlesSceneItems
+		*    Particles scene items to simulate, each particles scene item must be listed only once
+		*  @param[in] numberOfParticlesSceneItems
+		*    Number of particles scene items
+		*  @param[in] pastSecondsSinceLastFrame
+		*    Time step to simulate in seconds, clamped to a maximum time step to avoid that particles explode after a hitch
+		*
+		*  @note
+		*    - The particle packages of all given particles scene items are processed together by the default thread pool, many small emitters keep the worker threads as busy as a single huge one
+		*    - Must be called by the thread the RHI resources are used in since the structured buffers are mapped
+		*/
+		RENDERER_API_EXPORT static void updateParticlesSceneItems(const IRenderer& renderer, ParticlesSceneItem* const* particlesSceneItems, uint32_t numberOfParticlesSceneItems, float pastSecondsSinceLastFrame);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline uint32_t getMaximumNumberOfParticles() const
 		{
-			return TYPE_ID;
+			return mMaximumNumberOfParticles;
 		}
 
-		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
+		/**
+		*  @brief
+		*    Set the maximum number of particles
+		*
+		*  @param[in] maximumNumberOfParticles
+		*    Maximum number of particles, must be positive
+		*
+		*  @note
+		*    - Reallocates the particle pool as well as the structured buffer, alive particles exceeding the new maximum are killed
+		*    - Ignored if the RHI implementation has no structured buffer support
+		*/
+		RENDERER_API_EXPORT void setMaximumNumberOfParticles(uint32_t maximumNumberOfParticles);
+
+		[[nodiscard]] RENDERER_API_EXPORT uint32_t getNumberOfAliveParticles() const;
+
+		[[nodiscard]] inline const EmitterProperties& getEmitterProperties() const
+		{
+			return mEmitterProperties;
+		}
+
+		RENDERER_API_EXPORT void setEmitterProperties(const EmitterProperties& emitterProperties);
 
 
 	//[-------------------------------------------------------]
-	//[ Protected virtual Renderer::ISceneItem methods        ]
+	//[ Public virtual Renderer::ISceneItem methods           ]
 	//[-------------------------------------------------------]
-	protected:
-		[[nodiscard]] virtual void onExecuteOnRendering(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) const override;
+	public:
+		[[nodiscard]] inline virtual SceneItemTypeId getSceneItemTypeId() const override
+		{
+			return TYPE_ID;
+		}
+
+		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
 
 
 	//[-------------------------------------------------------]
@@ -102,13 +199,12 @@ namespace Renderer
 	private:
 		explicit ParticlesSceneItem(SceneResource& sceneResource);
 
-		inline virtual ~ParticlesSceneItem() override
-		{
-			// Nothing here
-		}
-
+		virtual ~ParticlesSceneItem() override;
 		explicit ParticlesSceneItem(const ParticlesSceneItem&) = delete;
 		ParticlesSceneItem& operator=(const ParticlesSceneItem&) = delete;
+		void createStructuredBuffer();
+		void setMaterialTechniquesStructuredBuffer();
+		void setSceneItemSetBoundingBox(const glm::vec3& minimumPosition, const glm::vec3& maximumPosition);
 
 
 	//[-------------------------------------------------------]
@@ -116,7 +212,9 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		uint32_t				  mMaximumNumberOfParticles;	///< Maximum number of particles
-		Rhi::IStructuredBufferPtr mStructuredBufferPtr;			///< Structured buffer the data of the individual particles ("Renderer::ParticlesSceneItem::ParticleDataStruct")
+		EmitterProperties		  mEmitterProperties;
+		ParticlePool*			  mParticlePool;				///< Structure-of-arrays particle pool, always valid, destroy the instance if you no longer need it
+		Rhi::IStructuredBufferPtr mStructuredBufferPtr;			///< Dynamic structured buffer the data of the individual alive particles ("Renderer::ParticlesSceneItem::ParticleDataStruct")
 
 
 	};
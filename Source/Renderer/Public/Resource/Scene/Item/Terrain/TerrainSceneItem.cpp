@@ -24,8 +24,23 @@
 #include "Renderer/Public/Resource/Scene/Item/Terrain/TerrainSceneItem.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialResource.h"
+#include "Renderer/Public/Resource/Texture/Loader/Lz4DdsFileFormat.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Public/Asset/AssetManager.h"
+#include "Renderer/Public/Core/File/IFile.h"
+#include "Renderer/Public/Core/File/IFileManager.h"
+#include "Renderer/Public/Core/File/MemoryFile.h"
+#include "Renderer/Public/Core/Math/Frustum.h"
 #include "Renderer/Public/IRenderer.h"
 
+#include <algorithm>
+#include <limits>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -39,27 +54,17 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		static constexpr int VERTICES_PER_TILE_EDGE = 9;	///< Overlap => -2
-		static constexpr int NUMBER_OF_INDICES = (VERTICES_PER_TILE_EDGE - 1) * (VERTICES_PER_TILE_EDGE - 1) * 4;
-
-		/**
-		*  @brief
-		*    These are the size of the neighbours along +/- x or y axes. For interior tiles this is 1. For edge tiles it is 0.5 or 2.0.
-		*/
-		struct Adjacency final
-		{
-			float neighbourMinusX;
-			float neighbourMinusY;
-			float neighbourPlusX;
-			float neighbourPlusY;
-		};
-
-		struct InstanceData final
-		{
-			float	  x, y;
-			float	  tileSize;
-			Adjacency adjacency;
-		};
+		static constexpr int	   VERTICES_PER_TILE_EDGE			= 9;	///< Overlap => -2
+		static constexpr int	   NUMBER_OF_INDICES				= (VERTICES_PER_TILE_EDGE - 1) * (VERTICES_PER_TILE_EDGE - 1) * 4;
+		static constexpr float	   TERRAIN_MESH_WIDTH				= 16.0f;	///< The terrain mesh spans [-8,8] in terrain mesh units, see "ReconstructPosition()" inside the terrain vertex shader
+		static constexpr float	   INNER_MOST_TILE_SIZE				= 0.125f;	///< Size of the tiles of the inner most ring in terrain mesh units, also defines the camera snap grid and the smallest quadtree tile size
+		static constexpr uint32_t  HEIGHT_RANGE_BLOCK_SIZE			= 8;		///< Number of height map texels along each block edge of the finest minimum/maximum height quadtree level
+		static constexpr float	   QUADTREE_LOD_DISTANCE_FACTOR		= 4.0f;		///< A quadtree node is split if the camera is closer than this factor times the node size, must be above sqrt(2) so neighbour leaves differ by at most one level as required by the tile adjacency
+		static constexpr uint32_t  MAXIMUM_NUMBER_OF_QUADTREE_TILES	= 4096;
+		static constexpr uint32_t  WORLD_POSITION_PROPERTY_ID		= STRING_ID("WorldPosition");
+		static constexpr uint32_t  WORLD_SIZE_PROPERTY_ID			= STRING_ID("WorldSize");
+		static constexpr uint32_t  WORLD_ROTATION_PROPERTY_ID		= STRING_ID("WorldRotation");
+		static constexpr uint32_t  HEIGHT_MAP_PROPERTY_ID			= STRING_ID("HeightMap");
 
 
 		//[-------------------------------------------------------]
@@ -96,6 +101,67 @@ namespace
 		};
 
 
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the rotation angle around the y-axis in radians of the given rotation, a height field can't be tilted so pitch and roll are ignored
+		*/
+		[[nodiscard]] float getTerrainYaw(const glm::quat& rotation)
+		{
+			// The rotation around the y-axis by the angle "a" maps the x-axis to (cos(a), 0, -sin(a)) and the z-axis to (sin(a), 0, cos(a))
+			const glm::vec3 xAxis = rotation * Renderer::Math::VEC3_UNIT_X;
+			if (std::abs(xAxis.x) + std::abs(xAxis.z) > 0.0001f)
+			{
+				return std::atan2(-xAxis.z, xAxis.x);
+			}
+			const glm::vec3 zAxis = rotation * Renderer::Math::VEC3_UNIT_Z;
+			return std::atan2(zAxis.x, zAxis.z);
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not an axis aligned bounding box is completely outside a frustum
+		*
+		*  @note
+		*    - Conservative, boxes near frustum corners might be reported as not being outside although they are
+		*/
+		[[nodiscard]] bool isTerrainBoxOutsideFrustum(const Renderer::Frustum& frustum, const glm::vec3& minimum, const glm::vec3& maximum)
+		{
+			for (const Renderer::Plane& plane : frustum.planes)
+			{
+				// Test the box corner which is farthest along the plane normal, plane normals point into the frustum
+				const glm::vec3 positiveVertex((plane.normal.x >= 0.0f) ? maximum.x : minimum.x, (plane.normal.y >= 0.0f) ? maximum.y : minimum.y, (plane.normal.z >= 0.0f) ? maximum.z : minimum.z);
+				if (glm::dot(plane.normal, positiveVertex) + plane.d < 0.0f)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not an axis aligned bounding box is completely inside a frustum
+		*/
+		[[nodiscard]] bool isTerrainBoxInsideFrustum(const Renderer::Frustum& frustum, const glm::vec3& minimum, const glm::vec3& maximum)
+		{
+			for (const Renderer::Plane& plane : frustum.planes)
+			{
+				// Test the box corner which is nearest along the plane normal, plane normals point into the frustum
+				const glm::vec3 negativeVertex((plane.normal.x >= 0.0f) ? minimum.x : maximum.x, (plane.normal.y >= 0.0f) ? minimum.y : maximum.y, (plane.normal.z >= 0.0f) ? minimum.z : maximum.z);
+				if (glm::dot(plane.normal, negativeVertex) + plane.d < 0.0f)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -117,17 +183,12 @@ namespace Renderer
 
 
 	//[-------------------------------------------------------]
-	//[ Public virtual Renderer::ISceneItem methods           ]
+	//[ Protected virtual Renderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
-	const RenderableManager* TerrainSceneItem::getRenderableManager() const
+	void TerrainSceneItem::onExecuteOnRendering(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
 	{
-		// Sanity checks
-		RHI_ASSERT(getContext(), Math::DVEC3_ZERO == mRenderableManager.getTransform().position, "No position is supported to keep things simple")
-		RHI_ASSERT(getContext(), Math::QUAT_IDENTITY == mRenderableManager.getTransform().rotation, "No rotation is supported to keep things simple")
-		RHI_ASSERT(getContext(), Math::VEC3_ONE == mRenderableManager.getTransform().scale, "No scale is supported to keep things simple")
-
-		// Call the base implementation
-		return MaterialSceneItem::getRenderableManager();
+		// The tile culling needs to update the tile instance buffers and the renderable instance counts
+		const_cast<TerrainSceneItem*>(this)->updateTerrainTiles(renderTarget, compositorContextData);
 	}
 
 
@@ -147,18 +208,41 @@ namespace Renderer
 	{
 		// Setup renderable manager: Instancing is used
 		// -> One tiles is one instance and the index buffer describes all the NxN patches within one tile
+		// -> One renderable per terrain tile ring followed by the quadtree renderable, the renderables of the inactive level of detail mode don't draw anything
 		#ifdef RHI_DEBUG
 			mRenderableManager.setDebugName("Terrain tile rings");
 		#endif
 		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
-		renderables.reserve(static_cast<size_t>(mNumberOfTerrainTileRings));
+		renderables.reserve(static_cast<size_t>(mNumberOfTerrainTileRings) + 1);
 		const MaterialResourceManager& materialResourceManager = getSceneResource().getRenderer().getMaterialResourceManager();
 		for (int i = 0; i != mNumberOfTerrainTileRings; ++i)
 		{
 			const TerrainTileRing& terrainTileRing = mTerrainTileRings[i];
 			renderables.emplace_back(mRenderableManager, terrainTileRing.vertexArrayPtr, materialResourceManager, getMaterialResourceId(), getInvalid<SkeletonResourceId>(), true, 0, ::detail::NUMBER_OF_INDICES, terrainTileRing.numberOfTiles RHI_RESOURCE_DEBUG_NAME((std::string("Terrain tile ring ") + std::to_string(i)).c_str()));
 		}
+		if (nullptr != mQuadtreeVertexArrayPtr)
+		{
+			renderables.emplace_back(mRenderableManager, mQuadtreeVertexArrayPtr, materialResourceManager, getMaterialResourceId(), getInvalid<SkeletonResourceId>(), true, 0, ::detail::NUMBER_OF_INDICES, 0 RHI_RESOURCE_DEBUG_NAME("Terrain quadtree"));
+		}
 		mRenderableManager.updateCachedRenderablesData();
+
+		{ // Backup the terrain world transform as defined by the material, the scene node transform is applied on top of it
+			// -> The transformed values are written into the material resource of this scene item, so read the untransformed ones from the scene item material properties and the parent material resource
+			const MaterialResource& materialResource = materialResourceManager.getById(getMaterialResourceId());
+			const MaterialProperty* materialProperty = getBaseMaterialPropertyById(materialResource, ::detail::WORLD_POSITION_PROPERTY_ID);
+			mMaterialWorldPosition = (nullptr != materialProperty) ? glm::vec3(materialProperty->getFloat3Value()[0], materialProperty->getFloat3Value()[1], materialProperty->getFloat3Value()[2]) : Math::VEC3_ZERO;
+			materialProperty = getBaseMaterialPropertyById(materialResource, ::detail::WORLD_SIZE_PROPERTY_ID);
+			mMaterialWorldSize = (nullptr != materialProperty) ? glm::vec3(materialProperty->getFloat3Value()[0], materialProperty->getFloat3Value()[1], materialProperty->getFloat3Value()[2]) : Math::VEC3_ONE;
+			materialProperty = getBaseMaterialPropertyById(materialResource, ::detail::WORLD_ROTATION_PROPERTY_ID);
+			mMaterialWorldRotation = (nullptr != materialProperty) ? glm::quat(materialProperty->getFloat4Value()[3], materialProperty->getFloat4Value()[0], materialProperty->getFloat4Value()[1], materialProperty->getFloat4Value()[2]) : Math::QUAT_IDENTITY;
+
+			// Read the height map into the minimum/maximum height quadtree used for the tile bounding boxes
+			materialProperty = getBaseMaterialPropertyById(materialResource, ::detail::HEIGHT_MAP_PROPERTY_ID);
+			loadHeightRangeLevels((nullptr != materialProperty) ? materialProperty->getTextureAssetIdValue() : getInvalid<AssetId>());
+		}
+
+		// We need "Renderer::ISceneItem::onExecuteOnRendering()" calls during runtime
+		setCallExecuteOnRendering(true);
 	}
 
 
@@ -166,9 +250,18 @@ namespace Renderer
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
 	TerrainSceneItem::TerrainSceneItem(SceneResource& sceneResource) :
-		MaterialSceneItem(sceneResource, false),	///< The GPU will automatically cull terrain patches	TODO(co) Later on there might be multiple smaller terrains which then would make terrain frustum culling useful, we'll take care of this as soon as it's really needed
+		MaterialSceneItem(sceneResource, false),	///< The terrain tiles are culled individually inside "Renderer::TerrainSceneItem::onExecuteOnRendering()", the GPU will automatically cull terrain patches
 		mNumberOfTerrainTileRings(0),
-		mTerrainTileRings{}
+		mTerrainTileRings{},
+		mTileSceneItemSet(new SceneItemSet()),
+		mHeightMapWidth(0),
+		mHeightMapHeight(0),
+		mMaterialWorldPosition(Math::VEC3_ZERO),
+		mMaterialWorldSize(Math::VEC3_ONE),
+		mMaterialWorldRotation(Math::QUAT_IDENTITY),
+		mLodMode(LodMode::TILE_RINGS),
+		mTileCulling(true),
+		mTerrainExtentClipping(false)
 	{
 		// The RHI implementation must support tessellation shaders
 		const IRenderer& renderer = getSceneResource().getRenderer();
@@ -180,12 +273,13 @@ namespace Renderer
 			RHI_ASSERT(getContext(), mNumberOfTerrainTileRings <= MAXIMUM_NUMBER_OF_TERRAIN_TILE_RINGS, "Invalid number of terrain tile rings")
 			Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
 			createIndexBuffer(bufferManager);
-			float tileWidth = 0.125f;
+			float tileWidth = ::detail::INNER_MOST_TILE_SIZE;
 			for (int i = 0; i != mNumberOfTerrainTileRings && i != MAXIMUM_NUMBER_OF_TERRAIN_TILE_RINGS; ++i)
 			{
 				createTerrainTileRing(mTerrainTileRings[i], bufferManager, WIDTHS[i] / 2, WIDTHS[i + 1], tileWidth);
 				tileWidth *= 2.0f;
 			}
+			createQuadtreeVertexArray(bufferManager);
 		}
 		else
 		{
@@ -193,6 +287,11 @@ namespace Renderer
 		}
 	}
 
+	TerrainSceneItem::~TerrainSceneItem()
+	{
+		delete mTileSceneItemSet;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -228,14 +327,16 @@ namespace Renderer
 		// Derive data
 		const int ringWidth = (outerWidth - holeWidth) / 2;	// No remainder - see assert above
 		const int numberOfTiles = terrainTileRing.numberOfTiles = outerWidth * outerWidth - holeWidth * holeWidth;
+		const float halfWidth = 0.5f * static_cast<float>(outerWidth);
+		terrainTileRing.halfWidth = tileSize * halfWidth;
 
 		// Create the vertex buffer object (VBO)
-		Rhi::IVertexBufferPtr vertexBuffer;
 		{
-			// Create the vertex buffer data
+			// Create the vertex buffer data, kept as source for the tile culling
 			int index = 0;
-			::detail::InstanceData* vertexBufferData = new ::detail::InstanceData[static_cast<uint32_t>(numberOfTiles)];
-			const float halfWidth = 0.5f * static_cast<float>(outerWidth);
+			InstanceDataVector& instanceDataVector = terrainTileRing.instanceDataVector;
+			instanceDataVector.resize(static_cast<size_t>(numberOfTiles));
+			InstanceData* vertexBufferData = instanceDataVector.data();
 			for (int y = 0; y < outerWidth; ++y)
 			{
 				for (int x = 0; x < outerWidth; ++x)
@@ -245,13 +346,13 @@ namespace Renderer
 					RHI_ASSERT(getContext(), y >= 0 && y < outerWidth, "Invalid y")
 					if (x < ringWidth || y < ringWidth || x >= outerWidth - ringWidth || y >= outerWidth - ringWidth)
 					{
-						::detail::InstanceData& instanceData = vertexBufferData[index];
+						InstanceData& instanceData = vertexBufferData[index];
 						instanceData.x = tileSize * (static_cast<float>(x) - halfWidth);
 						instanceData.y = tileSize * (static_cast<float>(y) - halfWidth);
 						instanceData.tileSize = tileSize;
 
 						{ // Assign neighbour sizes
-							::detail::Adjacency& adjacency = instanceData.adjacency;
+							Adjacency& adjacency = instanceData.adjacency;
 							adjacency.neighbourPlusX  = 1.0f;
 							adjacency.neighbourPlusY  = 1.0f;
 							adjacency.neighbourMinusX = 1.0f;
@@ -314,18 +415,534 @@ namespace Renderer
 			}
 			RHI_ASSERT(getContext(), index == numberOfTiles, "Invalid index")
 
-			// Create the vertex buffer object (VBO)
-			vertexBuffer = bufferManager.createVertexBuffer(sizeof(::detail::InstanceData) * numberOfTiles, vertexBufferData, 0, Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("Terrain tile ring"));
-
-			// Destroy temporary vertex buffer data
-			delete[] vertexBufferData;
+			// Create the vertex buffer object (VBO), dynamic since it receives the visible tiles
+			terrainTileRing.vertexBufferPtr = bufferManager.createVertexBuffer(static_cast<uint32_t>(sizeof(InstanceData) * instanceDataVector.size()), vertexBufferData, 0, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Terrain tile ring"));
+			terrainTileRing.allTilesUploaded = true;
 		}
 
 		// Create vertex array object (VAO)
-		const Rhi::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { { vertexBuffer } };
+		const Rhi::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { { terrainTileRing.vertexBufferPtr } };
 		terrainTileRing.vertexArrayPtr = bufferManager.createVertexArray(TerrainSceneItem::VERTEX_ATTRIBUTES, static_cast<uint32_t>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, mIndexBufferPtr RHI_RESOURCE_DEBUG_NAME("Terrain tile ring"));
 	}
 
+	void TerrainSceneItem::createQuadtreeVertexArray(Rhi::IBufferManager& bufferManager)
+	{
+		// Sanity check
+		RHI_ASSERT(getContext(), nullptr != mIndexBufferPtr, "The index buffer must be created before this method is called")
+
+		// Create the dynamic vertex buffer object (VBO) receiving the visible quadtree leaf tiles
+		mQuadtreeVertexBufferPtr = bufferManager.createVertexBuffer(static_cast<uint32_t>(sizeof(InstanceData) * ::detail::MAXIMUM_NUMBER_OF_QUADTREE_TILES), nullptr, 0, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Terrain quadtree"));
+
+		// Create vertex array object (VAO)
+		const Rhi::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { { mQuadtreeVertexBufferPtr } };
+		mQuadtreeVertexArrayPtr = bufferManager.createVertexArray(TerrainSceneItem::VERTEX_ATTRIBUTES, static_cast<uint32_t>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, mIndexBufferPtr RHI_RESOURCE_DEBUG_NAME("Terrain quadtree"));
+	}
+
+	const MaterialProperty* TerrainSceneItem::getBaseMaterialPropertyById(const MaterialResource& materialResource, MaterialPropertyId materialPropertyId) const
+	{
+		// Material properties set by the scene item overrule the ones of the parent material resource
+		const MaterialProperty* materialProperty = getMaterialProperties().getPropertyById(materialPropertyId);
+		if (nullptr != materialProperty && materialProperty->isOverwritten())
+		{
+			return materialProperty;
+		}
+		const MaterialResourceId parentMaterialResourceId = materialResource.getParentMaterialResourceId();
+		return isValid(parentMaterialResourceId) ? getSceneResource().getRenderer().getMaterialResourceManager().getById(parentMaterialResourceId).getPropertyById(materialPropertyId) : materialResource.getPropertyById(materialPropertyId);
+	}
+
+	void TerrainSceneItem::loadHeightRangeLevels(AssetId heightMapAssetId)
+	{
+		mHeightRangeLevels.clear();
+		mHeightMapWidth = 0;
+		mHeightMapHeight = 0;
+
+		// The height map texture only lives on the GPU, so read the 16-bit height map once from its LZ4 DDS file
+		// -> Only the top mipmap of the first face is needed, the chunk table allows to skip everything else
+		const IRenderer& renderer = getSceneResource().getRenderer();
+		const Asset* asset = isValid(heightMapAssetId) ? renderer.getAssetManager().tryGetAssetByAssetId(heightMapAssetId) : nullptr;
+		if (nullptr != asset)
+		{
+			std::vector<uint16_t> heightMap;
+			const IFileManager& fileManager = renderer.getFileManager();
+			IFile* file = fileManager.openFile(IFileManager::FileMode::READ, asset->virtualFilename);
+			if (nullptr != file)
+			{
+				v2Lz4Dds::FileFormatHeader fileFormatHeader;
+				file->read(&fileFormatHeader, sizeof(v2Lz4Dds::FileFormatHeader));
+				v2Lz4Dds::Lz4DdsHeader lz4DdsHeader;
+				file->read(&lz4DdsHeader, sizeof(v2Lz4Dds::Lz4DdsHeader));
+				uint32_t ddsHeader[5] = {};	// "DDS "-magic, size, flags, height and width
+				if (v2Lz4Dds::FORMAT_TYPE == fileFormatHeader.formatType && v2Lz4Dds::FORMAT_VERSION == fileFormatHeader.formatVersion && lz4DdsHeader.numberOfDdsHeaderBytes >= sizeof(ddsHeader) && 0 != lz4DdsHeader.numberOfMipmaps && 0 != lz4DdsHeader.numberOfFaces)
+				{
+					file->read(ddsHeader, sizeof(ddsHeader));
+					file->skip(lz4DdsHeader.numberOfDdsHeaderBytes - sizeof(ddsHeader));
+					const uint32_t height = ddsHeader[3];
+					const uint32_t width = ddsHeader[4];
+
+					// Read in the chunk table, the first chunk is the top mipmap of the first face
+					std::vector<v2Lz4Dds::Chunk> chunks(static_cast<size_t>(lz4DdsHeader.numberOfMipmaps) * lz4DdsHeader.numberOfFaces);
+					file->read(chunks.data(), sizeof(v2Lz4Dds::Chunk) * chunks.size());
+					const v2Lz4Dds::Chunk& chunk = chunks[0];
+					if (0 != width && 0 != height && sizeof(uint16_t) * width * height == chunk.numberOfDecompressedBytes)
+					{
+						if (0 != chunk.offset)
+						{
+							file->skip(chunk.offset);
+						}
+						MemoryFile::ByteVector compressedData(chunk.numberOfCompressedBytes);
+						file->read(compressedData.data(), compressedData.size());
+						heightMap.resize(static_cast<size_t>(width) * height);
+						if (MemoryFile::decompressLz4(compressedData.data(), chunk.numberOfCompressedBytes, reinterpret_cast<uint8_t*>(heightMap.data()), chunk.numberOfDecompressedBytes))
+						{
+							mHeightMapWidth = width;
+							mHeightMapHeight = height;
+						}
+						else
+						{
+							heightMap.clear();
+						}
+					}
+				}
+				fileManager.closeFile(*file);
+			}
+
+			// Build the minimum/maximum height quadtree, the finest level is using blocks of "::detail::HEIGHT_RANGE_BLOCK_SIZE" x "::detail::HEIGHT_RANGE_BLOCK_SIZE" texels
+			if (!heightMap.empty())
+			{
+				HeightRangeLevel heightRangeLevel;
+				heightRangeLevel.width = (mHeightMapWidth + ::detail::HEIGHT_RANGE_BLOCK_SIZE - 1) / ::detail::HEIGHT_RANGE_BLOCK_SIZE;
+				heightRangeLevel.height = (mHeightMapHeight + ::detail::HEIGHT_RANGE_BLOCK_SIZE - 1) / ::detail::HEIGHT_RANGE_BLOCK_SIZE;
+				heightRangeLevel.numberOfTexelsPerBlock = ::detail::HEIGHT_RANGE_BLOCK_SIZE;
+				heightRangeLevel.heightRanges.resize(static_cast<size_t>(heightRangeLevel.width) * heightRangeLevel.height, { UINT16_MAX, 0 });
+				for (uint32_t y = 0; y < mHeightMapHeight; ++y)
+				{
+					const uint16_t* heightMapRow = heightMap.data() + static_cast<size_t>(y) * mHeightMapWidth;
+					HeightRange* heightRangeRow = heightRangeLevel.heightRanges.data() + static_cast<size_t>(y / ::detail::HEIGHT_RANGE_BLOCK_SIZE) * heightRangeLevel.width;
+					for (uint32_t x = 0; x < mHeightMapWidth; ++x)
+					{
+						HeightRange& heightRange = heightRangeRow[x / ::detail::HEIGHT_RANGE_BLOCK_SIZE];
+						heightRange.minimum = std::min(heightRange.minimum, heightMapRow[x]);
+						heightRange.maximum = std::max(heightRange.maximum, heightMapRow[x]);
+					}
+				}
+				mHeightRangeLevels.push_back(std::move(heightRangeLevel));
+
+				// Each coarser level halves the resolution until a single block covers the whole height map
+				while (mHeightRangeLevels.back().width > 1 || mHeightRangeLevels.back().height > 1)
+				{
+					const HeightRangeLevel& previousHeightRangeLevel = mHeightRangeLevels.back();
+					heightRangeLevel.width = (previousHeightRangeLevel.width + 1) / 2;
+					heightRangeLevel.height = (previousHeightRangeLevel.height + 1) / 2;
+					heightRangeLevel.numberOfTexelsPerBlock = previousHeightRangeLevel.numberOfTexelsPerBlock * 2;
+					heightRangeLevel.heightRanges.clear();
+					heightRangeLevel.heightRanges.resize(static_cast<size_t>(heightRangeLevel.width) * heightRangeLevel.height, { UINT16_MAX, 0 });
+					for (uint32_t y = 0; y < previousHeightRangeLevel.height; ++y)
+					{
+						for (uint32_t x = 0; x < previousHeightRangeLevel.width; ++x)
+						{
+							const HeightRange& previousHeightRange = previousHeightRangeLevel.heightRanges[static_cast<size_t>(y) * previousHeightRangeLevel.width + x];
+							HeightRange& heightRange = heightRangeLevel.heightRanges[static_cast<size_t>(y / 2) * heightRangeLevel.width + x / 2];
+							heightRange.minimum = std::min(heightRange.minimum, previousHeightRange.minimum);
+							heightRange.maximum = std::max(heightRange.maximum, previousHeightRange.maximum);
+						}
+					}
+					mHeightRangeLevels.push_back(std::move(heightRangeLevel));
+				}
+			}
+		}
+	}
+
+	void TerrainSceneItem::getHeightRange(glm::vec2 uvMinimum, glm::vec2 uvMaximum, float& minimumHeight, float& maximumHeight) const
+	{
+		if (mHeightRangeLevels.empty())
+		{
+			// Conservative full height range
+			minimumHeight = 0.0f;
+			maximumHeight = 1.0f;
+		}
+		else
+		{
+			// Texture coordinates to texels, extended by one texel since bilinear filtering reaches the neighbour texels
+			// -> The height map sampler clamps, so the border texels define the height outside of the height map
+			const glm::vec2 maximumTexel(static_cast<float>(mHeightMapWidth - 1), static_cast<float>(mHeightMapHeight - 1));
+			const glm::vec2 heightMapSize = maximumTexel + 1.0f;
+			const glm::uvec2 texelMinimum(glm::clamp(uvMinimum * heightMapSize - 1.0f, glm::vec2(0.0f), maximumTexel));
+			const glm::uvec2 texelMaximum(glm::clamp(uvMaximum * heightMapSize + 1.0f, glm::vec2(0.0f), maximumTexel));
+
+			// Use the finest level on which the texels are covered by at most two blocks along each axis
+			const uint32_t numberOfTexels = std::max(texelMaximum.x - texelMinimum.x, texelMaximum.y - texelMinimum.y) + 1;
+			size_t levelIndex = 0;
+			while (levelIndex + 1 < mHeightRangeLevels.size() && mHeightRangeLevels[levelIndex].numberOfTexelsPerBlock < numberOfTexels)
+			{
+				++levelIndex;
+			}
+			const HeightRangeLevel& heightRangeLevel = mHeightRangeLevels[levelIndex];
+			const uint32_t numberOfTexelsPerBlock = heightRangeLevel.numberOfTexelsPerBlock;
+			const uint32_t blockMaximumX = std::min(texelMaximum.x / numberOfTexelsPerBlock, heightRangeLevel.width - 1);
+			const uint32_t blockMaximumY = std::min(texelMaximum.y / numberOfTexelsPerBlock, heightRangeLevel.height - 1);
+			uint16_t minimum = UINT16_MAX;
+			uint16_t maximum = 0;
+			for (uint32_t y = texelMinimum.y / numberOfTexelsPerBlock; y <= blockMaximumY; ++y)
+			{
+				for (uint32_t x = texelMinimum.x / numberOfTexelsPerBlock; x <= blockMaximumX; ++x)
+				{
+					const HeightRange& heightRange = heightRangeLevel.heightRanges[static_cast<size_t>(y) * heightRangeLevel.width + x];
+					minimum = std::min(minimum, heightRange.minimum);
+					maximum = std::max(maximum, heightRange.maximum);
+				}
+			}
+			minimumHeight = static_cast<float>(minimum) / static_cast<float>(UINT16_MAX);
+			maximumHeight = static_cast<float>(maximum) / static_cast<float>(UINT16_MAX);
+		}
+	}
+
+	TerrainSceneItem::ExtentIntersection TerrainSceneItem::getTileBoundingBox(const ViewData& viewData, float x, float y, float tileSize, glm::vec3& minimum, glm::vec3& maximum) const
+	{
+		// Camera relative world space rectangle on the xz-plane, terrain mesh units to world space is identical to "ReconstructPosition()" inside the terrain vertex shader
+		const glm::vec2 rectangleMinimum = viewData.cameraRelativeOrigin + glm::vec2(x, y) * viewData.terrainMeshUnitToWorld;
+		const glm::vec2 rectangleHalfSize = (0.5f * tileSize) * viewData.terrainMeshUnitToWorld;
+		const glm::vec2 offset = rectangleMinimum + rectangleHalfSize - viewData.extentCenter;
+
+		// Project the rectangle onto the terrain local x- and z-axes, which are (cos, -sin) and (sin, cos) on the xz-plane
+		const glm::vec2& yawCosSin = viewData.yawCosSin;
+		const glm::vec2 absoluteYawCosSin = glm::abs(yawCosSin);
+		const glm::vec2 localOffset(offset.x * yawCosSin.x - offset.y * yawCosSin.y, offset.x * yawCosSin.y + offset.y * yawCosSin.x);
+		const glm::vec2 localHalfSize(rectangleHalfSize.x * absoluteYawCosSin.x + rectangleHalfSize.y * absoluteYawCosSin.y, rectangleHalfSize.x * absoluteYawCosSin.y + rectangleHalfSize.y * absoluteYawCosSin.x);
+
+		// Separating axis test against the rotated terrain extent: World axes first, terrain local axes second
+		ExtentIntersection extentIntersection = ExtentIntersection::INSIDE;
+		if (viewData.extentClipping)
+		{
+			const glm::vec2 extentHalfSize = 0.5f * viewData.extentSize;
+			const glm::vec2 extentWorldHalfSize(extentHalfSize.x * absoluteYawCosSin.x + extentHalfSize.y * absoluteYawCosSin.y, extentHalfSize.x * absoluteYawCosSin.y + extentHalfSize.y * absoluteYawCosSin.x);
+			if (std::abs(offset.x) > rectangleHalfSize.x + extentWorldHalfSize.x || std::abs(offset.y) > rectangleHalfSize.y + extentWorldHalfSize.y ||
+				std::abs(localOffset.x) > localHalfSize.x + extentHalfSize.x || std::abs(localOffset.y) > localHalfSize.y + extentHalfSize.y)
+			{
+				return ExtentIntersection::OUTSIDE;
+			}
+			if (std::abs(localOffset.x) + localHalfSize.x > extentHalfSize.x || std::abs(localOffset.y) + localHalfSize.y > extentHalfSize.y)
+			{
+				extentIntersection = ExtentIntersection::INTERSECTING;
+			}
+		}
+
+		// Use the height range of the covered height map area, terrain local space to height map texture coordinates is identical to "WorldXZToHeightUV()" inside the terrain shaders
+		float minimumHeight = 0.0f;
+		float maximumHeight = 1.0f;
+		getHeightRange((localOffset - localHalfSize) / viewData.extentSize + 0.5f, (localOffset + localHalfSize) / viewData.extentSize + 0.5f, minimumHeight, maximumHeight);
+		minimum = glm::vec3(rectangleMinimum.x, viewData.minimumY + minimumHeight * viewData.heightSize, rectangleMinimum.y);
+		maximum = glm::vec3(rectangleMinimum.x + 2.0f * rectangleHalfSize.x, viewData.minimumY + maximumHeight * viewData.heightSize, rectangleMinimum.y + 2.0f * rectangleHalfSize.y);
+
+		// Done
+		return extentIntersection;
+	}
+
+	void TerrainSceneItem::updateTerrainTiles(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData)
+	{
+		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		if (nullptr != cameraSceneItem && !renderables.empty())
+		{
+			const IRenderer& renderer = getSceneResource().getRenderer();
+
+			// Apply the scene node transform: The position is added to the terrain world position, the scale is applied to the terrain world size and the rotation around the y-axis to the terrain world rotation
+			const Transform& transform = mRenderableManager.getTransform();
+			const glm::vec3 worldPosition = mMaterialWorldPosition + glm::vec3(transform.position);
+			const glm::vec3 worldSize = mMaterialWorldSize * transform.scale;
+			const float yaw = ::detail::getTerrainYaw(transform.rotation * mMaterialWorldRotation);
+			const glm::quat worldRotation = glm::angleAxis(yaw, Math::VEC3_UNIT_Y);
+			{
+				// Unchanged material property values are detected and ignored by the material resource
+				MaterialResource& materialResource = renderer.getMaterialResourceManager().getById(getMaterialResourceId());
+				if (nullptr != materialResource.getPropertyById(::detail::WORLD_POSITION_PROPERTY_ID))
+				{
+					materialResource.setPropertyById(::detail::WORLD_POSITION_PROPERTY_ID, MaterialPropertyValue::fromFloat3(worldPosition.x, worldPosition.y, worldPosition.z));
+				}
+				if (nullptr != materialResource.getPropertyById(::detail::WORLD_SIZE_PROPERTY_ID))
+				{
+					materialResource.setPropertyById(::detail::WORLD_SIZE_PROPERTY_ID, MaterialPropertyValue::fromFloat3(worldSize.x, worldSize.y, worldSize.z));
+				}
+				if (nullptr != materialResource.getPropertyById(::detail::WORLD_ROTATION_PROPERTY_ID))
+				{
+					materialResource.setPropertyById(::detail::WORLD_ROTATION_PROPERTY_ID, MaterialPropertyValue::fromFloat4(worldRotation.x, worldRotation.y, worldRotation.z, worldRotation.w));
+				}
+			}
+
+			// Tile culling is disabled for single pass stereo rendering, "Renderer::SceneCullingManager" doesn't cull in this case either
+			const bool tileCulling = (mTileCulling && !compositorContextData.getSinglePassStereoInstancing());
+
+			// Calculate the frustum using a camera relative world space to clip space matrix
+			uint32_t renderTargetWidth = 1;
+			uint32_t renderTargetHeight = 1;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			const Frustum frustum(cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight)) * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+
+			// Gather the view data, the terrain mesh origin is the camera position snapped to the grid of the inner most tiles identical to "ReconstructPosition()" inside the terrain vertex shader
+			const glm::dvec3& worldSpaceCameraPosition = compositorContextData.getWorldSpaceCameraPosition();
+			const glm::vec3 unmodifiedWorldSpaceCameraPosition = worldSpaceCameraPosition;
+			const glm::vec3 snapGridSize = worldSize * (::detail::INNER_MOST_TILE_SIZE / static_cast<float>(::detail::VERTICES_PER_TILE_EDGE - 1));
+			const glm::dvec2 snapPosition(std::floor(unmodifiedWorldSpaceCameraPosition.x / snapGridSize.x) * snapGridSize.x, std::floor(unmodifiedWorldSpaceCameraPosition.z / snapGridSize.z) * snapGridSize.z);
+			ViewData viewData;
+			viewData.cameraRelativeOrigin = glm::vec2(static_cast<float>(snapPosition.x - worldSpaceCameraPosition.x), static_cast<float>(snapPosition.y - worldSpaceCameraPosition.z));
+			viewData.terrainMeshUnitToWorld = glm::vec2(worldSize.x / ::detail::TERRAIN_MESH_WIDTH, worldSize.z / ::detail::TERRAIN_MESH_WIDTH);
+			viewData.extentCenter = glm::vec2(static_cast<float>(static_cast<double>(worldPosition.x) - worldSpaceCameraPosition.x), static_cast<float>(static_cast<double>(worldPosition.z) - worldSpaceCameraPosition.z));
+			viewData.extentSize = glm::vec2(worldSize.x, worldSize.z);
+			viewData.yawCosSin = glm::vec2(std::cos(yaw), std::sin(yaw));
+			viewData.minimumY = static_cast<float>(static_cast<double>(worldPosition.y) - worldSpaceCameraPosition.y);
+			viewData.heightSize = worldSize.y;
+			viewData.frustum = tileCulling ? &frustum : nullptr;
+			viewData.extentClipping = (mTerrainExtentClipping || LodMode::QUADTREE == mLodMode);
+			{ // The quadtree root node is the square in terrain mesh units enclosing the rotated terrain extent
+				const glm::vec2 absoluteYawCosSin = glm::abs(viewData.yawCosSin);
+				const glm::vec2 extentHalfSize = 0.5f * viewData.extentSize;
+				const glm::vec2 rootHalfSize = glm::vec2(extentHalfSize.x * absoluteYawCosSin.x + extentHalfSize.y * absoluteYawCosSin.y, extentHalfSize.x * absoluteYawCosSin.y + extentHalfSize.y * absoluteYawCosSin.x) / viewData.terrainMeshUnitToWorld;
+				viewData.quadtreeRootSize = 2.0f * std::max(rootHalfSize.x, rootHalfSize.y);
+				viewData.quadtreeRootPosition = (viewData.extentCenter - viewData.cameraRelativeOrigin) / viewData.terrainMeshUnitToWorld - 0.5f * viewData.quadtreeRootSize;
+			}
+
+			// Cull the tiles of the active level of detail mode, the renderables of the other mode don't draw anything
+			if (LodMode::QUADTREE == mLodMode && nullptr != mQuadtreeVertexBufferPtr)
+			{
+				for (int i = 0; i != mNumberOfTerrainTileRings; ++i)
+				{
+					renderables[static_cast<size_t>(i)].setInstanceCount(0);
+				}
+				cullTerrainQuadtree(viewData);
+			}
+			else
+			{
+				if (renderables.size() > static_cast<size_t>(mNumberOfTerrainTileRings))
+				{
+					renderables.back().setInstanceCount(0);
+				}
+				cullTerrainTileRings(viewData);
+			}
+		}
+	}
+
+	void TerrainSceneItem::cullTiles(const ViewData& viewData, const InstanceData* instanceData, uint32_t numberOfTiles)
+	{
+		// Gather the bounding spheres enclosing the tile bounding boxes, tiles outside the terrain extent get a bounding sphere which is never inside the frustum
+		SceneItemSet& sceneItemSet = *mTileSceneItemSet;
+		sceneItemSet.numberOfSceneItems = numberOfTiles;
+		if (sceneItemSet.spherePositionX.size() < numberOfTiles)
+		{
+			sceneItemSet.spherePositionX.resize(numberOfTiles);
+			sceneItemSet.spherePositionY.resize(numberOfTiles);
+			sceneItemSet.spherePositionZ.resize(numberOfTiles);
+			sceneItemSet.negativeRadius.resize(numberOfTiles);
+		}
+		for (uint32_t i = 0; i < numberOfTiles; ++i)
+		{
+			glm::vec3 minimum;
+			glm::vec3 maximum;
+			if (ExtentIntersection::OUTSIDE == getTileBoundingBox(viewData, instanceData[i].x, instanceData[i].y, instanceData[i].tileSize, minimum, maximum))
+			{
+				sceneItemSet.spherePositionX[i] = 0.0f;
+				sceneItemSet.spherePositionY[i] = 0.0f;
+				sceneItemSet.spherePositionZ[i] = 0.0f;
+				sceneItemSet.negativeRadius[i] = std::numeric_limits<float>::max();
+			}
+			else
+			{
+				const glm::vec3 center = (minimum + maximum) * 0.5f;
+				sceneItemSet.spherePositionX[i] = center.x;
+				sceneItemSet.spherePositionY[i] = center.y;
+				sceneItemSet.spherePositionZ[i] = center.z;
+				sceneItemSet.negativeRadius[i] = -glm::distance(center, maximum);
+			}
+		}
+
+		// SIMD frustum-sphere culling, without frustum only the terrain extent counts
+		if (nullptr != viewData.frustum)
+		{
+			SceneCullingManager::cullSceneItemSetSpheres(*viewData.frustum, sceneItemSet);
+		}
+		else
+		{
+			sceneItemSet.visibilityFlag.resize(std::max(sceneItemSet.visibilityFlag.size(), static_cast<size_t>(numberOfTiles)));
+			for (uint32_t i = 0; i < numberOfTiles; ++i)
+			{
+				sceneItemSet.visibilityFlag[i] = (sceneItemSet.negativeRadius[i] < std::numeric_limits<float>::max()) ? 0xffffffff : 0;
+			}
+		}
+	}
+
+	void TerrainSceneItem::cullTerrainTileRings(const ViewData& viewData)
+	{
+		// Cull the tiles ring by ring: Rings completely outside or inside the frustum don't need to look at the individual tiles
+		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
+		Rhi::IRhi& rhi = getSceneResource().getRenderer().getRhi();
+		for (int i = 0; i != mNumberOfTerrainTileRings; ++i)
+		{
+			TerrainTileRing& terrainTileRing = mTerrainTileRings[i];
+			Renderable& renderable = renderables[static_cast<size_t>(i)];
+			glm::vec3 ringMinimum;
+			glm::vec3 ringMaximum;
+			const ExtentIntersection ringExtentIntersection = getTileBoundingBox(viewData, -terrainTileRing.halfWidth, -terrainTileRing.halfWidth, 2.0f * terrainTileRing.halfWidth, ringMinimum, ringMaximum);
+			if (ExtentIntersection::OUTSIDE == ringExtentIntersection || (nullptr != viewData.frustum && ::detail::isTerrainBoxOutsideFrustum(*viewData.frustum, ringMinimum, ringMaximum)))
+			{
+				// The vertex buffer content doesn't matter if nothing is drawn
+				renderable.setInstanceCount(0);
+			}
+			else if (ExtentIntersection::INSIDE == ringExtentIntersection && (nullptr == viewData.frustum || ::detail::isTerrainBoxInsideFrustum(*viewData.frustum, ringMinimum, ringMaximum)))
+			{
+				// All tiles are visible, only upload them in case the vertex buffer content has been compacted before
+				if (!terrainTileRing.allTilesUploaded)
+				{
+					Rhi::MappedSubresource mappedSubresource;
+					if (rhi.map(*terrainTileRing.vertexBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+					{
+						memcpy(mappedSubresource.data, terrainTileRing.instanceDataVector.data(), sizeof(InstanceData) * terrainTileRing.instanceDataVector.size());
+						rhi.unmap(*terrainTileRing.vertexBufferPtr, 0);
+						terrainTileRing.allTilesUploaded = true;
+					}
+				}
+				renderable.setInstanceCount(terrainTileRing.allTilesUploaded ? static_cast<uint32_t>(terrainTileRing.numberOfTiles) : 0);
+			}
+			else
+			{
+				// Compact the visible tiles into the vertex buffer
+				Rhi::MappedSubresource mappedSubresource;
+				if (rhi.map(*terrainTileRing.vertexBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					const uint32_t numberOfTiles = static_cast<uint32_t>(terrainTileRing.instanceDataVector.size());
+					cullTiles(viewData, terrainTileRing.instanceDataVector.data(), numberOfTiles);
+					const uint32_t* visibilityFlag = mTileSceneItemSet->visibilityFlag.data();
+					InstanceData* visibleInstanceData = static_cast<InstanceData*>(mappedSubresource.data);
+					uint32_t numberOfVisibleTiles = 0;
+					for (uint32_t tileIndex = 0; tileIndex < numberOfTiles; ++tileIndex)
+					{
+						if (0 != visibilityFlag[tileIndex])
+						{
+							visibleInstanceData[numberOfVisibleTiles] = terrainTileRing.instanceDataVector[tileIndex];
+							++numberOfVisibleTiles;
+						}
+					}
+					rhi.unmap(*terrainTileRing.vertexBufferPtr, 0);
+					terrainTileRing.allTilesUploaded = (static_cast<int>(numberOfVisibleTiles) == terrainTileRing.numberOfTiles);
+					renderable.setInstanceCount(numberOfVisibleTiles);
+				}
+			}
+		}
+	}
+
+	void TerrainSceneItem::cullTerrainQuadtree(const ViewData& viewData)
+	{
+		// Traverse the quadtree level by level and compact the visible leaf tiles into the vertex buffer, all nodes of a level are culled at once using SIMD
+		Rhi::IRhi& rhi = getSceneResource().getRenderer().getRhi();
+		Rhi::MappedSubresource mappedSubresource;
+		if (rhi.map(*mQuadtreeVertexBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+		{
+			InstanceData* instanceData = static_cast<InstanceData*>(mappedSubresource.data);
+			uint32_t numberOfTiles = 0;
+			mQuadtreeNodes.clear();
+			mQuadtreeNodes.push_back({ viewData.quadtreeRootPosition.x, viewData.quadtreeRootPosition.y, viewData.quadtreeRootSize, { 1.0f, 1.0f, 1.0f, 1.0f } });
+			while (!mQuadtreeNodes.empty())
+			{
+				// Culled nodes are dropped including their children, visible nodes are either split into the next level or added as leaf tile
+				const uint32_t numberOfNodes = static_cast<uint32_t>(mQuadtreeNodes.size());
+				cullTiles(viewData, mQuadtreeNodes.data(), numberOfNodes);
+				const uint32_t* visibilityFlag = mTileSceneItemSet->visibilityFlag.data();
+				mNextQuadtreeNodes.clear();
+				for (uint32_t nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex)
+				{
+					if (0 != visibilityFlag[nodeIndex])
+					{
+						const InstanceData& node = mQuadtreeNodes[nodeIndex];
+						if (isQuadtreeNodeSplit(viewData, node.x, node.y, node.tileSize))
+						{
+							const float halfSize = node.tileSize * 0.5f;
+							mNextQuadtreeNodes.push_back({ node.x, node.y, halfSize, node.adjacency });
+							mNextQuadtreeNodes.push_back({ node.x + halfSize, node.y, halfSize, node.adjacency });
+							mNextQuadtreeNodes.push_back({ node.x, node.y + halfSize, halfSize, node.adjacency });
+							mNextQuadtreeNodes.push_back({ node.x + halfSize, node.y + halfSize, halfSize, node.adjacency });
+						}
+						else
+						{
+							addQuadtreeLeaf(viewData, node.x, node.y, node.tileSize, instanceData, numberOfTiles);
+						}
+					}
+				}
+				std::swap(mQuadtreeNodes, mNextQuadtreeNodes);
+			}
+			rhi.unmap(*mQuadtreeVertexBufferPtr, 0);
+			mRenderableManager.getRenderables().back().setInstanceCount(numberOfTiles);
+		}
+	}
+
+	bool TerrainSceneItem::isQuadtreeNodeSplit(const ViewData& viewData, float x, float y, float size) const
+	{
+		// Nodes aren't split below the tile size of the inner most terrain tile ring
+		if (size * 0.5f < ::detail::INNER_MOST_TILE_SIZE)
+		{
+			return false;
+		}
+
+		// Split the node if the camera is near, the full terrain height range keeps the decision independent of the culling so neighbour leaves can be found by repeating it
+		const glm::vec2 minimum = viewData.cameraRelativeOrigin + glm::vec2(x, y) * viewData.terrainMeshUnitToWorld;
+		const glm::vec2 maximum = minimum + size * viewData.terrainMeshUnitToWorld;
+		const glm::vec3 distance(std::max(std::max(minimum.x, -maximum.x), 0.0f), std::max(std::max(viewData.minimumY, -viewData.minimumY - viewData.heightSize), 0.0f), std::max(std::max(minimum.y, -maximum.y), 0.0f));
+		const float splitDistance = ::detail::QUADTREE_LOD_DISTANCE_FACTOR * size * std::max(viewData.terrainMeshUnitToWorld.x, viewData.terrainMeshUnitToWorld.y);
+		return (glm::dot(distance, distance) < splitDistance * splitDistance);
+	}
+
+	float TerrainSceneItem::getQuadtreeLeafSize(const ViewData& viewData, float x, float y) const
+	{
+		// There's no leaf outside of the quadtree
+		float nodeX = viewData.quadtreeRootPosition.x;
+		float nodeY = viewData.quadtreeRootPosition.y;
+		float size = viewData.quadtreeRootSize;
+		if (x < nodeX || y < nodeY || x >= nodeX + size || y >= nodeY + size)
+		{
+			return 0.0f;
+		}
+
+		// Descend into the child node containing the given position until a leaf is reached
+		while (isQuadtreeNodeSplit(viewData, nodeX, nodeY, size))
+		{
+			size *= 0.5f;
+			if (x >= nodeX + size)
+			{
+				nodeX += size;
+			}
+			if (y >= nodeY + size)
+			{
+				nodeY += size;
+			}
+		}
+		return size;
+	}
+
+	void TerrainSceneItem::addQuadtreeLeaf(const ViewData& viewData, float x, float y, float size, InstanceData* instanceData, uint32_t& numberOfTiles) const
+	{
+		RHI_ASSERT(getContext(), numberOfTiles < ::detail::MAXIMUM_NUMBER_OF_QUADTREE_TILES, "Maximum number of terrain quadtree tiles reached")
+		if (numberOfTiles < ::detail::MAXIMUM_NUMBER_OF_QUADTREE_TILES)
+		{
+			// The adjacency is the size of the neighbour leaves relative to this tile, neighbour leaves differ by at most one level
+			const float halfSize = size * 0.5f;
+			const float epsilon = ::detail::INNER_MOST_TILE_SIZE * 0.5f;
+			const auto getAdjacency = [this, &viewData, size](float neighbourX, float neighbourY)
+			{
+				const float neighbourSize = getQuadtreeLeafSize(viewData, neighbourX, neighbourY);
+				return (neighbourSize > 0.0f) ? glm::clamp(neighbourSize / size, 0.5f, 2.0f) : 1.0f;
+			};
+			const InstanceData leafInstanceData =
+			{
+				x, y,
+				size,
+				{
+					getAdjacency(x - epsilon, y + halfSize),	// neighbourMinusX
+					getAdjacency(x + halfSize, y - epsilon),	// neighbourMinusY
+					getAdjacency(x + size + epsilon, y + halfSize),	// neighbourPlusX
+					getAdjacency(x + halfSize, y + size + epsilon)	// neighbourPlusY
+				}
+			};
+			instanceData[numberOfTiles] = leafInstanceData;
+			++numberOfTiles;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
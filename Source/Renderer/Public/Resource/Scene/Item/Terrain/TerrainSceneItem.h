@@ -29,6 +29,14 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/MaterialSceneItem.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -37,6 +45,14 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class Frustum;
+	class MaterialResource;
+	struct SceneItemSet;
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -62,6 +78,16 @@ namespace Renderer
 	*    ###             ###
 	*    ###################
 	*    ###################
+	*
+	*    The tile rings follow the camera. Alternatively, a quadtree level of detail mode subdivides the terrain extent depending on the
+	*    camera distance. Per view, the tiles are culled on the CPU against the camera frustum, the visible tiles are compacted into the
+	*    dynamic tile instance buffers and the renderable instance counts are adjusted. The tile bounding boxes are using the height range
+	*    of the covered height map area, which is read once from the height map asset into a minimum/maximum height quadtree.
+	*
+	*    The position of the scene node is added to the material property "WorldPosition", the scale of the scene node is applied to the
+	*    material property "WorldSize" and the rotation of the scene node around the y-axis is written into the material property
+	*    "WorldRotation". A height field can't be tilted, so pitch and roll of the scene node are ignored. By clipping the tiles to the
+	*    terrain extent, multiple terrains can be placed side by side.
 	*/
 	class TerrainSceneItem final : public MaterialSceneItem
 	{
@@ -80,6 +106,61 @@ namespace Renderer
 		static constexpr uint32_t TYPE_ID = STRING_ID("TerrainSceneItem");
 		RENDERER_API_EXPORT static const Rhi::VertexAttributes VERTEX_ATTRIBUTES;
 
+		/**
+		*  @brief
+		*    Level of detail mode
+		*/
+		enum class LodMode : uint8_t
+		{
+			TILE_RINGS,	///< Concentric tile rings following the camera, the tile size doubles from ring to ring
+			QUADTREE	///< Quadtree covering the terrain extent, nodes are split depending on the camera distance
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline LodMode getLodMode() const
+		{
+			return mLodMode;
+		}
+
+		inline void setLodMode(LodMode lodMode)
+		{
+			mLodMode = lodMode;
+		}
+
+		[[nodiscard]] inline bool getTileCulling() const
+		{
+			return mTileCulling;
+		}
+
+		inline void setTileCulling(bool tileCulling)
+		{
+			mTileCulling = tileCulling;
+		}
+
+		[[nodiscard]] inline bool getTerrainExtentClipping() const
+		{
+			return mTerrainExtentClipping;
+		}
+
+		/**
+		*  @brief
+		*    Set whether or not tiles outside the terrain extent are culled
+		*
+		*  @param[in] terrainExtentClipping
+		*    "true" to cull tiles outside the terrain extent defined by the material properties "WorldPosition", "WorldSize" and "WorldRotation", "false" to continue the terrain border up to the outer most tile ring
+		*
+		*  @note
+		*    - The quadtree level of detail mode always clips to the terrain extent
+		*/
+		inline void setTerrainExtentClipping(bool terrainExtentClipping)
+		{
+			mTerrainExtentClipping = terrainExtentClipping;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ISceneItem methods           ]
@@ -90,7 +171,12 @@ namespace Renderer
 			return TYPE_ID;
 		}
 
-		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::ISceneItem methods        ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual void onExecuteOnRendering(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) const override;
 
 
 	//[-------------------------------------------------------]
@@ -106,10 +192,84 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		static constexpr int MAXIMUM_NUMBER_OF_TERRAIN_TILE_RINGS = 6;
+
+		/**
+		*  @brief
+		*    These are the size of the neighbours along +/- x or y axes. For interior tiles this is 1. For edge tiles it is 0.5 or 2.0.
+		*/
+		struct Adjacency final
+		{
+			float neighbourMinusX;
+			float neighbourMinusY;
+			float neighbourPlusX;
+			float neighbourPlusY;
+		};
+
+		struct InstanceData final
+		{
+			float	  x, y;
+			float	  tileSize;
+			Adjacency adjacency;
+		};
+		typedef std::vector<InstanceData> InstanceDataVector;
+
+		/**
+		*  @brief
+		*    Height map minimum and maximum inside a block of texels, normalized 16-bit unsigned integer as stored inside the height map
+		*/
+		struct HeightRange final
+		{
+			uint16_t minimum;
+			uint16_t maximum;
+		};
+
+		/**
+		*  @brief
+		*    Height quadtree level, each level halves the resolution of the previous one until a single block covers the whole height map
+		*/
+		struct HeightRangeLevel final
+		{
+			uint32_t				 width;						///< Number of blocks along the x-axis
+			uint32_t				 height;					///< Number of blocks along the y-axis
+			uint32_t				 numberOfTexelsPerBlock;	///< Number of height map texels along each block edge
+			std::vector<HeightRange> heightRanges;				///< "width" * "height" height ranges
+		};
+		typedef std::vector<HeightRangeLevel> HeightRangeLevels;
+
+		enum class ExtentIntersection : uint8_t
+		{
+			OUTSIDE,
+			INSIDE,
+			INTERSECTING
+		};
+
+		/**
+		*  @brief
+		*    Per view data required to cull terrain tiles, all positions are relative to the camera
+		*/
+		struct ViewData final
+		{
+			glm::vec2	   cameraRelativeOrigin;	///< Camera relative world space xz position of the terrain mesh origin, which is the camera position snapped to the grid of the inner most tiles
+			glm::vec2	   terrainMeshUnitToWorld;	///< Terrain mesh units to world space units along the x- and z-axes
+			glm::vec2	   extentCenter;			///< Camera relative world space xz position of the terrain center
+			glm::vec2	   extentSize;				///< World space terrain size along the terrain local x- and z-axes
+			glm::vec2	   yawCosSin;				///< Cosine and sine of the terrain rotation around the y-axis
+			float		   minimumY;				///< Camera relative world space minimum terrain height
+			float		   heightSize;				///< World space terrain height range
+			const Frustum* frustum;					///< Camera relative frustum, can be a null pointer if tile culling is disabled, don't destroy the instance
+			bool		   extentClipping;			///< Cull tiles outside the terrain extent?
+			glm::vec2	   quadtreeRootPosition;	///< Quadtree root node minimum in terrain mesh units
+			float		   quadtreeRootSize;		///< Quadtree root node size in terrain mesh units
+		};
+
 		struct TerrainTileRing final
 		{
-			int					 numberOfTiles;
-			Rhi::IVertexArrayPtr vertexArrayPtr;	///< Vertex array object (VAO), considered to be always valid
+			int					  numberOfTiles;
+			float				  halfWidth;				///< Half width of the ring in terrain mesh units, the ring is centered at the origin
+			InstanceDataVector	  instanceDataVector;		///< All "numberOfTiles" tiles of the ring, source for the tile culling
+			bool				  allTilesUploaded;			///< "true" if the vertex buffer currently contains all tiles in their original order, else "false"
+			Rhi::IVertexBufferPtr vertexBufferPtr;			///< Dynamic vertex buffer object (VBO) receiving the visible tiles, considered to be always valid
+			Rhi::IVertexArrayPtr  vertexArrayPtr;			///< Vertex array object (VAO), considered to be always valid
 		};
 
 
@@ -119,24 +279,47 @@ namespace Renderer
 	private:
 		explicit TerrainSceneItem(SceneResource& sceneResource);
 
-		inline virtual ~TerrainSceneItem() override
-		{
-			// Nothing here
-		}
+		virtual ~TerrainSceneItem() override;
 
 		explicit TerrainSceneItem(const TerrainSceneItem&) = delete;
 		TerrainSceneItem& operator=(const TerrainSceneItem&) = delete;
 		void createIndexBuffer(Rhi::IBufferManager& bufferManager);
 		void createTerrainTileRing(TerrainTileRing& terrainTileRing, Rhi::IBufferManager& bufferManager, int holeWidth, int outerWidth, float tileSize) const;
+		void createQuadtreeVertexArray(Rhi::IBufferManager& bufferManager);
+		[[nodiscard]] const MaterialProperty* getBaseMaterialPropertyById(const MaterialResource& materialResource, MaterialPropertyId materialPropertyId) const;
+		void loadHeightRangeLevels(AssetId heightMapAssetId);
+		void getHeightRange(glm::vec2 uvMinimum, glm::vec2 uvMaximum, float& minimumHeight, float& maximumHeight) const;
+		[[nodiscard]] ExtentIntersection getTileBoundingBox(const ViewData& viewData, float x, float y, float tileSize, glm::vec3& minimum, glm::vec3& maximum) const;
+		void updateTerrainTiles(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData);
+		void cullTiles(const ViewData& viewData, const InstanceData* instanceData, uint32_t numberOfTiles);
+		void cullTerrainTileRings(const ViewData& viewData);
+		void cullTerrainQuadtree(const ViewData& viewData);
+		[[nodiscard]] bool isQuadtreeNodeSplit(const ViewData& viewData, float x, float y, float size) const;
+		[[nodiscard]] float getQuadtreeLeafSize(const ViewData& viewData, float x, float y) const;
+		void addQuadtreeLeaf(const ViewData& viewData, float x, float y, float size, InstanceData* instanceData, uint32_t& numberOfTiles) const;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		Rhi::IIndexBufferPtr mIndexBufferPtr;			///< Index buffer which is shared between all terrain tile ring vertex array buffers
-		int					 mNumberOfTerrainTileRings;	///< Number of terrain tile rings
-		TerrainTileRing		 mTerrainTileRings[MAXIMUM_NUMBER_OF_TERRAIN_TILE_RINGS];
+		Rhi::IIndexBufferPtr  mIndexBufferPtr;				///< Index buffer which is shared between all terrain tile vertex array buffers
+		int					  mNumberOfTerrainTileRings;	///< Number of terrain tile rings
+		TerrainTileRing		  mTerrainTileRings[MAXIMUM_NUMBER_OF_TERRAIN_TILE_RINGS];
+		Rhi::IVertexBufferPtr mQuadtreeVertexBufferPtr;		///< Dynamic vertex buffer object (VBO) receiving the visible quadtree leaf tiles, can be a null pointer
+		Rhi::IVertexArrayPtr  mQuadtreeVertexArrayPtr;		///< Vertex array object (VAO) of the quadtree leaf tiles, can be a null pointer
+		InstanceDataVector	  mQuadtreeNodes;				///< Quadtree nodes of the quadtree level which is currently culled, only kept to reuse the memory
+		InstanceDataVector	  mNextQuadtreeNodes;			///< Quadtree nodes of the next quadtree level, only kept to reuse the memory
+		SceneItemSet*		  mTileSceneItemSet;			///< Bounding spheres and visibility flags of the tiles to cull, always valid, destroy the instance if you no longer need it
+		HeightRangeLevels	  mHeightRangeLevels;			///< Minimum/maximum height quadtree, finest level first, empty if the height map couldn't be read
+		uint32_t			  mHeightMapWidth;				///< Height map width in texels, only valid if there are height range levels
+		uint32_t			  mHeightMapHeight;				///< Height map height in texels, only valid if there are height range levels
+		glm::vec3			  mMaterialWorldPosition;		///< Terrain world space position center as defined by the material, the scene node position is added on top
+		glm::vec3			  mMaterialWorldSize;			///< Terrain world space size as defined by the material, the scene node scale is applied on top
+		glm::quat			  mMaterialWorldRotation;		///< Terrain world space rotation as defined by the material, the scene node rotation is applied on top
+		LodMode				  mLodMode;						///< Level of detail mode
+		bool				  mTileCulling;					///< Cull the terrain tiles against the camera frustum?
+		bool				  mTerrainExtentClipping;		///< Cull the terrain tiles outside the terrain extent?
 
 
 	};
@@ -144,6 +144,9 @@ namespace Renderer
 		{
 			const uint32_t sceneItemSetIndex = sceneItem.mSceneItemSetIndex;
 
+			// The scene item is no longer considered to be a static shadow caster
+			sceneItem.onSceneItemSetTransformChange();
+
 			{ // Set object space to world space matrix
 				glm::mat4 objectSpaceToWorldSpace;
 				mGlobalTransform.getAsMatrix(objectSpaceToWorldSpace);
@@ -23,9 +23,12 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/SceneResourceManager.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
+#include "Renderer/Public/Resource/Scene/Item/Particles/ParticlesSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Factory/SceneFactory.h"
 #include "Renderer/Public/Resource/Scene/Loader/SceneResourceLoader.h"
 #include "Renderer/Public/Resource/ResourceManagerTemplate.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/IRenderer.h"
 
 
 //[-------------------------------------------------------]
@@ -73,6 +76,13 @@ namespace Renderer
 		}
 	}
 
+	SceneResourceId SceneResourceManager::createEmptySceneResourceByAssetId(AssetId assetId)
+	{
+		SceneResource& sceneResource = mInternalResourceManager->createEmptyResourceByAssetId(assetId);
+		setResourceLoadingState(sceneResource, IResource::LoadingState::LOADED);
+		return sceneResource.getId();
+	}
+
 	SceneResource* SceneResourceManager::getSceneResourceByAssetId(AssetId assetId) const
 	{
 		return mInternalResourceManager->getResourceByAssetId(assetId);
@@ -91,7 +101,7 @@ namespace Renderer
 
 	void SceneResourceManager::destroySceneResource(SceneResourceId sceneResourceId)
 	{
-		mInternalResourceManager->getResources().removeElement(sceneResourceId);
+		mInternalResourceManager->removeResource(sceneResourceId);
 	}
 
 	void SceneResourceManager::setInvalidResourceId(SceneResourceId& sceneResourceId, IResourceListener& resourceListener) const
@@ -138,6 +148,34 @@ namespace Renderer
 		return mInternalResourceManager->reloadResourceByAssetId(assetId);
 	}
 
+	void SceneResourceManager::update()
+	{
+		// Gather the particles scene items of all loaded scene resources
+		// -> Scene resources which are still loading might get scene items created by a resource streamer worker thread
+		mParticlesSceneItems.clear();
+		const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+		for (uint32_t i = 0; i < numberOfElements; ++i)
+		{
+			const SceneResource& sceneResource = mInternalResourceManager->getResources().getElementByIndex(i);
+			if (IResource::LoadingState::LOADED == sceneResource.getLoadingState())
+			{
+				for (ISceneItem* sceneItem : sceneResource.getSceneItems())
+				{
+					if (ParticlesSceneItem::TYPE_ID == sceneItem->getSceneItemTypeId())
+					{
+						mParticlesSceneItems.push_back(static_cast<ParticlesSceneItem*>(sceneItem));
+					}
+				}
+			}
+		}
+
+		// Simulate the particles of all particles scene items at once so the default thread pool can work across emitters
+		if (!mParticlesSceneItems.empty())
+		{
+			ParticlesSceneItem::updateParticlesSceneItems(mRenderer, mParticlesSceneItems.data(), static_cast<uint32_t>(mParticlesSceneItems.size()), mRenderer.getTimeManager().getPastSecondsSinceLastFrame());
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual Renderer::IResourceManager methods    ]
@@ -30,6 +30,14 @@
 #include "Renderer/Public/Resource/ResourceManager.h"
 #include "Renderer/Public/Context.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -40,6 +48,7 @@ namespace Renderer
 	class SceneResource;
 	class IRenderer;
 	class SceneResourceLoader;
+	class ParticlesSceneItem;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
@@ -87,6 +96,7 @@ namespace Renderer
 		}
 
 		RENDERER_API_EXPORT void setSceneFactory(const ISceneFactory* sceneFactory);
+		[[nodiscard]] RENDERER_API_EXPORT SceneResourceId createEmptySceneResourceByAssetId(AssetId assetId);	// Scene resource is not allowed to exist, yet, prefer asynchronous scene resource loading over this method
 		[[nodiscard]] RENDERER_API_EXPORT SceneResource* getSceneResourceByAssetId(AssetId assetId) const;		// Considered to be inefficient, avoid method whenever possible
 		[[nodiscard]] RENDERER_API_EXPORT SceneResourceId getSceneResourceIdByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
 		RENDERER_API_EXPORT void loadSceneResourceByAssetId(AssetId assetId, SceneResourceId& sceneResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = getInvalid<ResourceLoaderTypeId>());	// Asynchronous
@@ -103,11 +113,7 @@ namespace Renderer
 		[[nodiscard]] virtual IResource& getResourceByResourceId(ResourceId resourceId) const override;
 		[[nodiscard]] virtual IResource* tryGetResourceByResourceId(ResourceId resourceId) const override;
 		virtual void reloadResourceByAssetId(AssetId assetId) override;
-
-		inline virtual void update() override
-		{
-			// Nothing here
-		}
+		virtual void update() override;
 
 
 	//[-------------------------------------------------------]
@@ -137,6 +143,9 @@ namespace Renderer
 		// Internal resource manager implementation
 		ResourceManagerTemplate<SceneResource, SceneResourceLoader, SceneResourceId, 16>* mInternalResourceManager;
 
+		// Per frame update
+		std::vector<ParticlesSceneItem*> mParticlesSceneItems;	///< Particles scene items of all loaded scene resources, gathered once per frame, don't destroy the instances
+
 
 	};
 
@@ -22,13 +22,656 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/Preprocessor.h"
-#define MOJOSHADER_NO_VERSION_INCLUDE
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 #include "Renderer/Public/Context.h"
 
-#include <MojoShader/mojoshader.h>
+#include <algorithm>	// For "std::count()"
+#include <cstring>		// For "memchr()"
 
-#include <cstring>	// For "strlen()"
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		enum class PreprocessorTokenType : uint8_t
+		{
+			END_OF_TEXT,
+			NEWLINE,		///< Only returned if requested, else newlines are whitespace
+			IDENTIFIER,
+			NUMBER,
+			STRING,
+			PUNCTUATION		///< Single character or "##"
+		};
+
+		struct PreprocessorToken final
+		{
+			PreprocessorTokenType type;
+			std::string_view	  text;
+			bool				  precededByWhitespace;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool isPreprocessorIdentifierStart(char character)
+		{
+			return ((character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || '_' == character);
+		}
+
+		[[nodiscard]] inline bool isPreprocessorDigit(char character)
+		{
+			return (character >= '0' && character <= '9');
+		}
+
+		[[nodiscard]] inline bool isPreprocessorIdentifierCharacter(char character)
+		{
+			return (isPreprocessorIdentifierStart(character) || isPreprocessorDigit(character));
+		}
+
+		[[nodiscard]] inline uint32_t calculatePreprocessorMacroHash(std::string_view name)
+		{
+			return Renderer::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(name.data()), static_cast<uint32_t>(name.length()));
+		}
+
+		[[nodiscard]] inline uint32_t getPreprocessorMacroFilterBit(std::string_view name)
+		{
+			return (static_cast<uint32_t>(static_cast<uint8_t>(name.front())) + static_cast<uint32_t>(static_cast<uint8_t>(name.back())) * 7u + static_cast<uint32_t>(name.length()) * 31u);
+		}
+
+		[[nodiscard]] inline bool isPreprocessorLineContinuation(std::string_view text, size_t position)
+		{
+			const size_t length = text.length();
+			return ('\\' == text[position] && position + 1 < length && ('\n' == text[position + 1] || ('\r' == text[position + 1] && position + 2 < length && '\n' == text[position + 2])));
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not two characters would fuse into a single token when written directly after each other
+		*
+		*  @note
+		*    - Used for text coming from different macro expansions, e.g. "-" followed by a macro expanding to "-1" must not become "--1"
+		*/
+		[[nodiscard]] bool needsPreprocessorSeparator(char previous, char next)
+		{
+			if ((isPreprocessorIdentifierCharacter(previous) && isPreprocessorIdentifierCharacter(next)) || (isPreprocessorDigit(previous) && '.' == next))
+			{
+				return true;
+			}
+			if ('/' == previous && ('/' == next || '*' == next))
+			{
+				return true;
+			}
+			return (std::string_view("+-<>&|=!*/%^#").find(previous) != std::string_view::npos && std::string_view("+-<>&|=#").find(next) != std::string_view::npos);
+		}
+
+		/**
+		*  @brief
+		*    Skip whitespace, comments and line continuations
+		*
+		*  @return
+		*    "true" if something was skipped, else "false"
+		*/
+		bool skipPreprocessorWhitespace(std::string_view text, size_t& position, bool stopAtNewline)
+		{
+			const size_t startPosition = position;
+			const size_t length = text.length();
+			while (position < length)
+			{
+				const char character = text[position];
+				if (' ' == character || '\t' == character || '\r' == character || '\v' == character || '\f' == character)
+				{
+					++position;
+				}
+				else if ('\n' == character)
+				{
+					if (stopAtNewline)
+					{
+						break;
+					}
+					++position;
+				}
+				else if ('\\' == character && isPreprocessorLineContinuation(text, position))
+				{
+					position += ('\n' == text[position + 1]) ? 2u : 3u;
+				}
+				else if ('/' == character && position + 1 < length && '/' == text[position + 1])
+				{
+					// The terminating newline isn't part of the line comment
+					const size_t newlinePosition = text.find('\n', position + 2);
+					position = (std::string_view::npos == newlinePosition) ? length : newlinePosition;
+				}
+				else if ('/' == character && position + 1 < length && '*' == text[position + 1])
+				{
+					const size_t endPosition = text.find("*/", position + 2);
+					position = (std::string_view::npos == endPosition) ? length : (endPosition + 2);
+				}
+				else
+				{
+					break;
+				}
+			}
+			return (position != startPosition);
+		}
+
+		void readPreprocessorToken(std::string_view text, size_t& position, bool stopAtNewline, PreprocessorToken& token)
+		{
+			token.precededByWhitespace = skipPreprocessorWhitespace(text, position, stopAtNewline);
+			const size_t length = text.length();
+			if (position >= length)
+			{
+				token.type = PreprocessorTokenType::END_OF_TEXT;
+				token.text = std::string_view();
+				return;
+			}
+
+			const size_t startPosition = position;
+			const char character = text[position];
+			++position;
+			if ('\n' == character)
+			{
+				token.type = PreprocessorTokenType::NEWLINE;
+			}
+			else if (isPreprocessorIdentifierStart(character))
+			{
+				while (position < length && isPreprocessorIdentifierCharacter(text[position]))
+				{
+					++position;
+				}
+				token.type = PreprocessorTokenType::IDENTIFIER;
+			}
+			else if (isPreprocessorDigit(character) || ('.' == character && position < length && isPreprocessorDigit(text[position])))
+			{
+				// Preprocessing number, e.g. "1.0e-3f" is a single token
+				while (position < length)
+				{
+					const char numberCharacter = text[position];
+					if (isPreprocessorIdentifierCharacter(numberCharacter) || '.' == numberCharacter)
+					{
+						++position;
+					}
+					else if (('+' == numberCharacter || '-' == numberCharacter) && ('e' == text[position - 1] || 'E' == text[position - 1]))
+					{
+						++position;
+					}
+					else
+					{
+						break;
+					}
+				}
+				token.type = PreprocessorTokenType::NUMBER;
+			}
+			else if ('"' == character || '\'' == character)
+			{
+				while (position < length && character != text[position] && '\n' != text[position])
+				{
+					position += ('\\' == text[position] && position + 1 < length) ? 2u : 1u;
+				}
+				if (position < length && character == text[position])
+				{
+					++position;
+				}
+				token.type = PreprocessorTokenType::STRING;
+			}
+			else
+			{
+				if ('#' == character && position < length && '#' == text[position])
+				{
+					++position;
+				}
+				token.type = PreprocessorTokenType::PUNCTUATION;
+			}
+			token.text = text.substr(startPosition, position - startPosition);
+		}
+
+		/**
+		*  @brief
+		*    Return the position of the newline terminating the logical line starting at the given position, or the text length
+		*
+		*  @note
+		*    - Line continuations and block comments spanning multiple lines are part of the logical line
+		*/
+		[[nodiscard]] size_t findPreprocessorLineEnd(std::string_view text, size_t position)
+		{
+			const size_t length = text.length();
+			if (position >= length)
+			{
+				return length;
+			}
+
+			{ // Fast path for lines without comments and line continuations
+				const char* lineBegin = text.data() + position;
+				const char* newline = static_cast<const char*>(memchr(lineBegin, '\n', length - position));
+				const size_t lineLength = (nullptr != newline) ? static_cast<size_t>(newline - lineBegin) : (length - position);
+				if (nullptr == memchr(lineBegin, '/', lineLength) && nullptr == memchr(lineBegin, '\\', lineLength))
+				{
+					return position + lineLength;
+				}
+			}
+
+			// Slow path
+			while (position < length)
+			{
+				const char character = text[position];
+				if ('\n' == character)
+				{
+					return position;
+				}
+				else if ('\\' == character && isPreprocessorLineContinuation(text, position))
+				{
+					position += ('\n' == text[position + 1]) ? 2u : 3u;
+				}
+				else if ('/' == character && position + 1 < length && '/' == text[position + 1])
+				{
+					const size_t newlinePosition = text.find('\n', position + 2);
+					return (std::string_view::npos == newlinePosition) ? length : newlinePosition;
+				}
+				else if ('/' == character && position + 1 < length && '*' == text[position + 1])
+				{
+					const size_t endPosition = text.find("*/", position + 2);
+					position = (std::string_view::npos == endPosition) ? length : (endPosition + 2);
+				}
+				else
+				{
+					++position;
+				}
+			}
+			return length;
+		}
+
+		[[nodiscard]] inline bool isPreprocessorPunctuation(const PreprocessorToken& token, char character)
+		{
+			return (PreprocessorTokenType::PUNCTUATION == token.type && 1 == token.text.length() && character == token.text.front());
+		}
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Integer expression evaluator for "#if" and "#elif", operates on already macro-expanded text
+		*
+		*  @note
+		*    - Remaining identifiers evaluate to zero
+		*/
+		class PreprocessorExpression final
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			inline explicit PreprocessorExpression(std::string_view text) :
+				mText(text),
+				mPosition(0),
+				mErrorMessage(nullptr)
+			{
+				// Nothing here
+			}
+
+			[[nodiscard]] inline const char* getErrorMessage() const
+			{
+				return mErrorMessage;
+			}
+
+			[[nodiscard]] bool evaluate(int64_t& value)
+			{
+				if (!parseConditional(value))
+				{
+					return false;
+				}
+				skipWhitespace();
+				return (mPosition < mText.length()) ? setError("Unexpected token in preprocessor expression") : true;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+		private:
+			explicit PreprocessorExpression(const PreprocessorExpression&) = delete;
+			PreprocessorExpression& operator=(const PreprocessorExpression&) = delete;
+
+			inline bool setError(const char* errorMessage)
+			{
+				mErrorMessage = errorMessage;
+				return false;
+			}
+
+			inline void skipWhitespace()
+			{
+				while (mPosition < mText.length() && (' ' == mText[mPosition] || '\t' == mText[mPosition]))
+				{
+					++mPosition;
+				}
+			}
+
+			[[nodiscard]] inline char getCharacter(size_t offset) const
+			{
+				return (mPosition + offset < mText.length()) ? mText[mPosition + offset] : '\0';
+			}
+
+			/**
+			*  @brief
+			*    Return the precedence of the binary operator at the current position, zero if there's none
+			*/
+			[[nodiscard]] uint32_t getBinaryOperator(size_t& operatorLength) const
+			{
+				const char character = getCharacter(0);
+				const char nextCharacter = getCharacter(1);
+				operatorLength = 1;
+				switch (character)
+				{
+					case '|':
+						if ('|' == nextCharacter)
+						{
+							operatorLength = 2;
+							return 1;
+						}
+						return 3;
+
+					case '&':
+						if ('&' == nextCharacter)
+						{
+							operatorLength = 2;
+							return 2;
+						}
+						return 5;
+
+					case '^':
+						return 4;
+
+					case '=':
+					case '!':
+						operatorLength = 2;
+						return ('=' == nextCharacter) ? 6u : 0u;
+
+					case '<':
+					case '>':
+						if (character == nextCharacter)
+						{
+							operatorLength = 2;
+							return 8;
+						}
+						if ('=' == nextCharacter)
+						{
+							operatorLength = 2;
+						}
+						return 7;
+
+					case '+':
+					case '-':
+						return 9;
+
+					case '*':
+					case '/':
+					case '%':
+						return 10;
+
+					default:
+						return 0;
+				}
+			}
+
+			[[nodiscard]] bool parseConditional(int64_t& value)
+			{
+				if (!parseBinary(1, value))
+				{
+					return false;
+				}
+				skipWhitespace();
+				if ('?' == getCharacter(0))
+				{
+					++mPosition;
+					int64_t trueValue = 0;
+					if (!parseConditional(trueValue))
+					{
+						return false;
+					}
+					skipWhitespace();
+					if (':' != getCharacter(0))
+					{
+						return setError("Missing \":\" in preprocessor expression");
+					}
+					++mPosition;
+					int64_t falseValue = 0;
+					if (!parseConditional(falseValue))
+					{
+						return false;
+					}
+					value = (0 != value) ? trueValue : falseValue;
+				}
+				return true;
+			}
+
+			[[nodiscard]] bool parseBinary(uint32_t minimumPrecedence, int64_t& value)
+			{
+				if (!parseUnary(value))
+				{
+					return false;
+				}
+				for (;;)
+				{
+					skipWhitespace();
+					size_t operatorLength = 0;
+					const uint32_t precedence = getBinaryOperator(operatorLength);
+					if (0 == precedence || precedence < minimumPrecedence)
+					{
+						return true;
+					}
+					const char character = getCharacter(0);
+					const char nextCharacter = getCharacter(1);
+					mPosition += operatorLength;
+					int64_t right = 0;
+					if (!parseBinary(precedence + 1, right))
+					{
+						return false;
+					}
+					switch (character)
+					{
+						case '|':
+							value = (2 == operatorLength) ? static_cast<int64_t>(0 != value || 0 != right) : (value | right);
+							break;
+
+						case '&':
+							value = (2 == operatorLength) ? static_cast<int64_t>(0 != value && 0 != right) : (value & right);
+							break;
+
+						case '^':
+							value ^= right;
+							break;
+
+						case '=':
+							value = static_cast<int64_t>(value == right);
+							break;
+
+						case '!':
+							value = static_cast<int64_t>(value != right);
+							break;
+
+						case '<':
+						case '>':
+							if (character == nextCharacter)
+							{
+								// Shifting by a negative count or by at least the bit width is undefined behaviour
+								if (right < 0 || right >= 64)
+								{
+									return setError("Shift count out of range in preprocessor expression");
+								}
+								value = ('<' == character) ? static_cast<int64_t>(static_cast<uint64_t>(value) << right) : (value >> right);
+							}
+							else if ('<' == character)
+							{
+								value = static_cast<int64_t>(('=' == nextCharacter) ? (value <= right) : (value < right));
+							}
+							else
+							{
+								value = static_cast<int64_t>(('=' == nextCharacter) ? (value >= right) : (value > right));
+							}
+							break;
+
+						case '+':
+							value += right;
+							break;
+
+						case '-':
+							value -= right;
+							break;
+
+						case '*':
+							value *= right;
+							break;
+
+						case '/':
+						case '%':
+							if (0 == right)
+							{
+								return setError("Division by zero in preprocessor expression");
+							}
+							value = ('/' == character) ? (value / right) : (value % right);
+							break;
+					}
+				}
+			}
+
+			[[nodiscard]] bool parseUnary(int64_t& value)
+			{
+				skipWhitespace();
+				const char character = getCharacter(0);
+				if ('(' == character)
+				{
+					++mPosition;
+					if (!parseConditional(value))
+					{
+						return false;
+					}
+					skipWhitespace();
+					if (')' != getCharacter(0))
+					{
+						return setError("Missing \")\" in preprocessor expression");
+					}
+					++mPosition;
+					return true;
+				}
+				else if ('+' == character || '-' == character || '!' == character || '~' == character)
+				{
+					++mPosition;
+					if (!parseUnary(value))
+					{
+						return false;
+					}
+					if ('-' == character)
+					{
+						value = -value;
+					}
+					else if ('!' == character)
+					{
+						value = static_cast<int64_t>(0 == value);
+					}
+					else if ('~' == character)
+					{
+						value = ~value;
+					}
+					return true;
+				}
+				else if (isPreprocessorDigit(character))
+				{
+					return parseNumber(value);
+				}
+				else if (isPreprocessorIdentifierStart(character))
+				{
+					while (isPreprocessorIdentifierCharacter(getCharacter(0)))
+					{
+						++mPosition;
+					}
+					value = 0;
+					return true;
+				}
+				return setError(('\0' == character) ? "Unexpected end of preprocessor expression" : "Unexpected token in preprocessor expression");
+			}
+
+			[[nodiscard]] bool parseNumber(int64_t& value)
+			{
+				uint64_t number = 0;
+				uint64_t base = 10;
+				if ('0' == getCharacter(0))
+				{
+					if ('x' == getCharacter(1) || 'X' == getCharacter(1))
+					{
+						base = 16;
+						mPosition += 2;
+					}
+					else
+					{
+						base = 8;
+					}
+				}
+				for (;;)
+				{
+					const char character = getCharacter(0);
+					uint64_t digit = base;
+					if (isPreprocessorDigit(character))
+					{
+						digit = static_cast<uint64_t>(character - '0');
+					}
+					else if (character >= 'a' && character <= 'f')
+					{
+						digit = static_cast<uint64_t>(character - 'a' + 10);
+					}
+					else if (character >= 'A' && character <= 'F')
+					{
+						digit = static_cast<uint64_t>(character - 'A' + 10);
+					}
+					if (digit >= base)
+					{
+						break;
+					}
+					number = number * base + digit;
+					++mPosition;
+				}
+
+				// Skip the integer suffix
+				while (std::string_view("uUlL").find(getCharacter(0)) != std::string_view::npos && '\0' != getCharacter(0))
+				{
+					++mPosition;
+				}
+				if (isPreprocessorIdentifierCharacter(getCharacter(0)) || '.' == getCharacter(0))
+				{
+					return setError("Invalid integer constant in preprocessor expression");
+				}
+				value = static_cast<int64_t>(number);
+				return true;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			std::string_view mText;
+			size_t			 mPosition;
+			const char*		 mErrorMessage;
+
+
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -39,33 +682,719 @@ namespace Renderer
 
 
 	//[-------------------------------------------------------]
-	//[ Public static methods                                 ]
+	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	void Preprocessor::preprocess(const IRenderer& renderer, std::string& source, std::string& result)
+	bool Preprocessor::preprocess(const IRenderer& renderer, const std::string& source, std::string& result)
+	{
+		// Reset, but keep the allocated memory
+		mMacros.clear();
+		std::fill(mMacroHashTable.begin(), mMacroHashTable.end(), 0u);
+		memset(mMacroFilter, 0, sizeof(mMacroFilter));
+		mMacroParameters.clear();
+		mNumberOfFrames = 0;
+		mArgumentsDepth = 0;
+		mConditionals.clear();
+		mErrorMessage = nullptr;
+		result.clear();
+		result.reserve(source.length());
+
+		// Process the source line by line
+		const std::string_view text = source;
+		const size_t length = text.length();
+		pushFrame(text, NO_MACRO);
+		Frame& sourceFrame = mFrames.front();
+		size_t lineBegin = 0;
+		bool success = true;
+		while (success && sourceFrame.position < length)
+		{
+			// Skip the indentation
+			lineBegin = sourceFrame.position;
+			size_t position = lineBegin;
+			while (position < length && (' ' == text[position] || '\t' == text[position]))
+			{
+				++position;
+			}
+
+			if (position < length && '#' == text[position])
+			{
+				// Directive
+				const size_t lineEnd = ::detail::findPreprocessorLineEnd(text, position);
+				success = processDirective(text.substr(position + 1, lineEnd - position - 1), result);
+				sourceFrame.position = (lineEnd < length) ? (lineEnd + 1) : length;
+			}
+			else if (isActive())
+			{
+				// Expand the source code line, keep the indentation but drop lines which end up empty
+				const size_t resultLength = result.length();
+				result.append(text.substr(lineBegin, position - lineBegin));
+				sourceFrame.position = position;
+				success = expand(0, result);
+				if (result.length() == resultLength + (position - lineBegin))
+				{
+					result.resize(resultLength);
+				}
+				else
+				{
+					result += '\n';
+				}
+			}
+			else
+			{
+				// Skip the inactive line
+				const size_t lineEnd = ::detail::findPreprocessorLineEnd(text, position);
+				sourceFrame.position = (lineEnd < length) ? (lineEnd + 1) : length;
+			}
+		}
+		if (success && !mConditionals.empty())
+		{
+			success = setError("Unterminated conditional directive");
+		}
+
+		// Error handling
+		if (!success)
+		{
+			const uint32_t line = 1u + static_cast<uint32_t>(std::count(text.begin(), text.begin() + static_cast<std::ptrdiff_t>(lineBegin), '\n'));
+			RHI_LOG(renderer.getContext(), CRITICAL, "Renderer shader preprocessor line %u: Error: %s", line, mErrorMessage)
+			result.clear();
+		}
+
+		// Done
+		return success;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	uint32_t Preprocessor::findMacroSlot(std::string_view name, uint32_t hash) const
+	{
+		// Linear probing, there's always at least one empty slot
+		const uint32_t mask = static_cast<uint32_t>(mMacroHashTable.size()) - 1;
+		uint32_t slot = hash & mask;
+		for (;;)
+		{
+			const uint32_t entry = mMacroHashTable[slot];
+			if (0 == entry)
+			{
+				return slot;
+			}
+			const Macro& macro = mMacros[entry - 1];
+			if (macro.hash == hash && macro.name == name)
+			{
+				return slot;
+			}
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	uint32_t Preprocessor::findMacro(std::string_view name) const
 	{
-		// TODO(co) The usage of MojoShader just as preprocessor is overkill. Find a simpler but still efficient solution. Switch to "mcpp -- a portable C preprocessor" ( http://mcpp.sourceforge.net/ ) ?
+		const uint32_t filterBit = ::detail::getPreprocessorMacroFilterBit(name) & (NUMBER_OF_MACRO_FILTER_BITS - 1);
+		if (0 == (mMacroFilter[filterBit / 64] & (uint64_t(1) << (filterBit % 64))))
+		{
+			return NO_MACRO;
+		}
+		const uint32_t entry = mMacroHashTable[findMacroSlot(name, ::detail::calculatePreprocessorMacroHash(name))];
+		return (0 != entry && mMacros[entry - 1].defined) ? (entry - 1) : NO_MACRO;
+	}
 
-		// Disable warnings in external headers, we can't fix them
-		PRAGMA_WARNING_PUSH
-			PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: 'MOJOSHADER_preprocess': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	void Preprocessor::defineMacro(const Macro& macro)
+	{
+		// Grow the hash table if it's more than half full, keep it as it is otherwise so the memory gets reused
+		if (mMacroHashTable.size() < (mMacros.size() + 1) * 2)
+		{
+			mMacroHashTable.assign(std::max<size_t>(mMacroHashTable.size() * 2, 256), 0u);
+			const uint32_t mask = static_cast<uint32_t>(mMacroHashTable.size()) - 1;
+			const uint32_t numberOfMacros = static_cast<uint32_t>(mMacros.size());
+			for (uint32_t i = 0; i < numberOfMacros; ++i)
+			{
+				uint32_t slot = mMacros[i].hash & mask;
+				while (0 != mMacroHashTable[slot])
+				{
+					slot = (slot + 1) & mask;
+				}
+				mMacroHashTable[slot] = i + 1;
+			}
+		}
 
-			// Preprocess
-			const MOJOSHADER_preprocessData* preprocessData = MOJOSHADER_preprocess(nullptr, source.c_str(), static_cast<unsigned int>(source.length()), 0, 0, 0, 0, 0, 0, 0, 0, 0);
-		PRAGMA_WARNING_POP
+		// Define or redefine the macro
+		const uint32_t filterBit = ::detail::getPreprocessorMacroFilterBit(macro.name) & (NUMBER_OF_MACRO_FILTER_BITS - 1);
+		mMacroFilter[filterBit / 64] |= (uint64_t(1) << (filterBit % 64));
+		uint32_t& entry = mMacroHashTable[findMacroSlot(macro.name, macro.hash)];
+		if (0 == entry)
+		{
+			mMacros.push_back(macro);
+			entry = static_cast<uint32_t>(mMacros.size());
+		}
+		else
+		{
+			mMacros[entry - 1] = macro;
+		}
+	}
+
+	bool Preprocessor::processDirective(std::string_view directive, std::string& result)
+	{
+		// Get the directive name, a single "#" is a valid null directive
+		size_t position = 0;
+		::detail::PreprocessorToken token;
+		::detail::readPreprocessorToken(directive, position, false, token);
+		if (::detail::PreprocessorTokenType::END_OF_TEXT == token.type)
+		{
+			return true;
+		}
+		if (::detail::PreprocessorTokenType::IDENTIFIER != token.type)
+		{
+			return isActive() ? setError("Invalid preprocessor directive") : true;
+		}
+		const std::string_view name = token.text;
 
-		// Evaluate the result
-		if (preprocessData->error_count > 0)
+		// Conditionals are evaluated even inside inactive groups to keep track of the nesting
+		if ("if" == name || "ifdef" == name || "ifndef" == name)
+		{
+			bool value = false;
+			if (isActive())
+			{
+				if ("if" == name)
+				{
+					if (!evaluateExpression(directive.substr(position), value))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					::detail::readPreprocessorToken(directive, position, false, token);
+					if (::detail::PreprocessorTokenType::IDENTIFIER != token.type)
+					{
+						return setError("Macro name expected");
+					}
+					value = ((NO_MACRO != findMacro(token.text)) == ("ifdef" == name));
+				}
+				mConditionals.push_back({ value, value, false });
+			}
+			else
+			{
+				mConditionals.push_back({ false, true, false });
+			}
+		}
+		else if ("elif" == name || "else" == name)
+		{
+			if (mConditionals.empty())
+			{
+				return setError("\"#elif\" or \"#else\" without \"#if\"");
+			}
+			Conditional& conditional = mConditionals.back();
+			if (conditional.hadElse)
+			{
+				return setError("\"#elif\" or \"#else\" after \"#else\"");
+			}
+			if (conditional.taken)
+			{
+				conditional.active = false;
+			}
+			else if ("else" == name)
+			{
+				conditional.active = conditional.taken = true;
+			}
+			else
+			{
+				bool value = false;
+				if (!evaluateExpression(directive.substr(position), value))
+				{
+					return false;
+				}
+				conditional.active = conditional.taken = value;
+			}
+			conditional.hadElse = ("else" == name);
+		}
+		else if ("endif" == name)
+		{
+			if (mConditionals.empty())
+			{
+				return setError("\"#endif\" without \"#if\"");
+			}
+			mConditionals.pop_back();
+		}
+		else if (!isActive())
 		{
-			for (int i = 0; i < preprocessData->error_count; ++i)
+			// Other directives inside inactive groups are ignored
+		}
+		else if ("define" == name)
+		{
+			return processDefine(directive.substr(position));
+		}
+		else if ("undef" == name)
+		{
+			::detail::readPreprocessorToken(directive, position, false, token);
+			if (::detail::PreprocessorTokenType::IDENTIFIER != token.type)
+			{
+				return setError("Macro name expected");
+			}
+			const uint32_t macroIndex = findMacro(token.text);
+			if (NO_MACRO != macroIndex)
 			{
-				RHI_LOG(renderer.getContext(), CRITICAL, "Renderer shader preprocessor %s:%d: Error: %s", preprocessData->errors[i].filename ? preprocessData->errors[i].filename : "???", preprocessData->errors[i].error_position, preprocessData->errors[i].error)
+				mMacros[macroIndex].defined = false;
 			}
 		}
+		else if ("version" == name || "extension" == name || "pragma" == name || "line" == name)
+		{
+			// Shader compiler directives are passed through without comments
+			result += '#';
+			result.append(name);
+			for (;;)
+			{
+				::detail::readPreprocessorToken(directive, position, false, token);
+				if (::detail::PreprocessorTokenType::END_OF_TEXT == token.type)
+				{
+					break;
+				}
+				if (token.precededByWhitespace)
+				{
+					result += ' ';
+				}
+				result.append(token.text);
+			}
+			result += '\n';
+		}
+		else if ("error" == name)
+		{
+			return setError("\"#error\" directive");
+		}
+		else if ("include" == name)
+		{
+			return setError("\"#include\" isn't supported, use shader pieces instead");
+		}
 		else
 		{
-			result.assign(preprocessData->output, static_cast<size_t>(preprocessData->output_len));
+			return setError("Unknown preprocessor directive");
+		}
+		return true;
+	}
+
+	bool Preprocessor::processDefine(std::string_view text)
+	{
+		size_t position = 0;
+		::detail::PreprocessorToken token;
+		::detail::readPreprocessorToken(text, position, false, token);
+		if (::detail::PreprocessorTokenType::IDENTIFIER != token.type)
+		{
+			return setError("Macro name expected");
+		}
+		Macro macro = { token.text, std::string_view(), ::detail::calculatePreprocessorMacroHash(token.text), static_cast<uint32_t>(mMacroParameters.size()), -1, true, false };
+
+		// It's a function-like macro if the name is directly followed by an opening parenthesis
+		if (position < text.length() && '(' == text[position])
+		{
+			++position;
+			macro.numberOfParameters = 0;
+			::detail::readPreprocessorToken(text, position, false, token);
+			if (!::detail::isPreprocessorPunctuation(token, ')'))
+			{
+				for (;;)
+				{
+					if (::detail::PreprocessorTokenType::IDENTIFIER != token.type)
+					{
+						return setError("Invalid macro parameter list");
+					}
+					mMacroParameters.push_back(token.text);
+					++macro.numberOfParameters;
+					::detail::readPreprocessorToken(text, position, false, token);
+					if (::detail::isPreprocessorPunctuation(token, ')'))
+					{
+						break;
+					}
+					if (!::detail::isPreprocessorPunctuation(token, ','))
+					{
+						return setError("Invalid macro parameter list");
+					}
+					::detail::readPreprocessorToken(text, position, false, token);
+				}
+			}
+		}
+
+		// The body stays unprocessed, comments and line continuations are skipped as whitespace during expansion
+		::detail::skipPreprocessorWhitespace(text, position, false);
+		macro.body = text.substr(position);
+		defineMacro(macro);
+		return true;
+	}
+
+	bool Preprocessor::evaluateExpression(std::string_view text, bool& value)
+	{
+		// Resolve "defined" before the macro expansion
+		mExpressionSource.clear();
+		size_t position = 0;
+		::detail::PreprocessorToken token;
+		for (;;)
+		{
+			::detail::readPreprocessorToken(text, position, false, token);
+			if (::detail::PreprocessorTokenType::END_OF_TEXT == token.type)
+			{
+				break;
+			}
+			if (::detail::PreprocessorTokenType::IDENTIFIER == token.type && "defined" == token.text)
+			{
+				::detail::readPreprocessorToken(text, position, false, token);
+				const bool parenthesis = ::detail::isPreprocessorPunctuation(token, '(');
+				if (parenthesis)
+				{
+					::detail::readPreprocessorToken(text, position, false, token);
+				}
+				if (::detail::PreprocessorTokenType::IDENTIFIER != token.type)
+				{
+					return setError("Macro name expected after \"defined\"");
+				}
+				const bool defined = (NO_MACRO != findMacro(token.text));
+				if (parenthesis)
+				{
+					::detail::readPreprocessorToken(text, position, false, token);
+					if (!::detail::isPreprocessorPunctuation(token, ')'))
+					{
+						return setError("Missing \")\" after \"defined\"");
+					}
+				}
+				mExpressionSource += defined ? " 1 " : " 0 ";
+			}
+			else
+			{
+				if (token.precededByWhitespace)
+				{
+					mExpressionSource += ' ';
+				}
+				mExpressionSource.append(token.text);
+			}
+		}
+
+		// Expand macros
+		mExpression.clear();
+		pushFrame(mExpressionSource, NO_MACRO);
+		if (!expand(mNumberOfFrames - 1, mExpression))
+		{
+			return false;
+		}
+		popFrame();
+
+		// Evaluate
+		::detail::PreprocessorExpression preprocessorExpression(mExpression);
+		int64_t result = 0;
+		if (!preprocessorExpression.evaluate(result))
+		{
+			return setError(preprocessorExpression.getErrorMessage());
 		}
-		MOJOSHADER_freePreprocessData(preprocessData);
+		value = (0 != result);
+		return true;
+	}
+
+	bool Preprocessor::expand(size_t baseFrame, std::string& output)
+	{
+		const size_t outputStart = output.length();
+		bool pendingWhitespace = false;
+		bool frameBoundary = false;
+		::detail::PreprocessorToken token;
+		for (;;)
+		{
+			// Only the source frame is line based
+			Frame& frame = mFrames[mNumberOfFrames - 1];
+			::detail::readPreprocessorToken(frame.text, frame.position, (1 == mNumberOfFrames), token);
+			if (::detail::PreprocessorTokenType::END_OF_TEXT == token.type)
+			{
+				// Trailing whitespace and comments of a macro body don't count
+				if (mNumberOfFrames - 1 == baseFrame)
+				{
+					return true;
+				}
+				popFrame();
+				frameBoundary = true;
+				continue;
+			}
+			pendingWhitespace |= token.precededByWhitespace;
+			if (::detail::PreprocessorTokenType::NEWLINE == token.type)
+			{
+				return true;
+			}
+			else if (::detail::PreprocessorTokenType::IDENTIFIER == token.type)
+			{
+				const uint32_t macroIndex = findMacro(token.text);
+				if (NO_MACRO != macroIndex && !mMacros[macroIndex].disabled)
+				{
+					bool expanded = false;
+					if (!expandMacro(baseFrame, macroIndex, expanded))
+					{
+						return false;
+					}
+					if (expanded)
+					{
+						frameBoundary = true;
+						continue;
+					}
+				}
+			}
+
+			// Emit the token, whitespace is collapsed into a single space
+			if (output.length() > outputStart && (pendingWhitespace || (frameBoundary && ::detail::needsPreprocessorSeparator(output.back(), token.text.front()))))
+			{
+				output += ' ';
+			}
+			output.append(token.text);
+			pendingWhitespace = frameBoundary = false;
+		}
+	}
+
+	bool Preprocessor::expandMacro(size_t baseFrame, uint32_t macroIndex, bool& expanded)
+	{
+		const Macro& macro = mMacros[macroIndex];
+		expanded = false;
+		if (macro.numberOfParameters < 0)
+		{
+			// Object-like macro
+			pushFrame(macro.body, macroIndex);
+			expanded = true;
+			return true;
+		}
+
+		{ // A function-like macro name is only an invocation if it's followed by an opening parenthesis, which can come from an outer frame
+			for (;;)
+			{
+				Frame& frame = mFrames[mNumberOfFrames - 1];
+				size_t position = frame.position;
+				::detail::skipPreprocessorWhitespace(frame.text, position, (1 == mNumberOfFrames));
+				if (position < frame.text.length())
+				{
+					if ('(' != frame.text[position])
+					{
+						return true;
+					}
+					frame.position = position + 1;
+					break;
+				}
+				if (mNumberOfFrames - 1 == baseFrame)
+				{
+					return true;
+				}
+				popFrame();
+			}
+		}
+
+		// Collect the arguments
+		if (mArgumentsStack.size() == mArgumentsDepth)
+		{
+			mArgumentsStack.emplace_back();
+		}
+		Arguments& arguments = mArgumentsStack[mArgumentsDepth];
+		++mArgumentsDepth;
+		if (!collectArguments(baseFrame, arguments))
+		{
+			return false;
+		}
+		const size_t numberOfArguments = arguments.rawOffsets.size() / 2;
+		if (static_cast<size_t>(macro.numberOfParameters) != numberOfArguments && (0 != macro.numberOfParameters || arguments.rawOffsets[0] != arguments.rawOffsets[1]))
+		{
+			return setError("Wrong number of macro arguments");
+		}
+
+		// Fully macro-expand each argument in isolation
+		arguments.expandedText.clear();
+		arguments.expandedOffsets.clear();
+		for (int32_t i = 0; i < macro.numberOfParameters; ++i)
+		{
+			arguments.expandedOffsets.push_back(arguments.expandedText.length());
+			pushFrame(std::string_view(arguments.rawText).substr(arguments.rawOffsets[static_cast<size_t>(i) * 2], arguments.rawOffsets[static_cast<size_t>(i) * 2 + 1] - arguments.rawOffsets[static_cast<size_t>(i) * 2]), NO_MACRO);
+			if (!expand(mNumberOfFrames - 1, arguments.expandedText))
+			{
+				return false;
+			}
+			popFrame();
+			arguments.expandedOffsets.push_back(arguments.expandedText.length());
+		}
+
+		// Substitute the arguments into the macro body, the result gets rescanned
+		if (mFrames.size() == mNumberOfFrames)
+		{
+			mFrames.emplace_back();
+		}
+		Frame& frame = mFrames[mNumberOfFrames];
+		substituteArguments(macro, arguments, frame.buffer);
+		--mArgumentsDepth;
+		pushFrame(frame.buffer, macroIndex);
+		expanded = true;
+		return true;
+	}
+
+	bool Preprocessor::collectArguments(size_t baseFrame, Arguments& arguments)
+	{
+		arguments.rawText.clear();
+		arguments.rawOffsets.clear();
+		arguments.rawOffsets.push_back(0);
+		uint32_t depth = 0;
+		bool frameBoundary = false;
+		::detail::PreprocessorToken token;
+		for (;;)
+		{
+			// Arguments may span multiple source lines as well as outer frames
+			Frame& frame = mFrames[mNumberOfFrames - 1];
+			::detail::readPreprocessorToken(frame.text, frame.position, false, token);
+			if (::detail::PreprocessorTokenType::END_OF_TEXT == token.type)
+			{
+				if (mNumberOfFrames - 1 == baseFrame)
+				{
+					return setError("Unterminated macro invocation");
+				}
+				popFrame();
+				frameBoundary = true;
+				continue;
+			}
+			if (::detail::PreprocessorTokenType::PUNCTUATION == token.type && 1 == token.text.length())
+			{
+				const char character = token.text.front();
+				if ('(' == character)
+				{
+					++depth;
+				}
+				else if (')' == character)
+				{
+					if (0 == depth)
+					{
+						arguments.rawOffsets.push_back(arguments.rawText.length());
+						return true;
+					}
+					--depth;
+				}
+				else if (',' == character && 0 == depth)
+				{
+					arguments.rawOffsets.push_back(arguments.rawText.length());
+					arguments.rawOffsets.push_back(arguments.rawText.length());
+					frameBoundary = false;
+					continue;
+				}
+			}
+
+			// Arguments are stored without leading whitespace and with collapsed whitespace
+			if (arguments.rawText.length() > arguments.rawOffsets.back() && (token.precededByWhitespace || (frameBoundary && ::detail::needsPreprocessorSeparator(arguments.rawText.back(), token.text.front()))))
+			{
+				arguments.rawText += ' ';
+			}
+			arguments.rawText.append(token.text);
+			frameBoundary = false;
+		}
+	}
+
+	void Preprocessor::substituteArguments(const Macro& macro, const Arguments& arguments, std::string& output) const
+	{
+		const std::string_view body = macro.body;
+		const MacroParameters::const_iterator parametersBegin = mMacroParameters.cbegin() + macro.firstParameter;
+		const MacroParameters::const_iterator parametersEnd = parametersBegin + macro.numberOfParameters;
+		output.clear();
+		size_t position = 0;
+		bool pasteWithPrevious = false;
+		bool previousWasArgument = false;
+		::detail::PreprocessorToken token;
+		::detail::PreprocessorToken nextToken;
+		::detail::readPreprocessorToken(body, position, false, token);
+		while (::detail::PreprocessorTokenType::END_OF_TEXT != token.type)
+		{
+			::detail::readPreprocessorToken(body, position, false, nextToken);
+
+			// Token pasting: drop the whitespace around "##" and concatenate
+			if (::detail::PreprocessorTokenType::PUNCTUATION == token.type && "##" == token.text)
+			{
+				while (!output.empty() && ' ' == output.back())
+				{
+					output.pop_back();
+				}
+				pasteWithPrevious = true;
+				token = nextToken;
+				continue;
+			}
+			if (!pasteWithPrevious && token.precededByWhitespace && !output.empty())
+			{
+				output += ' ';
+			}
+
+			// Stringizing
+			MacroParameters::const_iterator parameterIterator = parametersEnd;
+			if (::detail::isPreprocessorPunctuation(token, '#') && ::detail::PreprocessorTokenType::IDENTIFIER == nextToken.type && (parameterIterator = std::find(parametersBegin, parametersEnd, nextToken.text)) != parametersEnd)
+			{
+				const size_t index = static_cast<size_t>(parameterIterator - parametersBegin) * 2;
+				output += '"';
+				for (size_t i = arguments.rawOffsets[index]; i < arguments.rawOffsets[index + 1]; ++i)
+				{
+					const char character = arguments.rawText[i];
+					if ('"' == character || '\\' == character)
+					{
+						output += '\\';
+					}
+					output += character;
+				}
+				output += '"';
+				::detail::readPreprocessorToken(body, position, false, nextToken);
+				pasteWithPrevious = previousWasArgument = false;
+				token = nextToken;
+				continue;
+			}
+
+			// Parameters are replaced by the fully macro-expanded argument, or by the raw argument if they're part of token pasting
+			if (::detail::PreprocessorTokenType::IDENTIFIER == token.type && (parameterIterator = std::find(parametersBegin, parametersEnd, token.text)) != parametersEnd)
+			{
+				const size_t index = static_cast<size_t>(parameterIterator - parametersBegin) * 2;
+				const bool raw = (pasteWithPrevious || (::detail::PreprocessorTokenType::PUNCTUATION == nextToken.type && "##" == nextToken.text));
+				const std::string& argumentText = raw ? arguments.rawText : arguments.expandedText;
+				const std::vector<size_t>& argumentOffsets = raw ? arguments.rawOffsets : arguments.expandedOffsets;
+				const std::string_view argument = std::string_view(argumentText).substr(argumentOffsets[index], argumentOffsets[index + 1] - argumentOffsets[index]);
+				if (!argument.empty())
+				{
+					if (!pasteWithPrevious && !output.empty() && ' ' != output.back() && ::detail::needsPreprocessorSeparator(output.back(), argument.front()))
+					{
+						output += ' ';
+					}
+					output.append(argument);
+				}
+				previousWasArgument = true;
+			}
+			else
+			{
+				if (previousWasArgument && !pasteWithPrevious && !output.empty() && ' ' != output.back() && ::detail::needsPreprocessorSeparator(output.back(), token.text.front()))
+				{
+					output += ' ';
+				}
+				output.append(token.text);
+				previousWasArgument = false;
+			}
+			pasteWithPrevious = false;
+			token = nextToken;
+		}
+	}
+
+	void Preprocessor::pushFrame(std::string_view text, uint32_t macroIndex)
+	{
+		if (mFrames.size() == mNumberOfFrames)
+		{
+			mFrames.emplace_back();
+		}
+		Frame& frame = mFrames[mNumberOfFrames];
+		++mNumberOfFrames;
+		frame.text = text;
+		frame.position = 0;
+		frame.macroIndex = macroIndex;
+		if (NO_MACRO != macroIndex)
+		{
+			mMacros[macroIndex].disabled = true;
+		}
+	}
+
+	void Preprocessor::popFrame()
+	{
+		--mNumberOfFrames;
+		const uint32_t macroIndex = mFrames[mNumberOfFrames].macroIndex;
+		if (NO_MACRO != macroIndex)
+		{
+			mMacros[macroIndex].disabled = false;
+		}
+	}
+
+	bool Preprocessor::setError(const char* errorMessage)
+	{
+		mErrorMessage = errorMessage;
+		return false;
 	}
 
 
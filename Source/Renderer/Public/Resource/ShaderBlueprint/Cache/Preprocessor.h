@@ -37,7 +37,10 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <deque>
 	#include <string>
+	#include <vector>
+	#include <string_view>
 PRAGMA_WARNING_POP
 
 
@@ -62,24 +65,45 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    A simple interface for the shader preprocessor
+	*    Lightweight streaming C-preprocessor for shader source codes
+	*
+	*  @remarks
+	*    Supports the subset the shader builder emits and the shader pieces are written in:
+	*    - Object-like and function-like macros including "#" stringizing and "##" token pasting
+	*    - "#define", "#undef", "#if", "#ifdef", "#ifndef", "#elif", "#else", "#endif" and "#error"
+	*    - "defined" and integer arithmetic, comparison and logical operators inside "#if" and "#elif"
+	*    - "#version", "#extension", "#pragma" and "#line" are shader compiler directives and are passed through unchanged
+	*    - "#include" isn't supported, shader pieces are included by the shader builder
+	*    Comments and blank lines are stripped, the line structure and indentation of the remaining source code are preserved.
+	*
+	*    Macro names and bodies are string views into the source, so no per-macro memory allocations are done. Keep one
+	*    preprocessor instance per shader builder, all internal buffers are reused across calls to reduce memory allocations.
 	*
 	*  @note
-	*    - Internally MojoShader ( https://icculus.org/mojoshader/ ) is used
-	*    - Possible alternatives to MojoShader if we later on want to get rid of it:
-	*      - "fcpp" "Frexx C preprocessor" ( https://github.com/bagder/fcpp )
-	*      - "mcpp -- a portable C preprocessor" ( http://mcpp.sourceforge.net/ )
-	*      - https://github.com/lpsantil/ucpp
-	*      - https://github.com/danmar/simplecpp
+	*    - Not thread-safe, but independent instances can be used concurrently
 	*/
 	class Preprocessor final
 	{
 
 
 	//[-------------------------------------------------------]
-	//[ Public static methods                                 ]
+	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	public:
+		inline Preprocessor() :
+			mMacroFilter{},
+			mNumberOfFrames(0),
+			mArgumentsDepth(0),
+			mErrorMessage(nullptr)
+		{
+			// Nothing here
+		}
+
+		inline ~Preprocessor()
+		{
+			// Nothing here
+		}
+
 		/**
 		*  @brief
 		*    Run a shader source string through the preprocessor
@@ -87,11 +111,116 @@ namespace Renderer
 		*  @param[in] renderer
 		*    Renderer instance to use
 		*  @param[in] source
-		*    Source string
+		*    Source string, must stay valid during the call
 		*  @param[out] result
-		*    Receives the processed code
+		*    Receives the processed code, cleared on error
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (the error has already been written into the log)
+		*/
+		bool preprocess(const IRenderer& renderer, const std::string& source, std::string& result);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t NO_MACRO					  = ~0u;
+		static constexpr uint32_t NUMBER_OF_MACRO_FILTER_BITS = 1024;	///< Must be a power of two
+
+		struct Macro final
+		{
+			std::string_view name;					///< Macro name, view into the source
+			std::string_view body;					///< Unprocessed macro body, view into the source
+			uint32_t		 hash;					///< FNV-1a hash of the macro name
+			uint32_t		 firstParameter;		///< Index of the first parameter inside "mMacroParameters"
+			int32_t			 numberOfParameters;	///< Number of parameters, negative for object-like macros
+			bool			 defined;				///< "false" after "#undef", the macro is kept to be able to reuse its hash table slot
+			bool			 disabled;				///< "true" while the macro is being expanded, prevents endless recursion
+		};
+		typedef std::vector<Macro>			  Macros;
+		typedef std::vector<uint32_t>		  MacroHashTable;	///< Open addressing hash table with linear probing, power of two size, value is index into "mMacros" plus one, zero for empty slots
+		typedef std::vector<std::string_view> MacroParameters;
+
+		/**
+		*  @brief
+		*    Text which is currently read and expanded; frame zero is the source, all further frames are macro expansions
+		*
+		*  @note
+		*    - Frames live inside a "std::deque" and are never destroyed, so the text views into "buffer" stay valid and the buffer memory gets reused
 		*/
-		static void preprocess(const IRenderer& renderer, std::string& source, std::string& result);
+		struct Frame final
+		{
+			std::string_view text;
+			size_t			 position;
+			uint32_t		 macroIndex;	///< Macro to enable again as soon as the frame was popped, "NO_MACRO" if there's none
+			std::string		 buffer;		///< Backing memory for function-like macro expansions
+		};
+		typedef std::deque<Frame> Frames;
+
+		/**
+		*  @brief
+		*    Arguments of a function-like macro invocation, one instance per macro invocation nesting level
+		*/
+		struct Arguments final
+		{
+			std::string			rawText;			///< Concatenated raw arguments
+			std::string			expandedText;		///< Concatenated fully macro-expanded arguments
+			std::vector<size_t> rawOffsets;			///< Begin and end offset pair per argument inside "rawText"
+			std::vector<size_t> expandedOffsets;	///< Begin and end offset pair per argument inside "expandedText"
+		};
+		typedef std::deque<Arguments> ArgumentsStack;
+
+		struct Conditional final
+		{
+			bool active;	///< Is the current group of the conditional active?
+			bool taken;		///< Was a group of the conditional already active or is the parent group inactive?
+			bool hadElse;	///< Was "#else" already seen?
+		};
+		typedef std::vector<Conditional> Conditionals;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit Preprocessor(const Preprocessor&) = delete;
+		Preprocessor& operator=(const Preprocessor&) = delete;
+		[[nodiscard]] inline bool isActive() const
+		{
+			return (mConditionals.empty() || mConditionals.back().active);
+		}
+		[[nodiscard]] uint32_t findMacroSlot(std::string_view name, uint32_t hash) const;
+		[[nodiscard]] uint32_t findMacro(std::string_view name) const;
+		void defineMacro(const Macro& macro);
+		[[nodiscard]] bool processDirective(std::string_view directive, std::string& result);
+		[[nodiscard]] bool processDefine(std::string_view text);
+		[[nodiscard]] bool evaluateExpression(std::string_view text, bool& value);
+		[[nodiscard]] bool expand(size_t baseFrame, std::string& output);
+		[[nodiscard]] bool expandMacro(size_t baseFrame, uint32_t macroIndex, bool& expanded);
+		[[nodiscard]] bool collectArguments(size_t baseFrame, Arguments& arguments);
+		void substituteArguments(const Macro& macro, const Arguments& arguments, std::string& output) const;
+		void pushFrame(std::string_view text, uint32_t macroIndex);
+		void popFrame();
+		bool setError(const char* errorMessage);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Macros				mMacros;
+		MacroHashTable		mMacroHashTable;
+		uint64_t			mMacroFilter[NUMBER_OF_MACRO_FILTER_BITS / 64];	///< Cheap rejection of identifiers which aren't macro names before hashing them, one bit per combination of first character, last character and length
+		MacroParameters		mMacroParameters;
+		Frames				mFrames;
+		size_t				mNumberOfFrames;								///< Number of used frames inside "mFrames"
+		ArgumentsStack		mArgumentsStack;
+		size_t				mArgumentsDepth;								///< Number of used arguments instances inside "mArgumentsStack"
+		Conditionals		mConditionals;
+		std::string			mExpressionSource;								///< Could be a local variable, but when making it to a member we reduce memory allocations
+		std::string			mExpression;									///< Could be a local variable, but when making it to a member we reduce memory allocations
+		const char*			mErrorMessage;									///< Static error message, null pointer if there's no error
 
 
 	};
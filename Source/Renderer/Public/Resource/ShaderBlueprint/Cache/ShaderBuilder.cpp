@@ -51,7 +51,6 @@ THE SOFTWARE.
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
-#include "Renderer/Public/Resource/ShaderBlueprint/Cache/Preprocessor.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
 #include "Renderer/Public/Resource/ShaderPiece/ShaderPieceResourceManager.h"
@@ -937,7 +936,13 @@ namespace Renderer
 		}
 
 		// Apply a C-preprocessor
-		Preprocessor::preprocess(shaderPieceResourceManager.getRenderer(), mInString, mOutString);
+		if (!mPreprocessor.preprocess(shaderPieceResourceManager.getRenderer(), mInString, mOutString))
+		{
+			// Abort, the caller is handling the empty shader source code
+			RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Failed to preprocess the shader blueprint asset \"%s\"", assetManager.getAssetByAssetId(shaderBlueprintResource.getAssetId()).virtualFilename)
+			buildShader.sourceCode.clear();
+			return;
+		}
 
 		// Done
 		buildShader.sourceCode = mOutString;
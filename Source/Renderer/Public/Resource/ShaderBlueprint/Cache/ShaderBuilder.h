@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/Cache/Preprocessor.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -134,7 +135,7 @@ namespace Renderer
 		*  @param[in] shaderProperties
 		*    Shader properties to use
 		*  @param[out] buildShader
-		*    Receives the build shader
+		*    Receives the build shader, the shader source code is empty on error (the error has already been written into the log)
 		*/
 		void createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties, BuildShader& buildShader);
 
@@ -163,6 +164,7 @@ namespace Renderer
 		DynamicShaderPieces	mDynamicShaderPieces;
 		std::string			mInString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
 		std::string			mOutString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
+		Preprocessor		mPreprocessor;	///< Could be a local variable, but when making it to a member we reduce memory allocations
 
 
 	};
@@ -35,6 +35,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
 	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <atomic>
 	#include <vector>
 PRAGMA_WARNING_POP
 
@@ -111,14 +112,30 @@ namespace Renderer
 
 		/**
 		*  @brief
-		*    Return RHI shader
+		*    Return the IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
 		*
 		*  @return
-		*    The RHI shader
+		*    The asset IDs, taken from the master shader cache if there's one
 		*/
-		[[nodiscard]] inline const Rhi::IShaderPtr& getShaderPtr() const
+		[[nodiscard]] inline const AssetIds& getAssetIds() const
 		{
-			return (nullptr != mMasterShaderCache) ? mMasterShaderCache->mShaderPtr : mShaderPtr;
+			return (nullptr != mMasterShaderCache) ? mMasterShaderCache->mAssetIds : mAssetIds;
+		}
+
+		/**
+		*  @brief
+		*    Return RHI shader; thread-safe
+		*
+		*  @return
+		*    The RHI shader, null pointer if there's no RHI shader yet, do not release the returned instance unless you added an own reference to it
+		*
+		*  @note
+		*    - Lookups don't hold "Renderer::ShaderCacheManager::mMutex" and the pipeline state compiler threads create RHI shaders concurrently,
+		*      so the RHI shader is published via an acquire/release pair (see "Renderer::ShaderCache::setShader()")
+		*/
+		[[nodiscard]] inline Rhi::IShader* getShader() const
+		{
+			return ((nullptr != mMasterShaderCache) ? mMasterShaderCache : this)->mShader.load(std::memory_order_acquire);
 		}
 
 
@@ -128,21 +145,30 @@ namespace Renderer
 	private:
 		inline ShaderCache() :
 			mShaderCacheId(getInvalid<ShaderCacheId>()),
-			mMasterShaderCache(nullptr)
+			mMasterShaderCache(nullptr),
+			mCombinedAssetFileHashes(getInvalid<uint64_t>()),
+			mShader(nullptr),
+			mValidationState(ValidationState::VALID)
 		{
 			// Nothing here
 		}
 
 		inline explicit ShaderCache(ShaderCacheId shaderCacheId) :
 			mShaderCacheId(shaderCacheId),
-			mMasterShaderCache(nullptr)
+			mMasterShaderCache(nullptr),
+			mCombinedAssetFileHashes(getInvalid<uint64_t>()),
+			mShader(nullptr),
+			mValidationState(ValidationState::VALID)
 		{
 			// Nothing here
 		}
 
 		inline ShaderCache(ShaderCacheId shaderCacheId, ShaderCache* masterShaderCache) :
 			mShaderCacheId(shaderCacheId),
-			mMasterShaderCache(masterShaderCache)
+			mMasterShaderCache(masterShaderCache),
+			mCombinedAssetFileHashes(getInvalid<uint64_t>()),
+			mShader(nullptr),
+			mValidationState(ValidationState::VALID)
 		{
 			// Nothing here
 		}
@@ -155,17 +181,42 @@ namespace Renderer
 		explicit ShaderCache(const ShaderCache&) = delete;
 		ShaderCache& operator=(const ShaderCache&) = delete;
 
+		inline void setShader(Rhi::IShader* shader)
+		{
+			// Add our reference before publishing the RHI shader, the release store makes the fully created RHI shader visible to acquire loads
+			mShaderPtr = shader;
+			mShader.store(shader, std::memory_order_release);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Validation state of a master shader cache, shader caches loaded from the pipeline state object cache are validated lazily on first use
+		*/
+		enum class ValidationState : uint8_t
+		{
+			VALID,			///< The shader cache is up-to-date
+			NOT_VALIDATED,	///< The shader cache was loaded and the combined asset file hashes haven't been checked yet
+			OUT_OF_DATE		///< The shader cache was loaded but at least one asset which took part in the shader cache creation has changed
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ShaderCacheId		mShaderCacheId;
-		ShaderCache*		mMasterShaderCache;			///< If there's a master shader cache instance, we don't own the references shader but only redirect to it (multiple shader combinations resulting in same shader source code topic), don't destroy the instance
-		AssetIds			mAssetIds;					///< List of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
-		uint64_t			mCombinedAssetFileHashes;	///< Combination of the file hash of all assets (shader blueprint, shader piece) which took part in the shader cache creation
-		Rhi::ShaderBytecode mShaderBytecode;
-		Rhi::IShaderPtr		mShaderPtr;
+		ShaderCacheId					mShaderCacheId;
+		ShaderCache*					mMasterShaderCache;			///< If there's a master shader cache instance, we don't own the references shader but only redirect to it (multiple shader combinations resulting in same shader source code topic), don't destroy the instance
+		AssetIds						mAssetIds;					///< List of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
+		uint64_t						mCombinedAssetFileHashes;	///< Combination of the file hash of all assets (shader blueprint, shader piece) which took part in the shader cache creation
+		Rhi::ShaderBytecode				mShaderBytecode;			///< Shader bytecode, shader caches loaded from the pipeline state object cache reference the bytecode blob owned by the shader cache manager
+		Rhi::IShaderPtr					mShaderPtr;					///< Keeps the RHI shader alive, only written via "Renderer::ShaderCache::setShader()"
+		std::atomic<Rhi::IShader*>		mShader;					///< Published RHI shader, see "Renderer::ShaderCache::getShader()"
+		std::atomic<ValidationState>	mValidationState;			///< Only relevant for master shader caches, see "Renderer::ShaderCacheManager::tryGetShaderCacheById()", atomic since the lazy validation might be triggered by concurrent lookups
 
 
 	};
@@ -35,6 +35,60 @@
 #include "Renderer/Public/IRenderer.h"
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		// The shader caches are stored as index tables followed by one contiguous shader bytecode blob so loading is a handful of bulk reads
+		// -> Asset IDs and shader bytecodes are stored in master shader cache order, the offsets are implicit
+		#pragma pack(push)
+		#pragma pack(1)
+			struct ShaderCacheBlobHeader final
+			{
+				uint32_t numberOfMasterShaderCaches;
+				uint32_t numberOfSlaveShaderCaches;
+				uint32_t numberOfAssetIds;
+				uint32_t numberOfBytecodeBytes;
+				uint32_t numberOfShaderSourceCodeIds;
+			};
+
+			struct MasterShaderCacheHeader final
+			{
+				Renderer::ShaderCacheId shaderCacheId;
+				uint32_t				numberOfAssetIds;
+				uint32_t				numberOfBytes;
+				uint64_t				combinedAssetFileHashes;
+			};
+
+			struct SlaveShaderCacheHeader final
+			{
+				Renderer::ShaderCacheId shaderCacheId;
+				Renderer::ShaderCacheId masterShaderCacheId;
+			};
+
+			struct ShaderSourceCodeIdHeader final
+			{
+				Renderer::ShaderSourceCodeId shaderSourceCodeId;
+				Renderer::ShaderCacheId		 shaderCacheId;
+			};
+		#pragma pack(pop)
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -56,19 +110,28 @@ namespace Renderer
 			// Get the shader cache identifier, often but not always identical to the shader combination ID
 			const ShaderCacheId shaderCacheId = graphicsPipelineStateSignature.getShaderCombinationId(graphicsShaderType);
 
+			{ // Fast path: The shader cache already exists and has a RHI shader instance, lookups don't need the manager mutex since the RHI shader instance is published with release semantic
+				shaderCache = tryGetShaderCacheById(shaderCacheId);
+				ShaderCache* masterShaderCache = (nullptr != shaderCache && nullptr != shaderCache->getMasterShaderCache()) ? shaderCache->getMasterShaderCache() : shaderCache;
+				if (nullptr != masterShaderCache && nullptr != masterShaderCache->getShader())
+				{
+					return masterShaderCache;
+				}
+			}
+
 			// Does the shader cache already exist?
+			// -> Look it up again while holding the manager mutex, another thread might have created the shader cache in between
 			std::unique_lock<std::mutex> mutexLock(mMutex);
-			ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = mShaderCacheByShaderCacheId.find(shaderCacheId);
-			if (shaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
+			shaderCache = tryGetShaderCacheById(shaderCacheId);
+			if (nullptr != shaderCache)
 			{
-				shaderCache = shaderCacheIdIterator->second;
 				if (nullptr != shaderCache->getMasterShaderCache())
 				{
 					shaderCache = shaderCache->getMasterShaderCache();
 				}
 
 				// Create RHI shader instance using the shader bytecode, if necessary
-				if (nullptr == shaderCache->mShaderPtr.getPointer())
+				if (nullptr == shaderCache->getShader())
 				{
 					ASSERT(0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
 					if (0 != shaderCache->mShaderBytecode.getNumberOfBytes())
@@ -78,24 +141,24 @@ namespace Renderer
 							case GraphicsShaderType::Vertex:
 							{
 								const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
-								shaderCache->mShaderPtr = shaderLanguage.createVertexShaderFromBytecode(vertexAttributes, shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+								shaderCache->setShader(shaderLanguage.createVertexShaderFromBytecode(vertexAttributes, shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode")));
 								break;
 							}
 
 							case GraphicsShaderType::TessellationControl:
-								shaderCache->mShaderPtr = shaderLanguage.createTessellationControlShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+								shaderCache->setShader(shaderLanguage.createTessellationControlShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode")));
 								break;
 
 							case GraphicsShaderType::TessellationEvaluation:
-								shaderCache->mShaderPtr = shaderLanguage.createTessellationEvaluationShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+								shaderCache->setShader(shaderLanguage.createTessellationEvaluationShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode")));
 								break;
 
 							case GraphicsShaderType::Geometry:
-								shaderCache->mShaderPtr = shaderLanguage.createGeometryShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+								shaderCache->setShader(shaderLanguage.createGeometryShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode")));
 								break;
 
 							case GraphicsShaderType::Fragment:
-								shaderCache->mShaderPtr = shaderLanguage.createFragmentShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+								shaderCache->setShader(shaderLanguage.createFragmentShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode")));
 								break;
 						}
 					}
@@ -128,13 +191,13 @@ namespace Renderer
 						// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 						// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 						const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-						ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-						if (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.cend())
+						ShaderCache* masterShaderCache = tryGetShaderCacheByShaderSourceCodeId(shaderSourceCodeId);
+						if (nullptr != masterShaderCache)
 						{
 							// Reuse already existing shader instance
 							// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-							shaderCache = new ShaderCache(shaderCacheId, mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-							mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+							shaderCache = new ShaderCache(shaderCacheId, masterShaderCache);
+							mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
 							mCacheNeedsSaving = true;
 						}
 						else
@@ -174,9 +237,9 @@ namespace Renderer
 							if (nullptr != shader)
 							{
 								ASSERT(!shaderLanguage.getRhi().getCapabilities().shaderBytecode || 0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "Invalid shader bytecode received from RHI implementation")
-								shaderCache->mShaderPtr = shader;
-								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+								shaderCache->setShader(shader);
+								mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
+								mShaderCacheByShaderSourceCodeId.insert(shaderSourceCodeId, shaderCache);
 								mCacheNeedsSaving = true;
 							}
 							else
@@ -212,22 +275,31 @@ namespace Renderer
 			// Get the shader cache identifier, often but not always identical to the shader combination ID
 			const ShaderCacheId shaderCacheId = computePipelineStateSignature.getShaderCombinationId();
 
+			{ // Fast path: The shader cache already exists and has a RHI shader instance, lookups don't need the manager mutex since the RHI shader instance is published with release semantic
+				shaderCache = tryGetShaderCacheById(shaderCacheId);
+				ShaderCache* masterShaderCache = (nullptr != shaderCache && nullptr != shaderCache->getMasterShaderCache()) ? shaderCache->getMasterShaderCache() : shaderCache;
+				if (nullptr != masterShaderCache && nullptr != masterShaderCache->getShader())
+				{
+					return masterShaderCache;
+				}
+			}
+
 			// Does the shader cache already exist?
+			// -> Look it up again while holding the manager mutex, another thread might have created the shader cache in between
 			std::unique_lock<std::mutex> mutexLock(mMutex);
-			ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = mShaderCacheByShaderCacheId.find(shaderCacheId);
-			if (shaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
+			shaderCache = tryGetShaderCacheById(shaderCacheId);
+			if (nullptr != shaderCache)
 			{
-				shaderCache = shaderCacheIdIterator->second;
 				if (nullptr != shaderCache->getMasterShaderCache())
 				{
 					shaderCache = shaderCache->getMasterShaderCache();
 				}
 
 				// Create RHI shader instance using the shader bytecode, if necessary
-				if (nullptr == shaderCache->mShaderPtr.getPointer())
+				if (nullptr == shaderCache->getShader())
 				{
 					ASSERT(0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-					shaderCache->mShaderPtr = shaderLanguage.createComputeShaderFromBytecode(shaderCache->mShaderBytecode);
+					shaderCache->setShader(shaderLanguage.createComputeShaderFromBytecode(shaderCache->mShaderBytecode));
 				}
 			}
 			else
@@ -257,13 +329,13 @@ namespace Renderer
 						// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 						// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 						const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-						ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-						if (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.cend())
+						ShaderCache* masterShaderCache = tryGetShaderCacheByShaderSourceCodeId(shaderSourceCodeId);
+						if (nullptr != masterShaderCache)
 						{
 							// Reuse already existing shader instance
 							// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-							shaderCache = new ShaderCache(shaderCacheId, mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-							mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+							shaderCache = new ShaderCache(shaderCacheId, masterShaderCache);
+							mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
 							mCacheNeedsSaving = true;
 						}
 						else
@@ -278,9 +350,9 @@ namespace Renderer
 							if (nullptr != shader)
 							{
 								ASSERT(!shaderLanguage.getRhi().getCapabilities().shaderBytecode || 0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "Invalid shader bytecode received from RHI implementation")
-								shaderCache->mShaderPtr = shader;
-								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+								shaderCache->setShader(shader);
+								mShaderCacheByShaderCacheId.insert(shaderCacheId, shaderCache);
+								mShaderCacheByShaderSourceCodeId.insert(shaderSourceCodeId, shaderCache);
 								mCacheNeedsSaving = true;
 							}
 							else
@@ -308,137 +380,97 @@ namespace Renderer
 	void ShaderCacheManager::clearCache()
 	{
 		std::unique_lock<std::mutex> mutexLock(mMutex);
-		if (!mShaderCacheByShaderCacheId.empty() || !mShaderCacheByShaderSourceCodeId.empty())
+		std::lock_guard<std::mutex> outOfDateShaderCachesMutexLock(mOutOfDateShaderCachesMutex);
+		if (!mShaderCacheByShaderCacheId.empty() || !mShaderCacheByShaderSourceCodeId.empty() || !mOutOfDateShaderCaches.empty())
 		{
-			for (auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+			mShaderCacheByShaderCacheId.forEach([](ShaderCacheId, ShaderCache* shaderCache)
 			{
-				delete shaderCacheElement.second;
+				delete shaderCache;
+			});
+			for (ShaderCache* shaderCache : mOutOfDateShaderCaches)
+			{
+				delete shaderCache;
 			}
 			mShaderCacheByShaderCacheId.clear();
 			mShaderCacheByShaderSourceCodeId.clear();
+			mOutOfDateShaderCaches.clear();
 			mCacheNeedsSaving = true;
 		}
+
+		// The shader cache instances referencing the bytecode blob are gone, so release it as well
+		BytecodeBlob().swap(mBytecodeBlob);
 	}
 
 	void ShaderCacheManager::loadCache(IFile& file)
 	{
-		// TODO(co) This can certainly be implemented in a more efficient way. For instance, we could store all shader bytecodes inside a LZ4 compressed buffer and let shader caches directly point into this buffer.
-		typedef std::unordered_set<ShaderCacheId> OutOfDateShaderCacheIds;
-		OutOfDateShaderCacheIds outOfDateShaderCacheIds;
-		const AssetManager& assetManager = mShaderBlueprintResourceManager.getRenderer().getAssetManager();
-
-		{ // Load shader caches
-			uint32_t numberOfShaderCaches = getInvalid<uint32_t>();
-			file.read(&numberOfShaderCaches, sizeof(uint32_t));
-			mShaderCacheByShaderCacheId.reserve(numberOfShaderCaches);
-			std::vector<uint8_t> bytecode;
-			AssetIds assetIds;
-			for (uint32_t i = 0; i < numberOfShaderCaches; ++i)
+		ASSERT(mShaderCacheByShaderCacheId.empty() && mBytecodeBlob.empty(), "The shader cache must be cleared before it can be loaded")
+
+		// Read the index tables, the asset IDs and the shader bytecode blob using a handful of bulk reads
+		::detail::ShaderCacheBlobHeader shaderCacheBlobHeader;
+		file.read(&shaderCacheBlobHeader, sizeof(::detail::ShaderCacheBlobHeader));
+		std::vector<::detail::MasterShaderCacheHeader> masterShaderCacheHeaders(shaderCacheBlobHeader.numberOfMasterShaderCaches);
+		file.read(masterShaderCacheHeaders.data(), sizeof(::detail::MasterShaderCacheHeader) * shaderCacheBlobHeader.numberOfMasterShaderCaches);
+		std::vector<::detail::SlaveShaderCacheHeader> slaveShaderCacheHeaders(shaderCacheBlobHeader.numberOfSlaveShaderCaches);
+		file.read(slaveShaderCacheHeaders.data(), sizeof(::detail::SlaveShaderCacheHeader) * shaderCacheBlobHeader.numberOfSlaveShaderCaches);
+		AssetIds assetIds(shaderCacheBlobHeader.numberOfAssetIds);
+		file.read(assetIds.data(), sizeof(AssetId) * shaderCacheBlobHeader.numberOfAssetIds);
+		mBytecodeBlob.resize(shaderCacheBlobHeader.numberOfBytecodeBytes);
+		file.read(mBytecodeBlob.data(), shaderCacheBlobHeader.numberOfBytecodeBytes);
+		std::vector<::detail::ShaderSourceCodeIdHeader> shaderSourceCodeIdHeaders(shaderCacheBlobHeader.numberOfShaderSourceCodeIds);
+		file.read(shaderSourceCodeIdHeaders.data(), sizeof(::detail::ShaderSourceCodeIdHeader) * shaderCacheBlobHeader.numberOfShaderSourceCodeIds);
+
+		{ // Create the master shader caches
+		  // -> The shader bytecode isn't copied, the shader caches directly reference the shader bytecode blob
+		  // -> Checking whether or not a shader cache is still up-to-date is done lazily on first use, see "Renderer::ShaderCacheManager::tryGetShaderCacheById()"
+			mShaderCacheByShaderCacheId.reserve(shaderCacheBlobHeader.numberOfMasterShaderCaches + shaderCacheBlobHeader.numberOfSlaveShaderCaches);
+			uint32_t assetIdOffset = 0;
+			uint32_t bytecodeOffset = 0;
+			for (const ::detail::MasterShaderCacheHeader& masterShaderCacheHeader : masterShaderCacheHeaders)
 			{
-				ShaderCache* shaderCache = nullptr;
-
-				// Load shader cache
-				ShaderCacheId shaderCacheId = getInvalid<ShaderCacheId>();
-				file.read(&shaderCacheId, sizeof(ShaderCacheId));
-				uint32_t numberOfBytes = getInvalid<uint32_t>();
-				file.read(&numberOfBytes, sizeof(uint32_t));
-				if (isValid(numberOfBytes))
+				ASSERT(0 != masterShaderCacheHeader.numberOfAssetIds, "Invalid number of asset IDs")
+				ASSERT(0 != masterShaderCacheHeader.numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
+				if (assetIdOffset + masterShaderCacheHeader.numberOfAssetIds > shaderCacheBlobHeader.numberOfAssetIds || bytecodeOffset + masterShaderCacheHeader.numberOfBytes > shaderCacheBlobHeader.numberOfBytecodeBytes)
 				{
-					// Master shader cache
-
-					// Load list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
-					uint32_t numberOfAssetIds = getInvalid<uint32_t>();
-					file.read(&numberOfAssetIds, sizeof(uint32_t));
-					ASSERT(0 != numberOfAssetIds, "Invalid number of asset IDs")
-					assetIds.resize(numberOfAssetIds);
-					file.read(assetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
-					uint64_t combinedAssetFileHashes = getInvalid<uint64_t>();
-					file.read(&combinedAssetFileHashes, sizeof(uint64_t));
-
-					// Check whether or not the shader cache is still valid
-					uint64_t currentCombinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
-					for (AssetId assetId : assetIds)
-					{
-						const Asset* asset = assetManager.tryGetAssetByAssetId(assetId);
-						if (nullptr != asset)
-						{
-							currentCombinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), currentCombinedAssetFileHashes);
-						}
-					}
-					if (currentCombinedAssetFileHashes != combinedAssetFileHashes)
-					{
-						// Shader cache is out-of-date
-						file.skip(numberOfBytes);
-						outOfDateShaderCacheIds.insert(shaderCacheId);
-					}
-					else
-					{
-						// Shader cache is still valid
-
-						// Create shader cache instance
-						shaderCache = new ShaderCache(shaderCacheId);
-						shaderCache->mAssetIds = assetIds;
-						shaderCache->mCombinedAssetFileHashes = combinedAssetFileHashes;
-
-						// Load shader bytecode
-						ASSERT(0 != numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-						if (0 != numberOfBytes)
-						{
-							bytecode.resize(numberOfBytes);
-							file.read(bytecode.data(), numberOfBytes);
-							shaderCache->mShaderBytecode.setBytecodeCopy(numberOfBytes, bytecode.data());
-						}
-					}
-				}
-				else
-				{
-					ShaderCacheId masterShaderCacheId = getInvalid<ShaderCacheId>();
-					file.read(&masterShaderCacheId, sizeof(ShaderCacheId));
-					if (outOfDateShaderCacheIds.find(masterShaderCacheId) == outOfDateShaderCacheIds.cend())
-					{
-						// Shader cache is still valid
-						ShaderCacheByShaderCacheId::const_iterator masterShaderCacheIdIterator = mShaderCacheByShaderCacheId.find(masterShaderCacheId);
-						if (masterShaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
-						{
-							// Create shader cache instance
-							shaderCache = new ShaderCache(shaderCacheId);
-							shaderCache->mMasterShaderCache = masterShaderCacheIdIterator->second;
-						}
-						else
-						{
-							// Error!
-							ASSERT(false, "The shader cache is corrupt since a master shader cache is referenced which doesn't exist")
-						}
-					}
-					else
-					{
-						// Shader cache is out-of-date
-						outOfDateShaderCacheIds.insert(shaderCacheId);
-					}
+					// Error!
+					ASSERT(false, "The shader cache is corrupt since a master shader cache is referencing data outside of the shader bytecode blob")
+					break;
 				}
 
-				// Register shader cache
-				if (nullptr != shaderCache)
-				{
-					mShaderCacheByShaderCacheId.emplace(shaderCache->mShaderCacheId, shaderCache);
-				}
+				// Create shader cache instance
+				ShaderCache* shaderCache = new ShaderCache(masterShaderCacheHeader.shaderCacheId);
+				shaderCache->mAssetIds.assign(assetIds.cbegin() + assetIdOffset, assetIds.cbegin() + assetIdOffset + masterShaderCacheHeader.numberOfAssetIds);
+				shaderCache->mCombinedAssetFileHashes = masterShaderCacheHeader.combinedAssetFileHashes;
+				shaderCache->mShaderBytecode.setBytecodeReference(masterShaderCacheHeader.numberOfBytes, mBytecodeBlob.data() + bytecodeOffset);
+				shaderCache->mValidationState = ShaderCache::ValidationState::NOT_VALIDATED;
+				mShaderCacheByShaderCacheId.insert(masterShaderCacheHeader.shaderCacheId, shaderCache);
+				assetIdOffset += masterShaderCacheHeader.numberOfAssetIds;
+				bytecodeOffset += masterShaderCacheHeader.numberOfBytes;
 			}
 		}
 
-		{ // Load shader source code ID to shader cache ID mapping
-			uint32_t numberOfElements = getInvalid<uint32_t>();
-			file.read(&numberOfElements, sizeof(uint32_t));
-			mShaderCacheByShaderSourceCodeId.reserve(numberOfElements);
-			for (uint32_t i = 0; i < numberOfElements; ++i)
+		// Create the shader caches with a master shader cache
+		for (const ::detail::SlaveShaderCacheHeader& slaveShaderCacheHeader : slaveShaderCacheHeaders)
+		{
+			ShaderCache* masterShaderCache = nullptr;
+			if (mShaderCacheByShaderCacheId.tryGet(slaveShaderCacheHeader.masterShaderCacheId, masterShaderCache))
+			{
+				mShaderCacheByShaderCacheId.insert(slaveShaderCacheHeader.shaderCacheId, new ShaderCache(slaveShaderCacheHeader.shaderCacheId, masterShaderCache));
+			}
+			else
 			{
-				ShaderSourceCodeId shaderSourceCodeId = getInvalid<ShaderSourceCodeId>();
-				file.read(&shaderSourceCodeId, sizeof(ShaderSourceCodeId));
-				ShaderCacheId shaderCacheId = getInvalid<ShaderCacheId>();
-				file.read(&shaderCacheId, sizeof(ShaderCacheId));
-				if (outOfDateShaderCacheIds.find(shaderCacheId) == outOfDateShaderCacheIds.cend())
+				// Error!
+				ASSERT(false, "The shader cache is corrupt since a master shader cache is referenced which doesn't exist")
+			}
+		}
+
+		{ // Load shader source code ID to shader cache mapping
+			mShaderCacheByShaderSourceCodeId.reserve(shaderCacheBlobHeader.numberOfShaderSourceCodeIds);
+			for (const ::detail::ShaderSourceCodeIdHeader& shaderSourceCodeIdHeader : shaderSourceCodeIdHeaders)
+			{
+				ShaderCache* shaderCache = nullptr;
+				if (mShaderCacheByShaderCacheId.tryGet(shaderSourceCodeIdHeader.shaderCacheId, shaderCache))
 				{
-					// Shader cache is still valid
-					mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+					mShaderCacheByShaderSourceCodeId.insert(shaderSourceCodeIdHeader.shaderSourceCodeId, shaderCache);
 				}
 			}
 		}
@@ -449,66 +481,143 @@ namespace Renderer
 
 	void ShaderCacheManager::saveCache(IFile& file)
 	{
-		{ // Save shader caches
-		  // -> Shader caches with a master shader cache must come last to ensure the master is already loaded
-			const uint32_t numberOfShaderCaches = static_cast<uint32_t>(mShaderCacheByShaderCacheId.size());
-			file.write(&numberOfShaderCaches, sizeof(uint32_t));
-			std::vector<const ShaderCache*> shaderCachesWithMaster;
-			for (auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+		// Gather the shader caches to save
+		// -> Out-of-date shader caches which weren't used yet are dropped, shader caches which weren't validated yet are saved as they are and validated on next use
+		// -> Master shader caches must come first to ensure the master is already created when loading a shader cache with a master
+		std::vector<const ShaderCache*> masterShaderCaches;
+		std::vector<::detail::SlaveShaderCacheHeader> slaveShaderCacheHeaders;
+		::detail::ShaderCacheBlobHeader shaderCacheBlobHeader = {};
+		mShaderCacheByShaderCacheId.forEach([&masterShaderCaches, &slaveShaderCacheHeaders, &shaderCacheBlobHeader](ShaderCacheId, const ShaderCache* shaderCache)
+		{
+			const ShaderCache* masterShaderCache = shaderCache->getMasterShaderCache();
+			if (nullptr == masterShaderCache)
 			{
-				const ShaderCache* shaderCache = shaderCacheElement.second;
-				if (nullptr == shaderCache->getMasterShaderCache())
+				if (ShaderCache::ValidationState::OUT_OF_DATE != shaderCache->mValidationState)
 				{
-					// Master shader cache
-					const Rhi::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
-					const uint32_t numberOfBytes = shaderBytecode.getNumberOfBytes();
-					ASSERT(0 != numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-					file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
-					file.write(&numberOfBytes, sizeof(uint32_t));
-
-					// Write list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
-					const uint32_t numberOfAssetIds = static_cast<uint32_t>(shaderCache->mAssetIds.size());
-					ASSERT(0 != numberOfAssetIds, "Invalid number of asset IDs")
-					file.write(&numberOfAssetIds, sizeof(uint32_t));
-					file.write(shaderCache->mAssetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
-					file.write(&shaderCache->mCombinedAssetFileHashes, sizeof(uint64_t));
-
-					// Write shader bytecode
-					if (0 != numberOfBytes)
-					{
-						file.write(shaderBytecode.getBytecode(), numberOfBytes);
-					}
-				}
-				else
-				{
-					shaderCachesWithMaster.push_back(shaderCache);
+					ASSERT(0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
+					ASSERT(!shaderCache->mAssetIds.empty(), "Invalid number of asset IDs")
+					masterShaderCaches.push_back(shaderCache);
+					shaderCacheBlobHeader.numberOfAssetIds += static_cast<uint32_t>(shaderCache->mAssetIds.size());
+					shaderCacheBlobHeader.numberOfBytecodeBytes += shaderCache->mShaderBytecode.getNumberOfBytes();
 				}
 			}
-			for (const ShaderCache* shaderCache : shaderCachesWithMaster)
+			else if (ShaderCache::ValidationState::OUT_OF_DATE != masterShaderCache->mValidationState)
 			{
-				const ShaderCache* masterShaderCache = shaderCache->getMasterShaderCache();
-				ASSERT(nullptr != masterShaderCache->getShaderPtr().getPointer(), "A shader cache must always have a valid shader instance, else it's a pointless shader cache")
-				file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
-				const uint32_t numberOfBytes = getInvalid<uint32_t>();
-				file.write(&numberOfBytes, sizeof(uint32_t));
-				file.write(&masterShaderCache->mShaderCacheId, sizeof(ShaderCacheId));
+				ASSERT(nullptr != masterShaderCache->getShader() || 0 != masterShaderCache->mShaderBytecode.getNumberOfBytes(), "A shader cache must always have a valid shader instance, else it's a pointless shader cache")
+				slaveShaderCacheHeaders.push_back({ shaderCache->mShaderCacheId, masterShaderCache->mShaderCacheId });
 			}
+		});
+		std::vector<::detail::ShaderSourceCodeIdHeader> shaderSourceCodeIdHeaders;
+		shaderSourceCodeIdHeaders.reserve(mShaderCacheByShaderSourceCodeId.size());
+		mShaderCacheByShaderSourceCodeId.forEach([&shaderSourceCodeIdHeaders](ShaderSourceCodeId shaderSourceCodeId, const ShaderCache* masterShaderCache)
+		{
+			if (ShaderCache::ValidationState::OUT_OF_DATE != masterShaderCache->mValidationState)
+			{
+				shaderSourceCodeIdHeaders.push_back({ shaderSourceCodeId, masterShaderCache->mShaderCacheId });
+			}
+		});
+		shaderCacheBlobHeader.numberOfMasterShaderCaches = static_cast<uint32_t>(masterShaderCaches.size());
+		shaderCacheBlobHeader.numberOfSlaveShaderCaches = static_cast<uint32_t>(slaveShaderCacheHeaders.size());
+		shaderCacheBlobHeader.numberOfShaderSourceCodeIds = static_cast<uint32_t>(shaderSourceCodeIdHeaders.size());
+
+		// Write the index tables
+		file.write(&shaderCacheBlobHeader, sizeof(::detail::ShaderCacheBlobHeader));
+		for (const ShaderCache* shaderCache : masterShaderCaches)
+		{
+			const ::detail::MasterShaderCacheHeader masterShaderCacheHeader = { shaderCache->mShaderCacheId, static_cast<uint32_t>(shaderCache->mAssetIds.size()), shaderCache->mShaderBytecode.getNumberOfBytes(), shaderCache->mCombinedAssetFileHashes };
+			file.write(&masterShaderCacheHeader, sizeof(::detail::MasterShaderCacheHeader));
+		}
+		file.write(slaveShaderCacheHeaders.data(), sizeof(::detail::SlaveShaderCacheHeader) * shaderCacheBlobHeader.numberOfSlaveShaderCaches);
+
+		// Write list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
+		for (const ShaderCache* shaderCache : masterShaderCaches)
+		{
+			file.write(shaderCache->mAssetIds.data(), sizeof(AssetId) * shaderCache->mAssetIds.size());
 		}
 
-		{ // Save shader source code ID to shader cache ID mapping
-			const uint32_t numberOfElements = static_cast<uint32_t>(mShaderCacheByShaderSourceCodeId.size());
-			file.write(&numberOfElements, sizeof(uint32_t));
-			for (auto& element : mShaderCacheByShaderSourceCodeId)
+		// Write the shader bytecode blob
+		for (const ShaderCache* shaderCache : masterShaderCaches)
+		{
+			const Rhi::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
+			if (0 != shaderBytecode.getNumberOfBytes())
 			{
-				file.write(&element.first, sizeof(ShaderSourceCodeId));
-				file.write(&element.second, sizeof(ShaderCacheId));
+				file.write(shaderBytecode.getBytecode(), shaderBytecode.getNumberOfBytes());
 			}
 		}
 
+		// Write shader source code ID to shader cache ID mapping
+		file.write(shaderSourceCodeIdHeaders.data(), sizeof(::detail::ShaderSourceCodeIdHeader) * shaderCacheBlobHeader.numberOfShaderSourceCodeIds);
+
 		// Done
 		mCacheNeedsSaving = false;
 	}
 
+	ShaderCache* ShaderCacheManager::tryGetShaderCacheById(ShaderCacheId shaderCacheId)
+	{
+		ShaderCache* shaderCache = nullptr;
+		if (!mShaderCacheByShaderCacheId.tryGet(shaderCacheId, shaderCache))
+		{
+			return nullptr;
+		}
+		ShaderCache* masterShaderCache = (nullptr != shaderCache->mMasterShaderCache) ? shaderCache->mMasterShaderCache : shaderCache;
+		if (isShaderCacheUpToDate(*masterShaderCache))
+		{
+			return shaderCache;
+		}
+
+		// Shader cache is out-of-date, unregister it so the caller creates it again
+		// -> The instance itself is kept alive until the cache gets cleared since shader caches with a master shader cache might still reference it
+		// -> Only the thread which actually unregisters the shader cache takes care of it, concurrent lookups might have seen the same out-of-date shader cache
+		if (mShaderCacheByShaderCacheId.erase(shaderCacheId, shaderCache))
+		{
+			std::lock_guard<std::mutex> outOfDateShaderCachesMutexLock(mOutOfDateShaderCachesMutex);
+			mOutOfDateShaderCaches.push_back(shaderCache);
+			mCacheNeedsSaving = true;
+		}
+		return nullptr;
+	}
+
+	ShaderCache* ShaderCacheManager::tryGetShaderCacheByShaderSourceCodeId(ShaderSourceCodeId shaderSourceCodeId)
+	{
+		ShaderCache* masterShaderCache = nullptr;
+		if (!mShaderCacheByShaderSourceCodeId.tryGet(shaderSourceCodeId, masterShaderCache))
+		{
+			return nullptr;
+		}
+		if (isShaderCacheUpToDate(*masterShaderCache))
+		{
+			return masterShaderCache;
+		}
+
+		// Shader cache is out-of-date, drop the mapping
+		if (mShaderCacheByShaderSourceCodeId.erase(shaderSourceCodeId, masterShaderCache))
+		{
+			mCacheNeedsSaving = true;
+		}
+		return nullptr;
+	}
+
+	bool ShaderCacheManager::isShaderCacheUpToDate(ShaderCache& masterShaderCache) const
+	{
+		if (ShaderCache::ValidationState::NOT_VALIDATED == masterShaderCache.mValidationState)
+		{
+			// Check whether or not the loaded shader cache is still valid
+			// -> Concurrent lookups might validate the same shader cache at the same time, which is fine since they all come to the same result
+			const AssetManager& assetManager = mShaderBlueprintResourceManager.getRenderer().getAssetManager();
+			uint64_t currentCombinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
+			for (AssetId assetId : masterShaderCache.mAssetIds)
+			{
+				const Asset* asset = assetManager.tryGetAssetByAssetId(assetId);
+				if (nullptr != asset)
+				{
+					currentCombinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), currentCombinedAssetFileHashes);
+				}
+			}
+			masterShaderCache.mValidationState = (currentCombinedAssetFileHashes == masterShaderCache.mCombinedAssetFileHashes) ? ShaderCache::ValidationState::VALID : ShaderCache::ValidationState::OUT_OF_DATE;
+		}
+		return (ShaderCache::ValidationState::OUT_OF_DATE != masterShaderCache.mValidationState);
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
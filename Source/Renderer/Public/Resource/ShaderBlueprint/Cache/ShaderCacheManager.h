@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Core/Manager.h"
+#include "Renderer/Public/Core/Thread/ShardedHashMap.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/GraphicsShaderType.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -38,7 +39,8 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
 	#include <mutex>
-	#include <unordered_map>
+	#include <atomic>
+	#include <vector>
 PRAGMA_WARNING_POP
 
 
@@ -146,6 +148,23 @@ namespace Renderer
 		*/
 		[[nodiscard]] ShaderCache* getComputeShaderCache(const ComputePipelineStateSignature& computePipelineStateSignature, const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShaderLanguage& shaderLanguage);
 
+		/**
+		*  @brief
+		*    Return the lock statistics of the shader cache ID lookups, can be used to monitor the contention during permutation storms
+		*
+		*  @return
+		*    The lock statistics, only a snapshot since the builder threads might be still running
+		*/
+		[[nodiscard]] inline ShardedHashMapStatistics getShaderCacheLookupStatistics() const
+		{
+			return mShaderCacheByShaderCacheId.getStatistics();
+		}
+
+		inline void resetShaderCacheLookupStatistics()
+		{
+			mShaderCacheByShaderCacheId.resetStatistics();
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -178,13 +197,54 @@ namespace Renderer
 
 		void saveCache(IFile& file);
 
+		/**
+		*  @brief
+		*    Return a shader cache by its ID and perform the lazy validation of loaded shader caches; thread-safe, the caller doesn't need to hold "mMutex"
+		*
+		*  @param[in] shaderCacheId
+		*    ID of the shader cache to return
+		*
+		*  @return
+		*    The shader cache, null pointer if there's none or it's out-of-date, don't destroy the instance
+		*
+		*  @note
+		*    - An out-of-date shader cache is unregistered, the caller is responsible for creating it again
+		*/
+		[[nodiscard]] ShaderCache* tryGetShaderCacheById(ShaderCacheId shaderCacheId);
+
+		/**
+		*  @brief
+		*    Return the master shader cache by shader source code ID and perform the lazy validation of loaded shader caches; thread-safe, the caller doesn't need to hold "mMutex"
+		*
+		*  @param[in] shaderSourceCodeId
+		*    Shader source code ID
+		*
+		*  @return
+		*    The master shader cache, null pointer if there's none or it's out-of-date, don't destroy the instance
+		*/
+		[[nodiscard]] ShaderCache* tryGetShaderCacheByShaderSourceCodeId(ShaderSourceCodeId shaderSourceCodeId);
+
+		/**
+		*  @brief
+		*    Check whether or not a master shader cache is up-to-date, validates a loaded master shader cache on first call
+		*
+		*  @param[in] masterShaderCache
+		*    Master shader cache to check
+		*
+		*  @return
+		*    "true" if the master shader cache is up-to-date, else "false"
+		*/
+		[[nodiscard]] bool isShaderCacheUpToDate(ShaderCache& masterShaderCache) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::unordered_map<ShaderCacheId, ShaderCache*>		  ShaderCacheByShaderCacheId;
-		typedef std::unordered_map<ShaderSourceCodeId, ShaderCacheId> ShaderCacheByShaderSourceCodeId;
+		typedef ShardedHashMap<ShaderCacheId, ShaderCache*>		 ShaderCacheByShaderCacheId;
+		typedef ShardedHashMap<ShaderSourceCodeId, ShaderCache*> ShaderCacheByShaderSourceCodeId;
+		typedef std::vector<ShaderCache*>						 ShaderCaches;
+		typedef std::vector<uint8_t>							 BytecodeBlob;
 
 
 	//[-------------------------------------------------------]
@@ -193,9 +253,12 @@ namespace Renderer
 	private:
 		ShaderBlueprintResourceManager& mShaderBlueprintResourceManager;	///< Owner shader blueprint resource manager
 		ShaderCacheByShaderCacheId		mShaderCacheByShaderCacheId;		///< Manages the shader cache instances
-		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	///< Shader source code ID to shader cache ID mapping
-		bool							mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
-		std::mutex						mMutex;								///< Mutex due to "Renderer::GraphicsPipelineStateCompiler" and "Renderer::ComputePipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
+		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	///< Shader source code ID to master shader cache mapping, don't destroy the instances
+		ShaderCaches					mOutOfDateShaderCaches;				///< Unregistered out-of-date shader cache instances, destroyed when the cache gets cleared since shader caches with a master shader cache might still reference them
+		std::mutex						mOutOfDateShaderCachesMutex;		///< Mutex for "mOutOfDateShaderCaches", the lazy validation might unregister shader caches during lookups which don't hold "mMutex"
+		BytecodeBlob					mBytecodeBlob;						///< Contiguous shader bytecode of all loaded master shader caches, the loaded shader caches reference into it
+		std::atomic<bool>				mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
+		std::mutex						mMutex;								///< Mutex due to "Renderer::GraphicsPipelineStateCompiler" and "Renderer::ComputePipelineStateCompiler" interaction, only serializes the creation of new shader caches so checking and inserting is one step, lookups go through the concurrent maps without it
 
 
 	};
@@ -194,13 +194,6 @@ namespace Renderer
 		const uint32_t numberOfLevels = masterCrnTextureInfo.m_levels;
 		mDataContainsMipmaps = (numberOfLevels > 1);
 
-		crnd::crnd_unpack_context crndUnpackContext = crnd::crnd_unpack_begin(mFileData + masterSliceFileMetadata.offset, masterSliceFileMetadata.numberOfBytes);
-		if (nullptr == crndUnpackContext)
-		{
-			RHI_ASSERT(mRenderer.getContext(), false, "crnd_unpack_begin() failed")
-			return;
-		}
-
 		// Handle optional top mipmap removal
 		// TODO(co) Possible optimization of optional top mipmap removal: Don't load in the skipped mipmaps into memory in the first place ("mFileData")
 		int startLevelIndex = mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove();
@@ -250,16 +243,15 @@ namespace Renderer
 		//   Mip1: Face0, Face1, Face2, Face3, Face4, Face5
 		//   etc.
 
-		// Now transcode all face and mipmap levels into memory, one mip level at a time
+		// Gather the CRN slices to transcode
+		mCrnSlices.clear();
 		for (uint32_t sliceIndex = 0; sliceIndex < mNumberOfSlices; ++sliceIndex)
 		{
-			// Start CRN unpack context
-			if (sliceIndex > 0)
-			{
-				const SliceFileMetadata& sliceFileMetadata = mSliceFileMetadata[sliceIndex];
+			const SliceFileMetadata& sliceFileMetadata = mSliceFileMetadata[sliceIndex];
 
-				// Ensure the texture data matches the master texture data
-				#ifdef RHI_DEBUG
+			// Ensure the texture data matches the master texture data
+			#ifdef RHI_DEBUG
+				if (sliceIndex > 0)
 				{
 					crnd::crn_texture_info crnTextureInfo;
 					if (!crnd::crnd_get_texture_info(mFileData + sliceFileMetadata.offset, sliceFileMetadata.numberOfBytes, &crnTextureInfo))
@@ -269,49 +261,17 @@ namespace Renderer
 					}
 					RHI_ASSERT(mRenderer.getContext(), memcmp(&masterCrnTextureInfo, &crnTextureInfo, sizeof(crnd::crn_texture_info)) == 0, "CRN texture information mismatch")
 				}
-				#endif
-
-				// Start CRN unpack context
-				crndUnpackContext = crnd::crnd_unpack_begin(mFileData + sliceFileMetadata.offset, sliceFileMetadata.numberOfBytes);
-				if (nullptr == crndUnpackContext)
-				{
-					RHI_ASSERT(mRenderer.getContext(), false, "crnd_unpack_begin() failed")
-					return;
-				}
-			}
+			#endif
 
-			// Transcode slice
-			void* decompressedImages[cCRNMaxFaces];
-			uint8_t* currentImageData = mImageData;
-			for (crn_uint32 levelIndex = static_cast<crn_uint32>(startLevelIndex); levelIndex < numberOfLevels; ++levelIndex)
-			{
-				// Compute the face's width, height, number of DXT blocks per row/col, etc.
-				const crn_uint32 width = std::max(1U, mWidth >> levelIndex);
-				const crn_uint32 height = std::max(1U, mHeight >> levelIndex);
-				const crn_uint32 blocksX = std::max(1U, (width + 3) >> 2);
-				const crn_uint32 blocksY = std::max(1U, (height + 3) >> 2);
-				const crn_uint32 rowPitch = blocksX * numberOfBytesPerDxtBlock;
-				const crn_uint32 totalFaceSize = rowPitch * blocksY;
-
-				// Update the face pointer array needed by "crnd_unpack_level()"
-				for (crn_uint32 faceIndex = 0; faceIndex < numberOfFaces; ++faceIndex)
-				{
-					decompressedImages[faceIndex] = currentImageData + totalFaceSize * sliceIndex;
-					currentImageData += totalFaceSize * mNumberOfSlices;
-				}
-
-				// Now transcode the level to raw DXTn
-				if (!crnd::crnd_unpack_level(crndUnpackContext, decompressedImages, totalFaceSize, rowPitch, levelIndex))
-				{
-					// Free allocated memory
-					crnd::crnd_unpack_end(crndUnpackContext);
-					RHI_ASSERT(mRenderer.getContext(), false, "Failed transcoding texture")
-					return;
-				}
-			}
+			// Remember the slice
+			mCrnSlices.push_back({ sliceFileMetadata.offset, sliceFileMetadata.numberOfBytes });
+		}
 
-			// Free allocated memory
-			crnd::crnd_unpack_end(crndUnpackContext);
+		// Now transcode all slices, face and mipmap levels into memory
+		if (!transcodeCrnSlices(mCrnSlices.data(), mNumberOfSlices, numberOfFaces, static_cast<uint32_t>(startLevelIndex), numberOfLevels, numberOfBytesPerDxtBlock))
+		{
+			RHI_ASSERT(mRenderer.getContext(), false, "Failed transcoding texture")
+			return;
 		}
 
 		// In case we removed top level mipmaps, we need to update the texture dimension
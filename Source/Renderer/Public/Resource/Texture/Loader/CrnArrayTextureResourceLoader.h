@@ -127,6 +127,7 @@ namespace Renderer
 		MemoryFile					   mMemoryFile;
 		std::vector<AssetId>		   mAssetIds;
 		std::vector<SliceFileMetadata> mSliceFileMetadata;
+		std::vector<CrnSlice>		   mCrnSlices;			///< Temporary buffer, kept to reduce the number of dynamic memory allocations
 
 
 	};
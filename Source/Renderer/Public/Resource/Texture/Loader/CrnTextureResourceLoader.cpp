@@ -24,6 +24,7 @@
 #include "Renderer/Public/Resource/Texture/Loader/CrnTextureResourceLoader.h"
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
+#include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/Core/File/IFile.h"
 #include "Renderer/Public/IRenderer.h"
 
@@ -65,6 +66,12 @@ namespace
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MINIMUM_NUMBER_OF_BYTES_FOR_MULTITHREADED_TRANSCODING = 256 * 1024;	///< Below this amount of transcoded image data, the texture is transcoded inside the processing thread itself
+
+
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -181,13 +188,6 @@ namespace Renderer
 		// Does the data contain mipmaps?
 		mDataContainsMipmaps = (crnTextureInfo.m_levels > 1);
 
-		crnd::crnd_unpack_context crndUnpackContext = crnd::crnd_unpack_begin(mFileData, mNumberOfUsedFileDataBytes);
-		if (nullptr == crndUnpackContext)
-		{
-			RHI_ASSERT(mRenderer.getContext(), false, "crnd_unpack_begin() failed")
-			return;
-		}
-
 		// Handle optional top mipmap removal
 		// TODO(co) Possible optimization of optional top mipmap removal: Don't load in the skipped mipmaps into memory in the first place ("mFileData")
 		int startLevelIndex = mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove();
@@ -237,40 +237,14 @@ namespace Renderer
 		//   Mip1: Face0, Face1, Face2, Face3, Face4, Face5
 		//   etc.
 
-		{ // Now transcode all face and mipmap levels into memory, one mip level at a time
-			void* decompressedImages[cCRNMaxFaces];
-			uint8_t* currentImageData = mImageData;
-			for (crn_uint32 levelIndex = static_cast<crn_uint32>(startLevelIndex); levelIndex < crnTextureInfo.m_levels; ++levelIndex)
-			{
-				// Compute the face's width, height, number of DXT blocks per row/col, etc.
-				const crn_uint32 width = std::max(1U, mWidth >> levelIndex);
-				const crn_uint32 height = std::max(1U, mHeight >> levelIndex);
-				const crn_uint32 blocksX = std::max(1U, (width + 3) >> 2);
-				const crn_uint32 blocksY = std::max(1U, (height + 3) >> 2);
-				const crn_uint32 rowPitch = blocksX * numberOfBytesPerDxtBlock;
-				const crn_uint32 totalFaceSize = rowPitch * blocksY;
-
-				// Update the face pointer array needed by "crnd_unpack_level()"
-				for (crn_uint32 faceIndex = 0; faceIndex < crnTextureInfo.m_faces; ++faceIndex)
-				{
-					decompressedImages[faceIndex] = currentImageData;
-					currentImageData += totalFaceSize;
-				}
-
-				// Now transcode the level to raw DXTn
-				if (!crnd::crnd_unpack_level(crndUnpackContext, decompressedImages, totalFaceSize, rowPitch, levelIndex))
-				{
-					// Free allocated memory
-					crnd::crnd_unpack_end(crndUnpackContext);
-					RHI_ASSERT(mRenderer.getContext(), false, "Failed transcoding texture")
-					return;
-				}
-			}
+		// Now transcode all face and mipmap levels into memory
+		const CrnSlice crnSlice = { 0, mNumberOfUsedFileDataBytes };
+		if (!transcodeCrnSlices(&crnSlice, 1, crnTextureInfo.m_faces, static_cast<uint32_t>(startLevelIndex), crnTextureInfo.m_levels, numberOfBytesPerDxtBlock))
+		{
+			RHI_ASSERT(mRenderer.getContext(), false, "Failed transcoding texture")
+			return;
 		}
 
-		// Free allocated memory
-		crnd::crnd_unpack_end(crndUnpackContext);
-
 		// In case we removed top level mipmaps, we need to update the texture dimension
 		if (0 != startLevelIndex)
 		{
@@ -338,6 +312,105 @@ namespace Renderer
 		}
 	}
 
+	bool CrnTextureResourceLoader::transcodeCrnSlices(const CrnSlice* crnSlices, uint32_t numberOfSlices, uint32_t numberOfFaces, uint32_t startLevelIndex, uint32_t numberOfLevels, uint32_t numberOfBytesPerDxtBlock)
+	{
+		// Sanity checks
+		RHI_ASSERT(mRenderer.getContext(), nullptr != crnSlices, "Invalid CRN slices")
+		RHI_ASSERT(mRenderer.getContext(), numberOfFaces <= cCRNMaxFaces, "Invalid number of CRN faces")
+		RHI_ASSERT(mRenderer.getContext(), startLevelIndex < numberOfLevels, "Invalid CRN start level index")
+
+		// Gather the transcode jobs
+		// -> "crnd::crnd_unpack_level()" transcodes all faces of a mipmap level at once, so mipmap levels and slices are the units of work which can be distributed
+		// -> The top mipmap level is about three quarters of the total work, it gets a job of its own while the smaller remaining mipmap levels share one job
+		// -> Top mipmap level jobs are queued first so they end up inside the first wave of the thread pool
+		// -> Each job needs its own CRN unpack context, so not worth it for small textures where a single job per slice is used
+		ThreadPool<void>& threadPool = mRenderer.getResourceStreamer().getProcessingThreadPool();
+		const bool multithreaded = (threadPool.getThreadCount() > 1 && mNumberOfUsedImageDataBytes >= ::detail::MINIMUM_NUMBER_OF_BYTES_FOR_MULTITHREADED_TRANSCODING);
+		mTranscodeJobs.clear();
+		for (uint32_t sliceIndex = 0; sliceIndex < numberOfSlices; ++sliceIndex)
+		{
+			mTranscodeJobs.push_back({ sliceIndex, startLevelIndex, multithreaded ? (startLevelIndex + 1) : numberOfLevels });
+		}
+		if (multithreaded && startLevelIndex + 1 < numberOfLevels)
+		{
+			for (uint32_t sliceIndex = 0; sliceIndex < numberOfSlices; ++sliceIndex)
+			{
+				mTranscodeJobs.push_back({ sliceIndex, startLevelIndex + 1, numberOfLevels });
+			}
+		}
+
+		// Transcode job worker
+		std::atomic<bool> transcodingFailed = false;
+		const auto transcode = [this, crnSlices, numberOfSlices, numberOfFaces, startLevelIndex, numberOfBytesPerDxtBlock, &transcodingFailed](const TranscodeJob& transcodeJob)
+		{
+			// Start CRN unpack context
+			const CrnSlice& crnSlice = crnSlices[transcodeJob.sliceIndex];
+			crnd::crnd_unpack_context crndUnpackContext = crnd::crnd_unpack_begin(mFileData + crnSlice.fileDataOffset, crnSlice.numberOfFileDataBytes);
+			if (nullptr == crndUnpackContext)
+			{
+				transcodingFailed = true;
+				return;
+			}
+
+			// Transcode the mipmap levels of the job, one mip level at a time
+			void* decompressedImages[cCRNMaxFaces];
+			uint8_t* currentImageData = mImageData;
+			for (crn_uint32 levelIndex = startLevelIndex; levelIndex < transcodeJob.endLevelIndex; ++levelIndex)
+			{
+				// Compute the face's width, height, number of DXT blocks per row/col, etc.
+				const crn_uint32 width = std::max(1U, mWidth >> levelIndex);
+				const crn_uint32 height = std::max(1U, mHeight >> levelIndex);
+				const crn_uint32 blocksX = std::max(1U, (width + 3) >> 2);
+				const crn_uint32 blocksY = std::max(1U, (height + 3) >> 2);
+				const crn_uint32 rowPitch = blocksX * numberOfBytesPerDxtBlock;
+				const crn_uint32 totalFaceSize = rowPitch * blocksY;
+				if (levelIndex >= transcodeJob.firstLevelIndex)
+				{
+					// Update the face pointer array needed by "crnd_unpack_level()"
+					for (crn_uint32 faceIndex = 0; faceIndex < numberOfFaces; ++faceIndex)
+					{
+						decompressedImages[faceIndex] = currentImageData + totalFaceSize * (faceIndex * numberOfSlices + transcodeJob.sliceIndex);
+					}
+
+					// Now transcode the level to raw DXTn
+					if (!crnd::crnd_unpack_level(crndUnpackContext, decompressedImages, totalFaceSize, rowPitch, levelIndex))
+					{
+						transcodingFailed = true;
+						break;
+					}
+				}
+				currentImageData += totalFaceSize * numberOfFaces * numberOfSlices;
+			}
+
+			// Free allocated memory
+			crnd::crnd_unpack_end(crndUnpackContext);
+		};
+
+		// Transcode
+		if (1 == mTranscodeJobs.size() || !multithreaded)
+		{
+			// Just execute it directly inside the current thread, not worth the additional threading effort
+			for (const TranscodeJob& transcodeJob : mTranscodeJobs)
+			{
+				transcode(transcodeJob);
+			}
+		}
+		else
+		{
+			// Multi-threaded
+			for (const TranscodeJob& transcodeJob : mTranscodeJobs)
+			{
+				threadPool.queueTask(std::bind(transcode, std::cref(transcodeJob)));
+			}
+
+			// Wait that all worker threads have done their part of the transcoding
+			threadPool.process();
+		}
+
+		// Done
+		return !transcodingFailed;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -76,6 +76,22 @@ namespace Renderer
 	protected:
 		[[nodiscard]] virtual Rhi::ITexture* createRhiTexture() override;
 
+		[[nodiscard]] inline virtual uint64_t getNumberOfRhiTextureBytes() const override
+		{
+			return mNumberOfUsedImageDataBytes;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected definitions                                 ]
+	//[-------------------------------------------------------]
+	protected:
+		struct CrnSlice final
+		{
+			uint32_t fileDataOffset;	///< Offset of the CRN data inside "mFileData"
+			uint32_t numberOfFileDataBytes;
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -83,6 +99,32 @@ namespace Renderer
 	protected:
 		CrnTextureResourceLoader(IResourceManager& resourceManager, IRenderer& renderer);
 
+		/**
+		*  @brief
+		*    Transcode the given CRN slices into "mImageData"
+		*
+		*  @param[in] crnSlices
+		*    CRN slices to transcode, must be valid
+		*  @param[in] numberOfSlices
+		*    Number of CRN slices, all slices must have identical texture information
+		*  @param[in] numberOfFaces
+		*    Number of faces per slice
+		*  @param[in] startLevelIndex
+		*    Index of the first mipmap level to transcode, the ones before are the removed top mipmaps
+		*  @param[in] numberOfLevels
+		*    Total number of mipmap levels
+		*  @param[in] numberOfBytesPerDxtBlock
+		*    Number of bytes per DXT block
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - The resulting data is in mip-major order, inside a mipmap the slices of a face are next to each other
+		*    - Mipmap levels and slices are transcoded concurrently by using the resource streamer processing thread pool, each job is using its own CRN unpack context
+		*/
+		[[nodiscard]] bool transcodeCrnSlices(const CrnSlice* crnSlices, uint32_t numberOfSlices, uint32_t numberOfFaces, uint32_t startLevelIndex, uint32_t numberOfLevels, uint32_t numberOfBytesPerDxtBlock);
+
 		inline virtual ~CrnTextureResourceLoader() override
 		{
 			delete [] mFileData;
@@ -115,6 +157,26 @@ namespace Renderer
 		uint8_t* mImageData;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct TranscodeJob final
+		{
+			uint32_t sliceIndex;
+			uint32_t firstLevelIndex;
+			uint32_t endLevelIndex;	///< Exclusive
+		};
+		typedef std::vector<TranscodeJob> TranscodeJobs;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		TranscodeJobs mTranscodeJobs;
+
+
 	};
 
 
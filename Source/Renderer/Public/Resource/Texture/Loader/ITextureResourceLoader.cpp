@@ -46,6 +46,7 @@ namespace Renderer
 	{
 		// Create the RHI texture instance
 		mTextureResource->mTexture = (mRenderer.getRhi().getCapabilities().nativeMultithreading ? mTexture : createRhiTexture());
+		mTextureResource->setNumberOfResidentBytes(getNumberOfRhiTextureBytes());
 
 		// Fully loaded
 		return true;
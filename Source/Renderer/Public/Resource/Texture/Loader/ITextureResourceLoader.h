@@ -101,6 +101,18 @@ namespace Renderer
 	protected:
 		[[nodiscard]] virtual Rhi::ITexture* createRhiTexture() = 0;
 
+		/**
+		*  @brief
+		*    Return the number of bytes of the created RHI texture, used for the memory budget of the texture resource manager
+		*
+		*  @return
+		*    The number of bytes of the created RHI texture, 0 if unknown
+		*/
+		[[nodiscard]] inline virtual uint64_t getNumberOfRhiTextureBytes() const
+		{
+			return 0;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
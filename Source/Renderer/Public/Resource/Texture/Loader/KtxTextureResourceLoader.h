@@ -80,6 +80,11 @@ namespace Renderer
 	protected:
 		[[nodiscard]] virtual Rhi::ITexture* createRhiTexture() override;
 
+		[[nodiscard]] inline virtual uint64_t getNumberOfRhiTextureBytes() const override
+		{
+			return mNumberOfUsedImageDataBytes;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
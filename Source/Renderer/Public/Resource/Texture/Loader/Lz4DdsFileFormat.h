@@ -0,0 +1,87 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Platform/PlatformTypes.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	// LZ4 DDS file format content:
+	// - File format header
+	// - LZ4 DDS header
+	// - Uncompressed DDS header including the "DDS "-magic, optionally followed by the DX10 DDS header extension
+	// - Chunk table with one chunk per mipmap and face (or array slice), stored in mip-major order as expected by the RHI:
+	//     Mip0: Face0, Face1, Face2, Face3, Face4, Face5
+	//     Mip1: Face0, Face1, Face2, Face3, Face4, Face5
+	//     etc.
+	// - Independently LZ4 compressed chunk data, so a loader can skip mipmaps it doesn't need and decompress the rest in parallel
+	namespace v2Lz4Dds
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Definitions                                           ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("lz4dds");
+		static constexpr uint32_t FORMAT_VERSION = 2;
+
+		#pragma pack(push)
+		#pragma pack(1)
+			struct FileFormatHeader final
+			{
+				uint32_t formatType;
+				uint32_t formatVersion;
+			};
+
+			struct Lz4DdsHeader final
+			{
+				uint32_t numberOfDdsHeaderBytes;	///< Number of uncompressed DDS header bytes following this header
+				uint32_t numberOfMipmaps;			///< Always at least one
+				uint32_t numberOfFaces;				///< Number of faces or array slices per mipmap, always at least one
+			};
+
+			struct Chunk final
+			{
+				uint32_t offset;					///< Offset in bytes of the compressed chunk data, relative to the first byte after the chunk table
+				uint32_t numberOfCompressedBytes;
+				uint32_t numberOfDecompressedBytes;
+			};
+		#pragma pack(pop)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+	} // v2Lz4Dds
+} // Renderer
@@ -22,7 +22,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Texture/Loader/Lz4DdsTextureResourceLoader.h"
+#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Resource/Texture/TextureResource.h"
+#include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/Core/File/IFile.h"
 #include "Renderer/Public/IRenderer.h"
 
@@ -63,6 +65,7 @@ namespace
 		static constexpr uint32_t DDSCAPS2_CUBEMAP_POSITIVEZ = 0x00004000;
 		static constexpr uint32_t DDSCAPS2_CUBEMAP_NEGATIVEZ = 0x00008000;
 		static constexpr uint32_t DDSCAPS2_CUBEMAP_ALL_FACES = (DDSCAPS2_CUBEMAP_POSITIVEX | DDSCAPS2_CUBEMAP_NEGATIVEX | DDSCAPS2_CUBEMAP_POSITIVEY | DDSCAPS2_CUBEMAP_NEGATIVEY | DDSCAPS2_CUBEMAP_POSITIVEZ | DDSCAPS2_CUBEMAP_NEGATIVEZ);
+		static constexpr uint32_t MINIMUM_NUMBER_OF_BYTES_FOR_MULTITHREADING = 256 * 1024;	///< Below this amount of decompressed image data, chunks are decompressed inside the processing thread itself
 
 
 		//[-------------------------------------------------------]
@@ -126,19 +129,30 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceLoader methods      ]
 	//[-------------------------------------------------------]
-	void Lz4DdsTextureResourceLoader::onProcessing()
+	bool Lz4DdsTextureResourceLoader::onDeserialization(IFile& file)
 	{
-		// Decompress LZ4 compressed data
-		mMemoryFile.decompress();
+		// Read in the file format header
+		v2Lz4Dds::FileFormatHeader fileFormatHeader;
+		file.read(&fileFormatHeader, sizeof(v2Lz4Dds::FileFormatHeader));
+		if (FORMAT_TYPE != fileFormatHeader.formatType || FORMAT_VERSION != fileFormatHeader.formatVersion)
+		{
+			// Error!
+			RHI_ASSERT(mRenderer.getContext(), false, "Invalid LZ4 DDS file format header")
+			return false;
+		}
+
+		// Read in the LZ4 DDS header
+		v2Lz4Dds::Lz4DdsHeader lz4DdsHeader;
+		file.read(&lz4DdsHeader, sizeof(v2Lz4Dds::Lz4DdsHeader));
+		RHI_ASSERT(mRenderer.getContext(), 0 != lz4DdsHeader.numberOfMipmaps && 0 != lz4DdsHeader.numberOfFaces, "Invalid LZ4 DDS header")
 
 		// TODO(co) Cleanup and complete, currently just a prototype
-		// TODO(co) Add optional top mipmap removal support (see "Renderer::TextureResourceManager::NumberOfTopMipmapsToRemove")
 
 		#define MCHAR4(a, b, c, d) (a | (b << 8) | (c << 16) | (d << 24))
 
 		// Read the header
 		::detail::DdsHeader ddsHeader;
-		mMemoryFile.read(&ddsHeader, sizeof(::detail::DdsHeader));
+		file.read(&ddsHeader, sizeof(::detail::DdsHeader));
 		if (ddsHeader.magic[0] == 'D' && ddsHeader.magic[1] == 'D' && ddsHeader.magic[2] == 'S' && ddsHeader.magic[3] == ' ' &&
 			// Note that if "size" is "DDS " this is not a valid dds file according
 			// to the file spec. Some broken tool out there seems to produce files
@@ -156,7 +170,7 @@ namespace Renderer
 			if (((ddsHeader.ddpfPixelFormat.flags & ::detail::DDPF_FOURCC)) && ddsHeader.ddpfPixelFormat.fourCC == MCHAR4('D', 'X', '1', '0'))
 			{
 				// Read the DX10 header
-				mMemoryFile.read(&ddsHeaderDX10, sizeof(::detail::DdsHeaderDX10));
+				file.read(&ddsHeaderDX10, sizeof(::detail::DdsHeaderDX10));
 				mNumberOfSlices = ddsHeaderDX10.arraySize;
 				hasDX10Header = true;
 			}
@@ -168,9 +182,6 @@ namespace Renderer
 		//	EColorFormat nInternalColorFormat;
 		//	ECompression nCompression = CompressionNone;
 
-			// Does the data contain mipmaps?
-			mDataContainsMipmaps = (ddsHeader.mipMapCount > 0);
-
 			// Is this image compressed?
 			if (ddsHeader.ddpfPixelFormat.flags & ::detail::DDS_FOURCC)
 			{
@@ -291,7 +302,7 @@ namespace Renderer
 						default:
 							// Error!
 							RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-							return;
+							return false;
 					}
 				}
 				else
@@ -399,7 +410,7 @@ namespace Renderer
 									{
 										// Error
 										RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-										return;
+										return false;
 									}
 									break;
 
@@ -422,14 +433,14 @@ namespace Renderer
 									{
 										// Error
 										RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-										return;
+										return false;
 									}
 									break;
 
 								default:
 									// Error
 									RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-									return;
+									return false;
 							}
 					}
 				}
@@ -473,12 +484,6 @@ namespace Renderer
 				}
 			}
 
-			// Get the number of mipmaps
-			const uint32_t numberOfMipmaps = (!ddsHeader.mipMapCount) ? 1 : ddsHeader.mipMapCount;
-
-			// Cube map?
-			const uint32_t numberOfFaces = (ddsHeader.ddsCaps.caps2 & ::detail::DDSCAPS2_CUBEMAP) ? 6u : 1u;
-
 			// TODO(co) Make this dynamic
 			if (1 == mWidth || 1 == mHeight)
 			{
@@ -517,176 +522,129 @@ namespace Renderer
 				}
 			}
 
-			{ // Loop through all faces
-				uint32_t width = mWidth;
-				uint32_t height = mHeight;
-				uint32_t depth = mDepth;
-				mNumberOfUsedImageDataBytes = 0;
-				if (numberOfMipmaps > 1)
-				{
-					// Take mipmaps into account
-					while (width > 1 && height > 1 && depth > 1)
-					{
-						mNumberOfUsedImageDataBytes += Rhi::TextureFormat::getNumberOfBytesPerSlice(static_cast<Rhi::TextureFormat::Enum>(mTextureFormat), width, height) * depth * mNumberOfSlices;
-
-						width /= 2;
-						height /= 2;
-						depth /= 2;
-					}
-				}
-				mNumberOfUsedImageDataBytes += Rhi::TextureFormat::getNumberOfBytesPerSlice(static_cast<Rhi::TextureFormat::Enum>(mTextureFormat), width, height) * depth * mNumberOfSlices;
-
-				if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
-				{
-					mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
-					delete [] mImageData;
-					mImageData = new uint8_t[mNumberOfImageDataBytes];
-				}
-
-				// Avoid slow division by using bit-shift
-	//			const size_t compressedSize = ((ddsHeader.width + 3) >> 2) * ((ddsHeader.height + 3) >> 2) * 8;
-				// m_nCompressedSize = ((ddsHeader.width + 3) / 4) * ((ddsHeader.height + 3) / 4) * 8;
+			// Sanity check
+			RHI_ASSERT(mRenderer.getContext(), lz4DdsHeader.numberOfDdsHeaderBytes == sizeof(::detail::DdsHeader) + (hasDX10Header ? sizeof(::detail::DdsHeaderDX10) : 0), "Invalid number of LZ4 DDS header bytes")
+		}
+		else
+		{
+			// Error: Invalid magic number
+			RHI_ASSERT(mRenderer.getContext(), false, "Invalid DDS magic number")
+			return false;
+		}
 
-				// Data layout
-				// - DDS files are organized in face-major order, like this:
-				//     Face0: Mip0, Mip1, Mip2, etc.
-				//     Face1: Mip0, Mip1, Mip2, etc.
-				//     etc.
-				// - The RHI expects: CRN and KTX files are organized in mip-major order, like this:
-				//     Mip0: Face0, Face1, Face2, Face3, Face4, Face5
-				//     Mip1: Face0, Face1, Face2, Face3, Face4, Face5
-				//     etc.
+		#undef MCHAR4
 
-				// TODO(co) Data layout handling
-				// A simple one: Just read in the whole compressed data
-				mMemoryFile.read(mImageData, mNumberOfUsedImageDataBytes);
+		// Handle optional top mipmap removal
+		const uint32_t numberOfMipmaps = lz4DdsHeader.numberOfMipmaps;
+		const uint32_t numberOfFaces = lz4DdsHeader.numberOfFaces;
+		uint32_t startMipmap = std::min(static_cast<uint32_t>(mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove()), numberOfMipmaps - 1);
+		if (Rhi::TextureFormat::isCompressed(static_cast<Rhi::TextureFormat::Enum>(mTextureFormat)))
+		{
+			// Optional top mipmap removal security checks
+			// -> Ensure we don't go below 4x4 to not get into troubles with 4x4 blocked based compression
+			// -> Ensure the base mipmap we tell the RHI about is a multiple of four. Even if the original base mipmap is a multiple of four, one of the lower mipmaps might not be.
+			while (startMipmap > 0 && (std::max(1U, mWidth >> startMipmap) < 4 || std::max(1U, mHeight >> startMipmap) < 4))
+			{
+				--startMipmap;
+			}
+			while (startMipmap > 0 && (0 != (std::max(1U, mWidth >> startMipmap) % 4) || (0 != std::max(1U, mHeight >> startMipmap) % 4)))
+			{
+				--startMipmap;
+			}
+		}
+		mDataContainsMipmaps = (numberOfMipmaps - startMipmap > 1);
 
+		// In case we removed top level mipmaps, we need to update the texture dimension
+		if (0 != startMipmap)
+		{
+			mWidth = std::max(1U, mWidth >> startMipmap);
+			mHeight = std::max(1U, mHeight >> startMipmap);
+			mDepth = std::max(1U, mDepth >> startMipmap);
+		}
 
+		// Read in the chunk table
+		// -> The chunk table is in mip-major order, so the chunks of removed top mipmaps are a continuous range at the beginning
+		const uint32_t numberOfChunks = numberOfMipmaps * numberOfFaces;
+		mChunks.resize(numberOfChunks);
+		file.read(mChunks.data(), sizeof(v2Lz4Dds::Chunk) * numberOfChunks);
+		const v2Lz4Dds::Chunk& firstKeptChunk = mChunks[startMipmap * numberOfFaces];
+		const v2Lz4Dds::Chunk& lastChunk = mChunks.back();
+		mKeptChunks.clear();
+		mNumberOfUsedImageDataBytes = 0;
+		for (uint32_t chunkIndex = startMipmap * numberOfFaces; chunkIndex < numberOfChunks; ++chunkIndex)
+		{
+			const v2Lz4Dds::Chunk& chunk = mChunks[chunkIndex];
+			mKeptChunks.push_back({chunk.offset - firstKeptChunk.offset, chunk.numberOfCompressedBytes, mNumberOfUsedImageDataBytes, chunk.numberOfDecompressedBytes});
+			mNumberOfUsedImageDataBytes += chunk.numberOfDecompressedBytes;
+		}
 
-				//uint8_t* tempData = nullptr;	// Used when "DDS_LINEARSIZE" is set
-				for (uint32_t face = 0; face < numberOfFaces; ++face)
-				{
-					// Load in all mipmaps
-					for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
-					{
-					}
+		// Skip the compressed data of the removed top mipmaps and read in only the compressed data of the kept chunks
+		if (0 != firstKeptChunk.offset)
+		{
+			file.skip(firstKeptChunk.offset);
+		}
+		mCompressedData.resize(lastChunk.offset + lastChunk.numberOfCompressedBytes - firstKeptChunk.offset);
+		file.read(mCompressedData.data(), mCompressedData.size());
 
-					// TODO(co)
-					/*
-					// Create image part with reasonable semantic
-					ImagePart *pImagePart = cImage.CreatePart((numberOfFaces == 6) ? (static_cast<uint32_t>(ImagePartCubeSidePosX) + face) : 0);
-					if (pImagePart)
-					{
-						// Load in all mipmaps
-						for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
-						{
-							// Create image buffer
-							ImageBuffer *pImageBuffer = pImagePart->CreateMipmap();
-							pImageBuffer->CreateImage(nDataFormat,
-														nColorFormat,
-														Vector3i(ImageBuffer::GetMipmapSize(ddsHeader.nWidth,  mipmap),
-																ImageBuffer::GetMipmapSize(ddsHeader.nHeight, mipmap),
-																ImageBuffer::GetMipmapSize(nDepth,		   mipmap)),
-														nCompression);
-
-							// Read in compressed data?
-							if (nCompression == CompressionNone)
-							{
-								// If the "DDS_LINEARSIZE" flag is set we need to do some more work...
-								if (ddsHeader.ddpfPixelFormat.flags & DDS_LINEARSIZE)
-								{
-									// Calculate the current linear size
-									const uint32_t pitchOrLinearSize = (pImageBuffer->GetSize().x * pImageBuffer->GetSize().y * nDepth * (ddsHeader.ddpfPixelFormat.nRGBBitCount >> 3));
-
-									// Allocate temp data right now? (we can reuse it for the following smaller mipmaps)
-									if (!tempData)
-									{
-										tempData = new uint8_t[pitchOrLinearSize];
-									}
+		// Done
+		return true;
+	}
 
-									// Read the data
-									fread(tempData, 1, pitchOrLinearSize, file);
-
-									// Decompress the image data
-									DecompressRGBA(ddsHeader, *pImageBuffer, tempData);
-								}
-								else
-								{
-									// A simple one: Just read in the whole uncompressed data
-									fread(pImageBuffer->GetData(), 1, pImageBuffer->GetDataSize(), file);
-								}
-							}
-							else
-							{
-								// A simple one: Just read in the whole compressed data
-								fread(pImageBuffer->GetCompressedData(), 1, pImageBuffer->GetCompressedDataSize(), file);
-							}
-						}
-					}
-				}
+	void Lz4DdsTextureResourceLoader::onProcessing()
+	{
+		// Allocate resulting image data
+		if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
+		{
+			mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
+			delete [] mImageData;
+			mImageData = new uint8_t[mNumberOfImageDataBytes];
+		}
 
-				// Cleanup temp data
-				if (tempData)
+		// Decompress the kept chunks, each one directly into its final place inside the mip-major image data
+		std::atomic<bool> decompressionFailed = false;
+		const auto decompressKeptChunks = [this, &decompressionFailed](const KeptChunk* currentKeptChunk, const KeptChunk* endKeptChunk)
+		{
+			for (; currentKeptChunk < endKeptChunk; ++currentKeptChunk)
+			{
+				if (!MemoryFile::decompressLz4(mCompressedData.data() + currentKeptChunk->compressedDataOffset, currentKeptChunk->numberOfCompressedBytes, mImageData + currentKeptChunk->imageDataOffset, currentKeptChunk->numberOfDecompressedBytes))
 				{
-					delete [] tempData;
+					decompressionFailed = true;
 				}
-				*/
 			}
-
-			// TODO(co)
-			/*
-			// Convert BGR(A) to RGB(A)
-			if (nInternalColorFormat == ColorBGR)
+		};
+		{ // Multi-threaded chunk decompression
+			ThreadPool<void>& threadPool = mRenderer.getResourceStreamer().getProcessingThreadPool();
+			size_t itemCount = mKeptChunks.size();
+			size_t splitCount = 1;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = (mNumberOfUsedImageDataBytes >= ::detail::MINIMUM_NUMBER_OF_BYTES_FOR_MULTITHREADING) ? threadPool.getThreadCountAndSplitCount(itemCount, splitCount) : 1;
+			if (1 == threadCount)
 			{
-				// Loop through all faces
-				for (uint32_t face = 0; face < numberOfFaces; ++face)
-				{
-					// Create image part with reasonable semantic
-					ImagePart *pImagePart = cImage.GetPartBySemantics((numberOfFaces == 6) ? (static_cast<uint32_t>(ImagePartCubeSidePosX) + face) : 0);
-					if (pImagePart)
-					{
-						// Load in all mipmaps
-						for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
-						{
-							// Get image buffer
-							ImageBuffer *pImageBuffer = pImagePart->GetMipmap(mipmap);
-
-							// Swap R/B
-							Color3::SwapRB(pImageBuffer->GetData(), pImageBuffer->GetNumOfPixels());
-						}
-					}
-				}
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				decompressKeptChunks(mKeptChunks.data(), mKeptChunks.data() + itemCount);
 			}
-			else if (nInternalColorFormat == ColorBGRA)
+			else
 			{
-				// Loop through all faces
-				for (uint32_t face = 0; face < numberOfFaces; ++face)
+				// Multi-threaded
+				const KeptChunk* startKeptChunk = mKeptChunks.data();
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
 				{
-					// Create image part with reasonable semantic
-					ImagePart *pImagePart = cImage.GetPartBySemantics((numberOfFaces == 6) ? (static_cast<uint32_t>(ImagePartCubeSidePosX) + face) : 0);
-					if (pImagePart)
-					{
-						// Load in all mipmaps
-						for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
-						{
-							// Get image buffer
-							ImageBuffer *pImageBuffer = pImagePart->GetMipmap(mipmap);
-
-							// Swap R/B
-							Color4::SwapRB(pImageBuffer->GetData(), pImageBuffer->GetNumOfPixels());
-						}
-					}
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					threadPool.queueTask(std::bind(decompressKeptChunks, startKeptChunk, startKeptChunk + numberOfItemsToProcess));
+					itemCount -= splitCount;
+					startKeptChunk += splitCount;
 				}
-			*/
+
+				// Wait that all worker threads have done their part of the decompression
+				threadPool.process();
 			}
 		}
-		else
+		if (decompressionFailed)
 		{
-			// Error: Invalid magic number
+			// Error!
+			RHI_ASSERT(mRenderer.getContext(), false, "Failed to decompress LZ4 DDS texture chunk")
+			return;
 		}
 
-		#undef MCHAR4
-
 		// Can we create the RHI resource asynchronous as well?
 		if (mRenderer.getRhi().getCapabilities().nativeMultithreading)
 		{
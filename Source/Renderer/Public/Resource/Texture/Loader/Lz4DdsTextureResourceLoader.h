@@ -28,6 +28,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Texture/Loader/ITextureResourceLoader.h"
+#include "Renderer/Public/Resource/Texture/Loader/Lz4DdsFileFormat.h"
+#include "Renderer/Public/Core/File/MemoryFile.h"
 
 
 //[-------------------------------------------------------]
@@ -55,8 +57,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		static constexpr uint32_t TYPE_ID		 = STRING_ID("lz4dds");
-		static constexpr uint32_t FORMAT_TYPE	 = TYPE_ID;
-		static constexpr uint32_t FORMAT_VERSION = 1;
+		static constexpr uint32_t FORMAT_TYPE	 = v2Lz4Dds::FORMAT_TYPE;
+		static constexpr uint32_t FORMAT_VERSION = v2Lz4Dds::FORMAT_VERSION;
 
 
 	//[-------------------------------------------------------]
@@ -68,12 +70,7 @@ namespace Renderer
 			return TYPE_ID;
 		}
 
-		[[nodiscard]] inline virtual bool onDeserialization(IFile& file) override
-		{
-			// Tell the memory mapped file about the LZ4 compressed data
-			return mMemoryFile.loadLz4CompressedDataFromFile(FORMAT_TYPE, FORMAT_VERSION, file);
-		}
-
+		[[nodiscard]] virtual bool onDeserialization(IFile& file) override;
 		virtual void onProcessing() override;
 
 
@@ -83,6 +80,11 @@ namespace Renderer
 	protected:
 		[[nodiscard]] virtual Rhi::ITexture* createRhiTexture() override;
 
+		[[nodiscard]] inline virtual uint64_t getNumberOfRhiTextureBytes() const override
+		{
+			return mNumberOfUsedImageDataBytes;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -112,12 +114,29 @@ namespace Renderer
 		Lz4DdsTextureResourceLoader& operator=(const Lz4DdsTextureResourceLoader&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct KeptChunk final
+		{
+			uint32_t compressedDataOffset;	///< Offset inside "mCompressedData"
+			uint32_t numberOfCompressedBytes;
+			uint32_t imageDataOffset;		///< Offset inside "mImageData"
+			uint32_t numberOfDecompressedBytes;
+		};
+		typedef std::vector<v2Lz4Dds::Chunk> Chunks;
+		typedef std::vector<KeptChunk>		 KeptChunks;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
 		// Temporary data
-		MemoryFile mMemoryFile;
+		Chunks				   mChunks;			///< Chunk table as read from the file
+		KeptChunks			   mKeptChunks;		///< Chunks which survived the optional top mipmap removal
+		MemoryFile::ByteVector mCompressedData;	///< Compressed data of the kept chunks
 		uint32_t   mWidth;
 		uint32_t   mHeight;
 		uint32_t   mDepth;
@@ -36,7 +36,9 @@
 namespace Renderer
 {
 	class TextureResource;
+	class ITextureResourceLoader;
 	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
 
@@ -69,6 +71,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 		friend class TextureResourceManager;
 		friend class ITextureResourceLoader;
+		friend ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>;	// Type definition of template class
 		friend PackedElementManager<TextureResource, TextureResourceId, 2048>;	// Type definition of template class
 
 
@@ -154,6 +157,14 @@ namespace Renderer
 			IResource::deinitializeElement();
 		}
 
+		//[-------------------------------------------------------]
+		//[ "Renderer::ResourceManagerTemplate" management        ]
+		//[-------------------------------------------------------]
+		inline void unloadResidentData()
+		{
+			mTexture = nullptr;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
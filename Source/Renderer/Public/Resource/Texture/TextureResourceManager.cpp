@@ -219,13 +219,20 @@ namespace Renderer
 		bool load = (reload && nullptr != asset);
 		if (nullptr == textureResource && nullptr != asset)
 		{
-			textureResource = &mInternalResourceManager->getResources().addElement();
-			textureResource->setResourceManager(this);
-			textureResource->setAssetId(assetId);
+			textureResource = &mInternalResourceManager->addResource(assetId);
 			textureResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			textureResource->mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;
 			load = true;
 		}
+		else if (nullptr != textureResource && nullptr != asset && IResource::LoadingState::UNLOADED == textureResource->getLoadingState())
+		{
+			// The RHI texture has been evicted since the texture resource was no longer referenced, load it again using the resource loader type the texture resource was originally loaded with (e.g. OpenVR render model textures)
+			if (isValid(textureResource->getResourceLoaderTypeId()))
+			{
+				resourceLoaderTypeId = textureResource->getResourceLoaderTypeId();
+			}
+			load = true;
+		}
 
 		// Before connecting a resource listener, ensure we set the output resource ID at once so it can already directly be used inside the resource listener
 		if (nullptr != textureResource)
@@ -303,9 +310,7 @@ namespace Renderer
 		RHI_ASSERT(mInternalResourceManager->getRenderer().getContext(), nullptr == getTextureResourceByAssetId(assetId), "The texture resource isn't allowed to exist, yet")
 
 		// Create the texture resource instance
-		TextureResource& textureResource = mInternalResourceManager->getResources().addElement();
-		textureResource.setResourceManager(this);
-		textureResource.setAssetId(assetId);
+		TextureResource& textureResource = mInternalResourceManager->addResource(assetId);
 		textureResource.mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;	// TODO(co) We might need to extend "Rhi::ITexture" so we can readback the texture format
 		textureResource.mTexture = &texture;
 
@@ -316,7 +321,7 @@ namespace Renderer
 
 	void TextureResourceManager::destroyTextureResource(TextureResourceId textureResourceId)
 	{
-		mInternalResourceManager->getResources().removeElement(textureResourceId);
+		mInternalResourceManager->removeResource(textureResourceId);
 	}
 
 	void TextureResourceManager::setInvalidResourceId(TextureResourceId& textureResourceId, IResourceListener& resourceListener) const
@@ -329,6 +334,21 @@ namespace Renderer
 		setInvalid(textureResourceId);
 	}
 
+	uint64_t TextureResourceManager::getNumberOfResidentBytes() const
+	{
+		return mInternalResourceManager->getNumberOfResidentBytes();
+	}
+
+	uint64_t TextureResourceManager::getMemoryBudget() const
+	{
+		return mInternalResourceManager->getMemoryBudget();
+	}
+
+	void TextureResourceManager::setMemoryBudget(uint64_t memoryBudget)
+	{
+		mInternalResourceManager->setMemoryBudget(memoryBudget);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -362,13 +382,22 @@ namespace Renderer
 			const TextureResource& textureResource = mInternalResourceManager->getResources().getElementByIndex(i);
 			if (textureResource.getAssetId() == assetId)
 			{
-				TextureResourceId textureResourceId = getInvalid<TextureResourceId>();
-				loadTextureResourceByAssetId(assetId, getInvalid<AssetId>(), textureResourceId, nullptr, textureResource.isRgbHardwareGammaCorrection(), true, textureResource.getResourceLoaderTypeId());
+				// Textures with evicted resident data are loaded again by the next load request anyway, reloading them now would make them resident without being queued for a deferred unload
+				if (IResource::LoadingState::UNLOADED != textureResource.getLoadingState())
+				{
+					TextureResourceId textureResourceId = getInvalid<TextureResourceId>();
+					loadTextureResourceByAssetId(assetId, getInvalid<AssetId>(), textureResourceId, nullptr, textureResource.isRgbHardwareGammaCorrection(), true, textureResource.getResourceLoaderTypeId());
+				}
 				break;
 			}
 		}
 	}
 
+	void TextureResourceManager::update()
+	{
+		mInternalResourceManager->processDeferredUnloads();
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual Renderer::IResourceManager methods    ]
@@ -401,6 +430,16 @@ namespace Renderer
 		}
 	}
 
+	void TextureResourceManager::onResourceUnreferenced(IResource& resource)
+	{
+		mInternalResourceManager->enqueueDeferredUnload(static_cast<TextureResource&>(resource));
+	}
+
+	void TextureResourceManager::onResourceResidentBytesChanged(IResource& resource, uint64_t previousNumberOfResidentBytes)
+	{
+		mInternalResourceManager->updateNumberOfResidentBytes(previousNumberOfResidentBytes, resource.getNumberOfResidentBytes());
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -128,6 +128,30 @@ namespace Renderer
 		RENDERER_API_EXPORT void destroyTextureResource(TextureResourceId textureResourceId);
 		RENDERER_API_EXPORT void setInvalidResourceId(TextureResourceId& textureResourceId, IResourceListener& resourceListener) const;
 
+		/**
+		*  @brief
+		*    Return the number of bytes of resident texture data
+		*
+		*  @return
+		*    The number of bytes of resident RHI texture data of all loaded texture resources, runtime created textures (e.g. compositor render targets) don't report their size
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT uint64_t getNumberOfResidentBytes() const;
+
+		[[nodiscard]] RENDERER_API_EXPORT uint64_t getMemoryBudget() const;
+
+		/**
+		*  @brief
+		*    Set the memory budget
+		*
+		*  @param[in] memoryBudget
+		*    Memory budget in bytes, invalid means unlimited (default)
+		*
+		*  @note
+		*    - While the number of resident bytes exceeds the memory budget, the least recently used texture resources which are no longer referenced by a resource listener get unloaded inside "update()"
+		*    - Referenced texture resources are never unloaded, so the memory budget is a soft limit
+		*/
+		RENDERER_API_EXPORT void setMemoryBudget(uint64_t memoryBudget);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -138,11 +162,7 @@ namespace Renderer
 		[[nodiscard]] virtual IResource& getResourceByResourceId(ResourceId resourceId) const override;
 		[[nodiscard]] virtual IResource* tryGetResourceByResourceId(ResourceId resourceId) const override;
 		virtual void reloadResourceByAssetId(AssetId assetId) override;
-
-		inline virtual void update() override
-		{
-			// Nothing here
-		}
+		virtual void update() override;
 
 
 	//[-------------------------------------------------------]
@@ -150,6 +170,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
+		virtual void onResourceUnreferenced(IResource& resource) override;
+		virtual void onResourceResidentBytesChanged(IResource& resource, uint64_t previousNumberOfResidentBytes) override;
 
 
 	//[-------------------------------------------------------]
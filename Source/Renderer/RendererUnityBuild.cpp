@@ -36,6 +36,7 @@
 #include "Public/Core/Math/Math.cpp"
 #include "Public/Core/Math/Transform.cpp"
 #include "Public/Core/Platform/PlatformManager.cpp"
+#include "Public/Core/Renderer/CommandBufferCapture.cpp"
 #include "Public/Core/Renderer/FramebufferManager.cpp"
 #include "Public/Core/Renderer/FramebufferSignature.cpp"
 #include "Public/Core/Renderer/RenderPassManager.cpp"
@@ -105,6 +106,7 @@
 #include "Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateCompiler.cpp"
 #include "Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateSignature.cpp"
 #include "Public/Resource/MaterialBlueprint/Cache/GraphicsProgramCacheManager.cpp"
+#include "Public/Resource/MaterialBlueprint/Cache/GraphicsProgramBinaryCacheManager.cpp"
 #include "Public/Resource/MaterialBlueprint/Cache/ComputePipelineStateCacheManager.cpp"
 #include "Public/Resource/MaterialBlueprint/Cache/ComputePipelineStateCompiler.cpp"
 #include "Public/Resource/MaterialBlueprint/Cache/ComputePipelineStateSignature.cpp"
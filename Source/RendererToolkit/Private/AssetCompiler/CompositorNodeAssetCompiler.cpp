@@ -427,6 +427,18 @@ namespace
 											RendererToolkit::JsonHelper::mandatoryAssetIdProperty(rapidJsonValuePass, "Texture", passShadowMap.textureAssetId);
 											passShadowMap.depthToExponentialVarianceMaterialBlueprintAssetId = RendererToolkit::JsonHelper::getCompiledAssetId(input, rapidJsonValuePass, "DepthToExponentialVarianceMaterialBlueprint");
 											passShadowMap.blurMaterialBlueprintAssetId = RendererToolkit::JsonHelper::getCompiledAssetId(input, rapidJsonValuePass, "BlurMaterialBlueprint");
+											RendererToolkit::JsonHelper::optionalBooleanProperty(rapidJsonValuePass, "CacheStaticShadowCasters", passShadowMap.cacheStaticShadowCasters);
+											RendererToolkit::JsonHelper::optionalFloatProperty(rapidJsonValuePass, "StaticShadowCacheSnapThreshold", passShadowMap.staticShadowCacheSnapThreshold);
+											if (passShadowMap.staticShadowCacheSnapThreshold < 0.0f)
+											{
+												throw std::runtime_error("The static shadow cache snap threshold can't be negative");
+											}
+											RendererToolkit::JsonHelper::optionalCompiledAssetId(input, rapidJsonValuePass, "DepthReductionMaterialBlueprint", passShadowMap.depthReductionMaterialBlueprintAssetId);
+											RendererToolkit::JsonHelper::optionalAssetIdProperty(rapidJsonValuePass, "DepthReductionDepthMap", passShadowMap.depthReductionDepthMapAssetId);
+											if (Renderer::isValid(passShadowMap.depthReductionMaterialBlueprintAssetId) != Renderer::isValid(passShadowMap.depthReductionDepthMapAssetId))
+											{
+												throw std::runtime_error("The depth reduction needs both a material blueprint and a depth map");
+											}
 											renderTargetTextureAssetIds.insert(passShadowMap.textureAssetId);
 
 											// Write down
@@ -571,9 +583,10 @@ namespace
 						ELSE_IF_VALUE(ALLOW_MULTISAMPLE)
 						ELSE_IF_VALUE(GENERATE_MIPMAPS)
 						ELSE_IF_VALUE(ALLOW_RESOLUTION_SCALE)
+						ELSE_IF_VALUE(TRANSIENT)
 						else
 						{
-							throw std::runtime_error('\"' + std::string(propertyName) + "\" doesn't know the flag " + flagAsString + ". Must be \"UNORDERED_ACCESS\", \"SHADER_RESOURCE\", \"RENDER_TARGET\", \"ALLOW_MULTISAMPLE\", \"GENERATE_MIPMAPS\" or \"ALLOW_RESOLUTION_SCALE\".");
+							throw std::runtime_error('\"' + std::string(propertyName) + "\" doesn't know the flag " + flagAsString + ". Must be \"UNORDERED_ACCESS\", \"SHADER_RESOURCE\", \"RENDER_TARGET\", \"ALLOW_MULTISAMPLE\", \"GENERATE_MIPMAPS\", \"ALLOW_RESOLUTION_SCALE\" or \"TRANSIENT\".");
 						}
 
 						// Apply value
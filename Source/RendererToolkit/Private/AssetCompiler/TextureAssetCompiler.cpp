@@ -247,7 +247,7 @@ namespace
 			UNKNOWN
 		};
 
-		static constexpr uint16_t TEXTURE_FORMAT_VERSION = 0;
+		static constexpr uint16_t TEXTURE_FORMAT_VERSION = 2;	///< Texture arrays were cached using "RendererToolkit::IAssetCompiler::ASSET_FORMAT_VERSION" before, so this must be above it to rebuild all outdated outputs
 
 		typedef std::vector<std::string> Filenames;
 
@@ -1352,7 +1352,7 @@ namespace
 						filenames.emplace_back(virtualInputAssetFilename + RendererToolkit::JsonHelper::getAssetFile(rapidJsonValueInputFiles[i]));
 					}
 					RendererToolkit::CacheManager::CacheEntries cacheEntriesCandidate;
-					if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, filenames, virtualOutputAssetFilename, RendererToolkit::IAssetCompiler::ASSET_FORMAT_VERSION, cacheEntriesCandidate))
+					if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, filenames, virtualOutputAssetFilename, TEXTURE_FORMAT_VERSION, cacheEntriesCandidate))
 					{
 						// Changed
 						cacheEntries.push_back(cacheEntriesCandidate);
@@ -1480,6 +1480,122 @@ namespace
 			}
 		}
 
+		/**
+		*  @brief
+		*    Write the given DDS file as LZ4 DDS file ("Renderer::v2Lz4Dds") with independently LZ4 compressed chunks per mipmap and face
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		[[nodiscard]] bool writeLz4DdsFile(const Renderer::MemoryFile& ddsMemoryFile, const Renderer::IFileManager& fileManager, Renderer::VirtualFilename virtualFilename)
+		{
+			// Get the DDS header
+			const Renderer::MemoryFile::ByteVector& ddsData = ddsMemoryFile.getByteVector();
+			uint32_t numberOfDdsHeaderBytes = sizeof(uint32_t) + sizeof(crnlib::DDSURFACEDESC2);
+			if (ddsData.size() < numberOfDdsHeaderBytes || 0 != memcmp(ddsData.data(), "DDS ", sizeof(uint32_t)))
+			{
+				return false;
+			}
+			const crnlib::DDSURFACEDESC2& ddsSurfaceDesc2 = *reinterpret_cast<const crnlib::DDSURFACEDESC2*>(ddsData.data() + sizeof(uint32_t));
+			const bool fourCC = (0 != (ddsSurfaceDesc2.ddpfPixelFormat.dwFlags & crnlib::DDPF_FOURCC));
+			uint32_t numberOfFaces = (ddsSurfaceDesc2.ddsCaps.dwCaps2 & crnlib::DDSCAPS2_CUBEMAP) ? 6u : 1u;
+			if (fourCC && CRNLIB_PIXEL_FMT_FOURCC('D', 'X', '1', '0') == ddsSurfaceDesc2.ddpfPixelFormat.dwFourCC)
+			{
+				if (ddsData.size() < numberOfDdsHeaderBytes + sizeof(::detail::DdsHeaderDX10))
+				{
+					return false;
+				}
+				const ::detail::DdsHeaderDX10& ddsHeaderDX10 = *reinterpret_cast<const ::detail::DdsHeaderDX10*>(ddsData.data() + numberOfDdsHeaderBytes);
+				numberOfFaces *= std::max(1u, ddsHeaderDX10.arraySize);
+				numberOfDdsHeaderBytes += sizeof(::detail::DdsHeaderDX10);
+			}
+			const uint32_t numberOfMipmaps = std::max(1u, ddsSurfaceDesc2.dwMipMapCount);
+			const uint32_t numberOfImageDataBytes = static_cast<uint32_t>(ddsData.size()) - numberOfDdsHeaderBytes;
+
+			// Gather the number of bytes per mipmap
+			// -> Without mipmaps the image data is simply split into the faces, this way we don't need to care about the exact texture format
+			std::vector<uint32_t> numberOfBytesPerMipmap(numberOfMipmaps, numberOfImageDataBytes / numberOfFaces);
+			if (numberOfMipmaps > 1)
+			{
+				const uint32_t depth = std::max(1u, ddsSurfaceDesc2.dwBackBufferCount);
+				for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
+				{
+					const uint32_t width = std::max(1u, ddsSurfaceDesc2.dwWidth >> mipmap);
+					const uint32_t height = std::max(1u, ddsSurfaceDesc2.dwHeight >> mipmap);
+					if (fourCC)
+					{
+						// 4x4 block based compression, BC1 and BC4 use 8 bytes per block while the others use 16 bytes per block
+						const crnlib::pixel_format pixelFormat = static_cast<crnlib::pixel_format>(ddsSurfaceDesc2.ddpfPixelFormat.dwFourCC);
+						const uint32_t numberOfBytesPerBlock = (crnlib::PIXEL_FMT_DXT1 == pixelFormat || crnlib::PIXEL_FMT_DXT1A == pixelFormat || crnlib::PIXEL_FMT_DXT5A == pixelFormat) ? 8u : 16u;
+						numberOfBytesPerMipmap[mipmap] = ((width + 3) >> 2) * ((height + 3) >> 2) * numberOfBytesPerBlock * std::max(1u, depth >> mipmap);
+					}
+					else
+					{
+						numberOfBytesPerMipmap[mipmap] = width * height * std::max(1u, depth >> mipmap) * (ddsSurfaceDesc2.ddpfPixelFormat.dwRGBBitCount >> 3);
+					}
+				}
+			}
+			uint32_t numberOfBytesPerFace = 0;
+			for (uint32_t numberOfBytes : numberOfBytesPerMipmap)
+			{
+				numberOfBytesPerFace += numberOfBytes;
+			}
+			if (0 == numberOfBytesPerFace || numberOfBytesPerFace * numberOfFaces != numberOfImageDataBytes)
+			{
+				// Error! Unsupported DDS data layout.
+				return false;
+			}
+
+			// Compress the chunks
+			// -> DDS files are organized in face-major order, the chunks are stored in mip-major order as expected by the RHI
+			std::vector<Renderer::v2Lz4Dds::Chunk> chunks;
+			chunks.reserve(numberOfMipmaps * numberOfFaces);
+			Renderer::MemoryFile::ByteVector compressedData;
+			compressedData.reserve(numberOfImageDataBytes);
+			{
+				uint32_t mipmapOffset = 0;
+				for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
+				{
+					for (uint32_t face = 0; face < numberOfFaces; ++face)
+					{
+						Renderer::v2Lz4Dds::Chunk chunk;
+						chunk.offset = static_cast<uint32_t>(compressedData.size());
+						chunk.numberOfDecompressedBytes = numberOfBytesPerMipmap[mipmap];
+						chunk.numberOfCompressedBytes = Renderer::MemoryFile::compressLz4(ddsData.data() + numberOfDdsHeaderBytes + face * numberOfBytesPerFace + mipmapOffset, chunk.numberOfDecompressedBytes, compressedData);
+						chunks.push_back(chunk);
+					}
+					mipmapOffset += numberOfBytesPerMipmap[mipmap];
+				}
+			}
+
+			// Write down the LZ4 DDS file
+			Renderer::IFile* file = fileManager.openFile(Renderer::IFileManager::FileMode::WRITE, virtualFilename);
+			if (nullptr == file)
+			{
+				return false;
+			}
+			{ // Write down the file format header
+				Renderer::v2Lz4Dds::FileFormatHeader fileFormatHeader;
+				fileFormatHeader.formatType	   = Renderer::v2Lz4Dds::FORMAT_TYPE;
+				fileFormatHeader.formatVersion = Renderer::v2Lz4Dds::FORMAT_VERSION;
+				file->write(&fileFormatHeader, sizeof(Renderer::v2Lz4Dds::FileFormatHeader));
+			}
+			{ // Write down the LZ4 DDS header
+				Renderer::v2Lz4Dds::Lz4DdsHeader lz4DdsHeader;
+				lz4DdsHeader.numberOfDdsHeaderBytes = numberOfDdsHeaderBytes;
+				lz4DdsHeader.numberOfMipmaps		= numberOfMipmaps;
+				lz4DdsHeader.numberOfFaces			= numberOfFaces;
+				file->write(&lz4DdsHeader, sizeof(Renderer::v2Lz4Dds::Lz4DdsHeader));
+			}
+			file->write(ddsData.data(), numberOfDdsHeaderBytes);
+			file->write(chunks.data(), sizeof(Renderer::v2Lz4Dds::Chunk) * chunks.size());
+			file->write(compressedData.data(), compressedData.size());
+			fileManager.closeFile(*file);
+
+			// Done
+			return true;
+		}
+
 		void convertFile(const RendererToolkit::IAssetCompiler::Input& input, const RendererToolkit::IAssetCompiler::Configuration& configuration, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const char* basePath, Renderer::VirtualFilename virtualSourceFilename, Renderer::VirtualFilename virtualDestinationFilename, crnlib::texture_file_types::format outputCrunchTextureFileType, TextureSemantic textureSemantic, bool createMipmaps, float mipmapBlurriness, Renderer::VirtualFilename virtualSourceNormalMapFilename)
 		{
 			crnlib::texture_conversion::convert_params crunchConvertParams;
@@ -1729,7 +1845,7 @@ namespace
 			}
 
 			// Write LZ4 compressed memory file
-			if (crnlib::texture_file_types::cFormatDDS == outputCrunchTextureFileType && !memoryStream.getMemoryFile().writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, input.context.getFileManager(), virtualDestinationFilename))
+			if (crnlib::texture_file_types::cFormatDDS == outputCrunchTextureFileType && !writeLz4DdsFile(memoryStream.getMemoryFile(), input.context.getFileManager(), virtualDestinationFilename))
 			{
 				throw std::runtime_error("Failed to write LZ4 compressed output file \"" + std::string(virtualDestinationFilename) + '\"');
 			}
@@ -1793,7 +1909,7 @@ namespace
 			memoryFile.write("DDS ", sizeof(uint32_t));
 			memoryFile.write(reinterpret_cast<const char*>(&ddsSurfaceDesc2), sizeof(crnlib::DDSURFACEDESC2));
 			memoryFile.write(reinterpret_cast<const char*>(destinationData), sizeof(crnlib::color_quad_u8) * numberOfTexelsPerLayer * depth);
-			if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, fileManager, virtualOutputAssetFilename))
+			if (!writeLz4DdsFile(memoryFile, fileManager, virtualOutputAssetFilename))
 			{
 				delete [] destinationData;
 				throw std::runtime_error("Failed to write to destination file \"" + std::string(virtualOutputAssetFilename) + '\"');
@@ -1844,7 +1960,7 @@ namespace
 						memoryFile.write("DDS ", sizeof(uint32_t));
 						memoryFile.write(reinterpret_cast<const char*>(&ddsSurfaceDesc2), sizeof(crnlib::DDSURFACEDESC2));
 						memoryFile.write(pData, sizeof(stbi_us) * numberOfTexelsPerLayer);
-						if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, fileManager, virtualOutputAssetFilename))
+						if (!writeLz4DdsFile(memoryFile, fileManager, virtualOutputAssetFilename))
 						{
 							stbi_image_free(pData);
 							throw std::runtime_error("Failed to write to destination file \"" + std::string(virtualOutputAssetFilename) + '\"');
@@ -1949,7 +2065,7 @@ namespace
 				memoryFile.write("DDS ", sizeof(uint32_t));
 				memoryFile.write(reinterpret_cast<const char*>(&ddsSurfaceDesc2), sizeof(crnlib::DDSURFACEDESC2));
 				memoryFile.write(rawVoumeData.data(), rawVoumeDataNumberOfBytes);
-				if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, fileManager, virtualOutputAssetFilename))
+				if (!writeLz4DdsFile(memoryFile, fileManager, virtualOutputAssetFilename))
 				{
 					throw std::runtime_error("Failed to write to destination file \"" + std::string(virtualOutputAssetFilename) + '\"');
 				}
@@ -2080,7 +2196,7 @@ namespace
 					const IESOutputData& currentIesOutputData = iesOutputData[i];
 					memoryFile.write(currentIesOutputData.stream.data(), currentIesOutputData.stream.size() * sizeof(float));
 				}
-				if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, fileManager, virtualOutputAssetFilename))
+				if (!writeLz4DdsFile(memoryFile, fileManager, virtualOutputAssetFilename))
 				{
 					throw std::runtime_error("Failed to write to destination file \"" + std::string(virtualOutputAssetFilename) + '\"');
 				}
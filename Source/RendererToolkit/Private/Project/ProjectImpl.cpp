@@ -614,6 +614,23 @@ namespace RendererToolkit
 		}
 	}
 
+	bool ProjectImpl::precompilePipelineStateObjectCache(Renderer::IRenderer& renderer)
+	{
+		// The shader bytecodes can only be created by the RHI itself, so the pipeline state object cache is precompiled for the RHI the given renderer instance is using
+		// -> The assets must already have been compiled and be mounted by the renderer, see "RendererToolkit::IProject::compileAllAssets()" and "RendererToolkit::IProject::startupAssetMonitor()"
+		// -> Call this once per RHI which should be shipped with a fully warm pipeline state object cache
+		RHI_LOG(mContext, INFORMATION, "Precompiling the \"%s\" pipeline state object cache using the recorded pipeline state usage...", renderer.getRhi().getName())
+		if (renderer.precompilePipelineStateObjectCache())
+		{
+			RHI_LOG(mContext, INFORMATION, "Precompiled the \"%s\" pipeline state object cache", renderer.getRhi().getName())
+			return true;
+		}
+
+		// Error!
+		RHI_LOG(mContext, CRITICAL, "Failed to precompile the \"%s\" pipeline state object cache", renderer.getRhi().getName())
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -161,6 +161,7 @@ namespace RendererToolkit
 		virtual void importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName, const std::string& targetDirectoryName = "Imported") override;
 		virtual void startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget) override;
 		virtual void shutdownAssetMonitor() override;
+		virtual bool precompilePipelineStateObjectCache(Renderer::IRenderer& renderer) override;
 
 
 	//[-------------------------------------------------------]
@@ -105,6 +105,7 @@ namespace RendererToolkit
 		virtual void compileAllAssets(const char* rhiTarget) = 0;
 		virtual void startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget) = 0;
 		virtual void shutdownAssetMonitor() = 0;
+		virtual bool precompilePipelineStateObjectCache(Renderer::IRenderer& renderer) = 0;
 	protected:
 		IProject();
 		explicit IProject(const IProject& source) = delete;
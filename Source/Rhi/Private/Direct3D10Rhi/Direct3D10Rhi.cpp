@@ -9810,8 +9810,7 @@ namespace Direct3D10Rhi
 	void Direct3D10Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -9821,8 +9820,7 @@ namespace Direct3D10Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -12544,8 +12544,7 @@ namespace Direct3D11Rhi
 	void Direct3D11Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -12555,8 +12554,7 @@ namespace Direct3D11Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -14064,6 +14062,19 @@ namespace Direct3D11Rhi
 				}
 				break;
 
+			case Rhi::ResourceType::STRUCTURED_BUFFER:
+				if (sourceResource.getResourceType() == Rhi::ResourceType::STRUCTURED_BUFFER)
+				{
+					// Copy resource, e.g. from an unordered access structured buffer into a staging structured buffer for reading it back
+					mD3D11DeviceContext->CopyResource(static_cast<const StructuredBuffer&>(destinationResource).getD3D11Buffer(), static_cast<const StructuredBuffer&>(sourceResource).getD3D11Buffer());
+				}
+				else
+				{
+					// Error!
+					RHI_ASSERT(mContext, false, "Failed to copy Direct3D 11 resource")
+				}
+				break;
+
 			case Rhi::ResourceType::ROOT_SIGNATURE:
 			case Rhi::ResourceType::RESOURCE_GROUP:
 			case Rhi::ResourceType::GRAPHICS_PROGRAM:
@@ -14075,7 +14086,6 @@ namespace Direct3D11Rhi
 			case Rhi::ResourceType::VERTEX_BUFFER:
 			case Rhi::ResourceType::INDEX_BUFFER:
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-			case Rhi::ResourceType::STRUCTURED_BUFFER:
 			case Rhi::ResourceType::INDIRECT_BUFFER:
 			case Rhi::ResourceType::UNIFORM_BUFFER:
 			case Rhi::ResourceType::TEXTURE_1D:
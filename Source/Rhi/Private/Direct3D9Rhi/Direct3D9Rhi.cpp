@@ -7888,8 +7888,7 @@ namespace Direct3D9Rhi
 	void Direct3D9Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -7899,8 +7898,7 @@ namespace Direct3D9Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -3982,8 +3982,7 @@ namespace NullRhi
 	void NullRhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -3993,8 +3992,7 @@ namespace NullRhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -522,6 +522,7 @@ namespace OpenGLRhi
 {
 	class Extensions;
 	class VertexArray;
+	class UniformBuffer;
 	class RootSignature;
 	class IOpenGLContext;
 	class OpenGLRuntimeLinking;
@@ -819,6 +820,10 @@ FNDEF_EX(glPushDebugGroup,		PFNGLPUSHDEBUGGROUPPROC);
 FNDEF_EX(glPopDebugGroup,		PFNGLPOPDEBUGGROUPPROC);
 FNDEF_EX(glObjectLabel,			PFNGLOBJECTLABELPROC);
 
+// GL_KHR_parallel_shader_compile
+FNDEF_EX(glMaxShaderCompilerThreadsKHR,	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC);
+FNDEF_EX(glGetAttachedShaders,			PFNGLGETATTACHEDSHADERSPROC);	// Core since OpenGL 2.0, used to report compile errors after a background compile and link
+
 //[-------------------------------------------------------]
 //[ ARB                                                   ]
 //[-------------------------------------------------------]
@@ -904,11 +909,14 @@ FNDEF_EX(glActiveShaderProgram,			PFNGLACTIVESHADERPROGRAMPROC);
 
 // GL_ARB_get_program_binary
 FNDEF_EX(glProgramParameteri,	PFNGLPROGRAMPARAMETERIPROC);
+FNDEF_EX(glGetProgramBinary,	PFNGLGETPROGRAMBINARYPROC);
+FNDEF_EX(glProgramBinary,		PFNGLPROGRAMBINARYPROC);
 
 // GL_ARB_uniform_buffer_object
 FNDEF_EX(glGetUniformBlockIndex,	PFNGLGETUNIFORMBLOCKINDEXPROC);
 FNDEF_EX(glUniformBlockBinding,		PFNGLUNIFORMBLOCKBINDINGPROC);
 FNDEF_EX(glBindBufferBase,			PFNGLBINDBUFFERBASEPROC);
+FNDEF_EX(glBindBufferRange,			PFNGLBINDBUFFERRANGEPROC);
 
 // GL_ARB_texture_buffer_object
 FNDEF_EX(glTexBufferARB,	PFNGLTEXBUFFERARBPROC);
@@ -970,6 +978,7 @@ FNDEF_EX(glCreateTextures,					PFNGLCREATETEXTURESPROC);
 FNDEF_EX(glCreateVertexArrays,				PFNGLCREATEVERTEXARRAYSPROC);
 FNDEF_EX(glNamedBufferData,					PFNGLNAMEDBUFFERDATAPROC);
 FNDEF_EX(glNamedBufferSubData,				PFNGLNAMEDBUFFERSUBDATAPROC);
+FNDEF_EX(glGetNamedBufferSubData,			PFNGLGETNAMEDBUFFERSUBDATAPROC);
 FNDEF_EX(glMapNamedBuffer,					PFNGLMAPNAMEDBUFFERPROC);
 FNDEF_EX(glUnmapNamedBuffer,				PFNGLUNMAPNAMEDBUFFERPROC);
 FNDEF_EX(glProgramUniform1i,				PFNGLPROGRAMUNIFORM1IPROC);
@@ -1009,12 +1018,28 @@ FNDEF_EX(glTextureStorage2D,			PFNGLTEXTURESTORAGE2DPROC);
 FNDEF_EX(glTextureStorage3D,			PFNGLTEXTURESTORAGE3DPROC);
 FNDEF_EX(glTextureStorage2DMultisample,	PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC);
 
+// GL_ARB_buffer_storage, only the direct state access (DSA) entry points are used
+FNDEF_EX(glNamedBufferStorage,	PFNGLNAMEDBUFFERSTORAGEPROC);
+FNDEF_EX(glMapNamedBufferRange,	PFNGLMAPNAMEDBUFFERRANGEPROC);
+FNDEF_EX(glTextureBufferRange,	PFNGLTEXTUREBUFFERRANGEPROC);
+
+// GL_ARB_sync
+FNDEF_EX(glFenceSync,		PFNGLFENCESYNCPROC);
+FNDEF_EX(glDeleteSync,		PFNGLDELETESYNCPROC);
+FNDEF_EX(glClientWaitSync,	PFNGLCLIENTWAITSYNCPROC);
+
 // GL_ARB_copy_image
 FNDEF_EX(glCopyImageSubData,	PFNGLCOPYIMAGESUBDATAPROC);
 
+// GL_ARB_copy_buffer
+FNDEF_EX(glCopyBufferSubData,	PFNGLCOPYBUFFERSUBDATAPROC);
+
 // GL_ARB_gl_spirv
 FNDEF_EX(glSpecializeShaderARB,	PFNGLSPECIALIZESHADERARBPROC);
 
+// GL_ARB_parallel_shader_compile
+FNDEF_EX(glMaxShaderCompilerThreadsARB,	PFNGLMAXSHADERCOMPILERTHREADSARBPROC);
+
 // GL_ARB_clip_control
 FNDEF_EX(glClipControl,	PFNGLCLIPCONTROLPROC);
 
@@ -1311,6 +1336,24 @@ namespace
 			return openGLShader;
 		}
 
+		/**
+		*  @brief
+		*    Ask the driver to keep the binary of the given OpenGL program retrievable, must be called before linking
+		*
+		*  @param[in] openGLProgram
+		*    OpenGL program which is about to be linked
+		*
+		*  @note
+		*    - Programs created via "glCreateShaderProgramv()" are linked at once, for those we have to rely on the driver keeping the binary around anyway
+		*/
+		void setProgramBinaryRetrievableHint(GLuint openGLProgram)
+		{
+			if (nullptr != glGetProgramBinary)
+			{
+				glProgramParameteri(openGLProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+			}
+		}
+
 		/**
 		*  @brief
 		*    Create and load a shader program from bytecode
@@ -1342,6 +1385,7 @@ namespace
 				// All went fine, create and return the program
 				const GLuint openGLProgram = glCreateProgram();
 				glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+				setProgramBinaryRetrievableHint(openGLProgram);
 				glAttachShader(openGLProgram, openGLShader);
 				glLinkProgram(openGLProgram);
 				glDetachShader(openGLProgram, openGLShader);
@@ -1424,6 +1468,7 @@ namespace
 				if (openGLProgram > 0)
 				{
 					glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+					setProgramBinaryRetrievableHint(openGLProgram);
 
 					// Attach the shader to the program
 					glAttachShader(openGLProgram, openGLShader);
@@ -1511,11 +1556,13 @@ namespace
 		*    Shader type (for example "GL_VERTEX_SHADER_ARB")
 		*  @param[in] sourceCode
 		*    Shader ASCII source code, must be a valid pointer
+		*  @param[in] checkCompileStatus
+		*    If "false", the compile status isn't queried so a driver compiling in the background isn't stalled, compile errors are then reported when linking
 		*
 		*  @return
 		*    The OpenGL shader, 0 on error, destroy the resource if you no longer need it
 		*/
-		[[nodiscard]] GLuint loadShaderFromSourcecode(const Rhi::Context& context, GLenum shaderType, const GLchar* sourceCode)
+		[[nodiscard]] GLuint loadShaderFromSourcecode(const Rhi::Context& context, GLenum shaderType, const GLchar* sourceCode, bool checkCompileStatus)
 		{
 			// Create the shader object
 			const GLuint openGLShader = glCreateShader(shaderType);
@@ -1525,6 +1572,10 @@ namespace
 
 			// Compile the shader
 			glCompileShader(openGLShader);
+			if (!checkCompileStatus)
+			{
+				return openGLShader;
+			}
 
 			// Check the compile status
 			GLint compiled = GL_FALSE;
@@ -1571,7 +1622,7 @@ namespace
 
 		[[nodiscard]] GLuint loadShaderProgramFromSourcecode(const Rhi::Context& context, const Rhi::VertexAttributes& vertexAttributes, GLenum type, const char* sourceCode)
 		{
-			return createShaderProgramObject(context, loadShaderFromSourcecode(context, type, sourceCode), vertexAttributes);
+			return createShaderProgramObject(context, loadShaderFromSourcecode(context, type, sourceCode, true), vertexAttributes);
 		}
 
 		/**
@@ -1750,6 +1801,211 @@ namespace
 			}
 		}
 
+		//[-------------------------------------------------------]
+		//[ Graphics program binary                               ]
+		//[-------------------------------------------------------]
+		// Layout of the opaque graphics program binary: "ProgramBinaryHeader" followed by "numberOfPrograms" times "ProgramBinaryEntry" and the OpenGL program binary bytes of the entry
+		// -> The driver hash is checked before handing anything over to OpenGL, so binaries of other drivers are rejected without relying on "glProgramBinary()" doing so
+		static constexpr uint32_t PROGRAM_BINARY_TYPE_MONOLITHIC		= 0;	///< One OpenGL program holding all shader stages
+		static constexpr uint32_t PROGRAM_BINARY_TYPE_SEPARATE			= 1;	///< One separable OpenGL program per shader stage ("GL_ARB_separate_shader_objects")
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS = 5;	///< Vertex, tessellation control, tessellation evaluation, geometry and fragment shader
+
+		struct ProgramBinaryHeader final
+		{
+			uint32_t driverHash;		///< Driver hash, see "OpenGLRhi::OpenGLRhi::getProgramBinaryDriverHash()"
+			uint32_t programBinaryType;	///< "PROGRAM_BINARY_TYPE_MONOLITHIC" or "PROGRAM_BINARY_TYPE_SEPARATE"
+			uint32_t numberOfPrograms;	///< Number of following program entries
+		};
+
+		struct ProgramBinaryEntry final
+		{
+			uint32_t shaderStageBit;	///< OpenGL shader stage bit (e.g. "GL_VERTEX_SHADER_BIT") of separable programs, 0 for monolithic programs
+			uint32_t binaryFormat;		///< OpenGL program binary format
+			uint32_t numberOfBytes;		///< Number of OpenGL program binary bytes following this entry
+		};
+
+		/**
+		*  @brief
+		*    Calculate the driver hash used to invalidate graphics program binaries on driver changes
+		*
+		*  @return
+		*    FNV-1a hash of the "GL_VENDOR", "GL_RENDERER" and "GL_VERSION" strings
+		*/
+		[[nodiscard]] uint32_t calculateProgramBinaryDriverHash()
+		{
+			static constexpr GLenum NAMES[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+			uint32_t hash = 2166136261u;	// FNV-1a 32 bit offset basis
+			for (GLenum name : NAMES)
+			{
+				const GLubyte* string = glGetString(name);
+				if (nullptr != string)
+				{
+					for (; 0 != *string; ++string)
+					{
+						hash = (hash ^ *string) * 16777619u;	// FNV-1a 32 bit prime
+					}
+				}
+			}
+			return hash;
+		}
+
+		/**
+		*  @brief
+		*    Write the binaries of the given linked OpenGL programs into an opaque graphics program binary
+		*
+		*  @param[in] context
+		*    RHI context to use
+		*  @param[in] driverHash
+		*    Driver hash, see "OpenGLRhi::OpenGLRhi::getProgramBinaryDriverHash()"
+		*  @param[in] programBinaryType
+		*    "PROGRAM_BINARY_TYPE_MONOLITHIC" or "PROGRAM_BINARY_TYPE_SEPARATE"
+		*  @param[in] openGLPrograms
+		*    Linked OpenGL programs, "numberOfPrograms" entries
+		*  @param[in] shaderStageBits
+		*    OpenGL shader stage bit per program, "numberOfPrograms" entries
+		*  @param[in] numberOfPrograms
+		*    Number of programs, must be in [1, "MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS"]
+		*  @param[out] graphicsProgramBinary
+		*    Receives the opaque graphics program binary, untouched on failure
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		[[nodiscard]] bool getProgramBinary(const Rhi::Context& context, uint32_t driverHash, uint32_t programBinaryType, const GLuint* openGLPrograms, const uint32_t* shaderStageBits, uint32_t numberOfPrograms, Rhi::ShaderBytecode& graphicsProgramBinary)
+		{
+			RHI_ASSERT(context, numberOfPrograms > 0 && numberOfPrograms <= MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS, "Invalid OpenGL number of programs")
+
+			// Gather the total number of bytes, a program without retrievable binary is no error since it's just a hint
+			GLint programBinaryLengths[MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			uint32_t numberOfBytes = sizeof(ProgramBinaryHeader);
+			for (uint32_t i = 0; i < numberOfPrograms; ++i)
+			{
+				if (0 == openGLPrograms[i])
+				{
+					return false;
+				}
+				glGetProgramiv(openGLPrograms[i], GL_PROGRAM_BINARY_LENGTH, &programBinaryLengths[i]);
+				if (programBinaryLengths[i] <= 0)
+				{
+					return false;
+				}
+				numberOfBytes += sizeof(ProgramBinaryEntry) + static_cast<uint32_t>(programBinaryLengths[i]);
+			}
+
+			// Write the header followed by the program entries
+			// -> Program binary lengths are arbitrary, so don't assume aligned entries
+			uint8_t* bytes = RHI_MALLOC_TYPED(context, uint8_t, numberOfBytes);
+			const ProgramBinaryHeader programBinaryHeader = { driverHash, programBinaryType, numberOfPrograms };
+			memcpy(bytes, &programBinaryHeader, sizeof(ProgramBinaryHeader));
+			uint8_t* currentBytes = bytes + sizeof(ProgramBinaryHeader);
+			bool result = true;
+			for (uint32_t i = 0; i < numberOfPrograms; ++i)
+			{
+				GLsizei numberOfWrittenBytes = 0;
+				GLenum binaryFormat = GL_NONE;
+				glGetProgramBinary(openGLPrograms[i], programBinaryLengths[i], &numberOfWrittenBytes, &binaryFormat, currentBytes + sizeof(ProgramBinaryEntry));
+				if (numberOfWrittenBytes != programBinaryLengths[i])
+				{
+					result = false;
+					break;
+				}
+				const ProgramBinaryEntry programBinaryEntry = { shaderStageBits[i], static_cast<uint32_t>(binaryFormat), static_cast<uint32_t>(numberOfWrittenBytes) };
+				memcpy(currentBytes, &programBinaryEntry, sizeof(ProgramBinaryEntry));
+				currentBytes += sizeof(ProgramBinaryEntry) + static_cast<uint32_t>(numberOfWrittenBytes);
+			}
+			if (result)
+			{
+				graphicsProgramBinary.setBytecodeCopy(numberOfBytes, bytes);
+			}
+			RHI_FREE(context, bytes);
+
+			// Done
+			return result;
+		}
+
+		/**
+		*  @brief
+		*    Restore the OpenGL programs of an opaque graphics program binary
+		*
+		*  @param[in] driverHash
+		*    Driver hash, see "OpenGLRhi::OpenGLRhi::getProgramBinaryDriverHash()"
+		*  @param[in] programBinaryType
+		*    "PROGRAM_BINARY_TYPE_MONOLITHIC" or "PROGRAM_BINARY_TYPE_SEPARATE"
+		*  @param[in] graphicsProgramBinary
+		*    Opaque graphics program binary
+		*  @param[out] openGLPrograms
+		*    Receives the linked OpenGL programs, "MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS" entries, destroy the programs if you no longer need them
+		*  @param[out] shaderStageBits
+		*    Receives the OpenGL shader stage bit per program, "MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS" entries
+		*
+		*  @return
+		*    The number of restored programs, 0 if the graphics program binary was rejected (no OpenGL program is left behind in this case)
+		*/
+		[[nodiscard]] uint32_t loadProgramBinary(uint32_t driverHash, uint32_t programBinaryType, const Rhi::ShaderBytecode& graphicsProgramBinary, GLuint* openGLPrograms, uint32_t* shaderStageBits)
+		{
+			// Check the header
+			const uint8_t* currentBytes = graphicsProgramBinary.getBytecode();
+			const uint8_t* endBytes = currentBytes + graphicsProgramBinary.getNumberOfBytes();
+			ProgramBinaryHeader programBinaryHeader = {};
+			if (nullptr == currentBytes || graphicsProgramBinary.getNumberOfBytes() < sizeof(ProgramBinaryHeader))
+			{
+				return 0;
+			}
+			memcpy(&programBinaryHeader, currentBytes, sizeof(ProgramBinaryHeader));
+			currentBytes += sizeof(ProgramBinaryHeader);
+			if (programBinaryHeader.driverHash != driverHash || programBinaryHeader.programBinaryType != programBinaryType || 0 == programBinaryHeader.numberOfPrograms || programBinaryHeader.numberOfPrograms > MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS)
+			{
+				return 0;
+			}
+
+			// Restore the programs, the driver is still allowed to reject the binaries (e.g. hardware or driver change not visible in the driver strings)
+			uint32_t numberOfPrograms = 0;
+			for (; numberOfPrograms < programBinaryHeader.numberOfPrograms; ++numberOfPrograms)
+			{
+				ProgramBinaryEntry programBinaryEntry = {};
+				if (static_cast<size_t>(endBytes - currentBytes) < sizeof(ProgramBinaryEntry))
+				{
+					break;
+				}
+				memcpy(&programBinaryEntry, currentBytes, sizeof(ProgramBinaryEntry));
+				currentBytes += sizeof(ProgramBinaryEntry);
+				if (static_cast<size_t>(endBytes - currentBytes) < programBinaryEntry.numberOfBytes)
+				{
+					break;
+				}
+
+				// Separable programs must be flagged as such before the binary is loaded
+				const GLuint openGLProgram = glCreateProgram();
+				if (PROGRAM_BINARY_TYPE_SEPARATE == programBinaryType)
+				{
+					glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+				}
+				glProgramBinary(openGLProgram, static_cast<GLenum>(programBinaryEntry.binaryFormat), currentBytes, static_cast<GLsizei>(programBinaryEntry.numberOfBytes));
+				currentBytes += programBinaryEntry.numberOfBytes;
+				GLint linked = GL_FALSE;
+				glGetProgramiv(openGLProgram, GL_LINK_STATUS, &linked);
+				if (GL_TRUE != linked)
+				{
+					glDeleteProgram(openGLProgram);
+					break;
+				}
+				openGLPrograms[numberOfPrograms] = openGLProgram;
+				shaderStageBits[numberOfPrograms] = programBinaryEntry.shaderStageBit;
+			}
+			if (numberOfPrograms != programBinaryHeader.numberOfPrograms)
+			{
+				// Rejected, destroy what has been restored so far
+				for (uint32_t i = 0; i < numberOfPrograms; ++i)
+				{
+					glDeleteProgram(openGLPrograms[i]);
+				}
+				return 0;
+			}
+
+			// Done
+			return numberOfPrograms;
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -1853,6 +2109,36 @@ namespace OpenGLRhi
 			return *mExtensions;
 		}
 
+		/**
+		*  @brief
+		*    Return the driver hash graphics program binaries are tagged with
+		*
+		*  @return
+		*    The driver hash, changes if the "GL_VENDOR", "GL_RENDERER" or "GL_VERSION" string changes
+		*/
+		[[nodiscard]] inline uint32_t getProgramBinaryDriverHash() const
+		{
+			return mProgramBinaryDriverHash;
+		}
+
+		/**
+		*  @brief
+		*    Point the OpenGL uniform buffer binding points using the given persistent mapped uniform buffer to its current region
+		*
+		*  @param[in] uniformBuffer
+		*    Persistent mapped uniform buffer which just moved on to a new region
+		*/
+		void rebindPersistentUniformBuffer(const UniformBuffer& uniformBuffer);
+
+		/**
+		*  @brief
+		*    Forget about the given persistent mapped uniform buffer, called by the uniform buffer destructor
+		*
+		*  @param[in] uniformBuffer
+		*    Persistent mapped uniform buffer which is about to be destroyed
+		*/
+		void unbindPersistentUniformBuffer(const UniformBuffer& uniformBuffer);
+
 		void dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer);
 
 		//[-------------------------------------------------------]
@@ -1976,6 +2262,13 @@ namespace OpenGLRhi
 		static void CALLBACK debugMessageCallback(uint32_t source, uint32_t type, uint32_t id, uint32_t severity, int length, const char* message, const void* userParam);
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_PERSISTENT_UNIFORM_BUFFER_BINDINGS = 64;	///< Uniform block binding indices are assigned sequentially per root signature, so they stay small
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -2049,6 +2342,7 @@ namespace OpenGLRhi
 		Rhi::ISamplerState*   mDefaultSamplerState;				///< Default rasterizer state (we keep a reference to it), can be a null pointer
 		GLuint				  mOpenGLCopyResourceFramebuffer;	///< OpenGL framebuffer ("container" object, not shared between OpenGL contexts) used by "OpenGLRhi::OpenGLRhi::copyResource()" if the "GL_ARB_copy_image"-extension isn't available, can be zero if no resource is allocated
 		GLuint				  mDefaultOpenGLVertexArray;		///< Default OpenGL vertex array ("container" object, not shared between OpenGL contexts) to enable attribute-less rendering, can be zero if no resource is allocated
+		uint32_t			  mProgramBinaryDriverHash;			///< Driver hash graphics program binaries are tagged with, see "OpenGLRhi::OpenGLRhi::getProgramBinaryDriverHash()"
 		// States
 		GraphicsPipelineState* mGraphicsPipelineState;	///< Currently set graphics pipeline state (we keep a reference to it), can be a null pointer
 		ComputePipelineState*  mComputePipelineState;	///< Currently set compute pipeline state (we keep a reference to it), can be a null pointer
@@ -2063,6 +2357,8 @@ namespace OpenGLRhi
 		GLuint mOpenGLProgramPipeline;		///< Currently set OpenGL program pipeline, can be zero if no resource is set
 		GLuint mOpenGLProgram;				///< Currently set OpenGL program, can be zero if no resource is set
 		GLuint mOpenGLIndirectBuffer;		///< Currently set OpenGL indirect buffer, can be zero if no resource is set
+		// Persistent mapped uniform buffers currently attached to the OpenGL uniform buffer binding points, needed to follow their region changes
+		const UniformBuffer* mPersistentUniformBufferBindings[MAXIMUM_NUMBER_OF_PERSISTENT_UNIFORM_BUFFER_BINDINGS];	///< Indexed by uniform block binding index, entries can be null pointers
 		// Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		GLuint	 mOpenGLVertexProgram;			///< Currently set OpenGL vertex program, can be zero if no resource is set
 		GLint	 mDrawIdUniformLocation;		///< Draw ID uniform location
@@ -2441,6 +2737,11 @@ namespace OpenGLRhi
 			return mGL_KHR_debug;
 		}
 
+		[[nodiscard]] inline bool isGL_KHR_parallel_shader_compile() const
+		{
+			return mGL_KHR_parallel_shader_compile;
+		}
+
 		// ARB
 		[[nodiscard]] inline bool isGL_ARB_framebuffer_object() const
 		{
@@ -2587,6 +2888,16 @@ namespace OpenGLRhi
 			return mGL_ARB_texture_storage;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_buffer_storage() const
+		{
+			return mGL_ARB_buffer_storage;
+		}
+
+		[[nodiscard]] inline bool isGL_ARB_sync() const
+		{
+			return mGL_ARB_sync;
+		}
+
 		[[nodiscard]] inline bool isGL_ARB_shader_storage_buffer_object() const
 		{
 			return mGL_ARB_shader_storage_buffer_object;
@@ -2597,11 +2908,21 @@ namespace OpenGLRhi
 			return mGL_ARB_copy_image;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_copy_buffer() const
+		{
+			return mGL_ARB_copy_buffer;
+		}
+
 		[[nodiscard]] inline bool isGL_ARB_gl_spirv() const
 		{
 			return mGL_ARB_gl_spirv;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_parallel_shader_compile() const
+		{
+			return mGL_ARB_parallel_shader_compile;
+		}
+
 		[[nodiscard]] inline bool isGL_ARB_clip_control() const
 		{
 			return mGL_ARB_clip_control;
@@ -2798,6 +3119,7 @@ namespace OpenGLRhi
 			mGL_EXT_shader_image_load_store		 = false;
 			// KHR
 			mGL_KHR_debug						 = false;
+			mGL_KHR_parallel_shader_compile		 = false;
 			// ARB
 			mGL_ARB_framebuffer_object			 = false;
 			mGL_ARB_multitexture				 = false;
@@ -2828,9 +3150,13 @@ namespace OpenGLRhi
 			mGL_ARB_debug_output				 = false;
 			mGL_ARB_direct_state_access			 = false;
 			mGL_ARB_texture_storage				 = false;
+			mGL_ARB_buffer_storage				 = false;
+			mGL_ARB_sync						 = false;
 			mGL_ARB_shader_storage_buffer_object = false;
 			mGL_ARB_copy_image					 = false;
+			mGL_ARB_copy_buffer					 = false;
 			mGL_ARB_gl_spirv					 = false;
+			mGL_ARB_parallel_shader_compile		 = false;
 			mGL_ARB_clip_control				 = false;
 			mGL_ARB_occlusion_query				 = false;
 			mGL_ARB_pipeline_statistics_query	 = false;
@@ -3102,6 +3428,17 @@ namespace OpenGLRhi
 				mGL_KHR_debug = result;
 			}
 
+			// GL_KHR_parallel_shader_compile
+			mGL_KHR_parallel_shader_compile = isSupported("GL_KHR_parallel_shader_compile");
+			if (mGL_KHR_parallel_shader_compile)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glMaxShaderCompilerThreadsKHR)
+				IMPORT_FUNC(glGetAttachedShaders)
+				mGL_KHR_parallel_shader_compile = result;
+			}
+
 
 			//[-------------------------------------------------------]
 			//[ ARB                                                   ]
@@ -3243,6 +3580,8 @@ namespace OpenGLRhi
 				// Load the entry points
 				bool result = true;	// Success by default
 				IMPORT_FUNC(glProgramParameteri)
+				IMPORT_FUNC(glGetProgramBinary)
+				IMPORT_FUNC(glProgramBinary)
 				mGL_ARB_get_program_binary = result;
 			}
 
@@ -3255,6 +3594,7 @@ namespace OpenGLRhi
 				IMPORT_FUNC(glGetUniformBlockIndex)
 				IMPORT_FUNC(glUniformBlockBinding)
 				IMPORT_FUNC(glBindBufferBase)
+				IMPORT_FUNC(glBindBufferRange)
 				mGL_ARB_uniform_buffer_object = result;
 			}
 
@@ -3438,6 +3778,7 @@ namespace OpenGLRhi
 				IMPORT_FUNC(glCreateVertexArrays)
 				IMPORT_FUNC(glNamedBufferData)
 				IMPORT_FUNC(glNamedBufferSubData)
+				IMPORT_FUNC(glGetNamedBufferSubData)
 				IMPORT_FUNC(glMapNamedBuffer)
 				IMPORT_FUNC(glUnmapNamedBuffer)
 				IMPORT_FUNC(glProgramUniform1i)
@@ -3486,6 +3827,31 @@ namespace OpenGLRhi
 				mGL_ARB_texture_storage = result;
 			}
 
+			// GL_ARB_buffer_storage - Is core since OpenGL 4.4
+			// -> Only the direct state access (DSA) entry points are used, so "GL_ARB_direct_state_access" is required as well
+			mGL_ARB_buffer_storage = (mGL_ARB_direct_state_access && isSupported("GL_ARB_buffer_storage"));
+			if (mGL_ARB_buffer_storage)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glNamedBufferStorage)
+				IMPORT_FUNC(glMapNamedBufferRange)
+				IMPORT_FUNC(glTextureBufferRange)
+				mGL_ARB_buffer_storage = result;
+			}
+
+			// GL_ARB_sync - Is core since OpenGL 3.2
+			mGL_ARB_sync = isCoreProfile ? true : isSupported("GL_ARB_sync");
+			if (mGL_ARB_sync)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glFenceSync)
+				IMPORT_FUNC(glDeleteSync)
+				IMPORT_FUNC(glClientWaitSync)
+				mGL_ARB_sync = result;
+			}
+
 			// GL_ARB_shader_storage_buffer_object - Is core since OpenGL 4.3
 			mGL_ARB_shader_storage_buffer_object = isSupported("GL_ARB_shader_storage_buffer_object");
 
@@ -3499,6 +3865,16 @@ namespace OpenGLRhi
 				mGL_ARB_copy_image = result;
 			}
 
+			// GL_ARB_copy_buffer - Is core since OpenGL 3.1
+			mGL_ARB_copy_buffer = isSupported("GL_ARB_copy_buffer");
+			if (mGL_ARB_copy_buffer)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glCopyBufferSubData)
+				mGL_ARB_copy_buffer = result;
+			}
+
 			// GL_ARB_gl_spirv
 			mGL_ARB_gl_spirv = isSupported("GL_ARB_gl_spirv");
 			if (mGL_ARB_gl_spirv)
@@ -3512,6 +3888,17 @@ namespace OpenGLRhi
 				mGL_ARB_gl_spirv = false;
 			}
 
+			// GL_ARB_parallel_shader_compile
+			mGL_ARB_parallel_shader_compile = isSupported("GL_ARB_parallel_shader_compile");
+			if (mGL_ARB_parallel_shader_compile)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glMaxShaderCompilerThreadsARB)
+				IMPORT_FUNC(glGetAttachedShaders)
+				mGL_ARB_parallel_shader_compile = result;
+			}
+
 			// GL_ARB_clip_control
 			mGL_ARB_clip_control = isSupported("GL_ARB_clip_control");
 			if (mGL_ARB_clip_control)
@@ -3591,6 +3978,7 @@ namespace OpenGLRhi
 		bool mGL_EXT_shader_image_load_store;
 		// KHR
 		bool mGL_KHR_debug;
+		bool mGL_KHR_parallel_shader_compile;
 		// ARB
 		bool mGL_ARB_framebuffer_object;
 		bool mGL_ARB_multitexture;
@@ -3621,9 +4009,13 @@ namespace OpenGLRhi
 		bool mGL_ARB_debug_output;
 		bool mGL_ARB_direct_state_access;
 		bool mGL_ARB_texture_storage;
+		bool mGL_ARB_buffer_storage;
+		bool mGL_ARB_sync;
 		bool mGL_ARB_shader_storage_buffer_object;
 		bool mGL_ARB_copy_image;
+		bool mGL_ARB_copy_buffer;
 		bool mGL_ARB_gl_spirv;
+		bool mGL_ARB_parallel_shader_compile;
 		bool mGL_ARB_clip_control;
 		bool mGL_ARB_occlusion_query;
 		bool mGL_ARB_pipeline_statistics_query;
@@ -5502,6 +5894,283 @@ namespace OpenGLRhi
 
 
 
+	//[-------------------------------------------------------]
+	//[ OpenGLRhi/Buffer/PersistentBufferRegions.h            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Persistent and coherent mapped OpenGL buffer storage split into triple-buffered regions guarded by fences
+	*
+	*  @remarks
+	*    Used for "Rhi::BufferUsage::DYNAMIC_DRAW" buffers if "GL_ARB_buffer_storage" and "GL_ARB_sync" are available. The immutable OpenGL buffer
+	*    storage has room for "NUMBER_OF_REGIONS" copies of the buffer data and stays mapped during the whole buffer lifetime, so updating the buffer
+	*    doesn't force the implicit driver synchronization of "glMapBuffer()"/"glBufferSubData()". Each write-discard map moves on to the next region.
+	*    When leaving a region a fence is inserted, when entering a region the CPU waits for its fence so the GPU is never reading data the CPU is writing.
+	*    The mapping is write-only, all other map types go through a staging copy which is uploaded by "glNamedBufferSubData()" on unmap.
+	*
+	*    The buffer owner is responsible for pointing the OpenGL bindings to the current region. Buffers which are updated more often than once per frame
+	*    will make the CPU wait for the GPU.
+	*/
+	class PersistentBufferRegions final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_REGIONS			  = 3;			///< Triple buffering: While the CPU writes into one region the GPU might still read from the two others
+		static constexpr GLuint64 SYNC_TIMEOUT_IN_NANOSECONDS = 1000000000;	///< Fence wait timeout, the wait is repeated until the fence is signaled
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return whether or not persistent buffer regions should be used for a buffer
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] bufferUsage
+		*    Indication of the buffer usage
+		*
+		*  @return
+		*    "true" if persistent buffer regions should be used, else "false"
+		*/
+		[[nodiscard]] static inline bool isSupported(const OpenGLRhi& openGLRhi, Rhi::BufferUsage bufferUsage)
+		{
+			return (Rhi::BufferUsage::DYNAMIC_DRAW == bufferUsage && openGLRhi.getExtensions().isGL_ARB_buffer_storage() && openGLRhi.getExtensions().isGL_ARB_sync());
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline PersistentBufferRegions() :
+			mOpenGLBuffer(0),
+			mMappedData(nullptr),
+			mNumberOfBytes(0),
+			mNumberOfRegionBytes(0),
+			mCurrentRegionIndex(0),
+			mOpenGLSyncs{},
+			mStagingData(nullptr)
+		{}
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - The OpenGL buffer is owned by the buffer class, destroying it also unmaps the persistent mapping
+		*/
+		inline ~PersistentBufferRegions()
+		{
+			for (GLsync openGLSync : mOpenGLSyncs)
+			{
+				if (nullptr != openGLSync)
+				{
+					glDeleteSync(openGLSync);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Allocate the immutable OpenGL buffer storage and persistently map it
+		*
+		*  @param[in, out] openGLBuffer
+		*    OpenGL buffer created by "glCreateBuffers()" without any storage, on failure it's replaced by a new OpenGL buffer without any storage
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer, must be valid
+		*  @param[in] data
+		*    Buffer data, can be a null pointer (empty buffer), copied into the first region
+		*  @param[in] regionAlignment
+		*    Alignment of the region offsets in bytes, e.g. "GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT", must be a power of two
+		*
+		*  @return
+		*    "true" if all went fine, else "false" in which case the caller has to fall back to mutable OpenGL buffer storage
+		*/
+		[[nodiscard]] bool initialize(GLuint& openGLBuffer, uint32_t numberOfBytes, const void* data, GLint regionAlignment)
+		{
+			// Allocate and map the immutable OpenGL buffer storage
+			const GLsizeiptr alignment = std::max(static_cast<GLsizeiptr>(regionAlignment), static_cast<GLsizeiptr>(1));
+			// -> No "GL_MAP_READ_BIT", reading from the mapping would be uncached and might force the driver to place the storage into slower memory
+			// -> "GL_DYNAMIC_STORAGE_BIT" allows "glNamedBufferSubData()" uploads of the staging copy
+			const GLbitfield openGLMapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			mNumberOfBytes = numberOfBytes;
+			mNumberOfRegionBytes = (static_cast<GLsizeiptr>(numberOfBytes) + alignment - 1) & ~(alignment - 1);
+			glNamedBufferStorage(openGLBuffer, mNumberOfRegionBytes * NUMBER_OF_REGIONS, nullptr, openGLMapFlags | GL_DYNAMIC_STORAGE_BIT);
+			mMappedData = static_cast<uint8_t*>(glMapNamedBufferRange(openGLBuffer, 0, mNumberOfRegionBytes * NUMBER_OF_REGIONS, openGLMapFlags));
+			if (nullptr == mMappedData)
+			{
+				// Error! The immutable storage can't be respecified, hand out a fresh OpenGL buffer.
+				glDeleteBuffersARB(1, &openGLBuffer);
+				glCreateBuffers(1, &openGLBuffer);
+				return false;
+			}
+
+			// Upload the initial data
+			if (nullptr != data)
+			{
+				memcpy(mMappedData, data, numberOfBytes);
+			}
+
+			// Done
+			mOpenGLBuffer = openGLBuffer;
+			return true;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the buffer is persistently mapped
+		*
+		*  @return
+		*    "true" if the buffer is persistently mapped, else "false"
+		*/
+		[[nodiscard]] inline bool isInitialized() const
+		{
+			return (nullptr != mMappedData);
+		}
+
+		/**
+		*  @brief
+		*    Return the number of bytes within the buffer
+		*
+		*  @return
+		*    The number of bytes within the buffer, this is the size of the OpenGL buffer binding range
+		*/
+		[[nodiscard]] inline GLsizeiptr getNumberOfBytes() const
+		{
+			return static_cast<GLsizeiptr>(mNumberOfBytes);
+		}
+
+		/**
+		*  @brief
+		*    Return the byte offset of the current region
+		*
+		*  @return
+		*    The byte offset of the current region inside the OpenGL buffer, this is the offset of the OpenGL buffer binding range
+		*/
+		[[nodiscard]] inline GLintptr getCurrentRegionOffset() const
+		{
+			return static_cast<GLintptr>(mCurrentRegionIndex * mNumberOfRegionBytes);
+		}
+
+		/**
+		*  @brief
+		*    Return the data of the current region, or of the next region for write-discard
+		*
+		*  @param[in] context
+		*    RHI context, used for the staging copy allocation
+		*  @param[in] mapType
+		*    Map type
+		*
+		*  @return
+		*    Mapped data of the now current region, valid as long as the buffer exists
+		*
+		*  @note
+		*    - "Rhi::MapType::WRITE_DISCARD" moves on to the next region, the caller must point the OpenGL bindings to the new current region afterwards
+		*    - "Rhi::MapType::WRITE_NO_OVERWRITE" returns the current region without any synchronization
+		*    - The other map types return a staging copy of the current region, "OpenGLRhi::PersistentBufferRegions::unmap()" uploads it
+		*/
+		[[nodiscard]] uint8_t* map(const Rhi::Context& context, Rhi::MapType mapType)
+		{
+			if (Rhi::MapType::WRITE_DISCARD == mapType)
+			{
+				// The GPU might still be reading the current region, guard it by a fence and move on to the next region
+				mOpenGLSyncs[mCurrentRegionIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				mCurrentRegionIndex = (mCurrentRegionIndex + 1) % NUMBER_OF_REGIONS;
+				waitForRegion(mCurrentRegionIndex);
+			}
+			else if (Rhi::MapType::WRITE_NO_OVERWRITE != mapType)
+			{
+				// The mapping is write-only and the GPU might still be reading the current region, so hand out a staging copy instead of waiting for
+				// the GPU. The buffer content must be preserved, the GPU never writes into these buffers so the readback doesn't need to wait for it.
+				RHI_ASSERT(context, nullptr == mStagingData, "The OpenGL persistent buffer is already mapped")
+				mStagingData = RHI_MALLOC_TYPED(context, uint8_t, mNumberOfBytes);
+				glGetNamedBufferSubData(mOpenGLBuffer, getCurrentRegionOffset(), getNumberOfBytes(), mStagingData);
+				return mStagingData;
+			}
+			return mMappedData + mCurrentRegionIndex * mNumberOfRegionBytes;
+		}
+
+		/**
+		*  @brief
+		*    Finish a map
+		*
+		*  @param[in] context
+		*    RHI context, used for the staging copy deallocation
+		*
+		*  @note
+		*    - The persistent mapping is coherent and stays mapped, only a staging copy needs to be uploaded
+		*    - The staging copy is uploaded by "glNamedBufferSubData()", the OpenGL driver takes care of not overwriting data the GPU is still reading
+		*/
+		void unmap(const Rhi::Context& context)
+		{
+			if (nullptr != mStagingData)
+			{
+				glNamedBufferSubData(mOpenGLBuffer, getCurrentRegionOffset(), getNumberOfBytes(), mStagingData);
+				RHI_FREE(context, mStagingData);
+				mStagingData = nullptr;
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit PersistentBufferRegions(const PersistentBufferRegions& source) = delete;
+		PersistentBufferRegions& operator =(const PersistentBufferRegions& source) = delete;
+
+		/**
+		*  @brief
+		*    Wait until the GPU is done with the given region
+		*
+		*  @param[in] regionIndex
+		*    Index of the region to wait for
+		*/
+		void waitForRegion(uint32_t regionIndex)
+		{
+			GLsync& openGLSync = mOpenGLSyncs[regionIndex];
+			if (nullptr != openGLSync)
+			{
+				GLenum result = GL_TIMEOUT_EXPIRED;
+				do
+				{
+					result = glClientWaitSync(openGLSync, GL_SYNC_FLUSH_COMMANDS_BIT, SYNC_TIMEOUT_IN_NANOSECONDS);
+				} while (GL_TIMEOUT_EXPIRED == result);
+				glDeleteSync(openGLSync);
+				openGLSync = nullptr;
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		GLuint	   mOpenGLBuffer;					///< OpenGL buffer, not owned by us, zero if not initialized
+		uint8_t*   mMappedData;						///< Persistently mapped data of all regions, null pointer if not initialized
+		uint32_t   mNumberOfBytes;					///< Number of bytes within the buffer
+		GLsizeiptr mNumberOfRegionBytes;			///< Number of bytes per region, aligned
+		uint32_t   mCurrentRegionIndex;				///< Index of the region the OpenGL bindings are pointing to
+		GLsync	   mOpenGLSyncs[NUMBER_OF_REGIONS];	///< Per region fence, null pointer if the region isn't guarded
+		uint8_t*   mStagingData;					///< Staging copy handed out by maps which aren't write-discard or write-no-overwrite, null pointer if not mapped
+
+
+	};
+
+
+
+
 	//[-------------------------------------------------------]
 	//[ OpenGLRhi/Buffer/VertexBuffer.h                       ]
 	//[-------------------------------------------------------]
@@ -6880,26 +7549,50 @@ namespace OpenGLRhi
 
 		/**
 		*  @brief
-		*    Return the OpenGL texture instance
+		*    Return the OpenGL texture instance
+		*
+		*  @return
+		*    The OpenGL texture instance, can be zero if no resource is allocated
+		*/
+		[[nodiscard]] inline GLuint getOpenGLTexture() const
+		{
+			return mOpenGLTexture;
+		}
+
+		/**
+		*  @brief
+		*    Return the OpenGL internal format
+		*
+		*  @return
+		*    The OpenGL internal format
+		*/
+		[[nodiscard]] inline GLuint getOpenGLInternalFormat() const
+		{
+			return mOpenGLInternalFormat;
+		}
+
+		/**
+		*  @brief
+		*    Return the persistent buffer regions
 		*
 		*  @return
-		*    The OpenGL texture instance, can be zero if no resource is allocated
+		*    The persistent buffer regions, not initialized if the texture buffer isn't persistently mapped
 		*/
-		[[nodiscard]] inline GLuint getOpenGLTexture() const
+		[[nodiscard]] inline const PersistentBufferRegions& getPersistentBufferRegions() const
 		{
-			return mOpenGLTexture;
+			return mPersistentBufferRegions;
 		}
 
 		/**
 		*  @brief
-		*    Return the OpenGL internal format
+		*    Return the persistent buffer regions
 		*
 		*  @return
-		*    The OpenGL internal format
+		*    The persistent buffer regions, not initialized if the texture buffer isn't persistently mapped
 		*/
-		[[nodiscard]] inline GLuint getOpenGLInternalFormat() const
+		[[nodiscard]] inline PersistentBufferRegions& getPersistentBufferRegions()
 		{
-			return mOpenGLInternalFormat;
+			return mPersistentBufferRegions;
 		}
 
 
@@ -6938,9 +7631,10 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLTextureBuffer;	///< OpenGL texture buffer, can be zero if no resource is allocated
-		GLuint mOpenGLTexture;			///< OpenGL texture, can be zero if no resource is allocated
-		GLuint mOpenGLInternalFormat;	///< OpenGL internal format
+		GLuint					mOpenGLTextureBuffer;		///< OpenGL texture buffer, can be zero if no resource is allocated
+		GLuint					mOpenGLTexture;				///< OpenGL texture, can be zero if no resource is allocated
+		GLuint					mOpenGLInternalFormat;		///< OpenGL internal format
+		PersistentBufferRegions mPersistentBufferRegions;	///< Persistent buffer regions, only initialized for persistent mapped texture buffers
 
 
 	//[-------------------------------------------------------]
@@ -7103,17 +7797,35 @@ namespace OpenGLRhi
 					// Create the OpenGL texture buffer
 					glCreateBuffers(1, &mOpenGLTextureBuffer);
 
+					// Dynamic texture buffers are persistently mapped if possible
+					if (PersistentBufferRegions::isSupported(openGLRhi, bufferUsage))
+					{
+						GLint openGLTextureBufferOffsetAlignment = 0;
+						glGetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &openGLTextureBufferOffsetAlignment);
+						[[maybe_unused]] const bool result = mPersistentBufferRegions.initialize(mOpenGLTextureBuffer, numberOfBytes, data, openGLTextureBufferOffsetAlignment);
+					}
+
 					// Upload the data
 					// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-					glNamedBufferData(mOpenGLTextureBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+					if (!mPersistentBufferRegions.isInitialized())
+					{
+						glNamedBufferData(mOpenGLTextureBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+					}
 				}
 
 				{ // Texture part
 					// Create the OpenGL texture instance
 					glCreateTextures(GL_TEXTURE_BUFFER_ARB, 1, &mOpenGLTexture);
 
-					// Attach the storage for the buffer object to the buffer texture
-					glTextureBuffer(mOpenGLTexture, mOpenGLInternalFormat, mOpenGLTextureBuffer);
+					// Attach the storage for the buffer object to the buffer texture, for persistent mapped texture buffers only the current region
+					if (mPersistentBufferRegions.isInitialized())
+					{
+						glTextureBufferRange(mOpenGLTexture, mOpenGLInternalFormat, mOpenGLTextureBuffer, mPersistentBufferRegions.getCurrentRegionOffset(), mPersistentBufferRegions.getNumberOfBytes());
+					}
+					else
+					{
+						glTextureBuffer(mOpenGLTexture, mOpenGLInternalFormat, mOpenGLTextureBuffer);
+					}
 				}
 			}
 			else
@@ -7220,6 +7932,18 @@ namespace OpenGLRhi
 			return mOpenGLStructuredBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return the number of bytes within the structured buffer
+		*
+		*  @return
+		*    The number of bytes within the structured buffer
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfBytes() const
+		{
+			return mNumberOfBytes;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -7241,10 +7965,13 @@ namespace OpenGLRhi
 		*
 		*  @param[in] openGLRhi
 		*    Owner OpenGL RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the structured buffer
 		*/
-		inline explicit StructuredBuffer(OpenGLRhi& openGLRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+		inline StructuredBuffer(OpenGLRhi& openGLRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IStructuredBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLStructuredBuffer(0)
+			mOpenGLStructuredBuffer(0),
+			mNumberOfBytes(numberOfBytes)
 		{}
 
 
@@ -7252,7 +7979,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLStructuredBuffer;	///< OpenGL structured buffer, can be zero if no resource is allocated
+		GLuint	 mOpenGLStructuredBuffer;	///< OpenGL structured buffer, can be zero if no resource is allocated
+		uint32_t mNumberOfBytes;			///< Number of bytes within the structured buffer
 
 
 	//[-------------------------------------------------------]
@@ -7297,7 +8025,7 @@ namespace OpenGLRhi
 		*    Indication of the buffer usage
 		*/
 		StructuredBufferBind(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
-			StructuredBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+			StructuredBuffer(openGLRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
 			#ifdef RHI_OPENGL_STATE_CLEANUP
 				// Backup the currently bound OpenGL structured buffer
@@ -7378,7 +8106,7 @@ namespace OpenGLRhi
 		*    Indication of the buffer usage
 		*/
 		StructuredBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
-			StructuredBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+			StructuredBuffer(openGLRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
@@ -7469,6 +8197,30 @@ namespace OpenGLRhi
 			return mOpenGLIndirectBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return the persistent buffer regions
+		*
+		*  @return
+		*    The persistent buffer regions, not initialized if the indirect buffer isn't persistently mapped
+		*/
+		[[nodiscard]] inline const PersistentBufferRegions& getPersistentBufferRegions() const
+		{
+			return mPersistentBufferRegions;
+		}
+
+		/**
+		*  @brief
+		*    Return the persistent buffer regions
+		*
+		*  @return
+		*    The persistent buffer regions, not initialized if the indirect buffer isn't persistently mapped
+		*/
+		[[nodiscard]] inline PersistentBufferRegions& getPersistentBufferRegions()
+		{
+			return mPersistentBufferRegions;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Rhi::IIndirectBuffer methods           ]
@@ -7511,7 +8263,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated
+		GLuint					mOpenGLIndirectBuffer;		///< OpenGL indirect buffer, can be zero if no resource is allocated
+		PersistentBufferRegions mPersistentBufferRegions;	///< Persistent buffer regions, only initialized for persistent mapped indirect buffers
 
 
 	//[-------------------------------------------------------]
@@ -7633,10 +8386,12 @@ namespace OpenGLRhi
 		*    Number of bytes within the indirect buffer, must be valid
 		*  @param[in] data
 		*    Indirect buffer data, can be a null pointer (empty buffer), the data is internally copied and you have to free your memory if you no longer need it
+		*  @param[in] indirectBufferFlags
+		*    Indirect buffer flags, see "Rhi::IndirectBufferFlag"
 		*  @param[in] bufferUsage
 		*    Indication of the buffer usage
 		*/
-		IndirectBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		IndirectBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, uint32_t indirectBufferFlags, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IndirectBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
@@ -7644,9 +8399,20 @@ namespace OpenGLRhi
 				// Create the OpenGL indirect buffer
 				glCreateBuffers(1, &mOpenGLIndirectBuffer);
 
+				// Dynamic indirect buffers are persistently mapped if possible
+				// -> Not for indirect buffers which are also bound as shader storage buffer, the binding points wouldn't follow the region changes
+				// -> Indirect draw command offsets must be a multiple of four bytes
+				if (0 == (indirectBufferFlags & (Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::SHADER_RESOURCE)) && PersistentBufferRegions::isSupported(openGLRhi, bufferUsage))
+				{
+					[[maybe_unused]] const bool result = mPersistentBufferRegions.initialize(mOpenGLIndirectBuffer, numberOfBytes, data, static_cast<GLint>(sizeof(uint32_t)));
+				}
+
 				// Upload the data
 				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				if (!mPersistentBufferRegions.isInitialized())
+				{
+					glNamedBufferData(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				}
 			}
 			else
 			{
@@ -7710,6 +8476,12 @@ namespace OpenGLRhi
 		*/
 		inline virtual ~UniformBuffer() override
 		{
+			// Persistent mapped uniform buffers are tracked by the OpenGL RHI
+			if (mPersistentBufferRegions.isInitialized())
+			{
+				static_cast<OpenGLRhi&>(getRhi()).unbindPersistentUniformBuffer(*this);
+			}
+
 			// Destroy the OpenGL uniform buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
 			glDeleteBuffersARB(1, &mOpenGLUniformBuffer);
@@ -7727,6 +8499,30 @@ namespace OpenGLRhi
 			return mOpenGLUniformBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return the persistent buffer regions
+		*
+		*  @return
+		*    The persistent buffer regions, not initialized if the uniform buffer isn't persistently mapped
+		*/
+		[[nodiscard]] inline const PersistentBufferRegions& getPersistentBufferRegions() const
+		{
+			return mPersistentBufferRegions;
+		}
+
+		/**
+		*  @brief
+		*    Return the persistent buffer regions
+		*
+		*  @return
+		*    The persistent buffer regions, not initialized if the uniform buffer isn't persistently mapped
+		*/
+		[[nodiscard]] inline PersistentBufferRegions& getPersistentBufferRegions()
+		{
+			return mPersistentBufferRegions;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -7759,7 +8555,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLUniformBuffer;	///< OpenGL uniform buffer, can be zero if no resource is allocated
+		GLuint					mOpenGLUniformBuffer;		///< OpenGL uniform buffer, can be zero if no resource is allocated
+		PersistentBufferRegions mPersistentBufferRegions;	///< Persistent buffer regions, only initialized for persistent mapped uniform buffers
 
 
 	//[-------------------------------------------------------]
@@ -7896,9 +8693,20 @@ namespace OpenGLRhi
 				// Create the OpenGL uniform buffer
 				glCreateBuffers(1, &mOpenGLUniformBuffer);
 
+				// Dynamic uniform buffers are persistently mapped if possible
+				if (PersistentBufferRegions::isSupported(openGLRhi, bufferUsage))
+				{
+					GLint openGLUniformBufferOffsetAlignment = 0;
+					glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &openGLUniformBufferOffsetAlignment);
+					[[maybe_unused]] const bool result = mPersistentBufferRegions.initialize(mOpenGLUniformBuffer, numberOfBytes, data, openGLUniformBufferOffsetAlignment);
+				}
+
 				// Upload the data
 				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLUniformBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				if (!mPersistentBufferRegions.isInitialized())
+				{
+					glNamedBufferData(mOpenGLUniformBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				}
 			}
 			else
 			{
@@ -8148,7 +8956,7 @@ namespace OpenGLRhi
 			}
 		}
 
-		[[nodiscard]] virtual Rhi::IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, [[maybe_unused]] uint32_t indirectBufferFlags = 0, Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, uint32_t indirectBufferFlags = 0, Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			OpenGLRhi& openGLRhi = static_cast<OpenGLRhi&>(getRhi());
 
@@ -8165,7 +8973,7 @@ namespace OpenGLRhi
 				if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
 				{
 					// Effective direct state access (DSA)
-					return RHI_NEW(openGLRhi.getContext(), IndirectBufferDsa)(openGLRhi, numberOfBytes, data, bufferUsage RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+					return RHI_NEW(openGLRhi.getContext(), IndirectBufferDsa)(openGLRhi, numberOfBytes, data, indirectBufferFlags, bufferUsage RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 				}
 				else
 				{
@@ -14319,7 +15127,7 @@ namespace OpenGLRhi
 		*/
 		inline VertexShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IVertexShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_VERTEX_SHADER_ARB, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_VERTEX_SHADER_ARB, sourceCode, !openGLRhi.getCapabilities().parallelShaderCompilation))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -14421,7 +15229,7 @@ namespace OpenGLRhi
 		*/
 		inline TessellationControlShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITessellationControlShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_TESS_CONTROL_SHADER, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_TESS_CONTROL_SHADER, sourceCode, !openGLRhi.getCapabilities().parallelShaderCompilation))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -14523,7 +15331,7 @@ namespace OpenGLRhi
 		*/
 		inline TessellationEvaluationShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITessellationEvaluationShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_TESS_EVALUATION_SHADER, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_TESS_EVALUATION_SHADER, sourceCode, !openGLRhi.getCapabilities().parallelShaderCompilation))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -14625,7 +15433,7 @@ namespace OpenGLRhi
 		*/
 		inline GeometryShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IGeometryShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_GEOMETRY_SHADER_ARB, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_GEOMETRY_SHADER_ARB, sourceCode, !openGLRhi.getCapabilities().parallelShaderCompilation))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -14727,7 +15535,7 @@ namespace OpenGLRhi
 		*/
 		inline FragmentShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IFragmentShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_FRAGMENT_SHADER_ARB, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_FRAGMENT_SHADER_ARB, sourceCode, !openGLRhi.getCapabilities().parallelShaderCompilation))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -14829,7 +15637,7 @@ namespace OpenGLRhi
 		*/
 		inline TaskShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITaskShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_TASK_SHADER_NV, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_TASK_SHADER_NV, sourceCode, true))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -14931,7 +15739,7 @@ namespace OpenGLRhi
 		*/
 		inline MeshShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IMeshShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_MESH_SHADER_NV, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_MESH_SHADER_NV, sourceCode, true))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -15033,7 +15841,7 @@ namespace OpenGLRhi
 		*/
 		inline ComputeShaderMonolithic(OpenGLRhi& openGLRhi, const char* sourceCode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IComputeShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_COMPUTE_SHADER, sourceCode))
+			mOpenGLShader(::detail::loadShaderFromSourcecode(openGLRhi.getContext(), GL_COMPUTE_SHADER, sourceCode, true))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -15266,6 +16074,35 @@ namespace OpenGLRhi
 			#endif
 		}
 
+		/**
+		*  @brief
+		*    Constructor for a graphics program restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] rootSignature
+		*    Root signature
+		*  @param[in] openGLProgram
+		*    Linked OpenGL program restored via "glProgramBinary()", the graphics program takes over the ownership
+		*/
+		GraphicsProgramMonolithic(OpenGLRhi& openGLRhi, const Rhi::IRootSignature& rootSignature, GLuint openGLProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			IGraphicsProgram(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLProgram(openGLProgram),
+			mDrawIdUniformLocation(-1)
+		{
+			// Uniform values and uniform block bindings are reset by "glProgramBinary()", so redo what's done after linking
+			initializeLinkedProgram(openGLRhi, rootSignature);
+
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (0 != mOpenGLProgram && openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Graphics program", 19)	// 19 = "Graphics program: " including terminating zero
+					glObjectLabel(GL_PROGRAM, mOpenGLProgram, -1, detailedDebugName);
+				}
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -15289,6 +16126,22 @@ namespace OpenGLRhi
 			return mOpenGLProgram;
 		}
 
+		/**
+		*  @brief
+		*    Finish a link which is still performed by the driver in the background, blocking if the driver isn't done yet
+		*
+		*  @note
+		*    - Must be called before the OpenGL program is used, without parallel shader compilation there's never a pending link
+		*/
+		inline void finishPendingLink()
+		{
+			if (nullptr != mPendingRootSignaturePtr)
+			{
+				checkLinkStatus(static_cast<OpenGLRhi&>(getRhi()), *mPendingRootSignaturePtr);
+				mPendingRootSignaturePtr = nullptr;
+			}
+		}
+
 		/**
 		*  @brief
 		*    Return the draw ID uniform location
@@ -15312,6 +16165,33 @@ namespace OpenGLRhi
 			return NULL_HANDLE;
 		}
 
+		[[nodiscard]] virtual bool getGraphicsProgramBinary(Rhi::ShaderBytecode& graphicsProgramBinary) const override
+		{
+			const OpenGLRhi& openGLRhi = static_cast<const OpenGLRhi&>(getRhi());
+			if (openGLRhi.getCapabilities().graphicsProgramBinary)
+			{
+				const uint32_t shaderStageBit = 0;
+				return ::detail::getProgramBinary(openGLRhi.getContext(), openGLRhi.getProgramBinaryDriverHash(), ::detail::PROGRAM_BINARY_TYPE_MONOLITHIC, &mOpenGLProgram, &shaderStageBit, 1, graphicsProgramBinary);
+			}
+			return false;
+		}
+
+		[[nodiscard]] virtual bool isReady() override
+		{
+			if (nullptr != mPendingRootSignaturePtr)
+			{
+				// Non-blocking query whether or not the driver is done with compiling and linking
+				GLint completed = GL_FALSE;
+				glGetProgramiv(mOpenGLProgram, GL_COMPLETION_STATUS_KHR, &completed);
+				if (GL_TRUE != completed)
+				{
+					return false;
+				}
+				finishPendingLink();
+			}
+			return true;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -15340,111 +16220,50 @@ namespace OpenGLRhi
 		void linkProgram(OpenGLRhi& openGLRhi, const Rhi::IRootSignature& rootSignature)
 		{
 			// Link the program
+			::detail::setProgramBinaryRetrievableHint(mOpenGLProgram);
 			glLinkProgram(mOpenGLProgram);
 
+			// Don't stall a driver compiling and linking in the background by asking for the link status right now, "isReady()" and "finishPendingLink()" take over from here
+			if (openGLRhi.getCapabilities().parallelShaderCompilation)
+			{
+				mPendingRootSignaturePtr = const_cast<Rhi::IRootSignature*>(&rootSignature);
+			}
+			else
+			{
+				checkLinkStatus(openGLRhi, rootSignature);
+			}
+		}
+
+		void checkLinkStatus(OpenGLRhi& openGLRhi, const Rhi::IRootSignature& rootSignature)
+		{
 			// Check the link status
 			GLint linked = GL_FALSE;
 			glGetProgramiv(mOpenGLProgram, GL_LINK_STATUS, &linked);
 			if (GL_TRUE == linked)
 			{
-				// We're not using "glBindFragDataLocation()", else the user would have to provide us with additional OpenGL-only specific information
-				// -> Use modern GLSL:
-				//    "layout(location = 0) out vec4 ColorOutput0;"
-				//    "layout(location = 1) out vec4 ColorOutput1;"
-				// -> Use legacy GLSL if necessary:
-				//    "gl_FragData[0] = vec4(1.0f, 0.0f, 0.0f, 0.0f);"
-				//    "gl_FragData[1] = vec4(0.0f, 0.0f, 1.0f, 0.0f);"
-
-				// Get draw ID uniform location
-				if (!openGLRhi.getExtensions().isGL_ARB_base_instance())
-				{
-					mDrawIdUniformLocation = glGetUniformLocation(mOpenGLProgram, "drawIdUniform");
-				}
+				initializeLinkedProgram(openGLRhi, rootSignature);
+			}
+			else
+			{
+				// Error, program link failed!
+				const Rhi::Context& context = openGLRhi.getContext();
 
-				// The actual locations assigned to uniform variables are not known until the program object is linked successfully
-				// -> So we have to build a root signature parameter index -> uniform location mapping here
-				const Rhi::RootSignature& rootSignatureData = static_cast<const RootSignature&>(rootSignature).getRootSignature();
-				const uint32_t numberOfRootParameters = rootSignatureData.numberOfParameters;
-				uint32_t uniformBlockBindingIndex = 0;
-				for (uint32_t rootParameterIndex = 0; rootParameterIndex < numberOfRootParameters; ++rootParameterIndex)
+				// With parallel shader compilation the shader compile status wasn't checked, so a compile error might be the actual reason
+				if (openGLRhi.getCapabilities().parallelShaderCompilation)
 				{
-					const Rhi::RootParameter& rootParameter = rootSignatureData.parameters[rootParameterIndex];
-					if (Rhi::RootParameterType::DESCRIPTOR_TABLE == rootParameter.parameterType)
+					GLsizei numberOfOpenGLShaders = 0;
+					GLuint openGLShaders[5] = {};
+					glGetAttachedShaders(mOpenGLProgram, 5, &numberOfOpenGLShaders, openGLShaders);
+					for (GLsizei i = 0; i < numberOfOpenGLShaders; ++i)
 					{
-						RHI_ASSERT(openGLRhi.getContext(), nullptr != reinterpret_cast<const Rhi::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges), "Invalid OpenGL descriptor ranges")
-						const uint32_t numberOfDescriptorRanges = rootParameter.descriptorTable.numberOfDescriptorRanges;
-						for (uint32_t descriptorRangeIndex = 0; descriptorRangeIndex < numberOfDescriptorRanges; ++descriptorRangeIndex)
+						GLint compiled = GL_FALSE;
+						glGetShaderiv(openGLShaders[i], GL_OBJECT_COMPILE_STATUS_ARB, &compiled);
+						if (GL_TRUE != compiled)
 						{
-							const Rhi::DescriptorRange& descriptorRange = reinterpret_cast<const Rhi::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges)[descriptorRangeIndex];
-
-							// Ignore sampler range types in here (OpenGL handles samplers in a different way then Direct3D 10>=)
-							if (Rhi::DescriptorRangeType::UBV == descriptorRange.rangeType)
-							{
-								// Explicit binding points ("layout(binding = 0)" in GLSL shader) requires OpenGL 4.2 or the "GL_ARB_explicit_uniform_location"-extension,
-								// for backward compatibility, ask for the uniform block index
-								const GLuint uniformBlockIndex = glGetUniformBlockIndex(mOpenGLProgram, descriptorRange.baseShaderRegisterName);
-								if (GL_INVALID_INDEX != uniformBlockIndex)
-								{
-									// Associate the uniform block with the given binding point
-									glUniformBlockBinding(mOpenGLProgram, uniformBlockIndex, uniformBlockBindingIndex);
-									++uniformBlockBindingIndex;
-								}
-							}
-							else if (Rhi::DescriptorRangeType::SAMPLER != descriptorRange.rangeType)
-							{
-								const GLint uniformLocation = glGetUniformLocation(mOpenGLProgram, descriptorRange.baseShaderRegisterName);
-								if (uniformLocation >= 0)
-								{
-									// OpenGL/GLSL is not automatically assigning texture units to samplers, so, we have to take over this job
-									// -> When using OpenGL or OpenGL ES 3 this is required
-									// -> OpenGL 4.2 or the "GL_ARB_explicit_uniform_location"-extension supports explicit binding points ("layout(binding = 0)"
-									//    in GLSL shader) , for backward compatibility we don't use it in here
-									// -> When using Direct3D 9, 10, 11 or 12, the texture unit
-									//    to use is usually defined directly within the shader by using the "register"-keyword
-									// -> Use the "GL_ARB_direct_state_access" or "GL_EXT_direct_state_access" extension if possible to not change OpenGL states
-									if (nullptr != glProgramUniform1i)
-									{
-										glProgramUniform1i(mOpenGLProgram, uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
-									}
-									else if (nullptr != glProgramUniform1iEXT)
-									{
-										glProgramUniform1iEXT(mOpenGLProgram, uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
-									}
-									else
-									{
-										// TODO(co) There's room for binding API call related optimization in here (will certainly be no huge overall efficiency gain)
-										#ifdef RHI_OPENGL_STATE_CLEANUP
-											// Backup the currently used OpenGL program
-											GLint openGLProgramBackup = 0;
-											glGetIntegerv(GL_CURRENT_PROGRAM, &openGLProgramBackup);
-											if (static_cast<GLuint>(openGLProgramBackup) == mOpenGLProgram)
-											{
-												// Set uniform, please note that for this our program must be the currently used one
-												glUniform1i(uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
-											}
-											else
-											{
-												// Set uniform, please note that for this our program must be the currently used one
-												glUseProgram(mOpenGLProgram);
-												glUniform1i(uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
-
-												// Be polite and restore the previous used OpenGL program
-												glUseProgram(static_cast<GLhandleARB>(openGLProgramBackup));
-											}
-										#else
-											glUseProgram(mOpenGLProgram);
-											glUniform1i(uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
-										#endif
-									}
-								}
-							}
+							::detail::printOpenGLShaderInformationIntoLog(context, openGLShaders[i]);
 						}
 					}
 				}
-			}
-			else
-			{
-				// Error, program link failed!
 
 				// Get the length of the information (including a null termination)
 				GLint informationLength = 0;
@@ -15452,7 +16271,6 @@ namespace OpenGLRhi
 				if (informationLength > 1)
 				{
 					// Allocate memory for the information
-					const Rhi::Context& context = openGLRhi.getContext();
 					char* informationLog = RHI_MALLOC_TYPED(context, char, informationLength);
 
 					// Get the information
@@ -15461,8 +16279,106 @@ namespace OpenGLRhi
 					// Output the debug string
 					RHI_LOG(context, CRITICAL, informationLog)
 
-					// Cleanup information memory
-					RHI_FREE(context, informationLog);
+					// Cleanup information memory
+					RHI_FREE(context, informationLog);
+				}
+			}
+		}
+
+		void initializeLinkedProgram(OpenGLRhi& openGLRhi, const Rhi::IRootSignature& rootSignature)
+		{
+			// We're not using "glBindFragDataLocation()", else the user would have to provide us with additional OpenGL-only specific information
+			// -> Use modern GLSL:
+			//    "layout(location = 0) out vec4 ColorOutput0;"
+			//    "layout(location = 1) out vec4 ColorOutput1;"
+			// -> Use legacy GLSL if necessary:
+			//    "gl_FragData[0] = vec4(1.0f, 0.0f, 0.0f, 0.0f);"
+			//    "gl_FragData[1] = vec4(0.0f, 0.0f, 1.0f, 0.0f);"
+
+			// Get draw ID uniform location
+			if (!openGLRhi.getExtensions().isGL_ARB_base_instance())
+			{
+				mDrawIdUniformLocation = glGetUniformLocation(mOpenGLProgram, "drawIdUniform");
+			}
+
+			// The actual locations assigned to uniform variables are not known until the program object is linked successfully
+			// -> So we have to build a root signature parameter index -> uniform location mapping here
+			const Rhi::RootSignature& rootSignatureData = static_cast<const RootSignature&>(rootSignature).getRootSignature();
+			const uint32_t numberOfRootParameters = rootSignatureData.numberOfParameters;
+			uint32_t uniformBlockBindingIndex = 0;
+			for (uint32_t rootParameterIndex = 0; rootParameterIndex < numberOfRootParameters; ++rootParameterIndex)
+			{
+				const Rhi::RootParameter& rootParameter = rootSignatureData.parameters[rootParameterIndex];
+				if (Rhi::RootParameterType::DESCRIPTOR_TABLE == rootParameter.parameterType)
+				{
+					RHI_ASSERT(openGLRhi.getContext(), nullptr != reinterpret_cast<const Rhi::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges), "Invalid OpenGL descriptor ranges")
+					const uint32_t numberOfDescriptorRanges = rootParameter.descriptorTable.numberOfDescriptorRanges;
+					for (uint32_t descriptorRangeIndex = 0; descriptorRangeIndex < numberOfDescriptorRanges; ++descriptorRangeIndex)
+					{
+						const Rhi::DescriptorRange& descriptorRange = reinterpret_cast<const Rhi::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges)[descriptorRangeIndex];
+
+						// Ignore sampler range types in here (OpenGL handles samplers in a different way then Direct3D 10>=)
+						if (Rhi::DescriptorRangeType::UBV == descriptorRange.rangeType)
+						{
+							// Explicit binding points ("layout(binding = 0)" in GLSL shader) requires OpenGL 4.2 or the "GL_ARB_explicit_uniform_location"-extension,
+							// for backward compatibility, ask for the uniform block index
+							const GLuint uniformBlockIndex = glGetUniformBlockIndex(mOpenGLProgram, descriptorRange.baseShaderRegisterName);
+							if (GL_INVALID_INDEX != uniformBlockIndex)
+							{
+								// Associate the uniform block with the given binding point
+								glUniformBlockBinding(mOpenGLProgram, uniformBlockIndex, uniformBlockBindingIndex);
+								++uniformBlockBindingIndex;
+							}
+						}
+						else if (Rhi::DescriptorRangeType::SAMPLER != descriptorRange.rangeType)
+						{
+							const GLint uniformLocation = glGetUniformLocation(mOpenGLProgram, descriptorRange.baseShaderRegisterName);
+							if (uniformLocation >= 0)
+							{
+								// OpenGL/GLSL is not automatically assigning texture units to samplers, so, we have to take over this job
+								// -> When using OpenGL or OpenGL ES 3 this is required
+								// -> OpenGL 4.2 or the "GL_ARB_explicit_uniform_location"-extension supports explicit binding points ("layout(binding = 0)"
+								//    in GLSL shader) , for backward compatibility we don't use it in here
+								// -> When using Direct3D 9, 10, 11 or 12, the texture unit
+								//    to use is usually defined directly within the shader by using the "register"-keyword
+								// -> Use the "GL_ARB_direct_state_access" or "GL_EXT_direct_state_access" extension if possible to not change OpenGL states
+								if (nullptr != glProgramUniform1i)
+								{
+									glProgramUniform1i(mOpenGLProgram, uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
+								}
+								else if (nullptr != glProgramUniform1iEXT)
+								{
+									glProgramUniform1iEXT(mOpenGLProgram, uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
+								}
+								else
+								{
+									// TODO(co) There's room for binding API call related optimization in here (will certainly be no huge overall efficiency gain)
+									#ifdef RHI_OPENGL_STATE_CLEANUP
+										// Backup the currently used OpenGL program
+										GLint openGLProgramBackup = 0;
+										glGetIntegerv(GL_CURRENT_PROGRAM, &openGLProgramBackup);
+										if (static_cast<GLuint>(openGLProgramBackup) == mOpenGLProgram)
+										{
+											// Set uniform, please note that for this our program must be the currently used one
+											glUniform1i(uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
+										}
+										else
+										{
+											// Set uniform, please note that for this our program must be the currently used one
+											glUseProgram(mOpenGLProgram);
+											glUniform1i(uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
+
+											// Be polite and restore the previous used OpenGL program
+											glUseProgram(static_cast<GLhandleARB>(openGLProgramBackup));
+										}
+									#else
+										glUseProgram(mOpenGLProgram);
+										glUniform1i(uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
+									#endif
+								}
+							}
+						}
+					}
 				}
 			}
 		}
@@ -15472,7 +16388,8 @@ namespace OpenGLRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		GLint mDrawIdUniformLocation;	///< Draw ID uniform location, used for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
+		GLint				  mDrawIdUniformLocation;	///< Draw ID uniform location, used for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
+		Rhi::IRootSignaturePtr mPendingRootSignaturePtr;	///< Root signature of a link the driver is still performing in the background, null pointer if there's no pending link
 
 
 	};
@@ -15545,6 +16462,21 @@ namespace OpenGLRhi
 			GraphicsProgramMonolithic(openGLRhi, rootSignature, taskShaderMonolithic, meshShaderMonolithic, fragmentShaderMonolithic RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{}
 
+		/**
+		*  @brief
+		*    Constructor for a graphics program restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] rootSignature
+		*    Root signature
+		*  @param[in] openGLProgram
+		*    Linked OpenGL program restored via "glProgramBinary()", the graphics program takes over the ownership
+		*/
+		inline GraphicsProgramMonolithicDsa(OpenGLRhi& openGLRhi, const Rhi::IRootSignature& rootSignature, GLuint openGLProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			GraphicsProgramMonolithic(openGLRhi, rootSignature, openGLProgram RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		{}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -16125,6 +17057,32 @@ namespace OpenGLRhi
 			}
 		}
 
+		[[nodiscard]] virtual Rhi::IGraphicsProgram* createGraphicsProgramFromBinary(const Rhi::IRootSignature& rootSignature, const Rhi::VertexAttributes&, const Rhi::ShaderBytecode& graphicsProgramBinary RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		{
+			OpenGLRhi& openGLRhi = static_cast<OpenGLRhi&>(getRhi());
+
+			// The vertex array attribute binding locations are part of the linked program, so the vertex attributes aren't needed in here
+			GLuint openGLPrograms[::detail::MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			uint32_t shaderStageBits[::detail::MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			if (!openGLRhi.getCapabilities().graphicsProgramBinary || 1 != ::detail::loadProgramBinary(openGLRhi.getProgramBinaryDriverHash(), ::detail::PROGRAM_BINARY_TYPE_MONOLITHIC, graphicsProgramBinary, openGLPrograms, shaderStageBits))
+			{
+				// Error! Rejected graphics program binary, the caller is supposed to fall back to shaders.
+				return nullptr;
+			}
+
+			// Create the graphics program: Is "GL_EXT_direct_state_access" there?
+			if (openGLRhi.getExtensions().isGL_EXT_direct_state_access() || openGLRhi.getExtensions().isGL_ARB_direct_state_access())
+			{
+				// Effective direct state access (DSA)
+				return RHI_NEW(openGLRhi.getContext(), GraphicsProgramMonolithicDsa)(openGLRhi, rootSignature, openGLPrograms[0] RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			}
+			else
+			{
+				// Traditional bind version
+				return RHI_NEW(openGLRhi.getContext(), GraphicsProgramMonolithic)(openGLRhi, rootSignature, openGLPrograms[0] RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			}
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -16222,6 +17180,30 @@ namespace OpenGLRhi
 			#endif
 		}
 
+		/**
+		*  @brief
+		*    Constructor for a vertex shader restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] openGLShaderProgram
+		*    Linked separable OpenGL shader program restored via "glProgramBinary()", the shader takes over the ownership
+		*/
+		inline VertexShaderSeparate(OpenGLRhi& openGLRhi, GLuint openGLShaderProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			IVertexShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLShaderProgram(openGLShaderProgram),
+			mDrawIdUniformLocation(openGLRhi.getExtensions().isGL_ARB_base_instance() ? -1 : glGetUniformLocation(mOpenGLShaderProgram, "drawIdUniform"))
+		{
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (0 != mOpenGLShaderProgram && openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "VS", 5)	// 5 = "VS: " including terminating zero
+					glObjectLabel(GL_PROGRAM, mOpenGLShaderProgram, -1, detailedDebugName);
+				}
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -16366,6 +17348,29 @@ namespace OpenGLRhi
 			#endif
 		}
 
+		/**
+		*  @brief
+		*    Constructor for a tessellation control shader ("hull shader" in Direct3D terminology) restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] openGLShaderProgram
+		*    Linked separable OpenGL shader program restored via "glProgramBinary()", the shader takes over the ownership
+		*/
+		inline TessellationControlShaderSeparate(OpenGLRhi& openGLRhi, GLuint openGLShaderProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			ITessellationControlShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLShaderProgram(openGLShaderProgram)
+		{
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (0 != mOpenGLShaderProgram && openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "TCS", 6)	// 6 = "TCS: " including terminating zero
+					glObjectLabel(GL_PROGRAM, mOpenGLShaderProgram, -1, detailedDebugName);
+				}
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -16497,6 +17502,29 @@ namespace OpenGLRhi
 			#endif
 		}
 
+		/**
+		*  @brief
+		*    Constructor for a tessellation evaluation shader ("domain shader" in Direct3D terminology) restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] openGLShaderProgram
+		*    Linked separable OpenGL shader program restored via "glProgramBinary()", the shader takes over the ownership
+		*/
+		inline TessellationEvaluationShaderSeparate(OpenGLRhi& openGLRhi, GLuint openGLShaderProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			ITessellationEvaluationShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLShaderProgram(openGLShaderProgram)
+		{
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (0 != mOpenGLShaderProgram && openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "TES", 6)	// 6 = "TES: " including terminating zero
+					glObjectLabel(GL_PROGRAM, mOpenGLShaderProgram, -1, detailedDebugName);
+				}
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -16628,6 +17656,29 @@ namespace OpenGLRhi
 			#endif
 		}
 
+		/**
+		*  @brief
+		*    Constructor for a geometry shader restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] openGLShaderProgram
+		*    Linked separable OpenGL shader program restored via "glProgramBinary()", the shader takes over the ownership
+		*/
+		inline GeometryShaderSeparate(OpenGLRhi& openGLRhi, GLuint openGLShaderProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			IGeometryShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLShaderProgram(openGLShaderProgram)
+		{
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (0 != mOpenGLShaderProgram && openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "GS", 5)	// 5 = "GS: " including terminating zero
+					glObjectLabel(GL_PROGRAM, mOpenGLShaderProgram, -1, detailedDebugName);
+				}
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -16759,6 +17810,29 @@ namespace OpenGLRhi
 			#endif
 		}
 
+		/**
+		*  @brief
+		*    Constructor for a fragment shader restored from a graphics program binary
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] openGLShaderProgram
+		*    Linked separable OpenGL shader program restored via "glProgramBinary()", the shader takes over the ownership
+		*/
+		inline FragmentShaderSeparate(OpenGLRhi& openGLRhi, GLuint openGLShaderProgram RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+			IFragmentShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLShaderProgram(openGLShaderProgram)
+		{
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (0 != mOpenGLShaderProgram && openGLRhi.getExtensions().isGL_KHR_debug())
+				{
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "FS", 5)	// 5 = "FS: " including terminating zero
+					glObjectLabel(GL_PROGRAM, mOpenGLShaderProgram, -1, detailedDebugName);
+				}
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Destructor
@@ -17728,6 +18802,29 @@ namespace OpenGLRhi
 			return NULL_HANDLE;
 		}
 
+		[[nodiscard]] virtual bool getGraphicsProgramBinary(Rhi::ShaderBytecode& graphicsProgramBinary) const override
+		{
+			// Task and mesh shader based graphics programs aren't supported
+			const OpenGLRhi& openGLRhi = static_cast<const OpenGLRhi&>(getRhi());
+			if (!openGLRhi.getCapabilities().graphicsProgramBinary || nullptr != mMeshShaderSeparate)
+			{
+				return false;
+			}
+
+			// Gather the separable shader programs
+			GLuint openGLPrograms[::detail::MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			uint32_t shaderStageBits[::detail::MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			uint32_t numberOfPrograms = 0;
+			#define ADD_PROGRAM(ShaderBit, ShaderSeparate) if (nullptr != ShaderSeparate) { openGLPrograms[numberOfPrograms] = ShaderSeparate->getOpenGLShaderProgram(); shaderStageBits[numberOfPrograms] = ShaderBit; ++numberOfPrograms; }
+			ADD_PROGRAM(GL_VERTEX_SHADER_BIT,		   mVertexShaderSeparate)
+			ADD_PROGRAM(GL_TESS_CONTROL_SHADER_BIT,	   mTessellationControlShaderSeparate)
+			ADD_PROGRAM(GL_TESS_EVALUATION_SHADER_BIT, mTessellationEvaluationShaderSeparate)
+			ADD_PROGRAM(GL_GEOMETRY_SHADER_BIT,		   mGeometryShaderSeparate)
+			ADD_PROGRAM(GL_FRAGMENT_SHADER_BIT,		   mFragmentShaderSeparate)
+			#undef ADD_PROGRAM
+			return (numberOfPrograms > 0 && ::detail::getProgramBinary(openGLRhi.getContext(), openGLRhi.getProgramBinaryDriverHash(), ::detail::PROGRAM_BINARY_TYPE_SEPARATE, openGLPrograms, shaderStageBits, numberOfPrograms, graphicsProgramBinary));
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -18554,6 +19651,69 @@ namespace OpenGLRhi
 			// Error!
 			return nullptr;
 		}
+		[[nodiscard]] virtual Rhi::IGraphicsProgram* createGraphicsProgramFromBinary(const Rhi::IRootSignature& rootSignature, const Rhi::VertexAttributes&, const Rhi::ShaderBytecode& graphicsProgramBinary RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		{
+			OpenGLRhi& openGLRhi = static_cast<OpenGLRhi&>(getRhi());
+
+			// The vertex array attribute binding locations are part of the linked vertex shader program, so the vertex attributes aren't needed in here
+			GLuint openGLPrograms[::detail::MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			uint32_t shaderStageBits[::detail::MAXIMUM_NUMBER_OF_PROGRAM_BINARY_PROGRAMS] = {};
+			const uint32_t numberOfPrograms = openGLRhi.getCapabilities().graphicsProgramBinary ? ::detail::loadProgramBinary(openGLRhi.getProgramBinaryDriverHash(), ::detail::PROGRAM_BINARY_TYPE_SEPARATE, graphicsProgramBinary, openGLPrograms, shaderStageBits) : 0;
+			if (0 == numberOfPrograms)
+			{
+				// Error! Rejected graphics program binary, the caller is supposed to fall back to shaders.
+				return nullptr;
+			}
+
+			// Wrap the restored separable shader programs into shaders, the graphics program takes over the shader references
+			const Rhi::Context& context = openGLRhi.getContext();
+			VertexShaderSeparate*				  vertexShaderSeparate = nullptr;
+			TessellationControlShaderSeparate*	  tessellationControlShaderSeparate = nullptr;
+			TessellationEvaluationShaderSeparate* tessellationEvaluationShaderSeparate = nullptr;
+			GeometryShaderSeparate*				  geometryShaderSeparate = nullptr;
+			FragmentShaderSeparate*				  fragmentShaderSeparate = nullptr;
+			for (uint32_t i = 0; i < numberOfPrograms; ++i)
+			{
+				const GLuint openGLProgram = openGLPrograms[i];
+				switch (shaderStageBits[i])
+				{
+					#define CREATE_SHADER(ShaderSeparateType, ShaderSeparate) if (nullptr == ShaderSeparate) { ShaderSeparate = RHI_NEW(context, ShaderSeparateType)(openGLRhi, openGLProgram RHI_RESOURCE_DEBUG_PASS_PARAMETER); } else { glDeleteProgram(openGLProgram); } break;
+					case GL_VERTEX_SHADER_BIT:
+						CREATE_SHADER(VertexShaderSeparate, vertexShaderSeparate)
+
+					case GL_TESS_CONTROL_SHADER_BIT:
+						CREATE_SHADER(TessellationControlShaderSeparate, tessellationControlShaderSeparate)
+
+					case GL_TESS_EVALUATION_SHADER_BIT:
+						CREATE_SHADER(TessellationEvaluationShaderSeparate, tessellationEvaluationShaderSeparate)
+
+					case GL_GEOMETRY_SHADER_BIT:
+						CREATE_SHADER(GeometryShaderSeparate, geometryShaderSeparate)
+
+					case GL_FRAGMENT_SHADER_BIT:
+						CREATE_SHADER(FragmentShaderSeparate, fragmentShaderSeparate)
+					#undef CREATE_SHADER
+
+					default:
+						RHI_ASSERT(context, false, "Invalid OpenGL shader stage bit inside graphics program binary")
+						glDeleteProgram(openGLProgram);
+						break;
+				}
+			}
+
+			// Is "GL_EXT_direct_state_access" there?
+			if (openGLRhi.getExtensions().isGL_EXT_direct_state_access() || openGLRhi.getExtensions().isGL_ARB_direct_state_access())
+			{
+				// Effective direct state access (DSA)
+				return RHI_NEW(context, GraphicsProgramSeparateDsa)(openGLRhi, rootSignature, vertexShaderSeparate, tessellationControlShaderSeparate, tessellationEvaluationShaderSeparate, geometryShaderSeparate, fragmentShaderSeparate RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			}
+			else
+			{
+				// Traditional bind version
+				return RHI_NEW(context, GraphicsProgramSeparate)(openGLRhi, rootSignature, vertexShaderSeparate, tessellationControlShaderSeparate, tessellationEvaluationShaderSeparate, geometryShaderSeparate, fragmentShaderSeparate RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			}
+		}
+
 
 
 	//[-------------------------------------------------------]
@@ -18806,7 +19966,7 @@ namespace
 
 		[[nodiscard]] bool mapBuffer([[maybe_unused]] const Rhi::Context& context, const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
 		{
-			// TODO(co) This buffer update isn't efficient, use e.g. persistent buffer mapping
+			// TODO(co) This buffer update isn't efficient, "Rhi::BufferUsage::DYNAMIC_DRAW" uniform, texture and indirect buffers are using "OpenGLRhi::PersistentBufferRegions" if possible
 
 			// Is "GL_ARB_direct_state_access" there?
 			if (extensions.isGL_ARB_direct_state_access())
@@ -18853,6 +20013,15 @@ namespace
 			return (nullptr != mappedSubresource.data);
 		}
 
+		[[nodiscard]] bool mapPersistentBuffer(const Rhi::Context& context, OpenGLRhi::PersistentBufferRegions& persistentBufferRegions, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			// The mapping is coherent, only a staging copy needs an unmap
+			mappedSubresource.data		 = persistentBufferRegions.map(context, mapType);
+			mappedSubresource.rowPitch   = 0;
+			mappedSubresource.depthPitch = 0;
+			return true;
+		}
+
 		void unmapBuffer(const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer)
 		{
 			// Is "GL_ARB_direct_state_access" there?
@@ -19211,6 +20380,7 @@ namespace OpenGLRhi
 		mDefaultSamplerState(nullptr),
 		mOpenGLCopyResourceFramebuffer(0),
 		mDefaultOpenGLVertexArray(0),
+		mProgramBinaryDriverHash(0),
 		// States
 		mGraphicsPipelineState(nullptr),
 		mComputePipelineState(nullptr),
@@ -19225,6 +20395,8 @@ namespace OpenGLRhi
 		mOpenGLProgramPipeline(0),
 		mOpenGLProgram(0),
 		mOpenGLIndirectBuffer(0),
+		// Persistent mapped uniform buffers currently attached to the OpenGL uniform buffer binding points, needed to follow their region changes
+		mPersistentUniformBufferBindings{},
 		// Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		mOpenGLVertexProgram(0),
 		mDrawIdUniformLocation(-1),
@@ -19390,11 +20562,34 @@ namespace OpenGLRhi
 		RHI_DELETE(mContext, OpenGLRuntimeLinking, mOpenGLRuntimeLinking);
 	}
 
+
+	void OpenGLRhi::rebindPersistentUniformBuffer(const UniformBuffer& uniformBuffer)
+	{
+		const PersistentBufferRegions& persistentBufferRegions = uniformBuffer.getPersistentBufferRegions();
+		for (GLuint index = 0; index < MAXIMUM_NUMBER_OF_PERSISTENT_UNIFORM_BUFFER_BINDINGS; ++index)
+		{
+			if (mPersistentUniformBufferBindings[index] == &uniformBuffer)
+			{
+				glBindBufferRange(GL_UNIFORM_BUFFER, index, uniformBuffer.getOpenGLUniformBuffer(), persistentBufferRegions.getCurrentRegionOffset(), persistentBufferRegions.getNumberOfBytes());
+			}
+		}
+	}
+
+	void OpenGLRhi::unbindPersistentUniformBuffer(const UniformBuffer& uniformBuffer)
+	{
+		for (const UniformBuffer*& persistentUniformBufferBinding : mPersistentUniformBufferBindings)
+		{
+			if (persistentUniformBufferBinding == &uniformBuffer)
+			{
+				persistentUniformBufferBinding = nullptr;
+			}
+		}
+	}
+
 	void OpenGLRhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -19404,8 +20599,7 @@ namespace OpenGLRhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -19811,12 +21005,16 @@ namespace OpenGLRhi
 		// Tessellation support: "glPatchParameteri()" is called within "OpenGLRhi::iaSetPrimitiveTopology()"
 
 		{ // Bind indirect buffer
-			const GLuint openGLIndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer).getOpenGLIndirectBuffer();
+			const IndirectBuffer& openGLIndirectBufferInstance = static_cast<const IndirectBuffer&>(indirectBuffer);
+			const GLuint openGLIndirectBuffer = openGLIndirectBufferInstance.getOpenGLIndirectBuffer();
 			if (openGLIndirectBuffer != mOpenGLIndirectBuffer)
 			{
 				mOpenGLIndirectBuffer = openGLIndirectBuffer;
 				glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, mOpenGLIndirectBuffer);
 			}
+
+			// Persistent mapped indirect buffers are read from their current region
+			indirectBufferOffset += static_cast<uint32_t>(openGLIndirectBufferInstance.getPersistentBufferRegions().getCurrentRegionOffset());
 		}
 
 		// Draw indirect
@@ -19911,12 +21109,16 @@ namespace OpenGLRhi
 		// Tessellation support: "glPatchParameteri()" is called within "OpenGLRhi::iaSetPrimitiveTopology()"
 
 		{ // Bind indirect buffer
-			const GLuint openGLIndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer).getOpenGLIndirectBuffer();
+			const IndirectBuffer& openGLIndirectBufferInstance = static_cast<const IndirectBuffer&>(indirectBuffer);
+			const GLuint openGLIndirectBuffer = openGLIndirectBufferInstance.getOpenGLIndirectBuffer();
 			if (openGLIndirectBuffer != mOpenGLIndirectBuffer)
 			{
 				mOpenGLIndirectBuffer = openGLIndirectBuffer;
 				glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, mOpenGLIndirectBuffer);
 			}
+
+			// Persistent mapped indirect buffers are read from their current region
+			indirectBufferOffset += static_cast<uint32_t>(openGLIndirectBufferInstance.getPersistentBufferRegions().getCurrentRegionOffset());
 		}
 
 		// Draw indirect
@@ -20327,6 +21529,44 @@ namespace OpenGLRhi
 				}
 				break;
 
+			case Rhi::ResourceType::STRUCTURED_BUFFER:
+				if (sourceResource.getResourceType() == Rhi::ResourceType::STRUCTURED_BUFFER && mExtensions->isGL_ARB_copy_buffer())
+				{
+					// Get the OpenGL structured buffer instances
+					const StructuredBuffer& openGlDestinationStructuredBuffer = static_cast<const StructuredBuffer&>(destinationResource);
+					const StructuredBuffer& openGlSourceStructuredBuffer = static_cast<const StructuredBuffer&>(sourceResource);
+
+					#ifdef RHI_OPENGL_STATE_CLEANUP
+						// Backup the currently bound OpenGL copy buffers
+						GLint openGLCopyReadBufferBackup = 0;
+						GLint openGLCopyWriteBufferBackup = 0;
+						glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &openGLCopyReadBufferBackup);
+						glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &openGLCopyWriteBufferBackup);
+					#endif
+
+					// Copy resource, e.g. from a structured buffer written by a compute shader into a structured buffer for reading it back
+					// -> Make sure shader writes are visible to the buffer copy, the compute dispatch only issues shader image and storage barriers
+					if (mExtensions->isGL_EXT_shader_image_load_store())
+					{
+						glMemoryBarrierEXT(GL_BUFFER_UPDATE_BARRIER_BIT_EXT);
+					}
+					glBindBufferARB(GL_COPY_READ_BUFFER, openGlSourceStructuredBuffer.getOpenGLStructuredBuffer());
+					glBindBufferARB(GL_COPY_WRITE_BUFFER, openGlDestinationStructuredBuffer.getOpenGLStructuredBuffer());
+					glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(std::min(openGlSourceStructuredBuffer.getNumberOfBytes(), openGlDestinationStructuredBuffer.getNumberOfBytes())));
+
+					#ifdef RHI_OPENGL_STATE_CLEANUP
+						// Be polite and restore the previous bound OpenGL copy buffers
+						glBindBufferARB(GL_COPY_READ_BUFFER, static_cast<GLuint>(openGLCopyReadBufferBackup));
+						glBindBufferARB(GL_COPY_WRITE_BUFFER, static_cast<GLuint>(openGLCopyWriteBufferBackup));
+					#endif
+				}
+				else
+				{
+					// Error!
+					RHI_ASSERT(mContext, false, "Failed to copy OpenGL resource")
+				}
+				break;
+
 			case Rhi::ResourceType::ROOT_SIGNATURE:
 			case Rhi::ResourceType::RESOURCE_GROUP:
 			case Rhi::ResourceType::GRAPHICS_PROGRAM:
@@ -20338,7 +21578,6 @@ namespace OpenGLRhi
 			case Rhi::ResourceType::VERTEX_BUFFER:
 			case Rhi::ResourceType::INDEX_BUFFER:
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-			case Rhi::ResourceType::STRUCTURED_BUFFER:
 			case Rhi::ResourceType::INDIRECT_BUFFER:
 			case Rhi::ResourceType::UNIFORM_BUFFER:
 			case Rhi::ResourceType::TEXTURE_1D:
@@ -20828,16 +22067,51 @@ namespace OpenGLRhi
 				return ::detail::mapBuffer(mContext, *mExtensions, GL_ELEMENT_ARRAY_BUFFER_ARB, GL_ELEMENT_ARRAY_BUFFER_BINDING_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer(), mapType, mappedSubresource);
+			{
+				TextureBuffer& textureBuffer = static_cast<TextureBuffer&>(resource);
+				PersistentBufferRegions& persistentBufferRegions = textureBuffer.getPersistentBufferRegions();
+				if (persistentBufferRegions.isInitialized())
+				{
+					const bool result = ::detail::mapPersistentBuffer(mContext, persistentBufferRegions, mapType, mappedSubresource);
+					if (Rhi::MapType::WRITE_DISCARD == mapType)
+					{
+						// Attach the new current region to the buffer texture
+						glTextureBufferRange(textureBuffer.getOpenGLTexture(), textureBuffer.getOpenGLInternalFormat(), textureBuffer.getOpenGLTextureBuffer(), persistentBufferRegions.getCurrentRegionOffset(), persistentBufferRegions.getNumberOfBytes());
+					}
+					return result;
+				}
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, textureBuffer.getOpenGLTextureBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
 				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+			{
+				// The draw calls are reading the current region of persistent mapped indirect buffers
+				IndirectBuffer& indirectBuffer = static_cast<IndirectBuffer&>(resource);
+				if (indirectBuffer.getPersistentBufferRegions().isInitialized())
+				{
+					return ::detail::mapPersistentBuffer(mContext, indirectBuffer.getPersistentBufferRegions(), mapType, mappedSubresource);
+				}
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, indirectBuffer.getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer(), mapType, mappedSubresource);
+			{
+				UniformBuffer& uniformBuffer = static_cast<UniformBuffer&>(resource);
+				PersistentBufferRegions& persistentBufferRegions = uniformBuffer.getPersistentBufferRegions();
+				if (persistentBufferRegions.isInitialized())
+				{
+					const bool result = ::detail::mapPersistentBuffer(mContext, persistentBufferRegions, mapType, mappedSubresource);
+					if (Rhi::MapType::WRITE_DISCARD == mapType)
+					{
+						rebindPersistentUniformBuffer(uniformBuffer);
+					}
+					return result;
+				}
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, uniformBuffer.getOpenGLUniformBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
 			{
@@ -20968,7 +22242,15 @@ namespace OpenGLRhi
 				break;
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer());
+				// Persistent mapped texture buffers stay mapped, only a staging copy needs to be uploaded
+				if (static_cast<TextureBuffer&>(resource).getPersistentBufferRegions().isInitialized())
+				{
+					static_cast<TextureBuffer&>(resource).getPersistentBufferRegions().unmap(mContext);
+				}
+				else
+				{
+					::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer());
+				}
 				break;
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
@@ -20976,11 +22258,27 @@ namespace OpenGLRhi
 				break;
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer());
+				// Persistent mapped indirect buffers stay mapped, only a staging copy needs to be uploaded
+				if (static_cast<IndirectBuffer&>(resource).getPersistentBufferRegions().isInitialized())
+				{
+					static_cast<IndirectBuffer&>(resource).getPersistentBufferRegions().unmap(mContext);
+				}
+				else
+				{
+					::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer());
+				}
 				break;
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer());
+				// Persistent mapped uniform buffers stay mapped, only a staging copy needs to be uploaded
+				if (static_cast<UniformBuffer&>(resource).getPersistentBufferRegions().isInitialized())
+				{
+					static_cast<UniformBuffer&>(resource).getPersistentBufferRegions().unmap(mContext);
+				}
+				else
+				{
+					::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer());
+				}
 				break;
 
 			case Rhi::ResourceType::TEXTURE_1D:
@@ -21478,6 +22776,28 @@ namespace OpenGLRhi
 		// We don't support the OpenGL program binaries since those are operation system and graphics driver version dependent, which renders them useless for pre-compiled shaders shipping
 		mCapabilities.shaderBytecode = mExtensions->isGL_ARB_gl_spirv();
 
+		// OpenGL program binaries are still useful for a local cache, as long as the driver offers at least one binary format
+		// -> The driver hash is used to reject binaries of other drivers, see "OpenGLRhi::OpenGLRhi::getProgramBinaryDriverHash()"
+		if (mExtensions->isGL_ARB_get_program_binary())
+		{
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &openGLValue);
+			mCapabilities.graphicsProgramBinary = (openGLValue > 0);
+			mProgramBinaryDriverHash = ::detail::calculateProgramBinaryDriverHash();
+		}
+
+		// Let the driver compile shaders and link programs in the background, "0xFFFFFFFF" lets the driver pick the number of compiler threads
+		// -> Shader compile status and program link status are only queried once the driver reports completion, see "OpenGLRhi::GraphicsProgramMonolithic::isReady()"
+		if (mExtensions->isGL_KHR_parallel_shader_compile())
+		{
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+			mCapabilities.parallelShaderCompilation = true;
+		}
+		else if (mExtensions->isGL_ARB_parallel_shader_compile())
+		{
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+			mCapabilities.parallelShaderCompilation = true;
+		}
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = mExtensions->isGL_ARB_vertex_shader();
 
@@ -22072,7 +23392,24 @@ namespace OpenGLRhi
 							// -> Direct3D 10 and Direct3D 11 have explicit binding points
 							RHI_ASSERT(mContext, Rhi::DescriptorRangeType::UBV == descriptorRange.rangeType, "OpenGL uniform buffer must bound at UBV descriptor range type")
 							RHI_ASSERT(mContext, nullptr != openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex(), "Invalid OpenGL resource index to uniform block binding index")
-							glBindBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer());
+							const GLuint index = openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex];
+							const UniformBuffer* uniformBuffer = static_cast<UniformBuffer*>(resource);
+							const PersistentBufferRegions& persistentBufferRegions = uniformBuffer->getPersistentBufferRegions();
+							if (persistentBufferRegions.isInitialized())
+							{
+								// Attach only the current region of persistent mapped uniform buffers and remember the binding point to be able to follow region changes
+								RHI_ASSERT(mContext, index < MAXIMUM_NUMBER_OF_PERSISTENT_UNIFORM_BUFFER_BINDINGS, "Invalid OpenGL persistent mapped uniform buffer binding point")
+								glBindBufferRange(GL_UNIFORM_BUFFER, index, uniformBuffer->getOpenGLUniformBuffer(), persistentBufferRegions.getCurrentRegionOffset(), persistentBufferRegions.getNumberOfBytes());
+								mPersistentUniformBufferBindings[index] = uniformBuffer;
+							}
+							else
+							{
+								glBindBufferBase(GL_UNIFORM_BUFFER, index, uniformBuffer->getOpenGLUniformBuffer());
+								if (index < MAXIMUM_NUMBER_OF_PERSISTENT_UNIFORM_BUFFER_BINDINGS)
+								{
+									mPersistentUniformBufferBindings[index] = nullptr;
+								}
+							}
 						}
 						break;
 
@@ -22145,10 +23482,11 @@ namespace OpenGLRhi
 			else if (mExtensions->isGL_ARB_shader_objects())
 			{
 				// Bind the graphics program, if required
-				const GraphicsProgramMonolithic* graphicsProgramMonolithic = static_cast<GraphicsProgramMonolithic*>(graphicsProgram);
+				GraphicsProgramMonolithic* graphicsProgramMonolithic = static_cast<GraphicsProgramMonolithic*>(graphicsProgram);
 				const uint32_t openGLProgram = graphicsProgramMonolithic->getOpenGLProgram();
 				if (openGLProgram != mOpenGLProgram)
 				{
+					graphicsProgramMonolithic->finishPendingLink();
 					mOpenGLProgram = mOpenGLVertexProgram = openGLProgram;
 					mDrawIdUniformLocation = graphicsProgramMonolithic->getDrawIdUniformLocation();
 					mCurrentStartInstanceLocation = ~0u;
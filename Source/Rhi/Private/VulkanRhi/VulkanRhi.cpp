@@ -155,6 +155,7 @@ PRAGMA_WARNING_PUSH
 	#include <array>
 	#include <vector>
 	#include <sstream>
+	#include <algorithm>	// For "std::lower_bound()"
 PRAGMA_WARNING_POP
 
 
@@ -590,6 +591,7 @@ namespace VulkanRhi
 {
 	class VertexArray;
 	class RootSignature;
+	class ResourceGroup;
 	class VulkanContext;
 	class VulkanRuntimeLinking;
 }
@@ -700,6 +702,8 @@ FNPTR(vkDestroySemaphore)
 FNPTR(vkCreateFence)
 FNPTR(vkDestroyFence)
 FNPTR(vkWaitForFences)
+FNPTR(vkResetFences)
+FNPTR(vkGetFenceStatus)
 FNPTR(vkCreateCommandPool)
 FNPTR(vkDestroyCommandPool)
 FNPTR(vkAllocateCommandBuffers)
@@ -793,6 +797,11 @@ namespace
 		typedef Vector<VkPhysicalDevice> VkPhysicalDevices;
 		typedef Vector<VkExtensionProperties> VkExtensionPropertiesVector;
 		typedef std::array<VkPipelineShaderStageCreateInfo, 5> VkPipelineShaderStageCreateInfos;
+		struct CachedResourceGroup final
+		{
+			uint32_t					hash;			///< Hash of the resource and sampler state pointers of the resource group
+			::VulkanRhi::ResourceGroup*	resourceGroup;	///< Resource group, we don't own a reference
+		};
 		#ifdef __ANDROID__
 			// On Android we need to explicitly select all layers
 			#warning "TODO(co) Not tested"
@@ -931,6 +940,11 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool orderCachedResourceGroupByHash(const CachedResourceGroup& cachedResourceGroup, uint32_t hash)
+		{
+			return (cachedResourceGroup.hash < hash);
+		}
+
 		void updateWidthHeight(uint32_t mipmapIndex, uint32_t textureWidth, uint32_t textureHeight, uint32_t& width, uint32_t& height)
 		{
 			Rhi::ITexture::getMipmapSize(mipmapIndex, textureWidth, textureHeight);
@@ -2489,6 +2503,8 @@ namespace VulkanRhi
 			IMPORT_FUNC(vkCreateFence)
 			IMPORT_FUNC(vkDestroyFence)
 			IMPORT_FUNC(vkWaitForFences)
+			IMPORT_FUNC(vkResetFences)
+			IMPORT_FUNC(vkGetFenceStatus)
 			IMPORT_FUNC(vkCreateCommandPool)
 			IMPORT_FUNC(vkDestroyCommandPool)
 			IMPORT_FUNC(vkAllocateCommandBuffers)
@@ -2948,7 +2964,10 @@ namespace VulkanRhi
 			mGraphicsVkQueue(VK_NULL_HANDLE),
 			mPresentVkQueue(VK_NULL_HANDLE),
 			mVkCommandPool(VK_NULL_HANDLE),
-			mVkCommandBuffer(VK_NULL_HANDLE)
+			mVkCommandBuffer(VK_NULL_HANDLE),
+			mFrameVkFence(VK_NULL_HANDLE),
+			mNumberOfSubmittedFrames(0),
+			mNumberOfCompletedFrames(0)
 		{
 			const VulkanRuntimeLinking& vulkanRuntimeLinking = mVulkanRhi.getVulkanRuntimeLinking();
 
@@ -2987,6 +3006,20 @@ namespace VulkanRhi
 								{
 									// Create Vulkan command buffer instance
 									mVkCommandBuffer = ::detail::createVkCommandBuffer(mVulkanRhi.getContext(), mVkDevice, mVkCommandPool);
+
+									// Create the Vulkan fence signaled as soon as the GPU finished a submitted frame
+									const VkFenceCreateInfo vkFenceCreateInfo =
+									{
+										VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// sType (VkStructureType)
+										nullptr,								// pNext (const void*)
+										0										// flags (VkFenceCreateFlags)
+									};
+									if (vkCreateFence(mVkDevice, &vkFenceCreateInfo, mVulkanRhi.getVkAllocationCallbacks(), &mFrameVkFence) != VK_SUCCESS)
+									{
+										// Error!
+										mFrameVkFence = VK_NULL_HANDLE;
+										RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan frame fence instance")
+									}
 								}
 								else
 								{
@@ -3013,6 +3046,11 @@ namespace VulkanRhi
 		{
 			if (VK_NULL_HANDLE != mVkDevice)
 			{
+				if (VK_NULL_HANDLE != mFrameVkFence)
+				{
+					vkDeviceWaitIdle(mVkDevice);
+					vkDestroyFence(mVkDevice, mFrameVkFence, mVulkanRhi.getVkAllocationCallbacks());
+				}
 				if (VK_NULL_HANDLE != mVkCommandPool)
 				{
 					if (VK_NULL_HANDLE != mVkCommandBuffer)
@@ -3177,6 +3215,59 @@ namespace VulkanRhi
 			}
 		}
 
+		/**
+		*  @brief
+		*    Begin the submission of a frame to the graphics queue
+		*
+		*  @return
+		*    The Vulkan fence to pass to "vkQueueSubmit()", can be a null handle
+		*
+		*  @note
+		*    - There's only a single frame fence, so if the previously submitted frame is still in flight this waits for it
+		*/
+		[[nodiscard]] VkFence beginFrameSubmission() const
+		{
+			if (VK_NULL_HANDLE != mFrameVkFence)
+			{
+				if (mNumberOfSubmittedFrames > mNumberOfCompletedFrames)
+				{
+					vkWaitForFences(mVkDevice, 1, &mFrameVkFence, VK_TRUE, UINT64_MAX);
+					mNumberOfCompletedFrames = mNumberOfSubmittedFrames;
+				}
+				vkResetFences(mVkDevice, 1, &mFrameVkFence);
+			}
+			++mNumberOfSubmittedFrames;
+			return mFrameVkFence;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of frames submitted to the graphics queue
+		*
+		*  @return
+		*    The number of submitted frames, the frame currently being recorded will be submitted as frame number "getNumberOfSubmittedFrames() + 1"
+		*/
+		[[nodiscard]] inline uint64_t getNumberOfSubmittedFrames() const
+		{
+			return mNumberOfSubmittedFrames;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of frames the GPU has finished executing
+		*
+		*  @return
+		*    The number of completed frames, Vulkan objects last used by a frame number less or equal to this value can be reused
+		*/
+		[[nodiscard]] uint64_t getNumberOfCompletedFrames() const
+		{
+			if (mNumberOfSubmittedFrames > mNumberOfCompletedFrames && (VK_NULL_HANDLE == mFrameVkFence || vkGetFenceStatus(mVkDevice, mFrameVkFence) == VK_SUCCESS))
+			{
+				mNumberOfCompletedFrames = mNumberOfSubmittedFrames;
+			}
+			return mNumberOfCompletedFrames;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -3199,6 +3290,9 @@ namespace VulkanRhi
 		VkQueue			 mPresentVkQueue;			///< Handle to the Vulkan device present queue
 		VkCommandPool	 mVkCommandPool;			///< Vulkan command buffer pool instance
 		VkCommandBuffer  mVkCommandBuffer;			///< Vulkan command buffer instance
+		VkFence			 mFrameVkFence;				///< Vulkan fence signaled as soon as the GPU finished the last submitted frame, can be a null handle
+		mutable uint64_t mNumberOfSubmittedFrames;	///< Number of frames submitted to the graphics queue
+		mutable uint64_t mNumberOfCompletedFrames;	///< Number of frames the GPU has finished executing, lazily updated
 
 
 	};
@@ -4552,7 +4646,7 @@ namespace VulkanRhi
 			mVkPipelineLayout(VK_NULL_HANDLE),
 			mVkDescriptorPool(VK_NULL_HANDLE)
 		{
-			static constexpr uint32_t maxSets = 4242;	// TODO(co) We probably need to get this provided from the outside
+			static constexpr uint32_t maxSets = MAXIMUM_NUMBER_OF_VK_DESCRIPTOR_SETS;
 
 			// Copy the parameter data
 			const Rhi::Context& context = vulkanRhi.getContext();
@@ -4600,6 +4694,7 @@ namespace VulkanRhi
 				// Fill the Vulkan descriptor set layout bindings
 				vkDescriptorSetLayouts.reserve(numberOfRootParameters);
 				mVkDescriptorSetLayouts.resize(numberOfRootParameters);
+				mDescriptorSetCaches.resize(numberOfRootParameters);
 				std::fill(mVkDescriptorSetLayouts.begin(), mVkDescriptorSetLayouts.end(), static_cast<VkDescriptorSetLayout>(VK_NULL_HANDLE));	// TODO(co) Get rid of this
 				typedef Vector<VkDescriptorSetLayoutBinding> VkDescriptorSetLayoutBindings;
 				VkDescriptorSetLayoutBindings vkDescriptorSetLayoutBindings;
@@ -4795,8 +4890,7 @@ namespace VulkanRhi
 			}
 
 			{ // Create the Vulkan descriptor pool
-				typedef std::array<VkDescriptorPoolSize, 3> VkDescriptorPoolSizes;
-				VkDescriptorPoolSizes vkDescriptorPoolSizes;
+				std::array<VkDescriptorPoolSize, 6> vkDescriptorPoolSizes;
 				uint32_t numberOfVkDescriptorPoolSizes = 0;
 
 				// "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER"
@@ -4853,22 +4947,11 @@ namespace VulkanRhi
 					++numberOfVkDescriptorPoolSizes;
 				}
 
-				// Create the Vulkan descriptor pool
+				// Create the Vulkan descriptor pool, the pool sizes are kept for additional Vulkan descriptor pools created on demand
 				if (numberOfVkDescriptorPoolSizes > 0)
 				{
-					const VkDescriptorPoolCreateInfo VkDescriptorPoolCreateInfo =
-					{
-						VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,		// sType (VkStructureType)
-						nullptr,											// pNext (const void*)
-						VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,	// flags (VkDescriptorPoolCreateFlags)
-						maxSets,											// maxSets (uint32_t)
-						numberOfVkDescriptorPoolSizes,						// poolSizeCount (uint32_t)
-						vkDescriptorPoolSizes.data()						// pPoolSizes (const VkDescriptorPoolSize*)
-					};
-					if (vkCreateDescriptorPool(vkDevice, &VkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkDescriptorPool) != VK_SUCCESS)
-					{
-						RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan descriptor pool")
-					}
+					mVkDescriptorPoolSizes.assign(vkDescriptorPoolSizes.cbegin(), vkDescriptorPoolSizes.cbegin() + numberOfVkDescriptorPoolSizes);
+					mVkDescriptorPool = createVkDescriptorPool();
 				}
 			}
 
@@ -4896,11 +4979,15 @@ namespace VulkanRhi
 			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 
-			// Destroy the Vulkan descriptor pool
+			// Destroy the Vulkan descriptor pools
 			if (VK_NULL_HANDLE != mVkDescriptorPool)
 			{
 				vkDestroyDescriptorPool(vkDevice, mVkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
 			}
+			for (VkDescriptorPool vkDescriptorPool : mExhaustedVkDescriptorPools)
+			{
+				vkDestroyDescriptorPool(vkDevice, vkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
+			}
 
 			// Destroy the Vulkan pipeline layout
 			if (VK_NULL_HANDLE != mVkPipelineLayout)
@@ -4970,6 +5057,46 @@ namespace VulkanRhi
 			return mVkDescriptorPool;
 		}
 
+		/**
+		*  @brief
+		*    Called by a resource group of this root signature when it's destroyed
+		*
+		*  @param[in] rootParameterIndex
+		*    Root parameter index of the resource group
+		*  @param[in] hash
+		*    Resource group hash as calculated by "calculateResourceGroupHash()"
+		*  @param[in] resourceGroup
+		*    Resource group which is about to be destroyed
+		*  @param[in] vkDescriptorSet
+		*    Vulkan descriptor set wrapped by the resource group, can be a null handle, will be recycled for the next resource group of the same root parameter
+		*    as soon as the GPU finished all frames which might still reference it
+		*/
+		void onResourceGroupDestruction(uint32_t rootParameterIndex, uint32_t hash, const ResourceGroup* resourceGroup, VkDescriptorSet vkDescriptorSet)
+		{
+			DescriptorSetCache& descriptorSetCache = mDescriptorSetCaches[rootParameterIndex];
+
+			// Unregister the resource group so it's no longer handed out
+			CachedResourceGroups& cachedResourceGroups = descriptorSetCache.cachedResourceGroups;
+			CachedResourceGroups::iterator iterator = std::lower_bound(cachedResourceGroups.begin(), cachedResourceGroups.end(), hash, detail::orderCachedResourceGroupByHash);
+			while (iterator != cachedResourceGroups.end() && iterator->hash == hash)
+			{
+				if (iterator->resourceGroup == resourceGroup)
+				{
+					cachedResourceGroups.erase(iterator);
+					break;
+				}
+				++iterator;
+			}
+
+			// Put the Vulkan descriptor set into the pending list instead of giving it back to the Vulkan descriptor pool: The frame currently being recorded
+			// might still reference it, so it can only be reused after the GPU finished this frame
+			if (VK_NULL_HANDLE != vkDescriptorSet)
+			{
+				const uint64_t releaseFrameNumber = static_cast<VulkanRhi&>(getRhi()).getVulkanContext().getNumberOfSubmittedFrames() + 1;
+				descriptorSetCache.pendingVkDescriptorSets.push_back({vkDescriptorSet, releaseFrameNumber});
+			}
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Rhi::IRootSignature methods            ]
@@ -4995,12 +5122,153 @@ namespace VulkanRhi
 		explicit RootSignature(const RootSignature& source) = delete;
 		RootSignature& operator =(const RootSignature& source) = delete;
 
+		/**
+		*  @brief
+		*    Calculate the hash identifying the resources of a resource group
+		*
+		*  @param[in] numberOfResources
+		*    Number of resources
+		*  @param[in] resources
+		*    At least "numberOfResources" resource pointers, must be valid
+		*  @param[in] samplerStates
+		*    If not a null pointer at least "numberOfResources" sampler state pointers
+		*
+		*  @return
+		*    The 32-bit FNV-1a hash of the resource and sampler state pointers
+		*/
+		[[nodiscard]] static uint32_t calculateResourceGroupHash(uint32_t numberOfResources, Rhi::IResource* const* resources, Rhi::ISamplerState* const* samplerStates)
+		{
+			// 32-bit FNV-1a implementation basing on http://www.isthe.com/chongo/tech/comp/fnv/
+			static constexpr uint32_t FNV1a_INITIAL_HASH_32 = 0xcbf29ce4u;
+			static constexpr uint32_t FNV1a_MAGIC_PRIME_32 = 0x1000193u;
+			uint32_t hash = FNV1a_INITIAL_HASH_32;
+			const auto hashPointer = [&hash](const void* pointer)
+			{
+				const uint8_t* content = reinterpret_cast<const uint8_t*>(&pointer);
+				for (size_t i = 0; i < sizeof(const void*); ++i)
+				{
+					hash = (hash ^ content[i]) * FNV1a_MAGIC_PRIME_32;
+				}
+			};
+			for (uint32_t resourceIndex = 0; resourceIndex < numberOfResources; ++resourceIndex)
+			{
+				hashPointer(resources[resourceIndex]);
+				hashPointer((nullptr != samplerStates) ? samplerStates[resourceIndex] : nullptr);
+			}
+			return hash;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] VkDescriptorPool createVkDescriptorPool() const
+		{
+			// -> No "VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT", descriptor sets are never freed individually but recycled through the descriptor set caches
+			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
+			const VkDescriptorPoolCreateInfo vkDescriptorPoolCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,			// sType (VkStructureType)
+				nullptr,												// pNext (const void*)
+				0,														// flags (VkDescriptorPoolCreateFlags)
+				MAXIMUM_NUMBER_OF_VK_DESCRIPTOR_SETS,					// maxSets (uint32_t)
+				static_cast<uint32_t>(mVkDescriptorPoolSizes.size()),	// poolSizeCount (uint32_t)
+				mVkDescriptorPoolSizes.data()							// pPoolSizes (const VkDescriptorPoolSize*)
+			};
+			VkDescriptorPool vkDescriptorPool = VK_NULL_HANDLE;
+			if (vkCreateDescriptorPool(vulkanRhi.getVulkanContext().getVkDevice(), &vkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDescriptorPool) != VK_SUCCESS)
+			{
+				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan descriptor pool")
+				vkDescriptorPool = VK_NULL_HANDLE;
+			}
+			return vkDescriptorPool;
+		}
+
+		/**
+		*  @brief
+		*    Allocate a new Vulkan descriptor set, a new Vulkan descriptor pool is created if the current one is exhausted
+		*
+		*  @param[in] rootParameterIndex
+		*    Root parameter index of the Vulkan descriptor set layout to use
+		*
+		*  @return
+		*    The allocated Vulkan descriptor set, null handle on error
+		*
+		*  @note
+		*    - Vulkan descriptor sets of destroyed resource groups are only recycled after the GPU finished the frame they were released in, without
+		*      "Rhi::ISwapChain::present()" (e.g. offscreen or compute-only use) no frame is ever finished, so the descriptor pool must be able to grow
+		*/
+		[[nodiscard]] VkDescriptorSet allocateVkDescriptorSet(uint32_t rootParameterIndex)
+		{
+			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
+			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
+			VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
+			{
+				VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// sType (VkStructureType)
+				nullptr,										// pNext (const void*)
+				mVkDescriptorPool,								// descriptorPool (VkDescriptorPool)
+				1,												// descriptorSetCount (uint32_t)
+				&mVkDescriptorSetLayouts[rootParameterIndex]	// pSetLayouts (const VkDescriptorSetLayout*)
+			};
+			VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
+			if (vkAllocateDescriptorSets(vkDevice, &vkDescriptorSetAllocateInfo, &vkDescriptorSet) != VK_SUCCESS)
+			{
+				// Vulkan 1.0 implementations aren't required to report "VK_ERROR_OUT_OF_POOL_MEMORY" or "VK_ERROR_FRAGMENTED_POOL" on exhaustion, so try once
+				// again using a new Vulkan descriptor pool on any error: Vulkan descriptor sets of the exhausted pool stay valid and are still recycled
+				vkDescriptorSet = VK_NULL_HANDLE;
+				const VkDescriptorPool vkDescriptorPool = createVkDescriptorPool();
+				if (VK_NULL_HANDLE != vkDescriptorPool)
+				{
+					mExhaustedVkDescriptorPools.push_back(mVkDescriptorPool);
+					mVkDescriptorPool = vkDescriptorPool;
+					vkDescriptorSetAllocateInfo.descriptorPool = mVkDescriptorPool;
+					if (vkAllocateDescriptorSets(vkDevice, &vkDescriptorSetAllocateInfo, &vkDescriptorSet) != VK_SUCCESS)
+					{
+						vkDescriptorSet = VK_NULL_HANDLE;
+					}
+				}
+				if (VK_NULL_HANDLE == vkDescriptorSet)
+				{
+					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan descriptor set")
+				}
+			}
+			return vkDescriptorSet;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_VK_DESCRIPTOR_SETS = 4242;	///< Per Vulkan descriptor pool, additional Vulkan descriptor pools are created on demand
 		typedef Vector<VkDescriptorSetLayout> VkDescriptorSetLayouts;
+		typedef Vector<VkDescriptorSet> VkDescriptorSets;
+		typedef Vector<VkDescriptorPoolSize> VkDescriptorPoolSizes;
+		typedef Vector<VkDescriptorPool> VkDescriptorPools;
+		typedef Vector<detail::CachedResourceGroup> CachedResourceGroups;	///< Sorted by hash
+
+		struct PendingVkDescriptorSet final
+		{
+			VkDescriptorSet vkDescriptorSet;
+			uint64_t		releaseFrameNumber;	///< The Vulkan descriptor set can be reused as soon as the GPU finished this frame number
+		};
+		typedef Vector<PendingVkDescriptorSet> PendingVkDescriptorSets;
+		/**
+		*  @brief
+		*    Per root parameter descriptor set cache
+		*
+		*  @note
+		*    - Identical resource groups are deduplicated, a request for an already existing resource group returns this instance
+		*    - Vulkan descriptor sets of destroyed resource groups are recycled instead of being freed and allocated again
+		*/
+		struct DescriptorSetCache final
+		{
+			CachedResourceGroups	cachedResourceGroups;		///< Currently existing resource groups, we don't own a reference
+			VkDescriptorSets		freeVkDescriptorSets;		///< Vulkan descriptor sets ready for reuse, the Vulkan descriptor pools are the owners which manage the memory
+			PendingVkDescriptorSets	pendingVkDescriptorSets;	///< Vulkan descriptor sets of destroyed resource groups the GPU might still use, ordered by ascending release frame number
+		};
+		typedef Vector<DescriptorSetCache> DescriptorSetCaches;
 
 
 	//[-------------------------------------------------------]
@@ -5010,7 +5278,10 @@ namespace VulkanRhi
 		Rhi::RootSignature	   mRootSignature;
 		VkDescriptorSetLayouts mVkDescriptorSetLayouts;
 		VkPipelineLayout	   mVkPipelineLayout;
-		VkDescriptorPool	   mVkDescriptorPool;
+		VkDescriptorPoolSizes  mVkDescriptorPoolSizes;		///< Pool sizes of each Vulkan descriptor pool
+		VkDescriptorPool	   mVkDescriptorPool;			///< Vulkan descriptor pool new Vulkan descriptor sets are allocated from
+		VkDescriptorPools	   mExhaustedVkDescriptorPools;	///< Previously used Vulkan descriptor pools, their Vulkan descriptor sets are still in use or recycled
+		DescriptorSetCaches	   mDescriptorSetCaches;		///< One descriptor set cache per root parameter
 
 
 	};
@@ -8099,6 +8370,7 @@ namespace VulkanRhi
 			{ // Queue submit
 				const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 				const VkCommandBuffer vkCommandBuffer = vulkanContext.getVkCommandBuffer();
+				const VkFence frameVkFence = vulkanContext.beginFrameSubmission();
 				const VkSubmitInfo vkSubmitInfo =
 				{
 					VK_STRUCTURE_TYPE_SUBMIT_INFO,	// sType (VkStructureType)
@@ -8111,7 +8383,7 @@ namespace VulkanRhi
 					1,								// signalSemaphoreCount (uint32_t)
 					&mRenderingFinishedVkSemaphore	// pSignalSemaphores (const VkSemaphore*)
 				};
-				if (vkQueueSubmit(vulkanContext.getGraphicsVkQueue(), 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+				if (vkQueueSubmit(vulkanContext.getGraphicsVkQueue(), 1, &vkSubmitInfo, frameVkFence) != VK_SUCCESS)
 				{
 					// Error!
 					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Vulkan queue submit failed")
@@ -10921,6 +11193,8 @@ namespace VulkanRhi
 		*    Root signature
 		*  @param[in] rootParameterIndex
 		*    Root parameter index
+		*  @param[in] hash
+		*    Hash of the resource and sampler state pointers, used by the root signature descriptor set cache
 		*  @param[in] vkDescriptorSet
 		*    Wrapped Vulkan descriptor set
 		*  @param[in] numberOfResources
@@ -10930,9 +11204,11 @@ namespace VulkanRhi
 		*  @param[in] samplerStates
 		*    If not a null pointer at least "numberOfResources" sampler state pointers, must be valid if there's at least one texture resource, the resource group will keep a reference to the sampler states
 		*/
-		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, uint32_t hash, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IResourceGroup(rootSignature.getRhi() RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mRootSignature(rootSignature),
+			mRootParameterIndex(rootParameterIndex),
+			mHash(hash),
 			mVkDescriptorSet(vkDescriptorSet),
 			mNumberOfResources(numberOfResources),
 			mResources(RHI_MALLOC_TYPED(rootSignature.getRhi().getContext(), Rhi::IResource*, mNumberOfResources)),
@@ -11304,11 +11580,8 @@ namespace VulkanRhi
 			}
 			RHI_FREE(context, mResources);
 
-			// Free Vulkan descriptor set
-			if (VK_NULL_HANDLE != mVkDescriptorSet)
-			{
-				vkFreeDescriptorSets(static_cast<VulkanRhi&>(mRootSignature.getRhi()).getVulkanContext().getVkDevice(), mRootSignature.getVkDescriptorPool(), 1, &mVkDescriptorSet);
-			}
+			// Give the Vulkan descriptor set back to the root signature for recycling
+			mRootSignature.onResourceGroupDestruction(mRootParameterIndex, mHash, this, mVkDescriptorSet);
 			mRootSignature.releaseReference();
 		}
 
@@ -11324,6 +11597,38 @@ namespace VulkanRhi
 			return mVkDescriptorSet;
 		}
 
+		/**
+		*  @brief
+		*    Check whether or not this resource group groups exactly the given resources and sampler states
+		*
+		*  @param[in] numberOfResources
+		*    Number of resources
+		*  @param[in] resources
+		*    At least "numberOfResources" resource pointers, must be valid
+		*  @param[in] samplerStates
+		*    If not a null pointer at least "numberOfResources" sampler state pointers
+		*
+		*  @return
+		*    "true" if the resource group is identical, else "false"
+		*/
+		[[nodiscard]] bool hasSameResources(uint32_t numberOfResources, Rhi::IResource* const* resources, Rhi::ISamplerState* const* samplerStates) const
+		{
+			if (mNumberOfResources != numberOfResources)
+			{
+				return false;
+			}
+			for (uint32_t resourceIndex = 0; resourceIndex < mNumberOfResources; ++resourceIndex)
+			{
+				const Rhi::ISamplerState* samplerState = (nullptr != samplerStates) ? samplerStates[resourceIndex] : nullptr;
+				const Rhi::ISamplerState* ownSamplerState = (nullptr != mSamplerStates) ? mSamplerStates[resourceIndex] : nullptr;
+				if (mResources[resourceIndex] != resources[resourceIndex] || ownSamplerState != samplerState)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -11348,6 +11653,8 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		RootSignature&		 mRootSignature;		///< Root signature
+		uint32_t			 mRootParameterIndex;	///< Root parameter index
+		uint32_t			 mHash;					///< Hash of the resource and sampler state pointers, used by the root signature descriptor set cache
 		VkDescriptorSet		 mVkDescriptorSet;		///< "mVkDescriptorPool" of the root signature is the owner which manages the memory, can be a null handle (e.g. for a sampler resource group)
 		uint32_t			 mNumberOfResources;	///< Number of resources this resource group groups together
 		Rhi::IResource**	 mResources;			///< RHI resource, we keep a reference to it
@@ -11368,26 +11675,59 @@ namespace VulkanRhi
 		RHI_ASSERT(context, numberOfResources > 0, "The number of Vulkan resources must not be zero")
 		RHI_ASSERT(context, nullptr != resources, "The Vulkan resource pointers must be valid")
 
-		// Allocate Vulkan descriptor set
-		VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
-		if ((*resources)->getResourceType() != Rhi::ResourceType::SAMPLER_STATE)
+		// Reuse an already existing identical resource group, if possible
+		DescriptorSetCache& descriptorSetCache = mDescriptorSetCaches[rootParameterIndex];
+		CachedResourceGroups& cachedResourceGroups = descriptorSetCache.cachedResourceGroups;
+		const uint32_t hash = calculateResourceGroupHash(numberOfResources, resources, samplerStates);
+		const CachedResourceGroups::iterator insertIterator = std::lower_bound(cachedResourceGroups.begin(), cachedResourceGroups.end(), hash, detail::orderCachedResourceGroupByHash);
+		for (CachedResourceGroups::iterator iterator = insertIterator; iterator != cachedResourceGroups.end() && iterator->hash == hash; ++iterator)
 		{
-			const VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
+			if (iterator->resourceGroup->hasSameResources(numberOfResources, resources, samplerStates))
 			{
-				VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// sType (VkStructureType)
-				nullptr,										// pNext (const void*)
-				mVkDescriptorPool,								// descriptorPool (VkDescriptorPool)
-				1,												// descriptorSetCount (uint32_t)
-				&mVkDescriptorSetLayouts[rootParameterIndex]	// pSetLayouts (const VkDescriptorSetLayout*)
-			};
-			if (vkAllocateDescriptorSets(vulkanRhi.getVulkanContext().getVkDevice(), &vkDescriptorSetAllocateInfo, &vkDescriptorSet) != VK_SUCCESS)
+				#ifdef RHI_STATISTICS
+					updateResourceGroupCacheStatistics(true);
+				#endif
+				return iterator->resourceGroup;
+			}
+		}
+		#ifdef RHI_STATISTICS
+			updateResourceGroupCacheStatistics(false);
+		#endif
+
+		// Move Vulkan descriptor sets the GPU is no longer using from the pending list into the free list
+		PendingVkDescriptorSets& pendingVkDescriptorSets = descriptorSetCache.pendingVkDescriptorSets;
+		if (!pendingVkDescriptorSets.empty())
+		{
+			const uint64_t numberOfCompletedFrames = vulkanRhi.getVulkanContext().getNumberOfCompletedFrames();
+			PendingVkDescriptorSets::iterator iterator = pendingVkDescriptorSets.begin();
+			while (iterator != pendingVkDescriptorSets.end() && iterator->releaseFrameNumber <= numberOfCompletedFrames)
 			{
-				RHI_LOG(context, CRITICAL, "Failed to allocate the Vulkan descriptor set")
+				descriptorSetCache.freeVkDescriptorSets.push_back(iterator->vkDescriptorSet);
+				++iterator;
 			}
+			pendingVkDescriptorSets.erase(pendingVkDescriptorSets.begin(), iterator);
+		}
+
+		// Get Vulkan descriptor set: Recycle a free one or allocate a new one
+		VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
+		if ((*resources)->getResourceType() == Rhi::ResourceType::SAMPLER_STATE)
+		{
+			// Nothing to do in here, Vulkan is using combined image samplers
+		}
+		else if (!descriptorSetCache.freeVkDescriptorSets.empty())
+		{
+			vkDescriptorSet = descriptorSetCache.freeVkDescriptorSets.back();
+			descriptorSetCache.freeVkDescriptorSets.pop_back();
+		}
+		else
+		{
+			vkDescriptorSet = allocateVkDescriptorSet(rootParameterIndex);
 		}
 
-		// Create resource group
-		return RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, vkDescriptorSet, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+		// Create resource group and register it inside the descriptor set cache
+		ResourceGroup* resourceGroup = RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, hash, vkDescriptorSet, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+		cachedResourceGroups.insert(insertIterator, { hash, resourceGroup });
+		return resourceGroup;
 	}
 
 
@@ -11887,8 +12227,7 @@ namespace VulkanRhi
 	void VulkanRhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -11898,8 +12237,7 @@ namespace VulkanRhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = commandBuffer.getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -285,19 +285,17 @@ PRAGMA_WARNING_POP
 	*/
 	#define RHI_RESOURCE_DEBUG_PASS_PARAMETER
 #endif
-#ifdef RHI_STATISTICS
-	// Disable warnings in external headers, we can't fix them
-	PRAGMA_WARNING_PUSH
-		PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
-		PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_List_node<_Ty,std::_Default_allocator_traits<_Alloc>::void_pointer>': default constructor was implicitly defined as deleted
-		PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Ptr_base<_Ty>': copy constructor was implicitly defined as deleted
-		PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': assignment operator was implicitly defined as deleted
-		PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
-		PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted (compiling source file E:\private\unrimp\Source\Rhi\Private\Direct3D10Rhi\Direct3D10Rhi.cpp)
-		PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': move assignment operator was implicitly defined as deleted
-		#include <atomic>	// For "std::atomic<>"
-	PRAGMA_WARNING_POP
-#endif
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_List_node<_Ty,std::_Default_allocator_traits<_Alloc>::void_pointer>': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Ptr_base<_Ty>': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted (compiling source file E:\private\unrimp\Source\Rhi\Private\Direct3D10Rhi\Direct3D10Rhi.cpp)
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': move assignment operator was implicitly defined as deleted
+	#include <atomic>	// For "std::atomic<>" and "std::atomic_flag"
+PRAGMA_WARNING_POP
 #ifdef _WIN32
 	#include <intrin.h>	// For "__nop()"
 #endif
@@ -3263,12 +3261,16 @@ namespace Rhi
 	public:
 		inline ShaderBytecode() :
 			mNumberOfBytes(0),
-			mBytecode(nullptr)
+			mBytecode(nullptr),
+			mOwnsBytecode(false)
 		{}
 
 		inline ~ShaderBytecode()
 		{
-			delete [] mBytecode;
+			if (mOwnsBytecode)
+			{
+				delete [] mBytecode;
+			}
 		}
 
 		[[nodiscard]] inline uint32_t getNumberOfBytes() const
@@ -3283,16 +3285,42 @@ namespace Rhi
 
 		inline void setBytecodeCopy(uint32_t numberOfBytes, uint8_t* bytecode)
 		{
-			delete [] mBytecode;
+			if (mOwnsBytecode)
+			{
+				delete [] mBytecode;
+			}
+			uint8_t* bytecodeCopy = new uint8_t[numberOfBytes];
+			memcpy(bytecodeCopy, bytecode, numberOfBytes);
+			mNumberOfBytes = numberOfBytes;
+			mBytecode	   = bytecodeCopy;
+			mOwnsBytecode  = true;
+		}
+
+		/**
+		*  @brief
+		*    Set a bytecode reference without copying it
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes in the bytecode
+		*  @param[in] bytecode
+		*    Shader bytecode, can be a null pointer, must stay valid as long as this shader bytecode instance references it
+		*/
+		inline void setBytecodeReference(uint32_t numberOfBytes, const uint8_t* bytecode)
+		{
+			if (mOwnsBytecode)
+			{
+				delete [] mBytecode;
+			}
 			mNumberOfBytes = numberOfBytes;
-			mBytecode = new uint8_t[mNumberOfBytes];
-			memcpy(mBytecode, bytecode, mNumberOfBytes);
+			mBytecode	   = bytecode;
+			mOwnsBytecode  = false;
 		}
 
 	// Private data
 	private:
-		uint32_t mNumberOfBytes;	///< Number of bytes in the bytecode
-		uint8_t* mBytecode;			///< Shader bytecode, can be a null pointer
+		uint32_t	   mNumberOfBytes;	///< Number of bytes in the bytecode
+		const uint8_t* mBytecode;		///< Shader bytecode, can be a null pointer
+		bool		   mOwnsBytecode;	///< "true" if the shader bytecode instance owns the bytecode memory and has to destroy it, else "false" (bytecode reference)
 
 	};
 
@@ -3803,6 +3831,8 @@ namespace Rhi
 		bool				baseVertex;										///< Base vertex supported for draw calls?
 		bool				nativeMultithreading;							///< Does the RHI support native multithreading? For example Direct3D 11 does meaning we can also create RHI resources asynchronous while for OpenGL we have to create an separate OpenGL context (less efficient, more complex to implement).
 		bool				shaderBytecode;									///< Shader bytecode supported?
+		bool				graphicsProgramBinary;							///< Linked graphics program binaries can be retrieved and restored? The binary is only valid for the RHI and driver which created it (e.g. OpenGL "GL_ARB_get_program_binary").
+		bool				parallelShaderCompilation;						///< Are shader compilation and graphics program linking performed by the driver in the background? If so, poll "Rhi::IGraphicsProgram::isReady()" instead of using a graphics program right away (e.g. OpenGL "GL_KHR_parallel_shader_compile").
 		// Graphics
 		bool				vertexShader;									///< Is there support for vertex shaders (VS)?
 		uint32_t			maximumNumberOfPatchVertices;					///< Tessellation-control-shader (TCS) stage and tessellation-evaluation-shader (TES) stage: Maximum number of vertices per patch (usually 0 for no tessellation support or 32 which is the maximum number of supported vertices per patch)
@@ -3842,6 +3872,8 @@ namespace Rhi
 			baseVertex(false),
 			nativeMultithreading(false),
 			shaderBytecode(false),
+			graphicsProgramBinary(false),
+			parallelShaderCompilation(false),
 			vertexShader(false),
 			maximumNumberOfPatchVertices(0),
 			maximumNumberOfGsOutputVertices(0),
@@ -3954,6 +3986,9 @@ namespace Rhi
 			std::atomic<uint32_t> numberOfCreatedMeshShaders;					///< Number of created mesh shader (MS) instances
 			std::atomic<uint32_t> currentNumberOfComputeShaders;				///< Current number of compute shader (CS) instances
 			std::atomic<uint32_t> numberOfCreatedComputeShaders;				///< Number of created compute shader (CS) instances
+			// Resource group cache
+			std::atomic<uint32_t> numberOfResourceGroupCacheHits;				///< Number of resource group creation requests which were satisfied by reusing an already existing resource group instance, only updated by RHI implementations which cache resource groups
+			std::atomic<uint32_t> numberOfResourceGroupCacheMisses;				///< Number of resource group creation requests which resulted in a new resource group instance, only updated by RHI implementations which cache resource groups
 
 		// Public methods
 		public:
@@ -4030,7 +4065,10 @@ namespace Rhi
 				currentNumberOfMeshShaders(0),
 				numberOfCreatedMeshShaders(0),
 				currentNumberOfComputeShaders(0),
-				numberOfCreatedComputeShaders(0)
+				numberOfCreatedComputeShaders(0),
+				// Resource group cache
+				numberOfResourceGroupCacheHits(0),
+				numberOfResourceGroupCacheMisses(0)
 			{}
 
 			/**
@@ -4152,6 +4190,10 @@ namespace Rhi
 				RHI_LOG(context, INFORMATION, "Mesh shaders: %u", currentNumberOfMeshShaders.load())
 				RHI_LOG(context, INFORMATION, "Compute shaders: %u", currentNumberOfComputeShaders.load())
 
+				// Resource group cache
+				RHI_LOG(context, INFORMATION, "Resource group cache hits: %u", numberOfResourceGroupCacheHits.load())
+				RHI_LOG(context, INFORMATION, "Resource group cache misses: %u", numberOfResourceGroupCacheMisses.load())
+
 				// End
 				RHI_LOG(context, INFORMATION, "***************************************************")
 			}
@@ -5277,6 +5319,32 @@ namespace Rhi
 		*/
 		[[nodiscard]] virtual IGraphicsProgram* createGraphicsProgram(const IRootSignature& rootSignature, ITaskShader* taskShader, IMeshShader& meshShader, IFragmentShader* fragmentShader RHI_RESOURCE_DEBUG_NAME_PARAMETER) = 0;
 
+		/**
+		*  @brief
+		*    Create a graphics program from a graphics program binary previously returned by "Rhi::IGraphicsProgram::getGraphicsProgramBinary()"
+		*
+		*  @param[in] rootSignature
+		*    Root signature, must be the one the graphics program binary was created with
+		*  @param[in] vertexAttributes
+		*    Vertex attributes ("vertex declaration" in Direct3D 9 terminology, "input layout" in Direct3D 10 & 11 terminology), must be the ones the graphics program binary was created with
+		*  @param[in] graphicsProgramBinary
+		*    Graphics program binary
+		*
+		*  @return
+		*    The created graphics program, a null pointer if the graphics program binary was rejected (e.g. created by another driver version) or isn't supported. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Only supported if "Rhi::Capabilities::graphicsProgramBinary" is true
+		*    - A rejected graphics program binary is no error, the caller is supposed to fall back to creating the graphics program from shaders
+		*/
+		[[nodiscard]] inline virtual IGraphicsProgram* createGraphicsProgramFromBinary([[maybe_unused]] const IRootSignature& rootSignature, [[maybe_unused]] const VertexAttributes& vertexAttributes, [[maybe_unused]] const ShaderBytecode& graphicsProgramBinary RHI_RESOURCE_DEBUG_NAME_PARAMETER)
+		{
+			#ifdef RHI_DEBUG
+				static_cast<void>(debugName);
+			#endif
+			return nullptr;
+		}
+
 	// Protected methods
 	protected:
 		/**
@@ -5540,6 +5608,27 @@ namespace Rhi
 		explicit IRootSignature(const IRootSignature& source) = delete;
 		IRootSignature& operator =(const IRootSignature& source) = delete;
 
+		#ifdef RHI_STATISTICS
+			/**
+			*  @brief
+			*    Update the resource group cache statistics, for RHI implementations which reuse identical resource groups
+			*
+			*  @param[in] cacheHit
+			*    "true" if an already existing resource group instance was reused, else "false"
+			*/
+			inline void updateResourceGroupCacheStatistics(bool cacheHit)
+			{
+				if (cacheHit)
+				{
+					++getRhi().getStatistics().numberOfResourceGroupCacheHits;
+				}
+				else
+				{
+					++getRhi().getStatistics().numberOfResourceGroupCacheMisses;
+				}
+			}
+		#endif
+
 	};
 
 	typedef SmartRefCount<IRootSignature> IRootSignaturePtr;
@@ -5639,6 +5728,37 @@ namespace Rhi
 	public:
 		[[nodiscard]] inline virtual handle getUniformHandle([[maybe_unused]] const char* uniformName) = 0;
 
+		/**
+		*  @brief
+		*    Return the graphics program binary
+		*
+		*  @param[out] graphicsProgramBinary
+		*    Receives the graphics program binary, only valid for the RHI and driver which created it, see "Rhi::IShaderLanguage::createGraphicsProgramFromBinary()"
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (e.g. "Rhi::Capabilities::graphicsProgramBinary" is false)
+		*/
+		[[nodiscard]] inline virtual bool getGraphicsProgramBinary([[maybe_unused]] ShaderBytecode& graphicsProgramBinary) const
+		{
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the graphics program is ready to be used without stalling
+		*
+		*  @return
+		*    "true" if the graphics program is ready, "false" if the driver is still compiling and linking it in the background (see "Rhi::Capabilities::parallelShaderCompilation")
+		*
+		*  @note
+		*    - Non-blocking, can be polled once per frame
+		*    - Not constant since the RHI implementation might finish the graphics program setup as soon as it's ready
+		*/
+		[[nodiscard]] inline virtual bool isReady()
+		{
+			return true;
+		}
+
 	// Protected methods
 	protected:
 		/**
@@ -8905,6 +9025,152 @@ namespace Rhi
 
 	}
 
+	/**
+	*  @brief
+	*    Command buffer page pool
+	*
+	*  @remarks
+	*    Command buffers store their command packets inside fixed-size pages. Pages which are no longer required by a command buffer are
+	*    handed back to this free list so that all command buffers can recycle them without hitting the heap each frame.
+	*    The free list is intrusive: The first bytes of a free page store the pointer to the next free page.
+	*
+	*  @note
+	*    - Thread-safe, acquiring and releasing pages is guarded by a tiny spin lock since it's only done when a command buffer runs out of pages or shrinks
+	*    - The instance is a function local static inside this header, so it's only process wide in static builds: In shared library builds each module
+	*      (e.g. RHI, renderer and application shared library) which records command buffers has its own page pool. Pages always stay valid since all
+	*      modules use the same global "operator new[]"/"operator delete[]", but a page released by another module than the one which acquired it
+	*      ends up in the page pool of the releasing module.
+	*/
+	class CommandBufferPagePool final
+	{
+
+	// Public definitions
+	public:
+		static constexpr uint32_t PAGE_SHIFT			  = 16;
+		static constexpr uint32_t PAGE_NUMBER_OF_BYTES	  = 1u << PAGE_SHIFT;			///< 64 KiB
+		static constexpr uint32_t PAGE_BYTE_INDEX_MASK	  = PAGE_NUMBER_OF_BYTES - 1;
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_PAGES = (1u << (32 - PAGE_SHIFT)) - 1;	// Minus one so "~0u" stays a free invalid command packet byte index
+
+	// Public static methods
+	public:
+		/**
+		*  @brief
+		*    Return the command buffer page pool instance
+		*
+		*  @return
+		*    The command buffer page pool instance, one per module in shared library builds
+		*/
+		[[nodiscard]] static inline CommandBufferPagePool& getInstance()
+		{
+			static CommandBufferPagePool commandBufferPagePool;
+			return commandBufferPagePool;
+		}
+
+	// Public methods
+	public:
+		/**
+		*  @brief
+		*    Acquire a page, reuses a free page if possible
+		*
+		*  @return
+		*    The page with "Rhi::CommandBufferPagePool::PAGE_NUMBER_OF_BYTES" bytes, release it via "Rhi::CommandBufferPagePool::releasePage()"
+		*/
+		[[nodiscard]] inline uint8_t* acquirePage()
+		{
+			uint8_t* page = nullptr;
+			lock();
+			if (nullptr != mFirstFreePage)
+			{
+				page = mFirstFreePage;
+				mFirstFreePage = *reinterpret_cast<uint8_t**>(page);
+				--mNumberOfFreePages;
+			}
+			unlock();
+			return (nullptr != page) ? page : new uint8_t[PAGE_NUMBER_OF_BYTES];
+		}
+
+		/**
+		*  @brief
+		*    Release a page acquired via "Rhi::CommandBufferPagePool::acquirePage()" so it can be reused by any command buffer
+		*
+		*  @param[in] page
+		*    Page to release, must be valid
+		*/
+		inline void releasePage(uint8_t* page)
+		{
+			ASSERT(nullptr != page, "Invalid command buffer page")
+			lock();
+			*reinterpret_cast<uint8_t**>(page) = mFirstFreePage;
+			mFirstFreePage = page;
+			++mNumberOfFreePages;
+			unlock();
+		}
+
+		/**
+		*  @brief
+		*    Return the number of free pages
+		*
+		*  @return
+		*    The number of free pages
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfFreePages() const
+		{
+			return mNumberOfFreePages;
+		}
+
+		/**
+		*  @brief
+		*    Destroy all free pages
+		*/
+		inline void destroyFreePages()
+		{
+			lock();
+			while (nullptr != mFirstFreePage)
+			{
+				uint8_t* page = mFirstFreePage;
+				mFirstFreePage = *reinterpret_cast<uint8_t**>(page);
+				delete [] page;
+			}
+			mNumberOfFreePages = 0;
+			unlock();
+		}
+
+	// Private methods
+	private:
+		inline CommandBufferPagePool() :
+			mFirstFreePage(nullptr),
+			mNumberOfFreePages(0)
+		{}
+
+		inline ~CommandBufferPagePool()
+		{
+			destroyFreePages();
+		}
+
+		explicit CommandBufferPagePool(const CommandBufferPagePool&) = delete;
+		CommandBufferPagePool& operator=(const CommandBufferPagePool&) = delete;
+
+		inline void lock()
+		{
+			while (mLock.test_and_set(std::memory_order_acquire))
+			{
+				// Spin, the lock is only held for a few instructions
+			}
+		}
+
+		inline void unlock()
+		{
+			mLock.clear(std::memory_order_release);
+		}
+
+	// Private data
+	private:
+		std::atomic_flag mLock;
+		uint8_t*		 mFirstFreePage;		///< First free page, can be a null pointer, the first bytes of a free page point to the next free page
+		uint32_t		 mNumberOfFreePages;
+
+	};
+
 	/**
 	*  @brief
 	*    Command buffer
@@ -8919,7 +9185,7 @@ namespace Rhi
 	*    batching and instancing. Also the memory management is much simplified to be cache friendly.
 	*
 	*  @note
-	*    - The commands are stored as a flat contiguous array to be cache friendly
+	*    - The commands are stored inside fixed-size pages recycled via "Rhi::CommandBufferPagePool", a command never straddles pages so it's cache friendly and growing doesn't copy already recorded commands
 	*    - Each command can have an additional auxiliary buffer, e.g. to store uniform buffer data to dispatch to the RHI
 	*    - It's valid to record a command buffer only once, and dispatch it multiple times to the RHI
 	*/
@@ -8933,10 +9199,11 @@ namespace Rhi
 		*    Default constructor
 		*/
 		inline CommandBuffer() :
-			mCommandPacketBufferNumberOfBytes(0),
-			mCommandPacketBuffer(nullptr),
-			mPreviousCommandPacketByteIndex(~0u),
-			mCurrentCommandPacketByteIndex(0)
+			mPages(nullptr),
+			mNumberOfPageSlots(0),
+			mNumberOfPages(0),
+			mCurrentPageIndex(0),
+			mPreviousCommandPacketByteIndex(~0u)
 			#ifdef RHI_STATISTICS
 				, mNumberOfCommands(0)
 			#endif
@@ -8948,7 +9215,8 @@ namespace Rhi
 		*/
 		inline ~CommandBuffer()
 		{
-			delete [] mCommandPacketBuffer;
+			releasePages(0);
+			delete [] mPages;
 		}
 
 		/**
@@ -8982,27 +9250,100 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return the command packet buffer
+		*    Return the number of pages owned by the command buffer
+		*
+		*  @return
+		*    The number of pages owned by the command buffer
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfPages() const
+		{
+			return mNumberOfPages;
+		}
+
+		/**
+		*  @brief
+		*    Return the first command packet
 		*
 		*  @return
-		*    The command packet buffer, can be a null pointer, don't destroy the instance
+		*    The first command packet, null pointer if the command buffer is empty, don't destroy the instance
 		*
 		*  @note
 		*    - Internal, don't access the method if you don't have to
 		*/
-		[[nodiscard]] inline const uint8_t* getCommandPacketBuffer() const
+		[[nodiscard]] inline ConstCommandPacket getFirstCommandPacket() const
+		{
+			return (~0u != mPreviousCommandPacketByteIndex) ? mPages[0].memory : nullptr;
+		}
+
+		/**
+		*  @brief
+		*    Return the command packet following the given command packet
+		*
+		*  @param[in] constCommandPacket
+		*    Command packet of this command buffer, must be valid
+		*
+		*  @return
+		*    The next command packet, null pointer if the given command packet is the last one, don't destroy the instance
+		*
+		*  @note
+		*    - Internal, don't access the method if you don't have to
+		*/
+		[[nodiscard]] inline ConstCommandPacket getNextCommandPacket(const ConstCommandPacket constCommandPacket) const
+		{
+			const uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
+			return (~0u != nextCommandPacketByteIndex) ? getCommandPacket(nextCommandPacketByteIndex) : nullptr;
+		}
+
+		/**
+		*  @brief
+		*    Pre-size the command buffer
+		*
+		*  @param[in] numberOfBytes
+		*    Number of command packet bytes to reserve
+		*
+		*  @note
+		*    - "Rhi::CommandBuffer::clear()" keeps the pages required by the last recording (high-water mark), so calling this method is only useful for the first recording
+		*/
+		inline void reserve(uint32_t numberOfBytes)
 		{
-			return (~0u != mPreviousCommandPacketByteIndex) ? mCommandPacketBuffer : nullptr;
+			const uint32_t numberOfPages = (numberOfBytes + CommandBufferPagePool::PAGE_BYTE_INDEX_MASK) >> CommandBufferPagePool::PAGE_SHIFT;
+			ASSERT(numberOfPages <= CommandBufferPagePool::MAXIMUM_NUMBER_OF_PAGES, "Too many command buffer pages")
+			while (mNumberOfPages < numberOfPages)
+			{
+				addPage(CommandBufferPagePool::getInstance().acquirePage(), CommandBufferPagePool::PAGE_NUMBER_OF_BYTES);
+			}
 		}
 
 		/**
 		*  @brief
 		*    Clear the command buffer
+		*
+		*  @note
+		*    - The pages used by the last recording are kept so the next recording of a similar size doesn't need to allocate, surplus pages are handed back to "Rhi::CommandBufferPagePool"
+		*    - Oversized pages dedicated to a single command packet are freed, all kept pages have "Rhi::CommandBufferPagePool::PAGE_NUMBER_OF_BYTES" bytes
 		*/
 		inline void clear()
 		{
+			if (~0u != mPreviousCommandPacketByteIndex)
+			{
+				releasePages(mCurrentPageIndex + 1);
+				uint32_t numberOfKeptPages = 0;
+				for (uint32_t i = 0; i < mNumberOfPages; ++i)
+				{
+					if (CommandBufferPagePool::PAGE_NUMBER_OF_BYTES == mPages[i].numberOfBytes)
+					{
+						mPages[numberOfKeptPages] = { mPages[i].memory, mPages[i].numberOfBytes, 0 };
+						++numberOfKeptPages;
+					}
+					else
+					{
+						releasePage(mPages[i]);
+					}
+				}
+				mNumberOfPages = numberOfKeptPages;
+			}
+			mCurrentPageIndex = 0;
 			mPreviousCommandPacketByteIndex = ~0u;
-			mCurrentCommandPacketByteIndex = 0;
 			#ifdef RHI_STATISTICS
 				mNumberOfCommands = 0;
 			#endif
@@ -9021,44 +9362,9 @@ namespace Rhi
 		template <typename U>
 		[[nodiscard]] U* addCommand(uint32_t numberOfAuxiliaryBytes = 0)
 		{
-			// How many command package buffer bytes are consumed by the command to add?
-			const uint32_t numberOfCommandBytes = CommandPacketHelper::getNumberOfBytes<U>(numberOfAuxiliaryBytes);
-
-			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
-			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
-			ASSERT((static_cast<uint64_t>(mCurrentCommandPacketByteIndex) + numberOfCommandBytes) < 4294967295u, "Invalid current command packet byte index")
-
-			// Grow command packet buffer, if required
-			if (mCommandPacketBufferNumberOfBytes < mCurrentCommandPacketByteIndex + numberOfCommandBytes)
-			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
-
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != mCommandPacketBuffer)
-				{
-					memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes);
-					delete [] mCommandPacketBuffer;
-				}
-
-				// Finalize
-				mCommandPacketBuffer = newCommandPacketBuffer;
-				mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
-			}
-
 			// Get command package for the new command
-			CommandPacket commandPacket = &mCommandPacketBuffer[mCurrentCommandPacketByteIndex];
-
-			// Setup previous and current command package
-			if (~0u != mPreviousCommandPacketByteIndex)
-			{
-				CommandPacketHelper::storeNextCommandPacketByteIndex(&mCommandPacketBuffer[mPreviousCommandPacketByteIndex], mCurrentCommandPacketByteIndex);
-			}
-			CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, ~0u);
+			CommandPacket commandPacket = allocateCommandPacket(CommandPacketHelper::getNumberOfBytes<U>(numberOfAuxiliaryBytes));
 			CommandPacketHelper::storeImplementationDispatchFunctionIndex(commandPacket, U::COMMAND_DISPATCH_FUNCTION_INDEX);
-			mPreviousCommandPacketByteIndex = mCurrentCommandPacketByteIndex;
-			mCurrentCommandPacketByteIndex += numberOfCommandBytes;
 
 			// Done
 			#ifdef RHI_STATISTICS
@@ -9108,55 +9414,26 @@ namespace Rhi
 			ASSERT(this != &commandBuffer, "Can't append a command buffer to itself")
 			ASSERT(!isEmpty(), "Can't append empty command buffers")
 
-			// How many command package buffer bytes are consumed by the command to add?
-			const uint32_t numberOfCommandBytes = mCurrentCommandPacketByteIndex;
-
-			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
-			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
-			ASSERT((static_cast<uint64_t>(commandBuffer.mCurrentCommandPacketByteIndex) + numberOfCommandBytes) < 4294967295u, "Invalid current command packet byte index")
-
-			// Grow command packet buffer, if required
-			if (commandBuffer.mCommandPacketBufferNumberOfBytes < commandBuffer.mCurrentCommandPacketByteIndex + numberOfCommandBytes)
+			// Copy over the command packets one by one, the target command buffer pages are filled differently so the command packet byte indices change
+			uint32_t commandPacketByteIndex = 0;
+			while (~0u != commandPacketByteIndex)
 			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = commandBuffer.mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
-
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != commandBuffer.mCommandPacketBuffer)
-				{
-					memcpy(newCommandPacketBuffer, commandBuffer.mCommandPacketBuffer, commandBuffer.mCommandPacketBufferNumberOfBytes);
-					delete [] commandBuffer.mCommandPacketBuffer;
-				}
-
-				// Finalize
-				commandBuffer.mCommandPacketBuffer = newCommandPacketBuffer;
-				commandBuffer.mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
-			}
-
-			// Copy over the command buffer in one burst
-			memcpy(&commandBuffer.mCommandPacketBuffer[commandBuffer.mCurrentCommandPacketByteIndex], mCommandPacketBuffer, mCurrentCommandPacketByteIndex);
-
-			// Setup previous command package
-			if (~0u != commandBuffer.mPreviousCommandPacketByteIndex)
-			{
-				CommandPacketHelper::storeNextCommandPacketByteIndex(&commandBuffer.mCommandPacketBuffer[commandBuffer.mPreviousCommandPacketByteIndex], commandBuffer.mCurrentCommandPacketByteIndex);
-			}
-
-			// Update command package indices
-			CommandPacket commandPacket = &commandBuffer.mCommandPacketBuffer[commandBuffer.mCurrentCommandPacketByteIndex];
-			uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
-			while (~0u != nextCommandPacketByteIndex)
-			{
-				nextCommandPacketByteIndex = commandBuffer.mCurrentCommandPacketByteIndex + nextCommandPacketByteIndex;
-				CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, nextCommandPacketByteIndex);
-				commandPacket = &commandBuffer.mCommandPacketBuffer[nextCommandPacketByteIndex];
-				nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
+				// Get the number of bytes consumed by the command packet: Either up to the next command packet or up to the end of the used page part
+				ConstCommandPacket constCommandPacket = getCommandPacket(commandPacketByteIndex);
+				const uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
+				const uint32_t numberOfCommandBytes = ((~0u != nextCommandPacketByteIndex) && (nextCommandPacketByteIndex >> CommandBufferPagePool::PAGE_SHIFT) == (commandPacketByteIndex >> CommandBufferPagePool::PAGE_SHIFT)) ?
+					(nextCommandPacketByteIndex - commandPacketByteIndex) : (mPages[commandPacketByteIndex >> CommandBufferPagePool::PAGE_SHIFT].numberOfUsedBytes - (commandPacketByteIndex & CommandBufferPagePool::PAGE_BYTE_INDEX_MASK));
+
+				// Copy the command packet, the next command packet byte index is updated as soon as the next command packet is added
+				CommandPacket commandPacket = commandBuffer.allocateCommandPacket(numberOfCommandBytes);
+				memcpy(commandPacket, constCommandPacket, numberOfCommandBytes);
+				CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, ~0u);
+
+				// Next command packet
+				commandPacketByteIndex = nextCommandPacketByteIndex;
 			}
 
 			// Finalize
-			commandBuffer.mPreviousCommandPacketByteIndex = commandBuffer.mCurrentCommandPacketByteIndex + mPreviousCommandPacketByteIndex;
-			commandBuffer.mCurrentCommandPacketByteIndex += mCurrentCommandPacketByteIndex;
 			#ifdef RHI_STATISTICS
 				commandBuffer.mNumberOfCommands += mNumberOfCommands;
 			#endif
@@ -9175,18 +9452,163 @@ namespace Rhi
 			clear();
 		}
 
+		/**
+		*  @brief
+		*    Remove redundant commands, use this as pre-dispatch pass
+		*
+		*  @return
+		*    The number of eliminated command packets
+		*
+		*  @remarks
+		*    Works on the recorded command packets only, so it's independent of the RHI implementation the command buffer is dispatched to:
+		*    - Graphics root signature, pipeline state, vertex array and resource group binds which bind what's already bound are removed
+		*    - Adjacent indirect draws of the same type reading consecutive draw arguments from the same indirect buffer are merged into one multi-draw
+		*    The bound state is unknown at the start of the command buffer and whenever a command is reached which might change it behind
+		*    our back (compute, resource, render target, clear or dispatch command buffer commands), so the command buffer stays valid
+		*    regardless of what has been dispatched before.
+		*
+		*  @note
+		*    - Merged indirect draws are dispatched as a single multi-draw, don't use this method if shaders rely on the draw index being reset per draw command
+		*/
+		uint32_t removeRedundantCommands();
+
 	// Private definitions
 	private:
-		static constexpr uint32_t NUMBER_OF_BYTES_TO_GROW = 8192;
+		struct Page final
+		{
+			uint8_t* memory;
+			uint32_t numberOfBytes;		///< "Rhi::CommandBufferPagePool::PAGE_NUMBER_OF_BYTES" or more for pages dedicated to a single oversized command packet, such a page is full as soon as the command packet is allocated
+			uint32_t numberOfUsedBytes;
+		};
+
+	// Private methods
+	private:
+		explicit CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		/**
+		*  @brief
+		*    Return the command packet at the given command packet byte index
+		*
+		*  @param[in] commandPacketByteIndex
+		*    Command packet byte index, the upper bits are the page index and the lower bits the byte index inside the page
+		*
+		*  @return
+		*    The command packet
+		*/
+		[[nodiscard]] inline uint8_t* getCommandPacket(uint32_t commandPacketByteIndex) const
+		{
+			return mPages[commandPacketByteIndex >> CommandBufferPagePool::PAGE_SHIFT].memory + (commandPacketByteIndex & CommandBufferPagePool::PAGE_BYTE_INDEX_MASK);
+		}
+
+		/**
+		*  @brief
+		*    Allocate a command packet and link it to the previous command packet
+		*
+		*  @param[in] numberOfCommandBytes
+		*    Number of command package buffer bytes consumed by the command packet
+		*
+		*  @return
+		*    The allocated command packet, a command packet never straddles pages
+		*/
+		[[nodiscard]] CommandPacket allocateCommandPacket(uint32_t numberOfCommandBytes)
+		{
+			// Move on to the next page, if required
+			// -> The command packet byte index stores the byte index inside the page within "Rhi::CommandBufferPagePool::PAGE_SHIFT" bits, so a command packet
+			//    must start inside the first "Rhi::CommandBufferPagePool::PAGE_NUMBER_OF_BYTES" bytes of a page, also if the page is an oversized one
+			if (0 == mNumberOfPages || mPages[mCurrentPageIndex].numberOfBytes < mPages[mCurrentPageIndex].numberOfUsedBytes + numberOfCommandBytes || mPages[mCurrentPageIndex].numberOfUsedBytes > CommandBufferPagePool::PAGE_BYTE_INDEX_MASK)
+			{
+				// Stay on the current page in case it's still unused (we only end up in here if the command packet is too large for it)
+				const uint32_t pageIndex = (0 == mNumberOfPages || 0 == mPages[mCurrentPageIndex].numberOfUsedBytes) ? mCurrentPageIndex : (mCurrentPageIndex + 1);
+				ASSERT(pageIndex < CommandBufferPagePool::MAXIMUM_NUMBER_OF_PAGES, "Too many command buffer pages")
+				if (pageIndex == mNumberOfPages || mPages[pageIndex].numberOfBytes < numberOfCommandBytes)
+				{
+					// Oversized command packets (many auxiliary bytes might be requested) get a page of their own which isn't recycled by the page pool
+					const bool oversized = (numberOfCommandBytes > CommandBufferPagePool::PAGE_NUMBER_OF_BYTES);
+					uint8_t* memory = oversized ? new uint8_t[numberOfCommandBytes] : CommandBufferPagePool::getInstance().acquirePage();
+					const uint32_t numberOfBytes = oversized ? numberOfCommandBytes : CommandBufferPagePool::PAGE_NUMBER_OF_BYTES;
+					if (pageIndex == mNumberOfPages)
+					{
+						addPage(memory, numberOfBytes);
+					}
+					else
+					{
+						// The existing page is too small for the oversized command packet, replace it
+						releasePage(mPages[pageIndex]);
+						mPages[pageIndex] = { memory, numberOfBytes, 0 };
+					}
+				}
+				mCurrentPageIndex = pageIndex;
+			}
+
+			// Get command package for the new command
+			Page& page = mPages[mCurrentPageIndex];
+			ASSERT(page.numberOfUsedBytes <= CommandBufferPagePool::PAGE_BYTE_INDEX_MASK, "The command packet byte index inside the page exceeds the command packet byte index encoding")
+			const uint32_t commandPacketByteIndex = (mCurrentPageIndex << CommandBufferPagePool::PAGE_SHIFT) | page.numberOfUsedBytes;
+			CommandPacket commandPacket = page.memory + page.numberOfUsedBytes;
+			page.numberOfUsedBytes += numberOfCommandBytes;
+
+			// Setup previous and current command package
+			if (~0u != mPreviousCommandPacketByteIndex)
+			{
+				CommandPacketHelper::storeNextCommandPacketByteIndex(getCommandPacket(mPreviousCommandPacketByteIndex), commandPacketByteIndex);
+			}
+			CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, ~0u);
+			mPreviousCommandPacketByteIndex = commandPacketByteIndex;
+
+			// Done
+			return commandPacket;
+		}
+
+		void addPage(uint8_t* memory, uint32_t numberOfBytes)
+		{
+			// Grow page array, if required
+			if (mNumberOfPages == mNumberOfPageSlots)
+			{
+				const uint32_t newNumberOfPageSlots = (0 == mNumberOfPageSlots) ? 4 : (mNumberOfPageSlots * 2);
+				Page* newPages = new Page[newNumberOfPageSlots];
+				if (nullptr != mPages)
+				{
+					memcpy(newPages, mPages, sizeof(Page) * mNumberOfPages);
+					delete [] mPages;
+				}
+				mPages = newPages;
+				mNumberOfPageSlots = newNumberOfPageSlots;
+			}
+			mPages[mNumberOfPages] = { memory, numberOfBytes, 0 };
+			++mNumberOfPages;
+		}
+
+		inline void releasePage(const Page& page)
+		{
+			if (CommandBufferPagePool::PAGE_NUMBER_OF_BYTES == page.numberOfBytes)
+			{
+				CommandBufferPagePool::getInstance().releasePage(page.memory);
+			}
+			else
+			{
+				delete [] page.memory;
+			}
+		}
+
+		inline void releasePages(uint32_t numberOfPagesToKeep)
+		{
+			while (mNumberOfPages > numberOfPagesToKeep)
+			{
+				--mNumberOfPages;
+				releasePage(mPages[mNumberOfPages]);
+			}
+		}
 
 	// Private data
 	private:
 		// Memory
-		uint32_t mCommandPacketBufferNumberOfBytes;
-		uint8_t* mCommandPacketBuffer;
+		Page*	 mPages;			///< Pages owned by the command buffer, can be a null pointer
+		uint32_t mNumberOfPageSlots;
+		uint32_t mNumberOfPages;
 		// Current state
+		uint32_t mCurrentPageIndex;
 		uint32_t mPreviousCommandPacketByteIndex;
-		uint32_t mCurrentCommandPacketByteIndex;
 		#ifdef RHI_STATISTICS
 			uint32_t mNumberOfCommands;
 		#endif
@@ -10260,6 +10682,179 @@ namespace Rhi
 
 	}
 
+	// Command buffer methods which need to know the concrete commands
+	inline uint32_t CommandBuffer::removeRedundantCommands()
+	{
+		if (isEmpty())
+		{
+			return 0;
+		}
+
+		// Currently bound graphics state, "UNKNOWN" if we don't know what's bound
+		static constexpr uintptr_t UNKNOWN = ~static_cast<uintptr_t>(0);
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS = 8;
+		uintptr_t graphicsRootSignature = UNKNOWN;
+		uintptr_t graphicsPipelineState = UNKNOWN;
+		uintptr_t graphicsVertexArray = UNKNOWN;
+		uintptr_t graphicsResourceGroups[MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS];
+		for (uintptr_t& graphicsResourceGroup : graphicsResourceGroups)
+		{
+			graphicsResourceGroup = UNKNOWN;
+		}
+
+		// Loop through all command packets and unlink the redundant ones
+		uint32_t numberOfEliminatedCommandPackets = 0;
+		uint32_t previousCommandPacketByteIndex = ~0u;	// Previous command packet which has been kept
+		uint32_t commandPacketByteIndex = 0;
+		while (~0u != commandPacketByteIndex)
+		{
+			CommandPacket commandPacket = getCommandPacket(commandPacketByteIndex);
+			const CommandDispatchFunctionIndex commandDispatchFunctionIndex = CommandPacketHelper::loadCommandDispatchFunctionIndex(commandPacket);
+			const CommandPacket previousCommandPacket = (~0u != previousCommandPacketByteIndex) ? getCommandPacket(previousCommandPacketByteIndex) : nullptr;
+			bool redundant = false;
+			switch (commandDispatchFunctionIndex)
+			{
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_ROOT_SIGNATURE:
+				{
+					const uintptr_t rootSignature = reinterpret_cast<uintptr_t>(CommandPacketHelper::getCommand<Command::SetGraphicsRootSignature>(commandPacket)->rootSignature);
+					redundant = (graphicsRootSignature == rootSignature);
+					if (!redundant)
+					{
+						// A new root signature invalidates the bound resource groups
+						graphicsRootSignature = rootSignature;
+						for (uintptr_t& graphicsResourceGroup : graphicsResourceGroups)
+						{
+							graphicsResourceGroup = UNKNOWN;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_PIPELINE_STATE:
+				{
+					const uintptr_t pipelineState = reinterpret_cast<uintptr_t>(CommandPacketHelper::getCommand<Command::SetGraphicsPipelineState>(commandPacket)->graphicsPipelineState);
+					redundant = (graphicsPipelineState == pipelineState);
+					if (!redundant)
+					{
+						// Be conservative: Some RHI implementations (e.g. OpenGL) bind resource groups per program
+						graphicsPipelineState = pipelineState;
+						for (uintptr_t& graphicsResourceGroup : graphicsResourceGroups)
+						{
+							graphicsResourceGroup = UNKNOWN;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_RESOURCE_GROUP:
+				{
+					const Command::SetGraphicsResourceGroup* setGraphicsResourceGroup = CommandPacketHelper::getCommand<Command::SetGraphicsResourceGroup>(commandPacket);
+					if (setGraphicsResourceGroup->rootParameterIndex < MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS)
+					{
+						uintptr_t& graphicsResourceGroup = graphicsResourceGroups[setGraphicsResourceGroup->rootParameterIndex];
+						redundant = (graphicsResourceGroup == reinterpret_cast<uintptr_t>(setGraphicsResourceGroup->resourceGroup));
+						graphicsResourceGroup = reinterpret_cast<uintptr_t>(setGraphicsResourceGroup->resourceGroup);
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_VERTEX_ARRAY:
+				{
+					const uintptr_t vertexArray = reinterpret_cast<uintptr_t>(CommandPacketHelper::getCommand<Command::SetGraphicsVertexArray>(commandPacket)->vertexArray);
+					redundant = (graphicsVertexArray == vertexArray);
+					graphicsVertexArray = vertexArray;
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::DRAW_GRAPHICS:
+					if (nullptr != previousCommandPacket && CommandDispatchFunctionIndex::DRAW_GRAPHICS == CommandPacketHelper::loadCommandDispatchFunctionIndex(previousCommandPacket))
+					{
+						Command::DrawGraphics* previousDrawGraphics = CommandPacketHelper::getCommand<Command::DrawGraphics>(previousCommandPacket);
+						const Command::DrawGraphics* drawGraphics = CommandPacketHelper::getCommand<Command::DrawGraphics>(commandPacket);
+						if (nullptr != drawGraphics->indirectBuffer && previousDrawGraphics->indirectBuffer == drawGraphics->indirectBuffer && previousDrawGraphics->indirectBufferOffset + previousDrawGraphics->numberOfDraws * sizeof(DrawArguments) == drawGraphics->indirectBufferOffset)
+						{
+							previousDrawGraphics->numberOfDraws += drawGraphics->numberOfDraws;
+							redundant = true;
+						}
+					}
+					break;
+
+				case CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS:
+					if (nullptr != previousCommandPacket && CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS == CommandPacketHelper::loadCommandDispatchFunctionIndex(previousCommandPacket))
+					{
+						Command::DrawIndexedGraphics* previousDrawIndexedGraphics = CommandPacketHelper::getCommand<Command::DrawIndexedGraphics>(previousCommandPacket);
+						const Command::DrawIndexedGraphics* drawIndexedGraphics = CommandPacketHelper::getCommand<Command::DrawIndexedGraphics>(commandPacket);
+						if (nullptr != drawIndexedGraphics->indirectBuffer && previousDrawIndexedGraphics->indirectBuffer == drawIndexedGraphics->indirectBuffer && previousDrawIndexedGraphics->indirectBufferOffset + previousDrawIndexedGraphics->numberOfDraws * sizeof(DrawIndexedArguments) == drawIndexedGraphics->indirectBufferOffset)
+						{
+							previousDrawIndexedGraphics->numberOfDraws += drawIndexedGraphics->numberOfDraws;
+							redundant = true;
+						}
+					}
+					break;
+
+				// Commands which don't touch the tracked state
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_VIEWPORTS:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_SCISSOR_RECTANGLES:
+				case CommandDispatchFunctionIndex::DRAW_MESH_TASKS:
+				case CommandDispatchFunctionIndex::COPY_UNIFORM_BUFFER_DATA:
+				case CommandDispatchFunctionIndex::SET_UNIFORM:
+				case CommandDispatchFunctionIndex::RESET_QUERY_POOL:
+				case CommandDispatchFunctionIndex::BEGIN_QUERY:
+				case CommandDispatchFunctionIndex::END_QUERY:
+				case CommandDispatchFunctionIndex::WRITE_TIMESTAMP_QUERY:
+				case CommandDispatchFunctionIndex::SET_DEBUG_MARKER:
+				case CommandDispatchFunctionIndex::BEGIN_DEBUG_EVENT:
+				case CommandDispatchFunctionIndex::END_DEBUG_EVENT:
+					break;
+
+				// Commands which might change the tracked state behind our back
+				case CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_RENDER_TARGET:
+				case CommandDispatchFunctionIndex::CLEAR_GRAPHICS:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_ROOT_SIGNATURE:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_PIPELINE_STATE:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_RESOURCE_GROUP:
+				case CommandDispatchFunctionIndex::DISPATCH_COMPUTE:
+				case CommandDispatchFunctionIndex::SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX:
+				case CommandDispatchFunctionIndex::RESOLVE_MULTISAMPLE_FRAMEBUFFER:
+				case CommandDispatchFunctionIndex::COPY_RESOURCE:
+				case CommandDispatchFunctionIndex::GENERATE_MIPMAPS:
+				case CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+					graphicsRootSignature = UNKNOWN;
+					graphicsPipelineState = UNKNOWN;
+					graphicsVertexArray = UNKNOWN;
+					for (uintptr_t& graphicsResourceGroup : graphicsResourceGroups)
+					{
+						graphicsResourceGroup = UNKNOWN;
+					}
+					break;
+			}
+
+			// Unlink redundant command packet, the first command packet is never redundant since the bound state is unknown at this point in time
+			const uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
+			if (redundant)
+			{
+				CommandPacketHelper::storeNextCommandPacketByteIndex(previousCommandPacket, nextCommandPacketByteIndex);
+				if (~0u == nextCommandPacketByteIndex)
+				{
+					mPreviousCommandPacketByteIndex = previousCommandPacketByteIndex;
+				}
+				++numberOfEliminatedCommandPackets;
+			}
+			else
+			{
+				previousCommandPacketByteIndex = commandPacketByteIndex;
+			}
+			commandPacketByteIndex = nextCommandPacketByteIndex;
+		}
+
+		// Done
+		#ifdef RHI_STATISTICS
+			mNumberOfCommands -= numberOfEliminatedCommandPackets;
+		#endif
+		return numberOfEliminatedCommandPackets;
+	}
+
 	// Debug macros
 	#ifdef RHI_DEBUG
 		/**